@@ -0,0 +1,5 @@
+# Streaming block processing pipeline component, enabled by MIDDLEWARE := dsppipe
+# NMSIS_LIB must contain nmsis_dsp
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/dsppipe/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/dsppipe/include
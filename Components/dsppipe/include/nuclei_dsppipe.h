@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_dsppipe.h
+ * @brief    Streaming block processing pipeline on NMSIS DSP library
+ *
+ * A pipeline is a static chain of stages which process blocks of
+ * block_size float32_t samples:
+ * - the producer, such as an interrupt handler or DMA done interrupt, fills
+ *   one of the two input buffers with DSPPIPE_Write or DSPPIPE_GetInput and
+ *   DSPPIPE_InputDone, then it switches to the other input buffer
+ * - the consumer, such as the main loop or a RTOS task woken by the notify
+ *   callback, calls DSPPIPE_Process, which runs all stages on the filled
+ *   block, then passes the result to the sink callback
+ *
+ * Stages use two work buffers alternately, stages with DSPPIPE_INPLACE
+ * write their output to the input buffer, and a stage may modify its input.
+ * Cycles of each stage are accounted with __get_rv_cycle.
+ ******************************************************************************/
+#ifndef __NUCLEI_DSPPIPE_H__
+#define __NUCLEI_DSPPIPE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+#include "riscv_math.h"
+
+/** Number of float32_t of the buffers passed to DSPPIPE_Init, two input and two work buffers */
+#define DSPPIPE_BUFFER_SIZE(block_size)     (4 * (block_size))
+
+/** Stage flag, output of the stage can be written to its input buffer */
+#define DSPPIPE_INPLACE             0x1
+
+/**
+ * \brief  Process one block, src and dst have block_size samples
+ * \param [in]  inst        instance of the stage, such as riscv_fir_instance_f32
+ * \param [in]  src         input block, it may be modified by the stage
+ * \param [out] dst         output block, same as src for DSPPIPE_INPLACE stage
+ * \param [in]  block_size  number of samples
+ */
+typedef void (*DSPPIPE_StageFunc)(void *inst, float32_t *src, float32_t *dst, uint32_t block_size);
+
+/** Called with output of the last stage in DSPPIPE_Process */
+typedef void (*DSPPIPE_SinkFunc)(void *arg, const float32_t *data, uint32_t block_size);
+
+/** Called when a block is ready in DSPPIPE_InputDone, usually in interrupt handler */
+typedef void (*DSPPIPE_NotifyFunc)(void *arg);
+
+typedef struct {
+    const char *name;
+    DSPPIPE_StageFunc func;
+    void *inst;
+    uint32_t flags;
+    uint64_t cycles;                /*!< total cycles of all calls */
+    uint32_t max_cycles;            /*!< max cycles of one call */
+    uint32_t calls;
+} DSPPIPE_Stage;
+
+/** Initializer of DSPPIPE_Stage array element */
+#define DSPPIPE_STAGE(name, func, inst, flags)  { (name), (func), (void *)(inst), (flags), 0, 0, 0 }
+
+typedef struct {
+    DSPPIPE_Stage *stages;
+    uint32_t num_stages;
+    uint32_t block_size;
+    float32_t *input[2];
+    float32_t *work[2];
+    DSPPIPE_SinkFunc sink;
+    void *sink_arg;
+    DSPPIPE_NotifyFunc notify;
+    void *notify_arg;
+    volatile uint32_t full[2];      /*!< input buffer is filled and not processed */
+    volatile uint32_t fill;         /*!< input buffer filled by producer */
+    volatile uint32_t pos;          /*!< samples written by DSPPIPE_Write to current input buffer */
+    uint32_t next;                  /*!< input buffer to be processed */
+    volatile unsigned long blocks;  /*!< processed blocks */
+    volatile unsigned long overruns;/*!< blocks dropped because both input buffers are full */
+    uint64_t cycles;                /*!< total cycles of DSPPIPE_Process including sink */
+} DSPPIPE_Pipeline;
+
+/**
+ * \brief  Initialize a pipeline
+ * \param [in]  pipe        pipeline to be initialized
+ * \param [in]  stages      stages in processing order, initialized with DSPPIPE_STAGE
+ * \param [in]  num_stages  number of stages
+ * \param [in]  block_size  samples of each block
+ * \param [in]  buffers     DSPPIPE_BUFFER_SIZE(block_size) float32_t samples
+ */
+extern void DSPPIPE_Init(DSPPIPE_Pipeline *pipe, DSPPIPE_Stage *stages, uint32_t num_stages,
+                         uint32_t block_size, float32_t *buffers);
+
+extern void DSPPIPE_SetSink(DSPPIPE_Pipeline *pipe, DSPPIPE_SinkFunc sink, void *arg);
+
+extern void DSPPIPE_SetNotify(DSPPIPE_Pipeline *pipe, DSPPIPE_NotifyFunc notify, void *arg);
+
+/** \brief  Get the input buffer to be filled by producer, such as DMA destination */
+extern float32_t *DSPPIPE_GetInput(DSPPIPE_Pipeline *pipe);
+
+/**
+ * \brief  Mark the input buffer from DSPPIPE_GetInput as filled
+ * \details
+ * It can be called in interrupt handler, producer switches to the other
+ * input buffer, when the other one is not processed yet, the block is dropped
+ * and overruns is increased.
+ * \return 0 when block is accepted, -1 when it is dropped
+ */
+extern int32_t DSPPIPE_InputDone(DSPPIPE_Pipeline *pipe);
+
+/**
+ * \brief  Copy samples to input buffers, DSPPIPE_InputDone is called when a block is filled
+ * \details
+ * It can be called in interrupt handler, samples are copied as words, so
+ * FPU registers are not used.
+ * \return number of blocks dropped
+ */
+extern uint32_t DSPPIPE_Write(DSPPIPE_Pipeline *pipe, const float32_t *samples, uint32_t count);
+
+/**
+ * \brief  Process one filled block with all stages and pass it to sink
+ * \return 1 when a block is processed, 0 when no block is ready
+ */
+extern int32_t DSPPIPE_Process(DSPPIPE_Pipeline *pipe);
+
+/** \brief  Clear cycles of stages, blocks and overruns */
+extern void DSPPIPE_ResetStats(DSPPIPE_Pipeline *pipe);
+
+/** \brief  Print average and max cycles of each stage, blocks and overruns as CSV lines */
+extern void DSPPIPE_PrintStats(const DSPPIPE_Pipeline *pipe);
+
+/** Stage of riscv_fir_f32, inst is riscv_fir_instance_f32 */
+extern void DSPPIPE_FirF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size);
+
+/** Stage of riscv_biquad_cascade_df1_f32, inst is riscv_biquad_casd_df1_inst_f32, can be DSPPIPE_INPLACE */
+extern void DSPPIPE_BiquadF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size);
+
+/**
+ * Stage of forward riscv_rfft_fast_f32, inst is riscv_rfft_fast_instance_f32
+ * whose fftLen is block_size, output is packed complex spectrum
+ */
+extern void DSPPIPE_RfftF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NUCLEI_DSPPIPE_H__ */
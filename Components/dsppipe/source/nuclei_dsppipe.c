@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include "nuclei_dsppipe.h"
+
+void DSPPIPE_Init(DSPPIPE_Pipeline *pipe, DSPPIPE_Stage *stages, uint32_t num_stages,
+                  uint32_t block_size, float32_t *buffers)
+{
+    pipe->stages = stages;
+    pipe->num_stages = num_stages;
+    pipe->block_size = block_size;
+    pipe->input[0] = buffers;
+    pipe->input[1] = buffers + block_size;
+    pipe->work[0] = buffers + 2 * block_size;
+    pipe->work[1] = buffers + 3 * block_size;
+    pipe->sink = NULL;
+    pipe->sink_arg = NULL;
+    pipe->notify = NULL;
+    pipe->notify_arg = NULL;
+    pipe->full[0] = 0;
+    pipe->full[1] = 0;
+    pipe->fill = 0;
+    pipe->pos = 0;
+    pipe->next = 0;
+    DSPPIPE_ResetStats(pipe);
+}
+
+void DSPPIPE_SetSink(DSPPIPE_Pipeline *pipe, DSPPIPE_SinkFunc sink, void *arg)
+{
+    pipe->sink_arg = arg;
+    pipe->sink = sink;
+}
+
+void DSPPIPE_SetNotify(DSPPIPE_Pipeline *pipe, DSPPIPE_NotifyFunc notify, void *arg)
+{
+    pipe->notify_arg = arg;
+    pipe->notify = notify;
+}
+
+float32_t *DSPPIPE_GetInput(DSPPIPE_Pipeline *pipe)
+{
+    return pipe->input[pipe->fill];
+}
+
+int32_t DSPPIPE_InputDone(DSPPIPE_Pipeline *pipe)
+{
+    uint32_t fill = pipe->fill;
+
+    pipe->pos = 0;
+    /* The other buffer is still waiting or being processed, refill this one */
+    if (pipe->full[fill ^ 1]) {
+        pipe->overruns++;
+        return -1;
+    }
+    pipe->full[fill] = 1;
+    pipe->fill = fill ^ 1;
+    if (pipe->notify != NULL) {
+        pipe->notify(pipe->notify_arg);
+    }
+    return 0;
+}
+
+uint32_t DSPPIPE_Write(DSPPIPE_Pipeline *pipe, const float32_t *samples, uint32_t count)
+{
+    /* Copy as words, so no FPU or vector register is used in interrupt handler */
+    const uint32_t *src = (const uint32_t *)samples;
+    uint32_t *dst;
+    uint32_t pos, num, i, dropped = 0;
+
+    while (count > 0) {
+        pos = pipe->pos;
+        num = pipe->block_size - pos;
+        if (num > count) {
+            num = count;
+        }
+        dst = (uint32_t *)pipe->input[pipe->fill] + pos;
+        for (i = 0; i < num; i++) {
+            dst[i] = src[i];
+        }
+        src += num;
+        count -= num;
+        pipe->pos = pos + num;
+        if (pipe->pos == pipe->block_size) {
+            if (DSPPIPE_InputDone(pipe) != 0) {
+                dropped++;
+            }
+        }
+    }
+    return dropped;
+}
+
+int32_t DSPPIPE_Process(DSPPIPE_Pipeline *pipe)
+{
+    DSPPIPE_Stage *stage;
+    float32_t *src, *dst;
+    uint64_t begin, start;
+    uint32_t idx = pipe->next;
+    uint32_t i, cycles;
+
+    if (pipe->full[idx] == 0) {
+        return 0;
+    }
+    begin = __get_rv_cycle();
+    src = pipe->input[idx];
+    for (i = 0; i < pipe->num_stages; i++) {
+        stage = &pipe->stages[i];
+        if (stage->flags & DSPPIPE_INPLACE) {
+            dst = src;
+        } else {
+            dst = (src == pipe->work[0]) ? pipe->work[1] : pipe->work[0];
+        }
+        start = __get_rv_cycle();
+        stage->func(stage->inst, src, dst, pipe->block_size);
+        cycles = (uint32_t)(__get_rv_cycle() - start);
+        stage->cycles += cycles;
+        if (cycles > stage->max_cycles) {
+            stage->max_cycles = cycles;
+        }
+        stage->calls++;
+        src = dst;
+    }
+    if (pipe->sink != NULL) {
+        pipe->sink(pipe->sink_arg, src, pipe->block_size);
+    }
+    pipe->cycles += __get_rv_cycle() - begin;
+    pipe->blocks++;
+    pipe->next = idx ^ 1;
+    /* Release the input buffer to producer when all stages are done */
+    pipe->full[idx] = 0;
+    return 1;
+}
+
+void DSPPIPE_ResetStats(DSPPIPE_Pipeline *pipe)
+{
+    uint32_t i;
+
+    for (i = 0; i < pipe->num_stages; i++) {
+        pipe->stages[i].cycles = 0;
+        pipe->stages[i].max_cycles = 0;
+        pipe->stages[i].calls = 0;
+    }
+    pipe->blocks = 0;
+    pipe->overruns = 0;
+    pipe->cycles = 0;
+}
+
+void DSPPIPE_PrintStats(const DSPPIPE_Pipeline *pipe)
+{
+    const DSPPIPE_Stage *stage;
+    uint32_t i;
+
+    for (i = 0; i < pipe->num_stages; i++) {
+        stage = &pipe->stages[i];
+        if (stage->calls == 0) {
+            continue;
+        }
+        printf("CSV, %s.avg, %lu\n", stage->name, (unsigned long)(stage->cycles / stage->calls));
+        printf("CSV, %s.max, %lu\n", stage->name, (unsigned long)stage->max_cycles);
+    }
+    if (pipe->blocks > 0) {
+        printf("CSV, block.avg, %lu\n", (unsigned long)(pipe->cycles / pipe->blocks));
+    }
+    printf("CSV, blocks, %lu\n", (unsigned long)pipe->blocks);
+    printf("CSV, overruns, %lu\n", (unsigned long)pipe->overruns);
+}
+
+void DSPPIPE_FirF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size)
+{
+    riscv_fir_f32((const riscv_fir_instance_f32 *)inst, src, dst, block_size);
+}
+
+void DSPPIPE_BiquadF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size)
+{
+    riscv_biquad_cascade_df1_f32((const riscv_biquad_casd_df1_inst_f32 *)inst, src, dst, block_size);
+}
+
+void DSPPIPE_RfftF32(void *inst, float32_t *src, float32_t *dst, uint32_t block_size)
+{
+    (void)block_size;
+    riscv_rfft_fast_f32((const riscv_rfft_fast_instance_f32 *)inst, src, dst, 0);
+}
@@ -0,0 +1,4 @@
+# Function profiler component, enabled by MIDDLEWARE := funcprof or PROFILE=func
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/funcprof/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/funcprof/include
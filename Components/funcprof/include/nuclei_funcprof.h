@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_funcprof.h
+ * @brief    Function profiler recording entry and exit of instrumented functions
+ *
+ * Sources compiled with -finstrument-functions call __cyg_profile_func_enter
+ * and __cyg_profile_func_exit, which record the function address and mcycle
+ * into the ring buffer of @ref NFPROF_Buffer. A context record is inserted
+ * when the current RTOS task changes, so calls of each task are separated.
+ * Functions called in interrupt handlers are not recorded. The buffer is
+ * dumped over UART by NFPROF_Dump, which is called in _postmain_fini when
+ * main returns, or it can be read by gdb using
+ * "dump binary value fprof.bin NFPROF_Data", then
+ * tools/scripts/misc/funcprof_report.py computes inclusive and exclusive
+ * cycles of each function and the call graph.
+ ******************************************************************************/
+#ifndef __NUCLEI_FUNCPROF_H__
+#define __NUCLEI_FUNCPROF_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+
+/** Number of records kept in the ring buffer, must be power of 2 */
+#ifndef NFPROF_BUF_SIZE
+#define NFPROF_BUF_SIZE             1024
+#endif
+
+#if (NFPROF_BUF_SIZE & (NFPROF_BUF_SIZE - 1)) != 0
+#error "NFPROF_BUF_SIZE must be power of 2"
+#endif
+/** Host file written by NFPROF_Dump instead of UART dump when semihosting is enabled by SEMIHOST=1 */
+#ifndef NFPROF_DUMP_FILE
+#define NFPROF_DUMP_FILE    "fprof.bin"
+#endif
+
+#define NFPROF_MAGIC                0x434E464EUL    /*!< "NFNC" */
+#define NFPROF_VERSION              1
+
+/** Set in func of exit record, function addresses are at least 2 bytes aligned */
+#define NFPROF_EXIT                 0x1U
+
+typedef struct {
+    /**
+     * low 32 bits of function address, NFPROF_EXIT is set for exit record,
+     * 0 for context record
+     */
+    uint32_t func;
+    /** low 32 bits of mcycle, or context id of the following records for context record */
+    uint32_t time;
+} NFPROF_Record;
+
+typedef struct {
+    uint32_t magic;                 /*!< NFPROF_MAGIC */
+    uint16_t version;               /*!< NFPROF_VERSION */
+    uint16_t record_size;           /*!< sizeof(NFPROF_Record) */
+    uint32_t buf_size;              /*!< NFPROF_BUF_SIZE */
+    uint32_t freq;                  /*!< mcycle frequency in Hz */
+    uint32_t hart;                  /*!< hart id whose calls are recorded */
+    volatile uint32_t enable;       /*!< records are only recorded when not 0 */
+    volatile uint32_t index;        /*!< total number of records ever recorded */
+    uint32_t context;               /*!< context id of last record, task address or 0 without RTOS */
+    NFPROF_Record records[NFPROF_BUF_SIZE];
+} NFPROF_Buffer;
+
+extern NFPROF_Buffer NFPROF_Data;
+
+extern void NFPROF_Init(void);
+extern void NFPROF_Start(void);
+extern void NFPROF_Stop(void);
+extern void NFPROF_Dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __NUCLEI_FUNCPROF_H__ */
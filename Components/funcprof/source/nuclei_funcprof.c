@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "nuclei_funcprof.h"
+
+#if defined(RTOS_FREERTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#if (INCLUDE_xTaskGetCurrentTaskHandle == 1) || (configUSE_MUTEXES == 1)
+#define NFPROF_CONTEXT()            ((uint32_t)(unsigned long)xTaskGetCurrentTaskHandle())
+#else
+#define NFPROF_CONTEXT()            0
+#endif
+#elif defined(RTOS_UCOSII)
+#include "ucos_ii.h"
+#define NFPROF_CONTEXT()            ((uint32_t)(unsigned long)OSTCBCur)
+#elif defined(RTOS_RTTHREAD)
+#include <rtthread.h>
+#define NFPROF_CONTEXT()            ((uint32_t)(unsigned long)rt_thread_self())
+#else
+#define NFPROF_CONTEXT()            0
+#endif
+
+/* Functions of this file must not call the instrumentation hooks themselves */
+#define NFPROF_NOINSTR              __attribute__((no_instrument_function))
+
+/* Number of bytes printed in each line by NFPROF_Dump */
+#define NFPROF_DUMP_LINE_BYTES      32
+
+NFPROF_Buffer NFPROF_Data;
+
+NFPROF_NOINSTR static void nfprof_record(uint32_t func)
+{
+    NFPROF_Record *rec;
+    uint32_t idx, ctx;
+    rv_csr_t mstatus;
+
+    if (NFPROF_Data.enable == 0) {
+        return;
+    }
+    /* Skip calls in interrupt handlers, and calls of other harts */
+    if ((__RV_CSR_READ(CSR_MINTSTATUS) & MINTSTATUS_MIL) != 0) {
+        return;
+    }
+    if (__RV_CSR_READ(CSR_MHARTID) != NFPROF_Data.hart) {
+        return;
+    }
+    mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+    idx = NFPROF_Data.index;
+    ctx = NFPROF_CONTEXT();
+    if (ctx != NFPROF_Data.context) {
+        NFPROF_Data.context = ctx;
+        rec = &NFPROF_Data.records[idx & (NFPROF_BUF_SIZE - 1)];
+        rec->func = 0;
+        rec->time = ctx;
+        idx++;
+    }
+    rec = &NFPROF_Data.records[idx & (NFPROF_BUF_SIZE - 1)];
+    rec->func = func;
+    rec->time = (uint32_t)__RV_CSR_READ(CSR_MCYCLE);
+    NFPROF_Data.index = idx + 1;
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+}
+
+NFPROF_NOINSTR void __cyg_profile_func_enter(void *func, void *call_site)
+{
+    (void)call_site;
+    nfprof_record((uint32_t)(unsigned long)func);
+}
+
+NFPROF_NOINSTR void __cyg_profile_func_exit(void *func, void *call_site)
+{
+    (void)call_site;
+    nfprof_record((uint32_t)(unsigned long)func | NFPROF_EXIT);
+}
+
+#if defined(CFG_SEMIHOST)
+/* Write dumped data to host file directly, return 0 when done */
+static int nfprof_dump_file(const void *ptr, uint32_t size)
+{
+    FILE *fp = fopen(NFPROF_DUMP_FILE, "wb");
+    size_t written;
+
+    if (fp == NULL) {
+        return -1;
+    }
+    written = fwrite(ptr, 1, size, fp);
+    fclose(fp);
+    if (written != size) {
+        return -1;
+    }
+    printf("NFPROF:FILE %s %lu\n", NFPROF_DUMP_FILE, (unsigned long)size);
+    return 0;
+}
+#endif
+
+/**
+ * \brief  Initialize function profiler buffer, calls are not recorded until NFPROF_Start is called
+ */
+NFPROF_NOINSTR void NFPROF_Init(void)
+{
+    memset(&NFPROF_Data, 0, sizeof(NFPROF_Data));
+    NFPROF_Data.magic = NFPROF_MAGIC;
+    NFPROF_Data.version = NFPROF_VERSION;
+    NFPROF_Data.record_size = sizeof(NFPROF_Record);
+    NFPROF_Data.buf_size = NFPROF_BUF_SIZE;
+    NFPROF_Data.freq = SystemCoreClock;
+    __enable_mcycle_counter();
+}
+
+/**
+ * \brief  Start recording calls of current hart
+ * \details
+ * It is called in _premain_init when the component is used, so calls of
+ * the whole program are recorded, oldest records are overwritten when the
+ * ring buffer is full.
+ */
+NFPROF_NOINSTR void NFPROF_Start(void)
+{
+    if (NFPROF_Data.magic != NFPROF_MAGIC) {
+        NFPROF_Init();
+    }
+    NFPROF_Data.hart = __RV_CSR_READ(CSR_MHARTID);
+    NFPROF_Data.enable = 1;
+}
+
+/**
+ * \brief  Stop recording calls, the recorded calls are kept
+ */
+NFPROF_NOINSTR void NFPROF_Stop(void)
+{
+    NFPROF_Data.enable = 0;
+}
+
+/**
+ * \brief  Stop recording and dump the ring buffer in hex format
+ * \details
+ * It is called in _postmain_fini when main returns, and does nothing when
+ * function profiler is never started. Each line starts with "NFPROF:", so the
+ * dump can be extracted from a serial log by funcprof_report.py.
+ */
+NFPROF_NOINSTR void NFPROF_Dump(void)
+{
+    const uint8_t *ptr = (const uint8_t *)&NFPROF_Data;
+    uint32_t i, size, count;
+
+    if (NFPROF_Data.magic != NFPROF_MAGIC) {
+        return;
+    }
+    NFPROF_Stop();
+    /* Only dump the recorded part when the ring buffer is not full */
+    count = NFPROF_Data.index < NFPROF_BUF_SIZE ? NFPROF_Data.index : NFPROF_BUF_SIZE;
+    size = sizeof(NFPROF_Data) - sizeof(NFPROF_Data.records) + count * sizeof(NFPROF_Record);
+#if defined(CFG_SEMIHOST)
+    if (nfprof_dump_file(ptr, size) == 0) {
+        return;
+    }
+#endif
+    printf("NFPROF:BEGIN %lu\n", (unsigned long)size);
+    for (i = 0; i < size; i ++) {
+        if ((i % NFPROF_DUMP_LINE_BYTES) == 0) {
+            printf("NFPROF:");
+        }
+        printf("%02x", ptr[i]);
+        if (((i + 1) % NFPROF_DUMP_LINE_BYTES) == 0 || (i + 1) == size) {
+            printf("\n");
+        }
+    }
+    printf("NFPROF:END\n");
+}
@@ -0,0 +1,4 @@
+# Bare-metal gcov runtime component, enabled by MIDDLEWARE := gcov or PGO=gen
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/gcov/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/gcov/include
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_gcov.h
+ * @brief    Bare-metal gcov runtime dumping gcda data over UART
+ *
+ * It replaces __gcov_init and __gcov_exit of libgcov, which write gcda files
+ * using file I/O, objects compiled with -fprofile-generate register their
+ * counters by __gcov_init, and NGCOV_Dump prints the content of each gcda
+ * file in hex format, then tools/scripts/misc/uart2gcda.py writes them
+ * back to gcda files, which can be used by -fprofile-use or gcov.
+ * Only plain counters are supported, so value profiling must be disabled
+ * by -fno-profile-values, which is done by PGO=gen.
+ ******************************************************************************/
+#ifndef __NUCLEI_GCOV_H__
+#define __NUCLEI_GCOV_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief  Print gcda data of all instrumented objects
+ * \details
+ * It is called in _postmain_fini when main returns, or in __gcov_exit when
+ * exit is called, the data is only dumped once.
+ */
+extern void NGCOV_Dump(void);
+
+/** \brief  Clear all counters, such as after warm up, so only the measured part is profiled */
+extern void NGCOV_Reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __NUCLEI_GCOV_H__ */
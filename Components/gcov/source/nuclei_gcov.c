@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdint.h>
+#include "nuclei_gcov.h"
+
+#if !defined(__GNUC__) || (__GNUC__ < 9)
+#error "gcov component requires gcc 9 or later"
+#endif
+
+/* Functions of this file are not instrumented when it is built with -fprofile-generate */
+#define NGCOV_NOPROF                __attribute__((no_profile_instrument_function))
+
+/* Number of bytes printed in each line by NGCOV_Dump */
+#define NGCOV_DUMP_LINE_BYTES       32
+
+/*
+ * Layout of gcov data must match libgcov.h and gcov-io.h of the compiler,
+ * counter types of gcc 9 to 13 are arcs, interval, pow2, topn/single,
+ * indirect call, average, ior and time profiler, gcc 14 adds conditions.
+ */
+#if __GNUC__ >= 14
+#define GCOV_COUNTERS               9
+#else
+#define GCOV_COUNTERS               8
+#endif
+/* Since gcc 12, gcov_info has a checksum and lengths of records are in bytes */
+#if __GNUC__ >= 12
+#define GCOV_HAS_CHECKSUM           1
+#define GCOV_LENGTH_UNIT            4
+#else
+#define GCOV_HAS_CHECKSUM           0
+#define GCOV_LENGTH_UNIT            1
+#endif
+/* Since gcc 11, topn and indirect call counters are linked lists of values */
+#if __GNUC__ >= 11
+#define GCOV_TOPN_MEM_COUNTERS      3
+#else
+#define GCOV_TOPN_MEM_COUNTERS      0
+#endif
+#define GCOV_COUNTER_ARCS           0
+#define GCOV_COUNTER_V_TOPN         3
+#define GCOV_COUNTER_V_INDIR        4
+
+#define GCOV_DATA_MAGIC             0x67636461U     /* "gcda" */
+#define GCOV_TAG_FUNCTION           0x01000000U
+#define GCOV_TAG_FUNCTION_LENGTH    (3 * GCOV_LENGTH_UNIT)
+#define GCOV_TAG_FOR_COUNTER(ix)    (0x01a10000U + ((uint32_t)(ix) << 17))
+#define GCOV_TAG_COUNTER_LENGTH(n)  ((n) * 2 * GCOV_LENGTH_UNIT)
+#define GCOV_TAG_OBJECT_SUMMARY     0xa1000000U
+#define GCOV_TAG_SUMMARY_LENGTH     (2 * GCOV_LENGTH_UNIT)
+
+typedef uint32_t gcov_unsigned_t;
+typedef int64_t gcov_type;
+typedef void (*gcov_merge_fn)(gcov_type *, gcov_unsigned_t);
+
+struct gcov_info;
+
+struct gcov_ctr_info {
+    gcov_unsigned_t num;
+    gcov_type *values;
+};
+
+struct gcov_fn_info {
+    const struct gcov_info *key;
+    gcov_unsigned_t ident;
+    gcov_unsigned_t lineno_checksum;
+    gcov_unsigned_t cfg_checksum;
+    /* only counters whose merge function is not NULL */
+    struct gcov_ctr_info ctrs[1];
+};
+
+struct gcov_info {
+    gcov_unsigned_t version;
+    struct gcov_info *next;
+    gcov_unsigned_t stamp;
+#if GCOV_HAS_CHECKSUM
+    gcov_unsigned_t checksum;
+#endif
+    const char *filename;
+    gcov_merge_fn merge[GCOV_COUNTERS];
+    unsigned n_functions;
+    const struct gcov_fn_info *const *functions;
+};
+
+extern void __gcov_init(struct gcov_info *info);
+extern void __gcov_exit(void);
+extern void __gcov_merge_add(gcov_type *counters, gcov_unsigned_t n_counters);
+
+static struct gcov_info *ngcov_list;
+static int ngcov_dumped;
+
+static char ngcov_line[NGCOV_DUMP_LINE_BYTES * 2 + 1];
+static uint32_t ngcov_line_bytes;
+#if defined(CFG_SEMIHOST)
+/* gcda file opened on host by semihosting, NULL when dumped over UART */
+static FILE *ngcov_file;
+#endif
+
+NGCOV_NOPROF static void ngcov_flush_line(void)
+{
+    if (ngcov_line_bytes > 0) {
+        ngcov_line[ngcov_line_bytes * 2] = '\0';
+        printf("NGCOV:%s\n", ngcov_line);
+        ngcov_line_bytes = 0;
+    }
+}
+
+/* gcda files are in target byte order, which is little endian */
+NGCOV_NOPROF static void ngcov_write_unsigned(gcov_unsigned_t value)
+{
+    static const char hex[] = "0123456789abcdef";
+    uint32_t i;
+
+#if defined(CFG_SEMIHOST)
+    if (ngcov_file != NULL) {
+        uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+        fwrite(bytes, 1, sizeof(bytes), ngcov_file);
+        return;
+    }
+#endif
+    for (i = 0; i < 4; i++) {
+        ngcov_line[ngcov_line_bytes * 2] = hex[(value >> 4) & 0xF];
+        ngcov_line[ngcov_line_bytes * 2 + 1] = hex[value & 0xF];
+        value >>= 8;
+        ngcov_line_bytes++;
+        if (ngcov_line_bytes == NGCOV_DUMP_LINE_BYTES) {
+            ngcov_flush_line();
+        }
+    }
+}
+
+NGCOV_NOPROF static void ngcov_write_counter(gcov_type value)
+{
+    ngcov_write_unsigned((gcov_unsigned_t)value);
+    ngcov_write_unsigned((gcov_unsigned_t)((uint64_t)value >> 32));
+}
+
+NGCOV_NOPROF static int ngcov_is_topn(uint32_t type)
+{
+    return (GCOV_TOPN_MEM_COUNTERS > 0) && \
+           ((type == GCOV_COUNTER_V_TOPN) || (type == GCOV_COUNTER_V_INDIR));
+}
+
+NGCOV_NOPROF static void ngcov_write_counters(uint32_t type, const struct gcov_ctr_info *ctr)
+{
+    uint32_t i;
+
+    if (ngcov_is_topn(type)) {
+        /* Only total of each topn counter is written, the linked values are dropped */
+        uint32_t groups = ctr->num / (GCOV_TOPN_MEM_COUNTERS ? GCOV_TOPN_MEM_COUNTERS : 1);
+        ngcov_write_unsigned(GCOV_TAG_FOR_COUNTER(type));
+        ngcov_write_unsigned(GCOV_TAG_COUNTER_LENGTH(groups * 2));
+        for (i = 0; i < groups; i++) {
+            ngcov_write_counter(ctr->values[i * GCOV_TOPN_MEM_COUNTERS]);
+            ngcov_write_counter(0);
+        }
+        return;
+    }
+    ngcov_write_unsigned(GCOV_TAG_FOR_COUNTER(type));
+    ngcov_write_unsigned(GCOV_TAG_COUNTER_LENGTH(ctr->num));
+    for (i = 0; i < ctr->num; i++) {
+        ngcov_write_counter(ctr->values[i]);
+    }
+}
+
+NGCOV_NOPROF static void ngcov_write_info(const struct gcov_info *info, gcov_unsigned_t sum_max)
+{
+    const struct gcov_fn_info *fn;
+    const struct gcov_ctr_info *ctr;
+    uint32_t i, t;
+
+#if defined(CFG_SEMIHOST)
+    /* Write gcda file on host directly, dump over UART when it can't be opened */
+    ngcov_file = fopen(info->filename, "wb");
+    if (ngcov_file != NULL) {
+        printf("NGCOV:WRITE %s\n", info->filename);
+    } else
+#endif
+    printf("NGCOV:FILE %s\n", info->filename);
+    ngcov_write_unsigned(GCOV_DATA_MAGIC);
+    ngcov_write_unsigned(info->version);
+    ngcov_write_unsigned(info->stamp);
+#if GCOV_HAS_CHECKSUM
+    ngcov_write_unsigned(info->checksum);
+#endif
+    /* One run, sum_max is max arcs counter of the program */
+    ngcov_write_unsigned(GCOV_TAG_OBJECT_SUMMARY);
+    ngcov_write_unsigned(GCOV_TAG_SUMMARY_LENGTH);
+    ngcov_write_unsigned(1);
+    ngcov_write_unsigned(sum_max);
+    for (i = 0; i < info->n_functions; i++) {
+        fn = info->functions[i];
+        ngcov_write_unsigned(GCOV_TAG_FUNCTION);
+        /* Functions emitted in other objects, such as comdat functions */
+        if ((fn == NULL) || (fn->key != info)) {
+            ngcov_write_unsigned(0);
+            continue;
+        }
+        ngcov_write_unsigned(GCOV_TAG_FUNCTION_LENGTH);
+        ngcov_write_unsigned(fn->ident);
+        ngcov_write_unsigned(fn->lineno_checksum);
+        ngcov_write_unsigned(fn->cfg_checksum);
+        ctr = fn->ctrs;
+        for (t = 0; t < GCOV_COUNTERS; t++) {
+            if (info->merge[t] == NULL) {
+                continue;
+            }
+            ngcov_write_counters(t, ctr);
+            ctr++;
+        }
+    }
+    ngcov_write_unsigned(0);
+#if defined(CFG_SEMIHOST)
+    if (ngcov_file != NULL) {
+        fclose(ngcov_file);
+        ngcov_file = NULL;
+        return;
+    }
+#endif
+    ngcov_flush_line();
+    printf("NGCOV:END\n");
+}
+
+/* Call func for counters of each type of each function defined in each object */
+NGCOV_NOPROF static void ngcov_foreach_counters(void (*func)(uint32_t type, const struct gcov_ctr_info *ctr, void *arg), void *arg)
+{
+    const struct gcov_info *info;
+    const struct gcov_fn_info *fn;
+    uint32_t i, t, c;
+
+    for (info = ngcov_list; info != NULL; info = info->next) {
+        for (i = 0; i < info->n_functions; i++) {
+            fn = info->functions[i];
+            if ((fn == NULL) || (fn->key != info)) {
+                continue;
+            }
+            for (t = 0, c = 0; t < GCOV_COUNTERS; t++) {
+                if (info->merge[t] != NULL) {
+                    func(t, &fn->ctrs[c++], arg);
+                }
+            }
+        }
+    }
+}
+
+NGCOV_NOPROF static void ngcov_max_arcs(uint32_t type, const struct gcov_ctr_info *ctr, void *arg)
+{
+    gcov_type *max = (gcov_type *)arg;
+    uint32_t i;
+
+    if (type != GCOV_COUNTER_ARCS) {
+        return;
+    }
+    for (i = 0; i < ctr->num; i++) {
+        if (ctr->values[i] > *max) {
+            *max = ctr->values[i];
+        }
+    }
+}
+
+NGCOV_NOPROF static void ngcov_clear(uint32_t type, const struct gcov_ctr_info *ctr, void *arg)
+{
+    uint32_t i;
+
+    (void)type;
+    (void)arg;
+    for (i = 0; i < ctr->num; i++) {
+        ctr->values[i] = 0;
+    }
+}
+
+/**
+ * \brief  Register counters of an object, called by constructor of each instrumented object
+ */
+NGCOV_NOPROF void __gcov_init(struct gcov_info *info)
+{
+    if ((info == NULL) || (info->version == 0)) {
+        return;
+    }
+    info->next = ngcov_list;
+    ngcov_list = info;
+}
+
+/**
+ * \brief  Called by destructor of each instrumented object when exit is called
+ */
+NGCOV_NOPROF void __gcov_exit(void)
+{
+    NGCOV_Dump();
+}
+
+/**
+ * \brief  Merge function of arcs counters, only referenced by gcov_info, never called
+ * \details
+ * It is defined here, so libgcov, which writes gcda files using file I/O, is not linked.
+ */
+NGCOV_NOPROF void __gcov_merge_add(gcov_type *counters, gcov_unsigned_t n_counters)
+{
+    (void)counters;
+    (void)n_counters;
+}
+
+NGCOV_NOPROF void NGCOV_Dump(void)
+{
+    const struct gcov_info *info;
+    gcov_type max = 0;
+
+    if (ngcov_dumped || (ngcov_list == NULL)) {
+        return;
+    }
+    ngcov_dumped = 1;
+    ngcov_foreach_counters(ngcov_max_arcs, &max);
+    for (info = ngcov_list; info != NULL; info = info->next) {
+        ngcov_write_info(info, (gcov_unsigned_t)max);
+    }
+}
+
+NGCOV_NOPROF void NGCOV_Reset(void)
+{
+    ngcov_foreach_counters(ngcov_clear, NULL);
+}
@@ -0,0 +1,4 @@
+# Deferred logging component, enabled by MIDDLEWARE := nlog
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/nlog/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/nlog/include
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_log.h
+ * @brief    Interrupt safe deferred logging
+ *
+ * NLOG only stores the format string address and the raw arguments into a
+ * per-hart ring buffer, the formatting and uart output are done later by
+ * NLOG_Flush, which should be called from a low priority task, idle hook or
+ * the main loop, only one NLOG_Flush reads the ring buffers at a time.
+ *
+ * Arguments are stored as unsigned long, so only integer, char, pointer and
+ * %s arguments pointing to strings which are still valid when flushed (such
+ * as string literals) are supported, at most NLOG_MAX_ARGS arguments.
+ * Arguments wider than unsigned long, such as int64_t on RV32, are rejected
+ * at compile time by NLOG.
+ ******************************************************************************/
+#ifndef __NUCLEI_LOG_H__
+#define __NUCLEI_LOG_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+
+/** Number of unsigned long words in the ring buffer of each hart, must be power of 2 */
+#ifndef NLOG_BUF_WORDS
+#define NLOG_BUF_WORDS              256
+#endif
+/** Number of harts which have their own ring buffer */
+#ifndef NLOG_HART_NUM
+#ifdef SMP_CPU_CNT
+#define NLOG_HART_NUM               SMP_CPU_CNT
+#else
+#define NLOG_HART_NUM               1
+#endif
+#endif
+
+#define NLOG_MAX_ARGS               6
+
+#if (NLOG_BUF_WORDS & (NLOG_BUF_WORDS - 1)) != 0
+#error "NLOG_BUF_WORDS must be power of 2"
+#endif
+
+typedef struct {
+    volatile unsigned long head;    /*!< next word to be reserved by writers */
+    volatile unsigned long tail;    /*!< next word to be read by NLOG_Flush */
+    volatile unsigned long dropped; /*!< number of messages dropped because ring is full */
+    volatile unsigned long buf[NLOG_BUF_WORDS];
+} NLOG_Ring;
+
+extern NLOG_Ring NLOG_Rings[NLOG_HART_NUM];
+
+#define __NLOG_NARGS_(_0, _1, _2, _3, _4, _5, _6, N, ...)   N
+#define __NLOG_NARGS(...)           __NLOG_NARGS_(0, ##__VA_ARGS__, 6, 5, 4, 3, 2, 1, 0)
+
+/* Compile error when an argument doesn't fit in unsigned long, arrays are checked as pointers */
+#define __NLOG_CHK(x)               + sizeof(char[(sizeof((x) + 0) <= sizeof(unsigned long)) ? 1 : -1])
+#define __NLOG_CHK0()
+#define __NLOG_CHK1(a)              __NLOG_CHK(a)
+#define __NLOG_CHK2(a, ...)         __NLOG_CHK(a) __NLOG_CHK1(__VA_ARGS__)
+#define __NLOG_CHK3(a, ...)         __NLOG_CHK(a) __NLOG_CHK2(__VA_ARGS__)
+#define __NLOG_CHK4(a, ...)         __NLOG_CHK(a) __NLOG_CHK3(__VA_ARGS__)
+#define __NLOG_CHK5(a, ...)         __NLOG_CHK(a) __NLOG_CHK4(__VA_ARGS__)
+#define __NLOG_CHK6(a, ...)         __NLOG_CHK(a) __NLOG_CHK5(__VA_ARGS__)
+#define __NLOG_CHKN_(n, ...)        __NLOG_CHK##n(__VA_ARGS__)
+#define __NLOG_CHKN(n, ...)         __NLOG_CHKN_(n, ##__VA_ARGS__)
+#define __NLOG_CHECK(...)           ((void)(0 __NLOG_CHKN(__NLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__)))
+
+/**
+ * \brief  Record a log message, it can be called in interrupt handler
+ * \details
+ * Usage is the same as printf, such as NLOG("irq %d count %u\n", id, cnt),
+ * the message is formatted and printed when NLOG_Flush is called.
+ */
+#define NLOG(fmt, ...)              (__NLOG_CHECK(__VA_ARGS__), \
+                                     NLOG_Write(fmt, __NLOG_NARGS(__VA_ARGS__), ##__VA_ARGS__))
+
+extern void NLOG_Write(const char *fmt, unsigned int nargs, ...);
+extern void NLOG_Puts(const char *str);
+extern unsigned long NLOG_Flush(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __NUCLEI_LOG_H__ */
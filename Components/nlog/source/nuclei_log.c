@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "nuclei_log.h"
+
+/*
+ * Each message in the ring starts with a header word, which is written
+ * last, so NLOG_Flush never reads a message which is still being written:
+ * bit 31 is the valid flag, bits 30-24 the message type, bits 23-16 the
+ * number of arguments and bits 15-0 the number of words of the message.
+ * Words of consumed messages are cleared to 0 by NLOG_Flush.
+ */
+#define NLOG_HDR_VALID              0x80000000UL
+#define NLOG_TYPE_FORMAT            0
+#define NLOG_TYPE_STRING            1
+#define NLOG_HDR(type, nargs, len)  (NLOG_HDR_VALID | ((unsigned long)(type) << 24) | \
+                                     ((unsigned long)(nargs) << 16) | (unsigned long)(len))
+#define NLOG_HDR_TYPE(hdr)          (((hdr) >> 24) & 0x7F)
+#define NLOG_HDR_NARGS(hdr)         (((hdr) >> 16) & 0xFF)
+#define NLOG_HDR_LEN(hdr)           ((hdr) & 0xFFFF)
+
+#define NLOG_BUF_MASK               (NLOG_BUF_WORDS - 1)
+/* Max words of string payload in one message, longer strings are split */
+#define NLOG_STR_WORDS              8
+#define NLOG_STR_BYTES              (NLOG_STR_WORDS * sizeof(unsigned long))
+
+NLOG_Ring NLOG_Rings[NLOG_HART_NUM];
+/* Set while a NLOG_Flush is reading the rings, only one reader at a time */
+static volatile unsigned long nlog_flushing;
+
+static NLOG_Ring *nlog_ring(void)
+{
+#if NLOG_HART_NUM > 1
+    return &NLOG_Rings[__RV_CSR_READ(CSR_MHARTID) % NLOG_HART_NUM];
+#else
+    return &NLOG_Rings[0];
+#endif
+}
+
+/* Reserve len words in ring, return start position, or -1 when ring is full */
+static long nlog_reserve(NLOG_Ring *ring, unsigned long len)
+{
+    unsigned long head;
+
+#if defined(__riscv_atomic)
+    do {
+        head = ring->head;
+        if (head + len - ring->tail > NLOG_BUF_WORDS) {
+            __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return -1;
+        }
+    } while (!__atomic_compare_exchange_n(&ring->head, &head, head + len, 1, \
+                                          __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+#else
+    rv_csr_t mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+
+    head = ring->head;
+    if (head + len - ring->tail > NLOG_BUF_WORDS) {
+        ring->dropped ++;
+        __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+        return -1;
+    }
+    ring->head = head + len;
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+#endif
+    return (long)(head & NLOG_BUF_MASK);
+}
+
+static void nlog_commit(NLOG_Ring *ring, long pos, unsigned long hdr)
+{
+    __atomic_store_n(&ring->buf[pos], hdr, __ATOMIC_RELEASE);
+}
+
+/* Claim the reader side of all rings, return 0 when another NLOG_Flush owns it */
+static int nlog_flush_lock(void)
+{
+#if defined(__riscv_atomic)
+    return __atomic_exchange_n(&nlog_flushing, 1, __ATOMIC_ACQUIRE) == 0;
+#else
+    rv_csr_t mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+    int locked = (nlog_flushing == 0);
+
+    nlog_flushing = 1;
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+    return locked;
+#endif
+}
+
+static void nlog_flush_unlock(void)
+{
+    __atomic_store_n(&nlog_flushing, 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * \brief  Store a log message into ring buffer of current hart, use NLOG macro instead
+ * \param [in]  fmt     printf format string, must be a string literal
+ * \param [in]  nargs   number of arguments
+ */
+void NLOG_Write(const char *fmt, unsigned int nargs, ...)
+{
+    NLOG_Ring *ring = nlog_ring();
+    unsigned long len;
+    unsigned int i;
+    long pos;
+    va_list ap;
+
+    if (nargs > NLOG_MAX_ARGS) {
+        nargs = NLOG_MAX_ARGS;
+    }
+    len = 2 + nargs;
+    pos = nlog_reserve(ring, len);
+    if (pos < 0) {
+        return;
+    }
+    ring->buf[(pos + 1) & NLOG_BUF_MASK] = (unsigned long)fmt;
+    va_start(ap, nargs);
+    for (i = 0; i < nargs; i ++) {
+        ring->buf[(pos + 2 + i) & NLOG_BUF_MASK] = va_arg(ap, unsigned long);
+    }
+    va_end(ap);
+    nlog_commit(ring, pos, NLOG_HDR(NLOG_TYPE_FORMAT, nargs, len));
+}
+
+/**
+ * \brief  Copy a string into ring buffer of current hart, it will be output as it is
+ * \param [in]  str     string to be output
+ */
+void NLOG_Puts(const char *str)
+{
+    NLOG_Ring *ring = nlog_ring();
+    unsigned long word, len, size, total = strlen(str);
+    unsigned int i, j;
+    long pos;
+
+    while (total > 0) {
+        size = (total > NLOG_STR_BYTES) ? NLOG_STR_BYTES : total;
+        len = 1 + (size + sizeof(unsigned long) - 1) / sizeof(unsigned long);
+        pos = nlog_reserve(ring, len);
+        if (pos < 0) {
+            return;
+        }
+        for (i = 1; i < len; i ++) {
+            word = 0;
+            for (j = 0; j < sizeof(unsigned long); j ++) {
+                if (*str != '\0' && (i - 1) * sizeof(unsigned long) + j < size) {
+                    word |= (unsigned long)(uint8_t)(*str++) << (j * 8);
+                }
+            }
+            ring->buf[(pos + i) & NLOG_BUF_MASK] = word;
+        }
+        nlog_commit(ring, pos, NLOG_HDR(NLOG_TYPE_STRING, size, len));
+        total -= size;
+    }
+}
+
+static void nlog_output(unsigned long hdr, const unsigned long *msg)
+{
+    unsigned long i, nargs;
+
+    if (NLOG_HDR_TYPE(hdr) == NLOG_TYPE_STRING) {
+        /* For string message, nargs field holds the string length */
+        nargs = NLOG_HDR_NARGS(hdr);
+        for (i = 0; i < nargs; i ++) {
+            putchar((int)((msg[1 + i / sizeof(unsigned long)] >> ((i % sizeof(unsigned long)) * 8)) & 0xFF));
+        }
+        return;
+    }
+#if defined(NLOG_RAW_OUTPUT)
+    /* Only print format string address and arguments, decoded by nlog_decode.py */
+    nargs = NLOG_HDR_NARGS(hdr);
+    printf("NLOG:%lx", msg[1]);
+    for (i = 0; i < nargs; i ++) {
+        printf(" %lx", msg[2 + i]);
+    }
+    printf("\n");
+#else
+    printf((const char *)msg[1], msg[2], msg[3], msg[4], msg[5], msg[6], msg[7]);
+#endif
+}
+
+/**
+ * \brief  Format and output all pending log messages of all harts
+ * \details
+ * It should be called from a low priority place, such as a low priority task,
+ * idle hook or main loop. When it is called while another NLOG_Flush is
+ * running, such as from a preempting task or another hart, it returns 0
+ * at once and the messages are output by the running one.
+ * \return number of messages output
+ */
+unsigned long NLOG_Flush(void)
+{
+    unsigned long msg[2 + NLOG_MAX_ARGS + NLOG_STR_WORDS];
+    unsigned long hdr, tail, len, i, cnt = 0;
+    NLOG_Ring *ring;
+    unsigned int hart;
+
+    if (!nlog_flush_lock()) {
+        return 0;
+    }
+    for (hart = 0; hart < NLOG_HART_NUM; hart ++) {
+        ring = &NLOG_Rings[hart];
+        tail = ring->tail;
+        while (tail != ring->head) {
+            hdr = __atomic_load_n(&ring->buf[tail & NLOG_BUF_MASK], __ATOMIC_ACQUIRE);
+            if ((hdr & NLOG_HDR_VALID) == 0) {
+                /* message is still being written */
+                break;
+            }
+            len = NLOG_HDR_LEN(hdr);
+            memset(msg, 0, sizeof(msg));
+            for (i = 0; i < len; i ++) {
+                if (i < sizeof(msg) / sizeof(msg[0])) {
+                    msg[i] = ring->buf[(tail + i) & NLOG_BUF_MASK];
+                }
+                ring->buf[(tail + i) & NLOG_BUF_MASK] = 0;
+            }
+            tail += len;
+            __atomic_store_n(&ring->tail, tail, __ATOMIC_RELEASE);
+            nlog_output(hdr, msg);
+            cnt ++;
+        }
+        if (ring->dropped) {
+            printf("NLOG: %lu messages dropped\n", ring->dropped);
+            ring->dropped = 0;
+        }
+    }
+    nlog_flush_unlock();
+    return cnt;
+}
@@ -0,0 +1,5 @@
+# Multi-hart NMSIS NN layer component, enabled by MIDDLEWARE := nnsmp
+# NMSIS_LIB must contain nmsis_nn
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/nnsmp/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/nnsmp/include
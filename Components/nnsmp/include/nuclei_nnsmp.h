@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_nnsmp.h
+ * @brief    Run NMSIS NN layers on multiple harts
+ *
+ * The boot hart calls NNSMP_ wrappers with the same arguments as the NMSIS NN
+ * kernels, the other harts wait in NNSMP_Worker, the work is split between
+ * NNSMP_GetHarts() harts and all harts meet in a barrier when done:
+ * - convolution and depthwise convolution are split by rows of output
+ * - fully connected is split by output channels
+ *
+ * Each hart uses its own scratch buffer, ctx of the wrappers is an array of
+ * NNSMP_HART_NUM contexts, and the size of each one is returned by the
+ * *_get_buffer_size function of the kernel. Outputs are the same as the
+ * NMSIS NN kernels, which are called on one hart when SMP_CPU_CNT is not
+ * defined.
+ *
+ * Harts are selected by mhartid, the boot hart is BOOT_HARTID and runs the
+ * work with index 0, and memory must be shared by all harts, such as
+ * DOWNLOAD=ddr for demosoc.
+ ******************************************************************************/
+#ifndef __NUCLEI_NNSMP_H__
+#define __NUCLEI_NNSMP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+#include "riscv_nnfunctions.h"
+
+/** Number of harts which can run NN layers */
+#if defined(SMP_CPU_CNT) && (SMP_CPU_CNT > 1)
+#define NNSMP_HART_NUM              SMP_CPU_CNT
+#else
+#define NNSMP_HART_NUM              1
+#endif
+
+#ifndef BOOT_HARTID
+#define BOOT_HARTID                 0
+#endif
+
+#if BOOT_HARTID >= NNSMP_HART_NUM
+#error "BOOT_HARTID must be less than SMP_CPU_CNT"
+#endif
+
+/**
+ * \brief  Work function run by each hart in NNSMP_Run
+ * \param [in]  arg     argument passed to NNSMP_Run
+ * \param [in]  index   index of this hart, from 0 to count - 1
+ * \param [in]  count   number of harts which do the work
+ */
+typedef void (*NNSMP_Func)(void *arg, uint32_t index, uint32_t count);
+
+/**
+ * \brief  Loop of the harts other than the boot hart
+ * \details
+ * Call it in smp_main for harts other than boot hart, it runs the work
+ * started by NNSMP_Run, and returns when NNSMP_Stop is called.
+ */
+extern void NNSMP_Worker(void);
+
+/** \brief  Let NNSMP_Worker of the other harts return, called by the boot hart */
+extern void NNSMP_Stop(void);
+
+/**
+ * \brief  Set number of harts used by the following layers
+ * \details
+ * It is clamped to [1, NNSMP_HART_NUM], the other harts stay idle, which is
+ * used to measure scaling with the number of harts.
+ */
+extern void NNSMP_SetHarts(uint32_t harts);
+
+/** \brief  Get number of harts used by the layers */
+extern uint32_t NNSMP_GetHarts(void);
+
+/** \brief  Wait until all NNSMP_HART_NUM harts reach the barrier */
+extern void NNSMP_Barrier(void);
+
+/**
+ * \brief  Run func on NNSMP_GetHarts() harts and wait for all of them
+ * \details
+ * Only called by the boot hart, func is called with index 0 on the boot hart.
+ */
+extern void NNSMP_Run(NNSMP_Func func, void *arg);
+
+extern riscv_status NNSMP_convolve_s8(const nmsis_nn_context *ctx,
+                                      const nmsis_nn_conv_params *conv_params,
+                                      const nmsis_nn_per_channel_quant_params *quant_params,
+                                      const nmsis_nn_dims *input_dims,
+                                      const q7_t *input_data,
+                                      const nmsis_nn_dims *filter_dims,
+                                      const q7_t *filter_data,
+                                      const nmsis_nn_dims *bias_dims,
+                                      const int32_t *bias_data,
+                                      const nmsis_nn_dims *output_dims,
+                                      q7_t *output_data);
+
+extern riscv_status NNSMP_convolve_1x1_s8_fast(const nmsis_nn_context *ctx,
+                                               const nmsis_nn_conv_params *conv_params,
+                                               const nmsis_nn_per_channel_quant_params *quant_params,
+                                               const nmsis_nn_dims *input_dims,
+                                               const q7_t *input_data,
+                                               const nmsis_nn_dims *filter_dims,
+                                               const q7_t *filter_data,
+                                               const nmsis_nn_dims *bias_dims,
+                                               const int32_t *bias_data,
+                                               const nmsis_nn_dims *output_dims,
+                                               q7_t *output_data);
+
+extern riscv_status NNSMP_depthwise_conv_s8(const nmsis_nn_context *ctx,
+                                            const nmsis_nn_dw_conv_params *dw_conv_params,
+                                            const nmsis_nn_per_channel_quant_params *quant_params,
+                                            const nmsis_nn_dims *input_dims,
+                                            const q7_t *input_data,
+                                            const nmsis_nn_dims *filter_dims,
+                                            const q7_t *filter_data,
+                                            const nmsis_nn_dims *bias_dims,
+                                            const int32_t *bias_data,
+                                            const nmsis_nn_dims *output_dims,
+                                            q7_t *output_data);
+
+extern riscv_status NNSMP_depthwise_conv_s8_opt(const nmsis_nn_context *ctx,
+                                                const nmsis_nn_dw_conv_params *dw_conv_params,
+                                                const nmsis_nn_per_channel_quant_params *quant_params,
+                                                const nmsis_nn_dims *input_dims,
+                                                const q7_t *input_data,
+                                                const nmsis_nn_dims *filter_dims,
+                                                const q7_t *filter_data,
+                                                const nmsis_nn_dims *bias_dims,
+                                                const int32_t *bias_data,
+                                                const nmsis_nn_dims *output_dims,
+                                                q7_t *output_data);
+
+extern riscv_status NNSMP_fully_connected_s8(const nmsis_nn_context *ctx,
+                                             const nmsis_nn_fc_params *fc_params,
+                                             const nmsis_nn_per_tensor_quant_params *quant_params,
+                                             const nmsis_nn_dims *input_dims,
+                                             const q7_t *input_data,
+                                             const nmsis_nn_dims *filter_dims,
+                                             const q7_t *filter_data,
+                                             const nmsis_nn_dims *bias_dims,
+                                             const int32_t *bias_data,
+                                             const nmsis_nn_dims *output_dims,
+                                             q7_t *output_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NUCLEI_NNSMP_H__ */
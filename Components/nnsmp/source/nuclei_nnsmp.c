@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "nuclei_nnsmp.h"
+
+typedef enum {
+    NNSMP_CONV = 0,
+    NNSMP_CONV_1X1,
+    NNSMP_DW_CONV,
+    NNSMP_DW_CONV_OPT,
+    NNSMP_FC,
+} NNSMP_Kernel;
+
+/* Arguments of a layer shared by all harts, it is on the stack of boot hart */
+typedef struct {
+    NNSMP_Kernel kernel;
+    const nmsis_nn_context *ctx;
+    const void *params;
+    const void *quant_params;
+    const nmsis_nn_dims *input_dims;
+    const q7_t *input_data;
+    const nmsis_nn_dims *filter_dims;
+    const q7_t *filter_data;
+    const nmsis_nn_dims *bias_dims;
+    const int32_t *bias_data;
+    const nmsis_nn_dims *output_dims;
+    q7_t *output_data;
+    riscv_status status[NNSMP_HART_NUM];
+} NNSMP_Job;
+
+static NNSMP_Func nnsmp_func;
+static void *nnsmp_arg;
+static volatile uint32_t nnsmp_harts = NNSMP_HART_NUM;
+static volatile uint32_t nnsmp_stop;
+
+/*
+ * Sense reversing barrier, each hart flips its own sense and writes it
+ * to its arrive flag, boot hart waits for all flags then writes release,
+ * so no atomic instruction is required.
+ */
+static volatile uint32_t nnsmp_arrive[NNSMP_HART_NUM];
+static volatile uint32_t nnsmp_release;
+static uint32_t nnsmp_sense[NNSMP_HART_NUM];
+
+void NNSMP_Barrier(void)
+{
+#if NNSMP_HART_NUM > 1
+    uint32_t hart = __RV_CSR_READ(CSR_MHARTID);
+    uint32_t sense, i;
+
+    if (hart >= NNSMP_HART_NUM) {
+        return;
+    }
+    sense = nnsmp_sense[hart] ^ 1;
+    nnsmp_sense[hart] = sense;
+    /* Make results of this hart visible before arriving */
+    __SMP_RWMB();
+    if (hart == BOOT_HARTID) {
+        for (i = 0; i < NNSMP_HART_NUM; i++) {
+            if (i != BOOT_HARTID) {
+                while (nnsmp_arrive[i] != sense);
+            }
+        }
+        __SMP_RWMB();
+        nnsmp_release = sense;
+    } else {
+        nnsmp_arrive[hart] = sense;
+        while (nnsmp_release != sense);
+    }
+    __SMP_RWMB();
+#endif
+}
+
+void NNSMP_Worker(void)
+{
+#if NNSMP_HART_NUM > 1
+    uint32_t hart = __RV_CSR_READ(CSR_MHARTID);
+    /* Index 0 is used by boot hart, the other harts follow it in order of mhartid */
+    uint32_t index = (hart + NNSMP_HART_NUM - BOOT_HARTID) % NNSMP_HART_NUM;
+
+    if ((hart == BOOT_HARTID) || (hart >= NNSMP_HART_NUM)) {
+        return;
+    }
+    while (1) {
+        /* Wait for NNSMP_Run or NNSMP_Stop */
+        NNSMP_Barrier();
+        if (nnsmp_stop) {
+            break;
+        }
+        if (index < nnsmp_harts) {
+            nnsmp_func(nnsmp_arg, index, nnsmp_harts);
+        }
+        NNSMP_Barrier();
+    }
+#endif
+}
+
+void NNSMP_Stop(void)
+{
+    nnsmp_stop = 1;
+    NNSMP_Barrier();
+}
+
+void NNSMP_SetHarts(uint32_t harts)
+{
+    if (harts < 1) {
+        harts = 1;
+    } else if (harts > NNSMP_HART_NUM) {
+        harts = NNSMP_HART_NUM;
+    }
+    nnsmp_harts = harts;
+}
+
+uint32_t NNSMP_GetHarts(void)
+{
+    return nnsmp_harts;
+}
+
+void NNSMP_Run(NNSMP_Func func, void *arg)
+{
+    if ((NNSMP_HART_NUM == 1) || (nnsmp_harts == 1)) {
+        func(arg, 0, 1);
+        return;
+    }
+    nnsmp_func = func;
+    nnsmp_arg = arg;
+    NNSMP_Barrier();
+    func(arg, 0, nnsmp_harts);
+    NNSMP_Barrier();
+}
+
+/*
+ * Run output rows [row_start, row_end) of convolution on this hart, input
+ * is bounded to the rows used by them, (rows - 1) * stride + kernel rows,
+ * so 1x1 kernel which sizes its work by input rows only does this tile.
+ * Padding of the first tile is kept, bottom padding is done by the bound
+ * check of the kernels.
+ */
+static void nnsmp_conv_rows(void *arg, uint32_t index, uint32_t count)
+{
+    NNSMP_Job *job = (NNSMP_Job *)arg;
+    const nmsis_nn_dims *input_dims = job->input_dims;
+    const nmsis_nn_dims *output_dims = job->output_dims;
+    const nmsis_nn_context *ctx = &job->ctx[index];
+    nmsis_nn_conv_params conv_params;
+    nmsis_nn_dw_conv_params dw_conv_params;
+    nmsis_nn_tile *padding;
+    nmsis_nn_dims tile_input, tile_output;
+    const q7_t *input;
+    q7_t *output;
+    int32_t row_start, row_end, in_row, in_end, kernel_h;
+
+    row_start = output_dims->h * index / count;
+    row_end = output_dims->h * (index + 1) / count;
+    if (row_start >= row_end) {
+        job->status[index] = RISCV_MATH_SUCCESS;
+        return;
+    }
+    if ((job->kernel == NNSMP_DW_CONV) || (job->kernel == NNSMP_DW_CONV_OPT)) {
+        dw_conv_params = *(const nmsis_nn_dw_conv_params *)job->params;
+        padding = &dw_conv_params.padding;
+        kernel_h = (job->filter_dims->h - 1) * dw_conv_params.dilation.h + 1;
+        in_row = row_start * dw_conv_params.stride.h - padding->h;
+        in_end = (row_end - 1) * dw_conv_params.stride.h - padding->h + kernel_h;
+    } else {
+        conv_params = *(const nmsis_nn_conv_params *)job->params;
+        padding = &conv_params.padding;
+        kernel_h = (job->filter_dims->h - 1) * conv_params.dilation.h + 1;
+        in_row = row_start * conv_params.stride.h - padding->h;
+        in_end = (row_end - 1) * conv_params.stride.h - padding->h + kernel_h;
+    }
+    padding->h = 0;
+    if (in_row < 0) {
+        padding->h = -in_row;
+        in_row = 0;
+    } else if (in_row > input_dims->h) {
+        in_row = input_dims->h;
+    }
+    if (in_end > input_dims->h) {
+        in_end = input_dims->h;
+    } else if (in_end < in_row) {
+        in_end = in_row;
+    }
+    tile_input = *input_dims;
+    tile_input.h = in_end - in_row;
+    tile_output = *output_dims;
+    tile_output.h = row_end - row_start;
+    input = job->input_data + in_row * input_dims->w * input_dims->c;
+    output = job->output_data + row_start * output_dims->w * output_dims->c;
+
+    switch (job->kernel) {
+        case NNSMP_CONV:
+            job->status[index] = riscv_convolve_s8(ctx, &conv_params, job->quant_params, &tile_input, input, \
+                                                   job->filter_dims, job->filter_data, job->bias_dims, \
+                                                   job->bias_data, &tile_output, output);
+            break;
+        case NNSMP_CONV_1X1:
+            job->status[index] = riscv_convolve_1x1_s8_fast(ctx, &conv_params, job->quant_params, &tile_input, \
+                                                            input, job->filter_dims, job->filter_data, \
+                                                            job->bias_dims, job->bias_data, &tile_output, output);
+            break;
+        case NNSMP_DW_CONV:
+            job->status[index] = riscv_depthwise_conv_s8(ctx, &dw_conv_params, job->quant_params, &tile_input, \
+                                                         input, job->filter_dims, job->filter_data, \
+                                                         job->bias_dims, job->bias_data, &tile_output, output);
+            break;
+        case NNSMP_DW_CONV_OPT:
+            job->status[index] = riscv_depthwise_conv_s8_opt(ctx, &dw_conv_params, job->quant_params, \
+                                                             &tile_input, input, job->filter_dims, \
+                                                             job->filter_data, job->bias_dims, job->bias_data, \
+                                                             &tile_output, output);
+            break;
+        default:
+            job->status[index] = RISCV_MATH_ARGUMENT_ERROR;
+            break;
+    }
+}
+
+/* Run output channels [ch_start, ch_end) of fully connected on this hart */
+static void nnsmp_fc_channels(void *arg, uint32_t index, uint32_t count)
+{
+    NNSMP_Job *job = (NNSMP_Job *)arg;
+    const nmsis_nn_dims *filter_dims = job->filter_dims;
+    nmsis_nn_dims tile_filter, tile_bias, tile_output;
+    int32_t ch_start, ch_end;
+
+    ch_start = job->output_dims->c * index / count;
+    ch_end = job->output_dims->c * (index + 1) / count;
+    if (ch_start >= ch_end) {
+        job->status[index] = RISCV_MATH_SUCCESS;
+        return;
+    }
+    tile_filter = *filter_dims;
+    tile_filter.c = ch_end - ch_start;
+    tile_bias = *job->bias_dims;
+    tile_bias.c = ch_end - ch_start;
+    tile_output = *job->output_dims;
+    tile_output.c = ch_end - ch_start;
+    job->status[index] = riscv_fully_connected_s8(&job->ctx[index], job->params, job->quant_params, \
+                                                  job->input_dims, job->input_data, &tile_filter, \
+                                                  job->filter_data + ch_start * filter_dims->n, &tile_bias, \
+                                                  (job->bias_data != NULL) ? (job->bias_data + ch_start) : NULL, \
+                                                  &tile_output, job->output_data + ch_start);
+}
+
+/* Tiles depend on a single batch, other batches are run on the boot hart only */
+static riscv_status nnsmp_run_job(NNSMP_Func func, NNSMP_Job *job, int32_t batches)
+{
+    uint32_t i;
+
+    for (i = 0; i < NNSMP_HART_NUM; i++) {
+        job->status[i] = RISCV_MATH_SUCCESS;
+    }
+    if (batches != 1) {
+        func(job, 0, 1);
+    } else {
+        NNSMP_Run(func, job);
+    }
+    for (i = 0; i < NNSMP_HART_NUM; i++) {
+        if (job->status[i] != RISCV_MATH_SUCCESS) {
+            return job->status[i];
+        }
+    }
+    return RISCV_MATH_SUCCESS;
+}
+
+#define NNSMP_JOB_INIT(job, kern)                       \
+    do {                                                \
+        (job).kernel = (kern);                          \
+        (job).ctx = ctx;                                \
+        (job).quant_params = quant_params;              \
+        (job).input_dims = input_dims;                  \
+        (job).input_data = input_data;                  \
+        (job).filter_dims = filter_dims;                \
+        (job).filter_data = filter_data;                \
+        (job).bias_dims = bias_dims;                    \
+        (job).bias_data = bias_data;                    \
+        (job).output_dims = output_dims;                \
+        (job).output_data = output_data;                \
+    } while (0)
+
+riscv_status NNSMP_convolve_s8(const nmsis_nn_context *ctx,
+                               const nmsis_nn_conv_params *conv_params,
+                               const nmsis_nn_per_channel_quant_params *quant_params,
+                               const nmsis_nn_dims *input_dims,
+                               const q7_t *input_data,
+                               const nmsis_nn_dims *filter_dims,
+                               const q7_t *filter_data,
+                               const nmsis_nn_dims *bias_dims,
+                               const int32_t *bias_data,
+                               const nmsis_nn_dims *output_dims,
+                               q7_t *output_data)
+{
+    NNSMP_Job job;
+
+    NNSMP_JOB_INIT(job, NNSMP_CONV);
+    job.params = conv_params;
+    return nnsmp_run_job(nnsmp_conv_rows, &job, input_dims->n);
+}
+
+riscv_status NNSMP_convolve_1x1_s8_fast(const nmsis_nn_context *ctx,
+                                        const nmsis_nn_conv_params *conv_params,
+                                        const nmsis_nn_per_channel_quant_params *quant_params,
+                                        const nmsis_nn_dims *input_dims,
+                                        const q7_t *input_data,
+                                        const nmsis_nn_dims *filter_dims,
+                                        const q7_t *filter_data,
+                                        const nmsis_nn_dims *bias_dims,
+                                        const int32_t *bias_data,
+                                        const nmsis_nn_dims *output_dims,
+                                        q7_t *output_data)
+{
+    NNSMP_Job job;
+
+    NNSMP_JOB_INIT(job, NNSMP_CONV_1X1);
+    job.params = conv_params;
+    return nnsmp_run_job(nnsmp_conv_rows, &job, input_dims->n);
+}
+
+riscv_status NNSMP_depthwise_conv_s8(const nmsis_nn_context *ctx,
+                                     const nmsis_nn_dw_conv_params *dw_conv_params,
+                                     const nmsis_nn_per_channel_quant_params *quant_params,
+                                     const nmsis_nn_dims *input_dims,
+                                     const q7_t *input_data,
+                                     const nmsis_nn_dims *filter_dims,
+                                     const q7_t *filter_data,
+                                     const nmsis_nn_dims *bias_dims,
+                                     const int32_t *bias_data,
+                                     const nmsis_nn_dims *output_dims,
+                                     q7_t *output_data)
+{
+    NNSMP_Job job;
+
+    NNSMP_JOB_INIT(job, NNSMP_DW_CONV);
+    job.params = dw_conv_params;
+    return nnsmp_run_job(nnsmp_conv_rows, &job, input_dims->n);
+}
+
+riscv_status NNSMP_depthwise_conv_s8_opt(const nmsis_nn_context *ctx,
+                                         const nmsis_nn_dw_conv_params *dw_conv_params,
+                                         const nmsis_nn_per_channel_quant_params *quant_params,
+                                         const nmsis_nn_dims *input_dims,
+                                         const q7_t *input_data,
+                                         const nmsis_nn_dims *filter_dims,
+                                         const q7_t *filter_data,
+                                         const nmsis_nn_dims *bias_dims,
+                                         const int32_t *bias_data,
+                                         const nmsis_nn_dims *output_dims,
+                                         q7_t *output_data)
+{
+    NNSMP_Job job;
+
+    NNSMP_JOB_INIT(job, NNSMP_DW_CONV_OPT);
+    job.params = dw_conv_params;
+    return nnsmp_run_job(nnsmp_conv_rows, &job, input_dims->n);
+}
+
+riscv_status NNSMP_fully_connected_s8(const nmsis_nn_context *ctx,
+                                      const nmsis_nn_fc_params *fc_params,
+                                      const nmsis_nn_per_tensor_quant_params *quant_params,
+                                      const nmsis_nn_dims *input_dims,
+                                      const q7_t *input_data,
+                                      const nmsis_nn_dims *filter_dims,
+                                      const q7_t *filter_data,
+                                      const nmsis_nn_dims *bias_dims,
+                                      const int32_t *bias_data,
+                                      const nmsis_nn_dims *output_dims,
+                                      q7_t *output_data)
+{
+    NNSMP_Job job;
+
+    NNSMP_JOB_INIT(job, NNSMP_FC);
+    job.params = fc_params;
+    return nnsmp_run_job(nnsmp_fc_channels, &job, input_dims->n);
+}
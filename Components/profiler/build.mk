@@ -0,0 +1,4 @@
+# Sampling profiler component, enabled by MIDDLEWARE := profiler
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/profiler/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/profiler/include
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_profiler.h
+ * @brief    Sampling profiler recording interrupted pc into a RAM buffer
+ *
+ * The system timer interrupt, or an interrupt handler of the application
+ * calling NPROF_Sample, records the interrupted pc from mepc, and optionally
+ * NPROF_DEPTH return addresses found by walking the frame pointer chain.
+ * The @ref NPROF_Buffer is dumped over UART by NPROF_Dump, which is called
+ * in _postmain_fini when main returns, or it can be read by gdb using
+ * "dump binary value prof.bin NPROF_Data", then it is symbolized by
+ * tools/scripts/misc/prof2flame.py into folded stacks and flame graph.
+ ******************************************************************************/
+#ifndef __NUCLEI_PROFILER_H__
+#define __NUCLEI_PROFILER_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+
+/** Number of samples kept in buffer, samples taken when buffer is full are dropped */
+#ifndef NPROF_BUF_SIZE
+#define NPROF_BUF_SIZE              1024
+#endif
+/**
+ * Number of return addresses recorded in each sample besides pc, 0 means
+ * only record pc, the application must be compiled with -fno-omit-frame-pointer
+ * when it is not 0
+ */
+#ifndef NPROF_DEPTH
+#define NPROF_DEPTH                 0
+#endif
+/** Max size of one stack frame, larger frames stop the backtrace */
+#ifndef NPROF_FRAME_MAX
+#define NPROF_FRAME_MAX             4096
+#endif
+/** Host file written by NPROF_Dump instead of UART dump when semihosting is enabled by SEMIHOST=1 */
+#ifndef NPROF_DUMP_FILE
+#define NPROF_DUMP_FILE     "prof.bin"
+#endif
+
+#define NPROF_MAGIC                 0x4652504EUL    /*!< "NPRF" */
+#define NPROF_VERSION               1
+
+typedef struct {
+    uint32_t magic;                 /*!< NPROF_MAGIC */
+    uint32_t version;               /*!< NPROF_VERSION */
+    uint32_t word_size;             /*!< sizeof(unsigned long), 4 for rv32, 8 for rv64 */
+    uint32_t depth;                 /*!< NPROF_DEPTH */
+    uint32_t buf_size;              /*!< NPROF_BUF_SIZE */
+    uint32_t rate;                  /*!< sample rate in Hz, 0 when sampled by application */
+    volatile uint32_t enable;       /*!< samples are only recorded when not 0 */
+    volatile uint32_t count;        /*!< number of samples recorded */
+    volatile uint32_t dropped;      /*!< number of samples dropped because buffer is full */
+    uint32_t reserved;
+    /** pc of each sample, followed by return addresses of callers, 0 if not found */
+    unsigned long samples[NPROF_BUF_SIZE][NPROF_DEPTH + 1];
+} NPROF_Buffer;
+
+extern NPROF_Buffer NPROF_Data;
+
+/**
+ * \brief  Record one sample
+ * \param [in]  pc      interrupted pc, usually read from mepc
+ * \param [in]  fp      frame address of the interrupt handler, whose saved
+ *                      frame pointer is the one of interrupted code
+ */
+extern void NPROF_Record(unsigned long pc, unsigned long fp);
+
+/**
+ * Record one sample in an interrupt handler of the application, such as a
+ * periodic timer interrupt other than the system timer, it must be used in the
+ * handler function itself, not in functions called by the handler
+ */
+#define NPROF_Sample()              \
+    NPROF_Record(__RV_CSR_READ(CSR_MEPC), (unsigned long)__builtin_frame_address(0))
+
+extern void NPROF_Init(void);
+extern int32_t NPROF_Start(uint32_t rate);
+extern void NPROF_Stop(void);
+extern void NPROF_Dump(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __NUCLEI_PROFILER_H__ */
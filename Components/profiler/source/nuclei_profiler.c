@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "nuclei_profiler.h"
+
+/* Number of bytes printed in each line by NPROF_Dump */
+#define NPROF_DUMP_LINE_BYTES       32
+
+/* Data, bss, heap and stacks are placed between _data and _sp by linker script */
+extern char _data[];
+extern char _sp[];
+
+NPROF_Buffer NPROF_Data;
+
+static uint64_t nprof_period;
+
+#if NPROF_DEPTH > 0
+static int nprof_is_fp(unsigned long fp)
+{
+    return ((fp & (sizeof(unsigned long) - 1)) == 0) && \
+           (fp >= (unsigned long)_data + 2 * sizeof(unsigned long)) && (fp <= (unsigned long)_sp);
+}
+
+/*
+ * Walk the frame pointer chain of interrupted code, s0 points to the top of
+ * the frame, return address and previous s0 are saved below it. Leaf
+ * functions don't save return address, a saved s0 is found in its slot
+ * instead, then ra register of interrupted code is used if it is known.
+ */
+static void nprof_backtrace(unsigned long *sample, unsigned long ra, unsigned long hfp)
+{
+    unsigned long fp, next, word;
+    uint32_t i = 0;
+
+    if (nprof_is_fp(hfp) == 0) {
+        return;
+    }
+    fp = ((unsigned long *)hfp)[-2];
+    while ((i < NPROF_DEPTH) && nprof_is_fp(fp)) {
+        word = ((unsigned long *)fp)[-1];
+        if (nprof_is_fp(word) && (word > fp) && (word - fp <= NPROF_FRAME_MAX)) {
+            /* Only the innermost frame can be a leaf function */
+            if ((i > 0) || (ra == 0)) {
+                break;
+            }
+            sample[i++] = ra;
+            next = word;
+        } else {
+            sample[i++] = word;
+            next = ((unsigned long *)fp)[-2];
+        }
+        if ((next <= fp) || (next - fp > NPROF_FRAME_MAX)) {
+            break;
+        }
+        fp = next;
+    }
+}
+#endif
+
+static void nprof_record(unsigned long pc, unsigned long ra, unsigned long fp)
+{
+    unsigned long *sample;
+    uint32_t idx;
+    rv_csr_t mstatus;
+
+    if (NPROF_Data.enable == 0) {
+        return;
+    }
+    mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+    idx = NPROF_Data.count;
+    if (idx >= NPROF_BUF_SIZE) {
+        NPROF_Data.dropped++;
+        __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+        return;
+    }
+    NPROF_Data.count = idx + 1;
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+
+    sample = NPROF_Data.samples[idx];
+    sample[0] = pc;
+#if NPROF_DEPTH > 0
+    memset(&sample[1], 0, NPROF_DEPTH * sizeof(unsigned long));
+    nprof_backtrace(&sample[1], ra, fp);
+#else
+    (void)ra;
+    (void)fp;
+#endif
+}
+
+void NPROF_Record(unsigned long pc, unsigned long fp)
+{
+    nprof_record(pc, 0, fp);
+}
+
+/*
+ * System timer interrupt registered as non-vector interrupt, it is called
+ * from irq_entry, which saves ra of interrupted code at the bottom of its
+ * context, right above the frame of this handler.
+ */
+static void nprof_timer_handler(void)
+{
+    unsigned long fp = 0, ra = 0;
+    uint64_t next;
+
+#if NPROF_DEPTH > 0
+    fp = (unsigned long)__builtin_frame_address(0);
+    if (nprof_is_fp(fp)) {
+        ra = ((unsigned long *)fp)[0];
+    }
+#endif
+    nprof_record(__RV_CSR_READ(CSR_MEPC), ra, fp);
+    next = SysTimer_GetCompareValue() + nprof_period;
+    /* Skip missed periods instead of raising timer interrupt continuously */
+    if (next <= SysTimer_GetLoadValue()) {
+        next = SysTimer_GetLoadValue() + nprof_period;
+    }
+    SysTimer_SetCompareValue(next);
+}
+
+#if defined(CFG_SEMIHOST)
+/* Write dumped data to host file directly, return 0 when done */
+static int nprof_dump_file(const void *ptr, uint32_t size)
+{
+    FILE *fp = fopen(NPROF_DUMP_FILE, "wb");
+    size_t written;
+
+    if (fp == NULL) {
+        return -1;
+    }
+    written = fwrite(ptr, 1, size, fp);
+    fclose(fp);
+    if (written != size) {
+        return -1;
+    }
+    printf("NPROF:FILE %s %lu\n", NPROF_DUMP_FILE, (unsigned long)size);
+    return 0;
+}
+#endif
+
+/**
+ * \brief  Initialize profiler buffer, samples are not recorded until NPROF_Start is called
+ */
+void NPROF_Init(void)
+{
+    memset(&NPROF_Data, 0, sizeof(NPROF_Data));
+    NPROF_Data.magic = NPROF_MAGIC;
+    NPROF_Data.version = NPROF_VERSION;
+    NPROF_Data.word_size = sizeof(unsigned long);
+    NPROF_Data.depth = NPROF_DEPTH;
+    NPROF_Data.buf_size = NPROF_BUF_SIZE;
+}
+
+/**
+ * \brief  Start sampling
+ * \details
+ * When rate is not 0, the system timer interrupt is used to take samples at
+ * highest interrupt level, so the application must not use the system timer
+ * interrupt itself. When rate is 0, samples are only recorded by NPROF_Sample
+ * called in interrupt handlers of the application.
+ * \param [in]  rate    sample rate in Hz
+ * \return 0 when started, -1 when rate is higher than system timer frequency
+ */
+int32_t NPROF_Start(uint32_t rate)
+{
+    if (NPROF_Data.magic != NPROF_MAGIC) {
+        NPROF_Init();
+    }
+    NPROF_Data.rate = rate;
+    if (rate != 0) {
+        nprof_period = SOC_TIMER_FREQ / rate;
+        if (nprof_period == 0) {
+            return -1;
+        }
+        ECLIC_Register_IRQ(SysTimer_IRQn, ECLIC_NON_VECTOR_INTERRUPT, ECLIC_LEVEL_TRIGGER, 0xFF, 0, \
+                           nprof_timer_handler);
+        SysTimer_SetCompareValue(SysTimer_GetLoadValue() + nprof_period);
+    }
+    NPROF_Data.enable = 1;
+    if (rate != 0) {
+        __enable_irq();
+    }
+    return 0;
+}
+
+/**
+ * \brief  Stop sampling, the recorded samples are kept
+ */
+void NPROF_Stop(void)
+{
+    NPROF_Data.enable = 0;
+    if (NPROF_Data.rate != 0) {
+        ECLIC_DisableIRQ(SysTimer_IRQn);
+    }
+}
+
+/**
+ * \brief  Stop sampling and dump the recorded samples in hex format
+ * \details
+ * It is called in _postmain_fini when main returns, and does nothing when
+ * profiler is never started. Each line starts with "NPROF:", so the dump can
+ * be extracted from a serial log by prof2flame.py.
+ */
+void NPROF_Dump(void)
+{
+    const uint8_t *ptr = (const uint8_t *)&NPROF_Data;
+    uint32_t i, size;
+
+    if (NPROF_Data.magic != NPROF_MAGIC) {
+        return;
+    }
+    NPROF_Stop();
+    /* Only dump the recorded samples */
+    size = sizeof(NPROF_Data) - sizeof(NPROF_Data.samples) + NPROF_Data.count * sizeof(NPROF_Data.samples[0]);
+#if defined(CFG_SEMIHOST)
+    if (nprof_dump_file(ptr, size) == 0) {
+        return;
+    }
+#endif
+    printf("NPROF:BEGIN %lu\n", (unsigned long)size);
+    for (i = 0; i < size; i ++) {
+        if ((i % NPROF_DUMP_LINE_BYTES) == 0) {
+            printf("NPROF:");
+        }
+        printf("%02x", ptr[i]);
+        if (((i + 1) % NPROF_DUMP_LINE_BYTES) == 0 || (i + 1) == size) {
+            printf("\n");
+        }
+    }
+    printf("NPROF:END\n");
+}
@@ -0,0 +1,10 @@
+# Semihosting file I/O stubs of newlib, enabled by SEMIHOST=1
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/semihost/source
+
+# These newlib stubs of SoC are replaced by semihosting ones, both are weak,
+# and linker keeps the first one, so they are not compiled
+SEMIHOST_NEWLIB_STUBS := open close read write lseek fstat isatty unlink
+EXCLUDE_SRCS += $(foreach stub, $(SEMIHOST_NEWLIB_STUBS), $(NUCLEI_SDK_SOC_COMMON)/Source/Stubs/newlib/$(stub).c)
+
+# Stubs are only referenced by system library, they are not compiled with LTO
+LTO_EXCLUDE_SRCS += $(NUCLEI_SDK_MIDDLEWARE)/semihost/source/*.c
@@ -0,0 +1,299 @@
+/* See LICENSE of license details. */
+/*
+ * Newlib file I/O stubs using RISC-V semihosting, used when SEMIHOST=1,
+ * such as qemu started with -semihosting-config enable=on,target=native.
+ * The same stubs in SoC/<SOC>/Common/Source/Stubs/newlib are not compiled
+ * then, see build.mk, stdin, stdout and stderr still use UART, other files
+ * are opened on the host by SYS_OPEN.
+ */
+#include "nuclei_sdk_soc.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#undef errno
+extern int errno;
+
+#undef putchar
+#undef getchar
+extern int putchar(int dat);
+extern int getchar(void);
+
+/* Semihosting operations */
+#define SYS_OPEN                0x01
+#define SYS_CLOSE               0x02
+#define SYS_WRITE               0x05
+#define SYS_READ                0x06
+#define SYS_SEEK                0x0A
+#define SYS_FLEN                0x0C
+#define SYS_REMOVE              0x0E
+#define SYS_ERRNO               0x13
+
+/* Mode of SYS_OPEN, index of "r", "rb", "r+", "r+b", "w", "wb", "w+", "w+b", "a", "ab", "a+", "a+b" */
+#define SH_MODE_R               0
+#define SH_MODE_RW              2
+#define SH_MODE_W               4
+#define SH_MODE_WR              6
+#define SH_MODE_A               8
+#define SH_MODE_AR              10
+#define SH_MODE_BINARY          1
+
+/* Number of host files opened at the same time, file descriptors start from 3 */
+#ifndef SEMIHOST_MAX_FILES
+#define SEMIHOST_MAX_FILES      8
+#endif
+#define SEMIHOST_FD_BASE        3
+
+typedef struct {
+    long handle;                /* host handle + 1, 0 when not used */
+    long pos;                   /* current position, SYS_SEEK only accepts absolute position */
+} SemihostFile;
+
+static SemihostFile semihost_files[SEMIHOST_MAX_FILES];
+
+/*
+ * Trap to the debugger or qemu, the three instructions must be uncompressed
+ * and in the same page, a0 is operation and a1 is pointer to arguments
+ */
+static __attribute__((noinline)) long semihost_call(long op, void *args)
+{
+    register long a0 __asm("a0") = op;
+    register long a1 __asm("a1") = (long)args;
+
+    __ASM volatile(".balign 16\n"
+                   ".option push\n"
+                   ".option norvc\n"
+                   "slli zero, zero, 0x1f\n"
+                   "ebreak\n"
+                   "srai zero, zero, 0x7\n"
+                   ".option pop\n"
+                   : "+r"(a0) : "r"(a1) : "memory");
+    return a0;
+}
+
+static SemihostFile *semihost_get_file(int fd)
+{
+    if ((fd < SEMIHOST_FD_BASE) || (fd >= SEMIHOST_FD_BASE + SEMIHOST_MAX_FILES)) {
+        return NULL;
+    }
+    if (semihost_files[fd - SEMIHOST_FD_BASE].handle == 0) {
+        return NULL;
+    }
+    return &semihost_files[fd - SEMIHOST_FD_BASE];
+}
+
+static int semihost_error(void)
+{
+    errno = (int)semihost_call(SYS_ERRNO, NULL);
+    return -1;
+}
+
+__WEAK int _open(const char* name, int flags, int mode)
+{
+    long args[3];
+    long handle;
+    int fd, shmode;
+
+    (void)mode;
+    for (fd = 0; fd < SEMIHOST_MAX_FILES; fd++) {
+        if (semihost_files[fd].handle == 0) {
+            break;
+        }
+    }
+    if (fd == SEMIHOST_MAX_FILES) {
+        errno = EMFILE;
+        return -1;
+    }
+    switch (flags & O_ACCMODE) {
+        case O_RDONLY:
+            shmode = SH_MODE_R;
+            break;
+        case O_WRONLY:
+            shmode = (flags & O_APPEND) ? SH_MODE_A : SH_MODE_W;
+            break;
+        default:
+            if (flags & O_APPEND) {
+                shmode = SH_MODE_AR;
+            } else {
+                shmode = (flags & O_TRUNC) ? SH_MODE_WR : SH_MODE_RW;
+            }
+            break;
+    }
+    args[0] = (long)name;
+    args[1] = shmode | SH_MODE_BINARY;
+    args[2] = (long)strlen(name);
+    handle = semihost_call(SYS_OPEN, args);
+    if (handle == -1) {
+        return semihost_error();
+    }
+    semihost_files[fd].handle = handle + 1;
+    semihost_files[fd].pos = 0;
+    return fd + SEMIHOST_FD_BASE;
+}
+
+__WEAK int _close(int fd)
+{
+    SemihostFile *file = semihost_get_file(fd);
+    long args[1];
+
+    if (file == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    args[0] = file->handle - 1;
+    file->handle = 0;
+    if (semihost_call(SYS_CLOSE, args) != 0) {
+        return semihost_error();
+    }
+    return 0;
+}
+
+__WEAK ssize_t _write(int fd, const void* ptr, size_t len)
+{
+    SemihostFile *file;
+    long args[3];
+    long left;
+
+    if ((fd == STDOUT_FILENO) || (fd == STDERR_FILENO)) {
+        const uint8_t* writebuf = (const uint8_t*)ptr;
+        for (size_t i = 0; i < len; i++) {
+            putchar((int)writebuf[i]);
+        }
+        return len;
+    }
+    file = semihost_get_file(fd);
+    if (file == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    args[0] = file->handle - 1;
+    args[1] = (long)ptr;
+    args[2] = (long)len;
+    /* Number of bytes not written is returned */
+    left = semihost_call(SYS_WRITE, args);
+    if (left < 0 || (size_t)left > len) {
+        return semihost_error();
+    }
+    file->pos += len - left;
+    return len - left;
+}
+
+__WEAK ssize_t _read(int fd, void* ptr, size_t len)
+{
+    SemihostFile *file;
+    long args[3];
+    long left;
+
+    if (fd == STDIN_FILENO) {
+        ssize_t cnt = 0;
+        uint8_t* readbuf = (uint8_t*)ptr;
+        for (cnt = 0; cnt < len; cnt ++) {
+            readbuf[cnt] = getchar();
+            /* Return partial buffer if we get EOL */
+            if (readbuf[cnt] == '\n') {
+                return cnt;
+            }
+        }
+        return cnt;
+    }
+    file = semihost_get_file(fd);
+    if (file == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    args[0] = file->handle - 1;
+    args[1] = (long)ptr;
+    args[2] = (long)len;
+    /* Number of bytes not read is returned, len means end of file */
+    left = semihost_call(SYS_READ, args);
+    if (left < 0 || (size_t)left > len) {
+        return semihost_error();
+    }
+    file->pos += len - left;
+    return len - left;
+}
+
+__WEAK int _lseek(int fd, int offset, int whence)
+{
+    SemihostFile *file = semihost_get_file(fd);
+    long args[2];
+    long pos;
+
+    if (file == NULL) {
+        if (fd < SEMIHOST_FD_BASE) {
+            return 0;
+        }
+        errno = EBADF;
+        return -1;
+    }
+    args[0] = file->handle - 1;
+    if (whence == SEEK_SET) {
+        pos = offset;
+    } else if (whence == SEEK_CUR) {
+        pos = file->pos + offset;
+    } else if (whence == SEEK_END) {
+        pos = semihost_call(SYS_FLEN, args);
+        if (pos < 0) {
+            return semihost_error();
+        }
+        pos += offset;
+    } else {
+        errno = EINVAL;
+        return -1;
+    }
+    if (pos < 0) {
+        errno = EINVAL;
+        return -1;
+    }
+    args[1] = pos;
+    if (semihost_call(SYS_SEEK, args) != 0) {
+        return semihost_error();
+    }
+    file->pos = pos;
+    return (int)pos;
+}
+
+__WEAK int _fstat(int fd, struct stat* st)
+{
+    SemihostFile *file = semihost_get_file(fd);
+    long args[1];
+    long size;
+
+    memset(st, 0, sizeof(struct stat));
+    if (fd < SEMIHOST_FD_BASE) {
+        st->st_mode = S_IFCHR;
+        return 0;
+    }
+    if (file == NULL) {
+        errno = EBADF;
+        return -1;
+    }
+    args[0] = file->handle - 1;
+    size = semihost_call(SYS_FLEN, args);
+    if (size < 0) {
+        return semihost_error();
+    }
+    st->st_mode = S_IFREG;
+    st->st_size = size;
+    return 0;
+}
+
+/* Host files are fully buffered by newlib, only stdin, stdout and stderr are tty */
+__WEAK int _isatty(int fd)
+{
+    return fd < SEMIHOST_FD_BASE;
+}
+
+__WEAK int _unlink(const char* name)
+{
+    long args[2];
+
+    args[0] = (long)name;
+    args[1] = (long)strlen(name);
+    if (semihost_call(SYS_REMOVE, args) != 0) {
+        return semihost_error();
+    }
+    return 0;
+}
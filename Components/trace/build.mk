@@ -0,0 +1,4 @@
+# Binary event trace component, enabled by MIDDLEWARE := trace
+C_SRCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/trace/source
+
+INCDIRS += $(NUCLEI_SDK_MIDDLEWARE)/trace/include
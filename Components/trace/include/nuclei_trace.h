@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+/*******************************************************************************
+ * @file     nuclei_trace.h
+ * @brief    Binary event trace recorded into a RAM ring buffer
+ *
+ * Each event is 12 bytes and holds the low 32 bits of mcycle, the event type,
+ * the hart id, a 16-bit argument and a 32-bit object address. The whole
+ * @ref NTRACE_Buffer can be dumped over UART using NTRACE_Dump, or read by
+ * gdb using "dump binary value trace.bin NTRACE_Data", then converted by
+ * tools/scripts/misc/trace2chrome.py into chrome trace json format.
+ ******************************************************************************/
+#ifndef __NUCLEI_TRACE_H__
+#define __NUCLEI_TRACE_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "nuclei_sdk_soc.h"
+
+/** Number of events kept in the ring buffer, must be power of 2 */
+#ifndef NTRACE_BUF_SIZE
+#define NTRACE_BUF_SIZE             1024
+#endif
+/** Number of object names which can be registered */
+#ifndef NTRACE_NAME_MAX
+#define NTRACE_NAME_MAX             32
+#endif
+/** Max length of registered object name, including the ending '\0' */
+#define NTRACE_NAME_LEN             12
+
+#if (NTRACE_BUF_SIZE & (NTRACE_BUF_SIZE - 1)) != 0
+#error "NTRACE_BUF_SIZE must be power of 2"
+#endif
+/** Host file written by NTRACE_Dump instead of UART dump when semihosting is enabled by SEMIHOST=1 */
+#ifndef NTRACE_DUMP_FILE
+#define NTRACE_DUMP_FILE    "trace.bin"
+#endif
+
+#define NTRACE_MAGIC                0x4352544EUL    /*!< "NTRC" */
+#define NTRACE_VERSION              1
+
+/** Event types */
+#define NTRACE_EVT_TASK_SWITCH      1   /*!< obj: task switched in */
+#define NTRACE_EVT_IRQ_ENTER        2   /*!< arg: interrupt id */
+#define NTRACE_EVT_IRQ_EXIT         3   /*!< arg: interrupt id */
+#define NTRACE_EVT_OBJ_GIVE         4   /*!< obj: queue/semaphore/mailbox given or sent to, arg: items before */
+#define NTRACE_EVT_OBJ_TAKE         5   /*!< obj: queue/semaphore/mailbox taken or received from, arg: items before */
+#define NTRACE_EVT_OBJ_BLOCK        6   /*!< obj: queue/semaphore/mailbox the task is going to wait on */
+#define NTRACE_EVT_MARK             7   /*!< arg: user marker id, obj: user value */
+#define NTRACE_EVT_SPAN_BEGIN       8   /*!< arg: user span id */
+#define NTRACE_EVT_SPAN_END         9   /*!< arg: user span id */
+
+typedef struct {
+    uint32_t time;                  /*!< low 32 bits of mcycle */
+    uint8_t type;                   /*!< event type, NTRACE_EVT_* */
+    uint8_t hart;                   /*!< hart id which recorded this event */
+    uint16_t arg;                   /*!< event argument */
+    uint32_t obj;                   /*!< object address or user value */
+} NTRACE_Event;
+
+typedef struct {
+    uint32_t obj;                   /*!< object address */
+    char name[NTRACE_NAME_LEN];     /*!< object name */
+} NTRACE_Name;
+
+typedef struct {
+    uint32_t magic;                 /*!< NTRACE_MAGIC */
+    uint16_t version;               /*!< NTRACE_VERSION */
+    uint16_t event_size;            /*!< sizeof(NTRACE_Event) */
+    uint32_t buf_size;              /*!< NTRACE_BUF_SIZE */
+    uint32_t name_max;              /*!< NTRACE_NAME_MAX */
+    uint32_t freq;                  /*!< timestamp frequency in Hz */
+    volatile uint32_t enable;       /*!< events are only recorded when not 0 */
+    volatile uint32_t index;        /*!< total number of events ever recorded */
+    volatile uint32_t name_cnt;     /*!< number of registered names */
+    NTRACE_Name names[NTRACE_NAME_MAX];
+    NTRACE_Event events[NTRACE_BUF_SIZE];
+} NTRACE_Buffer;
+
+extern NTRACE_Buffer NTRACE_Data;
+
+/**
+ * \brief  Record one event into the trace ring buffer
+ * \details
+ * Oldest events are overwritten when the ring buffer is full.
+ * With A extension the slot is claimed by one amoadd, so it can be
+ * called from any hart and from nested interrupts without disabling interrupts.
+ * \param [in]  type    event type, NTRACE_EVT_*
+ * \param [in]  arg     event argument
+ * \param [in]  obj     object address or user value
+ */
+__STATIC_FORCEINLINE void NTRACE_Record(uint8_t type, uint16_t arg, uint32_t obj)
+{
+    uint32_t idx;
+    NTRACE_Event *evt;
+
+    if (NTRACE_Data.enable == 0) {
+        return;
+    }
+#if defined(__riscv_atomic)
+    idx = __atomic_fetch_add(&NTRACE_Data.index, 1, __ATOMIC_RELAXED);
+#else
+    rv_csr_t mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+    idx = NTRACE_Data.index;
+    NTRACE_Data.index = idx + 1;
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+#endif
+    evt = &NTRACE_Data.events[idx & (NTRACE_BUF_SIZE - 1)];
+    evt->time = (uint32_t)__RV_CSR_READ(CSR_MCYCLE);
+    evt->type = type;
+    evt->hart = (uint8_t)__RV_CSR_READ(CSR_MHARTID);
+    evt->arg = arg;
+    evt->obj = obj;
+}
+
+/** Record a user marker with id and value */
+#define NTRACE_Mark(id, value)      NTRACE_Record(NTRACE_EVT_MARK, (uint16_t)(id), (uint32_t)(value))
+/** Record begin of a user span with id */
+#define NTRACE_Begin(id)            NTRACE_Record(NTRACE_EVT_SPAN_BEGIN, (uint16_t)(id), 0)
+/** Record end of a user span with id */
+#define NTRACE_End(id)              NTRACE_Record(NTRACE_EVT_SPAN_END, (uint16_t)(id), 0)
+
+/**
+ * Record interrupt enter in a vector interrupt handler.
+ * Only non-vector interrupts going through irq_entry are recorded automatically,
+ * a vector interrupt handler jumps from the vector table directly, so call it
+ * after SAVE_IRQ_CSR_CONTEXT() when this interrupt need to be traced.
+ */
+#define NTRACE_VectorIrqEnter()     NTRACE_IrqEnter(__RV_CSR_READ(CSR_MCAUSE))
+/** Record interrupt exit in a vector interrupt handler, call it before RESTORE_IRQ_CSR_CONTEXT() */
+#define NTRACE_VectorIrqExit()      NTRACE_IrqExit(__RV_CSR_READ(CSR_MCAUSE))
+
+extern void NTRACE_Init(void);
+extern void NTRACE_Start(void);
+extern void NTRACE_Stop(void);
+extern void NTRACE_SetName(const void *obj, const char *name);
+extern void NTRACE_Dump(void);
+extern void NTRACE_IrqEnter(unsigned long mcause);
+extern void NTRACE_IrqExit(unsigned long mcause);
+
+#if defined(RTOS_RTTHREAD)
+extern void NTRACE_RTThreadInit(void);
+#endif
+
+#if defined(RTOS_FREERTOS)
+/*
+ * FreeRTOS trace macros, include this file at the end of FreeRTOSConfig.h
+ * to record task switches and queue/semaphore operations, the PMP stack
+ * guard of the port is still moved at task switch
+ */
+#define traceTASK_SWITCHED_IN()                         \
+    do {                                                \
+        NTRACE_Record(NTRACE_EVT_TASK_SWITCH, 0, (uint32_t)(unsigned long)pxCurrentTCB); \
+        portSTACK_GUARD_SWITCH();                       \
+    } while (0)
+#define traceTASK_CREATE(pxNewTCB)                      \
+    NTRACE_SetName(pxNewTCB, pxNewTCB->pcTaskName)
+#define traceQUEUE_REGISTRY_ADD(xQueue, pcQueueName)    \
+    NTRACE_SetName(xQueue, pcQueueName)
+#define traceQUEUE_SEND(pxQueue)                        \
+    NTRACE_Record(NTRACE_EVT_OBJ_GIVE, (uint16_t)pxQueue->uxMessagesWaiting, (uint32_t)(unsigned long)pxQueue)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)               traceQUEUE_SEND(pxQueue)
+#define traceQUEUE_RECEIVE(pxQueue)                     \
+    NTRACE_Record(NTRACE_EVT_OBJ_TAKE, (uint16_t)pxQueue->uxMessagesWaiting, (uint32_t)(unsigned long)pxQueue)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)            traceQUEUE_RECEIVE(pxQueue)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)            \
+    NTRACE_Record(NTRACE_EVT_OBJ_BLOCK, (uint16_t)pxQueue->uxMessagesWaiting, (uint32_t)(unsigned long)pxQueue)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)         traceBLOCKING_ON_QUEUE_SEND(pxQueue)
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* __NUCLEI_TRACE_H__ */
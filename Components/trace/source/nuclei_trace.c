@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <stdio.h>
+#include <string.h>
+#include "nuclei_trace.h"
+
+#if defined(RTOS_RTTHREAD)
+#include <rtthread.h>
+#endif
+
+/* Number of bytes printed in each line by NTRACE_Dump */
+#define NTRACE_DUMP_LINE_BYTES      32
+
+NTRACE_Buffer NTRACE_Data;
+
+#if defined(CFG_SEMIHOST)
+/* Write dumped data to host file directly, return 0 when done */
+static int ntrace_dump_file(const void *ptr, uint32_t size)
+{
+    FILE *fp = fopen(NTRACE_DUMP_FILE, "wb");
+    size_t written;
+
+    if (fp == NULL) {
+        return -1;
+    }
+    written = fwrite(ptr, 1, size, fp);
+    fclose(fp);
+    if (written != size) {
+        return -1;
+    }
+    printf("NTRACE:FILE %s %lu\n", NTRACE_DUMP_FILE, (unsigned long)size);
+    return 0;
+}
+#endif
+
+/**
+ * \brief  Initialize trace buffer, events are not recorded until NTRACE_Start is called
+ */
+void NTRACE_Init(void)
+{
+    memset(&NTRACE_Data, 0, sizeof(NTRACE_Data));
+    NTRACE_Data.magic = NTRACE_MAGIC;
+    NTRACE_Data.version = NTRACE_VERSION;
+    NTRACE_Data.event_size = sizeof(NTRACE_Event);
+    NTRACE_Data.buf_size = NTRACE_BUF_SIZE;
+    NTRACE_Data.name_max = NTRACE_NAME_MAX;
+    NTRACE_Data.freq = SystemCoreClock;
+    __enable_mcycle_counter();
+}
+
+/**
+ * \brief  Start recording events
+ */
+void NTRACE_Start(void)
+{
+    if (NTRACE_Data.magic != NTRACE_MAGIC) {
+        NTRACE_Init();
+    }
+    NTRACE_Data.enable = 1;
+}
+
+/**
+ * \brief  Stop recording events, the recorded events are kept
+ */
+void NTRACE_Stop(void)
+{
+    NTRACE_Data.enable = 0;
+}
+
+/**
+ * \brief  Register name of an object such as task or queue
+ * \details
+ * Names are looked up by object address when converting the trace,
+ * registering the same object again updates its name.
+ */
+void NTRACE_SetName(const void *obj, const char *name)
+{
+    uint32_t i, addr = (uint32_t)(unsigned long)obj;
+    rv_csr_t mstatus;
+
+    if (NTRACE_Data.magic != NTRACE_MAGIC) {
+        NTRACE_Init();
+    }
+    mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MIE);
+    for (i = 0; i < NTRACE_Data.name_cnt; i ++) {
+        if (NTRACE_Data.names[i].obj == addr) {
+            break;
+        }
+    }
+    if (i < NTRACE_NAME_MAX) {
+        NTRACE_Data.names[i].obj = addr;
+        strncpy(NTRACE_Data.names[i].name, name, NTRACE_NAME_LEN - 1);
+        NTRACE_Data.names[i].name[NTRACE_NAME_LEN - 1] = '\0';
+        if (i == NTRACE_Data.name_cnt) {
+            NTRACE_Data.name_cnt = i + 1;
+        }
+    }
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+}
+
+/**
+ * \brief  Called from irq_entry before the interrupt handlers are called
+ * \details
+ * Vector interrupts don't go through irq_entry, their handlers need to
+ * call NTRACE_VectorIrqEnter and NTRACE_VectorIrqExit to be recorded.
+ */
+void NTRACE_IrqEnter(unsigned long mcause)
+{
+    NTRACE_Record(NTRACE_EVT_IRQ_ENTER, (uint16_t)(mcause & 0xFFFUL), 0);
+}
+
+/**
+ * \brief  Called from irq_entry after the interrupt handlers returned
+ */
+void NTRACE_IrqExit(unsigned long mcause)
+{
+    NTRACE_Record(NTRACE_EVT_IRQ_EXIT, (uint16_t)(mcause & 0xFFFUL), 0);
+}
+
+/**
+ * \brief  Dump the whole trace buffer in hex format
+ * \details
+ * Recording is stopped during the dump, each line starts with "NTRACE:",
+ * so the dump can be extracted from a serial log by trace2chrome.py.
+ */
+void NTRACE_Dump(void)
+{
+    const uint8_t *ptr = (const uint8_t *)&NTRACE_Data;
+    uint32_t enable = NTRACE_Data.enable;
+    uint32_t i, size;
+
+    NTRACE_Data.enable = 0;
+    /* Only dump the used part of the ring buffer */
+    size = sizeof(NTRACE_Data) - sizeof(NTRACE_Data.events);
+    if (NTRACE_Data.index < NTRACE_BUF_SIZE) {
+        size += NTRACE_Data.index * sizeof(NTRACE_Event);
+    } else {
+        size += sizeof(NTRACE_Data.events);
+    }
+#if defined(CFG_SEMIHOST)
+    if (ntrace_dump_file(ptr, size) == 0) {
+        NTRACE_Data.enable = enable;
+        return;
+    }
+#endif
+    printf("NTRACE:BEGIN %lu\n", (unsigned long)size);
+    for (i = 0; i < size; i ++) {
+        if ((i % NTRACE_DUMP_LINE_BYTES) == 0) {
+            printf("NTRACE:");
+        }
+        printf("%02x", ptr[i]);
+        if (((i + 1) % NTRACE_DUMP_LINE_BYTES) == 0 || (i + 1) == size) {
+            printf("\n");
+        }
+    }
+    printf("NTRACE:END\n");
+    NTRACE_Data.enable = enable;
+}
+
+#if defined(RTOS_RTTHREAD)
+#ifdef RT_USING_HOOK
+static void ntrace_scheduler_hook(struct rt_thread *from, struct rt_thread *to)
+{
+    NTRACE_Record(NTRACE_EVT_TASK_SWITCH, 0, (uint32_t)(unsigned long)to);
+}
+
+static void ntrace_object_attach_hook(struct rt_object *object)
+{
+    NTRACE_SetName(object, object->name);
+}
+
+static void ntrace_object_take_hook(struct rt_object *object)
+{
+    NTRACE_Record(NTRACE_EVT_OBJ_TAKE, object->type, (uint32_t)(unsigned long)object);
+}
+
+static void ntrace_object_trytake_hook(struct rt_object *object)
+{
+    NTRACE_Record(NTRACE_EVT_OBJ_BLOCK, object->type, (uint32_t)(unsigned long)object);
+}
+
+static void ntrace_object_put_hook(struct rt_object *object)
+{
+    NTRACE_Record(NTRACE_EVT_OBJ_GIVE, object->type, (uint32_t)(unsigned long)object);
+}
+#endif
+
+/**
+ * \brief  Install RT-Thread hooks to record thread switches and ipc operations
+ * \details
+ * RT_USING_HOOK must be defined in rtconfig.h, objects created before this
+ * function is called are not named in the trace.
+ */
+void NTRACE_RTThreadInit(void)
+{
+    NTRACE_Init();
+#ifdef RT_USING_HOOK
+    rt_scheduler_sethook(ntrace_scheduler_hook);
+    rt_object_attach_sethook(ntrace_object_attach_hook);
+    rt_object_take_sethook(ntrace_object_take_hook);
+    rt_object_trytake_sethook(ntrace_object_trytake_hook);
+    rt_object_put_sethook(ntrace_object_put_hook);
+    NTRACE_SetName(rt_thread_self(), rt_thread_self()->name);
+#endif
+}
+#endif
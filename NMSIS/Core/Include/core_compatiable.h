@@ -121,13 +121,11 @@ __STATIC_FORCEINLINE uint32_t __USAT(int32_t val, uint32_t sat)
  */
 __STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
 {
-    uint32_t result;
-
-    result =  ((value & 0xff000000) >> 24)
-        | ((value & 0x00ff0000) >> 8 )
-        | ((value & 0x0000ff00) << 8 )
-        | ((value & 0x000000ff) << 24);
-    return result;
+#if __RISCV_XLEN == 32
+    return (uint32_t)__RV_REV8(value);
+#else
+    return (uint32_t)(__RV_REV8(value) >> 32);
+#endif
 }
 
 /**
@@ -139,13 +137,9 @@ __STATIC_FORCEINLINE uint32_t __REV(uint32_t value)
  */
 __STATIC_FORCEINLINE uint32_t __REV16(uint32_t value)
 {
-    uint32_t result;
-    result =  ((value & 0xff000000) >> 8)
-        | ((value & 0x00ff0000) << 8 )
-        | ((value & 0x0000ff00) >> 8 )
-        | ((value & 0x000000ff) << 8) ;
+    uint32_t result = __REV(value);
 
-    return result;
+    return (result >> 16) | (result << 16);
 }
 
 /**
@@ -216,13 +210,7 @@ __STATIC_FORCEINLINE uint32_t __RBIT(uint32_t value)
 #else
 __STATIC_FORCEINLINE uint8_t __CLZ(uint32_t data)
 {
-    uint8_t ret = 0;
-    uint32_t temp = ~data;
-    while (temp & 0x80000000) {
-          temp <<= 1;
-          ret++;
-    }
-    return ret;
+    return (uint8_t)(__RV_CLZ(data) - (__RISCV_XLEN - 32));
 }
 #endif /* defined(__DSP_PRESENT) && (__DSP_PRESENT == 1) */
 
@@ -27,6 +27,10 @@
  * 1. __BITMANIP_PRESENT:  Define whether Bitmanipulation Unit is present or not
  *   * 0: Not present
  *   * 1: Present
+ * 2. Bitmanipulation wrapper functions such as __RV_CLZ are always available,
+ *    when compiler option enables B extension (__riscv_bitmanip) or Zba/Zbb/Zbs
+ *    (__riscv_zba/__riscv_zbb/__riscv_zbs), instructions will be generated,
+ *    otherwise constant-time C code will be used.
  */
 #ifdef __cplusplus
  extern "C" {
@@ -59,6 +63,376 @@
 
 #endif /* defined(__BITMANIP_PRESENT) && (__BITMANIP_PRESENT == 1) */
 
+/* ###########################  CPU Bitmanipulation Wrapper Functions ########################### */
+/**
+ * \defgroup NMSIS_Core_Bitmanip_Wrapper   Wrapper Functions for Bitmanipulation Instructions
+ * \ingroup  NMSIS_Core
+ * \brief    Functions that generate RISC-V Bitmanipulation instructions or equivalent C code.
+ * \details
+ *
+ * These functions can be used by portable code without checking whether bitmanipulation
+ * extension is present. When B extension or Zba/Zbb/Zbs extension is enabled in compiler
+ * option, the instruction will be generated, otherwise constant-time C code without branch
+ * and table lookup will be used.
+ *
+ * All the functions operate on XLEN bits unsigned long value.
+ *   @{
+ */
+#if defined(__riscv_bitmanip) || defined(__riscv_zbb)
+#define __RV_ZBB_PRESENT            1
+#endif
+#if defined(__riscv_bitmanip) || defined(__riscv_zba)
+#define __RV_ZBA_PRESENT            1
+#endif
+#if defined(__riscv_bitmanip) || defined(__riscv_zbs)
+#define __RV_ZBS_PRESENT            1
+#endif
+
+/* Masks used by C code, such as 0x55555555 for RV32 */
+#define __RV_BM_MASK55              (~0UL / 3)
+#define __RV_BM_MASK33              (~0UL / 5)
+#define __RV_BM_MASK0F              (~0UL / 17)
+#define __RV_BM_MASK01              (~0UL / 255)
+#define __RV_BM_MASK7F              (__RV_BM_MASK01 * 0x7F)
+#define __RV_BM_MASK00FF            (~0UL / 257)
+#define __RV_BM_MASK0000FFFF        (~0UL / 65537)
+
+/**
+ * \brief   Count set bits
+ * \details Count the number of bits set to 1 in \em a, generate cpop instruction when Zbb present.
+ * \param [in]    a     value to count
+ * \return              number of set bits
+ */
+__STATIC_FORCEINLINE unsigned long __RV_CPOP(unsigned long a)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("cpop %0, %1" : "=r"(result) : "r"(a));
+    return result;
+#else
+    a = a - ((a >> 1) & __RV_BM_MASK55);
+    a = (a & __RV_BM_MASK33) + ((a >> 2) & __RV_BM_MASK33);
+    a = (a + (a >> 4)) & __RV_BM_MASK0F;
+    return (a * __RV_BM_MASK01) >> (__RISCV_XLEN - 8);
+#endif
+}
+
+/**
+ * \brief   Count leading zero bits
+ * \details Count the number of 0 bits before the first 1 bit starting from the MSB,
+ * generate clz instruction when Zbb present.
+ * \param [in]    a     value to count
+ * \return              number of leading zero bits, XLEN when \em a is 0
+ */
+__STATIC_FORCEINLINE unsigned long __RV_CLZ(unsigned long a)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("clz %0, %1" : "=r"(result) : "r"(a));
+    return result;
+#else
+    /* Set all bits after the first 1 bit, then the leading zeros are the clear bits */
+    a |= a >> 1;
+    a |= a >> 2;
+    a |= a >> 4;
+    a |= a >> 8;
+    a |= a >> 16;
+#if __RISCV_XLEN == 64
+    a |= a >> 32;
+#endif
+    return __RISCV_XLEN - __RV_CPOP(a);
+#endif
+}
+
+/**
+ * \brief   Count trailing zero bits
+ * \details Count the number of 0 bits before the first 1 bit starting from the LSB,
+ * generate ctz instruction when Zbb present.
+ * \param [in]    a     value to count
+ * \return              number of trailing zero bits, XLEN when \em a is 0
+ */
+__STATIC_FORCEINLINE unsigned long __RV_CTZ(unsigned long a)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("ctz %0, %1" : "=r"(result) : "r"(a));
+    return result;
+#else
+    /* Bits below the lowest 1 bit, all bits when a is 0 */
+    return __RV_CPOP((a & (0UL - a)) - 1);
+#endif
+}
+
+/**
+ * \brief   Reverse bytes
+ * \details Reverse the byte order of \em a, generate rev8 instruction when Zbb present.
+ * For example, 0x12345678 becomes 0x78563412 on RV32.
+ * \param [in]    a     value to reverse
+ * \return              byte reversed value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_REV8(unsigned long a)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("rev8 %0, %1" : "=r"(result) : "r"(a));
+    return result;
+#else
+#if __RISCV_XLEN == 64
+    a = (a >> 32) | (a << 32);
+    a = ((a >> 16) & __RV_BM_MASK0000FFFF) | ((a & __RV_BM_MASK0000FFFF) << 16);
+#else
+    a = (a >> 16) | (a << 16);
+#endif
+    return ((a >> 8) & __RV_BM_MASK00FF) | ((a & __RV_BM_MASK00FF) << 8);
+#endif
+}
+
+/**
+ * \brief   OR-combine bits within each byte
+ * \details Set each byte of result to 0xFF when the same byte of \em a is not zero,
+ * otherwise 0, generate orc.b instruction when Zbb present. It can be used to find
+ * zero byte in a word, such as in strlen.
+ * \param [in]    a     value to combine
+ * \return              combined value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_ORCB(unsigned long a)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("orc.b %0, %1" : "=r"(result) : "r"(a));
+    return result;
+#else
+    /* bit 7 of each byte is set when the byte is not zero, no carry between bytes */
+    a = (((a & __RV_BM_MASK7F) + __RV_BM_MASK7F) | a) & ~__RV_BM_MASK7F;
+    return (a >> 7) * 0xFF;
+#endif
+}
+
+/**
+ * \brief   AND with inverted operand
+ * \details Calculate \em a & ~\em b, generate andn instruction when Zbb present.
+ * \param [in]    a     first operand
+ * \param [in]    b     second operand, which is inverted
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_ANDN(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("andn %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return a & ~b;
+#endif
+}
+
+/**
+ * \brief   OR with inverted operand
+ * \details Calculate \em a | ~\em b, generate orn instruction when Zbb present.
+ * \param [in]    a     first operand
+ * \param [in]    b     second operand, which is inverted
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_ORN(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("orn %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return a | ~b;
+#endif
+}
+
+/**
+ * \brief   Exclusive NOR
+ * \details Calculate ~(\em a ^ \em b), generate xnor instruction when Zbb present.
+ * \param [in]    a     first operand
+ * \param [in]    b     second operand
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_XNOR(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("xnor %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return ~(a ^ b);
+#endif
+}
+
+/**
+ * \brief   Rotate left
+ * \details Rotate \em a left by the low log2(XLEN) bits of \em b,
+ * generate rol instruction when Zbb present.
+ * \param [in]    a     value to rotate
+ * \param [in]    b     rotate amount
+ * \return              rotated value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_ROL(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("rol %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    b &= __RISCV_XLEN - 1;
+    return (a << b) | (a >> ((__RISCV_XLEN - b) & (__RISCV_XLEN - 1)));
+#endif
+}
+
+/**
+ * \brief   Rotate right
+ * \details Rotate \em a right by the low log2(XLEN) bits of \em b,
+ * generate ror instruction when Zbb present.
+ * \param [in]    a     value to rotate
+ * \param [in]    b     rotate amount
+ * \return              rotated value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_ROR(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBB_PRESENT)
+    unsigned long result;
+    __ASM volatile("ror %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    b &= __RISCV_XLEN - 1;
+    return (a >> b) | (a << ((__RISCV_XLEN - b) & (__RISCV_XLEN - 1)));
+#endif
+}
+
+/**
+ * \brief   Shift left by 1 and add
+ * \details Calculate (\em a << 1) + \em b, generate sh1add instruction when Zba present.
+ * \param [in]    a     value to shift, such as array index
+ * \param [in]    b     value to add, such as array base address
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_SH1ADD(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBA_PRESENT)
+    unsigned long result;
+    __ASM volatile("sh1add %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return (a << 1) + b;
+#endif
+}
+
+/**
+ * \brief   Shift left by 2 and add
+ * \details Calculate (\em a << 2) + \em b, generate sh2add instruction when Zba present.
+ * \param [in]    a     value to shift, such as array index
+ * \param [in]    b     value to add, such as array base address
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_SH2ADD(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBA_PRESENT)
+    unsigned long result;
+    __ASM volatile("sh2add %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return (a << 2) + b;
+#endif
+}
+
+/**
+ * \brief   Shift left by 3 and add
+ * \details Calculate (\em a << 3) + \em b, generate sh3add instruction when Zba present.
+ * \param [in]    a     value to shift, such as array index
+ * \param [in]    b     value to add, such as array base address
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_SH3ADD(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBA_PRESENT)
+    unsigned long result;
+    __ASM volatile("sh3add %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return (a << 3) + b;
+#endif
+}
+
+/**
+ * \brief   Set single bit
+ * \details Set bit \em b of \em a to 1, only low log2(XLEN) bits of \em b are used,
+ * generate bset instruction when Zbs present.
+ * \param [in]    a     value to change
+ * \param [in]    b     bit index
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_BSET(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBS_PRESENT)
+    unsigned long result;
+    __ASM volatile("bset %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return a | (1UL << (b & (__RISCV_XLEN - 1)));
+#endif
+}
+
+/**
+ * \brief   Clear single bit
+ * \details Clear bit \em b of \em a to 0, only low log2(XLEN) bits of \em b are used,
+ * generate bclr instruction when Zbs present.
+ * \param [in]    a     value to change
+ * \param [in]    b     bit index
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_BCLR(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBS_PRESENT)
+    unsigned long result;
+    __ASM volatile("bclr %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return a & ~(1UL << (b & (__RISCV_XLEN - 1)));
+#endif
+}
+
+/**
+ * \brief   Invert single bit
+ * \details Invert bit \em b of \em a, only low log2(XLEN) bits of \em b are used,
+ * generate binv instruction when Zbs present.
+ * \param [in]    a     value to change
+ * \param [in]    b     bit index
+ * \return              result value
+ */
+__STATIC_FORCEINLINE unsigned long __RV_BINV(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBS_PRESENT)
+    unsigned long result;
+    __ASM volatile("binv %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return a ^ (1UL << (b & (__RISCV_XLEN - 1)));
+#endif
+}
+
+/**
+ * \brief   Extract single bit
+ * \details Get bit \em b of \em a, only low log2(XLEN) bits of \em b are used,
+ * generate bext instruction when Zbs present.
+ * \param [in]    a     value to read
+ * \param [in]    b     bit index
+ * \return              0 or 1
+ */
+__STATIC_FORCEINLINE unsigned long __RV_BEXT(unsigned long a, unsigned long b)
+{
+#if defined(__RV_ZBS_PRESENT)
+    unsigned long result;
+    __ASM volatile("bext %0, %1, %2" : "=r"(result) : "r"(a), "r"(b));
+    return result;
+#else
+    return (a >> (b & (__RISCV_XLEN - 1))) & 1UL;
+#endif
+}
+/** @} */ /* End of Doxygen Group NMSIS_Core_Bitmanip_Wrapper */
+
 #ifdef __cplusplus
 }
 #endif
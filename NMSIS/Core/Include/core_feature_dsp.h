@@ -27,6 +27,8 @@
  * 1. __DSP_PRESENT:  Define whether Digital Signal Processing Unit(DSP) is present or not
  *   * 0: Not present
  *   * 1: Present
+ * 2. When __DSP_PRESENT is 1 but compiler doesn't enable P extension(__riscv_dsp not defined),
+ *    the C emulation in core_feature_dsp_emu.h is used instead of DSP instructions
  */
 #ifdef __cplusplus
  extern "C" {
@@ -36,6 +38,10 @@
 
 #if defined(__DSP_PRESENT) && (__DSP_PRESENT == 1)
 
+#if !defined(__riscv_dsp) && !defined(__ONLY_FOR_DOXYGEN_DOCUMENT_GENERATION__)
+#include "core_feature_dsp_emu.h"
+#else
+
 #if defined(__INC_INTRINSIC_API) && (__INC_INTRINSIC_API == 1)
 #include <rvp_intrinsic.h>
 #endif
@@ -18536,6 +18542,8 @@ __STATIC_FORCEINLINE unsigned long __RV_EXPD83(unsigned long a)
 /* ===== Inline Function End for A11.4. EXPD83 ===== */
 #endif /* __RISCV_XLEN == 32 */
 
+#endif /* !defined(__riscv_dsp) */
+
 /* XXXXX ARM Compatiable SIMD API XXXXX */
 /** \brief Q setting quad 8-bit saturating addition. */
 #define __QADD8(x, y)               __RV_KADD8(x, y)
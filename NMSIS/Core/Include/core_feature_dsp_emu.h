@@ -0,0 +1,1069 @@
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef __CORE_FEATURE_DSP_EMU__
+#define __CORE_FEATURE_DSP_EMU__
+
+/*!
+ * @file     core_feature_dsp_emu.h
+ * @brief    Portable C emulation of the DSP intrinsic functions in core_feature_dsp.h
+ */
+/*
+ * This header provides a pure C implementation of every __RV_xxx DSP intrinsic,
+ * following the operation description of the RISC-V P extension(0.5.x) used by
+ * core_feature_dsp.h, including the OV flag which can be read by __RV_RDOV.
+ *
+ * * When __DSP_PRESENT is 1 and the compiler doesn't support the P extension,
+ *   core_feature_dsp.h includes this header instead of the inline assembly
+ *   implementation, so DSP code can run on cores without P extension.
+ * * It doesn't depend on any other NMSIS header, so it can be included directly
+ *   on the host(such as x86 Linux) to develop and check DSP code, RV64 behavior
+ *   is emulated when long is 64-bit, otherwise RV32 behavior is emulated.
+ * * When __riscv_dsp is defined, the functions are named __RV_EMU_xxx instead,
+ *   so they can be compared with the instruction results, see test/core/test_dsp.c
+ *
+ * GCC or Clang is required, signed right shift is expected to be arithmetic.
+ */
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+#if __SIZEOF_LONG__ == 4
+#define __DSP_EMU_XLEN              32
+#else
+#define __DSP_EMU_XLEN              64
+#endif
+
+#if defined(__riscv_dsp)
+#define __DSP_EMU_FUNC(name)        __RV_EMU_##name
+#else
+#define __DSP_EMU_FUNC(name)        __RV_##name
+#endif
+
+#define __DSP_EMU_INLINE            static inline
+
+/** Emulated OV flag of ucode CSR, set by saturating operations */
+__attribute__((weak)) volatile unsigned long __dsp_emu_ov;
+
+/* ===== Internal helpers, all lane values are handled as 64-bit integer ===== */
+__DSP_EMU_INLINE int64_t __dsp_emu_lane_s(uint64_t v, unsigned int i, unsigned int w)
+{
+    return (int64_t)(v << (64 - w * (i + 1))) >> (64 - w);
+}
+
+__DSP_EMU_INLINE uint64_t __dsp_emu_lane_u(uint64_t v, unsigned int i, unsigned int w)
+{
+    return (v >> (w * i)) & ((1ULL << w) - 1);
+}
+
+__DSP_EMU_INLINE uint64_t __dsp_emu_lane_set(uint64_t v, unsigned int i, unsigned int w, int64_t x)
+{
+    return v | (((uint64_t)x & ((1ULL << w) - 1)) << (w * i));
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_sext(uint64_t v, unsigned int w)
+{
+    return (int64_t)(v << (64 - w)) >> (64 - w);
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_setov(int64_t v)
+{
+    __dsp_emu_ov = 1;
+    return v;
+}
+
+/* Saturate v to w-bit signed integer, 1 <= w <= 32 */
+__DSP_EMU_INLINE int64_t __dsp_emu_sat_s(int64_t v, unsigned int w)
+{
+    int64_t max = (int64_t)((1ULL << (w - 1)) - 1);
+
+    if (v > max) {
+        return __dsp_emu_setov(max);
+    } else if (v < -max - 1) {
+        return __dsp_emu_setov(-max - 1);
+    }
+    return v;
+}
+
+/* Saturate v to w-bit unsigned integer, 0 <= w <= 32 */
+__DSP_EMU_INLINE int64_t __dsp_emu_sat_u(int64_t v, unsigned int w)
+{
+    int64_t max = (int64_t)((1ULL << w) - 1);
+
+    if (v > max) {
+        return __dsp_emu_setov(max);
+    } else if (v < 0) {
+        return __dsp_emu_setov(0);
+    }
+    return v;
+}
+
+/* Arithmetic right shift by sh(>=1) with rounding */
+__DSP_EMU_INLINE int64_t __dsp_emu_rnd(int64_t v, unsigned int sh)
+{
+    return (v >> sh) + ((v >> (sh - 1)) & 1);
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_shl(int64_t v, unsigned int sh)
+{
+    return (int64_t)((uint64_t)v << sh);
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_kabs(int64_t v, unsigned int w)
+{
+    if (v == -(int64_t)(1ULL << (w - 1))) {
+        return __dsp_emu_setov((int64_t)(1ULL << (w - 1)) - 1);
+    }
+    return (v < 0) ? -v : v;
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_clz(uint64_t v, unsigned int w)
+{
+    int64_t cnt = 0;
+
+    while (cnt < w && ((v >> (w - 1 - cnt)) & 1) == 0) {
+        cnt++;
+    }
+    return cnt;
+}
+
+/* Q(w-1) multiply with saturation of (-1) * (-1) */
+__DSP_EMU_INLINE int64_t __dsp_emu_khm(int64_t x, int64_t y, unsigned int w)
+{
+    int64_t min = -(int64_t)(1ULL << (w - 1));
+
+    if (x == min && y == min) {
+        return __dsp_emu_setov(-min - 1);
+    }
+    return (x * y) >> (w - 1);
+}
+
+/* Q15 x Q15 doubling multiply to Q31 */
+__DSP_EMU_INLINE int64_t __dsp_emu_kdm(int64_t x, int64_t y)
+{
+    if (x == -32768 && y == -32768) {
+        return __dsp_emu_setov(0x7FFFFFFF);
+    }
+    return (x * y) * 2;
+}
+
+/* Q31 x Q15 multiply to Q31, used by KMMAWx2 and KMMWx2 */
+__DSP_EMU_INLINE int64_t __dsp_emu_kmmw2(int64_t x, int64_t y, int round)
+{
+    if (x == INT32_MIN && y == -32768) {
+        return __dsp_emu_setov(0x7FFFFFFF);
+    }
+    return round ? __dsp_emu_rnd(x * y, 15) : ((x * y) >> 15);
+}
+
+/* Saturating left shift or arithmetic right shift selected by sign of shbits-bit shift amount b */
+__DSP_EMU_INLINE int64_t __dsp_emu_kslra(int64_t v, int b, unsigned int w, unsigned int shbits, int round)
+{
+    int64_t sh = __dsp_emu_sext((uint64_t)b, shbits);
+
+    if (sh < 0) {
+        sh = -sh;
+        if (sh >= w) {
+            sh = w - 1;
+        }
+        return round ? __dsp_emu_rnd(v, sh) : (v >> sh);
+    }
+    return __dsp_emu_sat_s(__dsp_emu_shl(v, sh), w);
+}
+
+/* 128-bit accumulator used by 64-bit saturating multiply and add operations */
+typedef struct {
+    int64_t hi;
+    uint64_t lo;
+} __dsp_emu_acc_t;
+
+__DSP_EMU_INLINE void __dsp_emu_acc_add(__dsp_emu_acc_t *acc, int64_t v)
+{
+    uint64_t old = acc->lo;
+
+    acc->lo += (uint64_t)v;
+    acc->hi += ((v < 0) ? -1 : 0) + ((acc->lo < old) ? 1 : 0);
+}
+
+__DSP_EMU_INLINE int64_t __dsp_emu_acc_sat(__dsp_emu_acc_t *acc)
+{
+    if (acc->hi > 0 || (acc->hi == 0 && (acc->lo >> 63))) {
+        return __dsp_emu_setov(INT64_MAX);
+    } else if (acc->hi < -1 || (acc->hi == -1 && !(acc->lo >> 63))) {
+        return __dsp_emu_setov(INT64_MIN);
+    }
+    return (int64_t)acc->lo;
+}
+
+/* ===== Generators, operation expr is evaluated for each lane or word ===== */
+/*
+ * SIMD operation on all w-bit lanes of bits-bit register,
+ * sa/sb are signed lane values, ua/ub are unsigned lane values, i is lane index
+ */
+#define __DSP_EMU_SIMD2(name, type, bits, w, expr)                          \
+__DSP_EMU_INLINE type __DSP_EMU_FUNC(name)(type a, type b)                  \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < (bits) / (w); i++) {                                    \
+        int64_t sa = __dsp_emu_lane_s(a, i, w), sb = __dsp_emu_lane_s(b, i, w); \
+        int64_t ua = (int64_t)__dsp_emu_lane_u(a, i, w);                    \
+        int64_t ub = (int64_t)__dsp_emu_lane_u(b, i, w);                    \
+        (void)sa; (void)sb; (void)ua; (void)ub;                             \
+        r = __dsp_emu_lane_set(r, i, w, (expr));                            \
+    }                                                                       \
+    return (type)r;                                                         \
+}
+
+#define __DSP_EMU_SIMD1(name, type, bits, w, expr)                          \
+__DSP_EMU_INLINE type __DSP_EMU_FUNC(name)(type a)                          \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < (bits) / (w); i++) {                                    \
+        int64_t sa = __dsp_emu_lane_s(a, i, w);                             \
+        int64_t ua = (int64_t)__dsp_emu_lane_u(a, i, w);                    \
+        (void)sa; (void)ua;                                                 \
+        r = __dsp_emu_lane_set(r, i, w, (expr));                            \
+    }                                                                       \
+    return (type)r;                                                         \
+}
+
+/* SIMD operation with scalar b, sh is b masked to lane shift range */
+#define __DSP_EMU_SIMDS(name, type, bits, w, btype, expr)                   \
+__DSP_EMU_INLINE type __DSP_EMU_FUNC(name)(type a, btype b)                 \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i, sh = (unsigned int)b & ((w) - 1);                       \
+    for (i = 0; i < (bits) / (w); i++) {                                    \
+        int64_t sa = __dsp_emu_lane_s(a, i, w);                             \
+        int64_t ua = (int64_t)__dsp_emu_lane_u(a, i, w);                    \
+        (void)sa; (void)ua; (void)sh;                                       \
+        r = __dsp_emu_lane_set(r, i, w, (expr));                            \
+    }                                                                       \
+    return (type)r;                                                         \
+}
+
+/*
+ * Cross or straight operation on each pair of w-bit lanes,
+ * ah/al/bh/bl are signed and uah/ual/ubh/ubl are unsigned top/bottom lane values
+ */
+#define __DSP_EMU_PAIR(name, w, hexpr, lexpr)                               \
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(name)(unsigned long a, unsigned long b) \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < __DSP_EMU_XLEN / (w); i += 2) {                         \
+        int64_t ah = __dsp_emu_lane_s(a, i + 1, w), al = __dsp_emu_lane_s(a, i, w); \
+        int64_t bh = __dsp_emu_lane_s(b, i + 1, w), bl = __dsp_emu_lane_s(b, i, w); \
+        int64_t uah = (int64_t)__dsp_emu_lane_u(a, i + 1, w);               \
+        int64_t ual = (int64_t)__dsp_emu_lane_u(a, i, w);                   \
+        int64_t ubh = (int64_t)__dsp_emu_lane_u(b, i + 1, w);               \
+        int64_t ubl = (int64_t)__dsp_emu_lane_u(b, i, w);                   \
+        (void)ah; (void)al; (void)bh; (void)bl;                             \
+        (void)uah; (void)ual; (void)ubh; (void)ubl;                         \
+        r = __dsp_emu_lane_set(r, i + 1, w, (hexpr));                       \
+        r = __dsp_emu_lane_set(r, i, w, (lexpr));                           \
+    }                                                                       \
+    return r;                                                               \
+}
+
+/*
+ * Operation on each 32-bit word, wa/wb are unsigned word values, sa/sb are
+ * signed word values, a1/a0/b1/b0 are signed top/bottom halfword values
+ */
+#define __DSP_EMU_WORD_VARS                                                 \
+        uint64_t wa = __dsp_emu_lane_u((uint64_t)a, i, 32);                 \
+        uint64_t wb = __dsp_emu_lane_u((uint64_t)b, i, 32);                 \
+        int64_t sa = __dsp_emu_lane_s((uint64_t)a, i, 32);                  \
+        int64_t sb = __dsp_emu_lane_s((uint64_t)b, i, 32);                  \
+        int64_t a1 = __dsp_emu_lane_s(wa, 1, 16), a0 = __dsp_emu_lane_s(wa, 0, 16); \
+        int64_t b1 = __dsp_emu_lane_s(wb, 1, 16), b0 = __dsp_emu_lane_s(wb, 0, 16); \
+        (void)wa; (void)wb; (void)sa; (void)sb;                             \
+        (void)a1; (void)a0; (void)b1; (void)b0;
+
+#define __DSP_EMU_WORD2(name, rtype, atype, btype, expr)                    \
+__DSP_EMU_INLINE rtype __DSP_EMU_FUNC(name)(atype a, btype b)               \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {                             \
+        __DSP_EMU_WORD_VARS                                                 \
+        r = __dsp_emu_lane_set(r, i, 32, (expr));                           \
+    }                                                                       \
+    return (rtype)r;                                                        \
+}
+
+/* Same as __DSP_EMU_WORD2 with accumulator t, st is signed word value of t */
+#define __DSP_EMU_WORD3(name, rtype, ttype, abtype, expr)                   \
+__DSP_EMU_INLINE rtype __DSP_EMU_FUNC(name)(ttype t, abtype a, abtype b)    \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {                             \
+        int64_t st = __dsp_emu_lane_s((uint64_t)t, i, 32);                  \
+        __DSP_EMU_WORD_VARS                                                 \
+        r = __dsp_emu_lane_set(r, i, 32, (expr));                           \
+    }                                                                       \
+    return (rtype)r;                                                        \
+}
+
+/* 64-bit wrap-around accumulation of expr of all 32-bit words */
+#define __DSP_EMU_WORD_SUM(name, rtype, ttype, abtype, op, expr)            \
+__DSP_EMU_INLINE rtype __DSP_EMU_FUNC(name)(ttype t, abtype a, abtype b)    \
+{                                                                           \
+    uint64_t r = (uint64_t)t;                                               \
+    unsigned int i;                                                         \
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {                             \
+        __DSP_EMU_WORD_VARS                                                 \
+        r = r op (uint64_t)(expr);                                          \
+    }                                                                       \
+    return (rtype)r;                                                        \
+}
+
+/* 64-bit saturating accumulation of expr of all 32-bit words */
+#define __DSP_EMU_WORD_KSUM(name, rtype, ttype, abtype, sign, expr)         \
+__DSP_EMU_INLINE rtype __DSP_EMU_FUNC(name)(ttype t, abtype a, abtype b)    \
+{                                                                           \
+    __dsp_emu_acc_t acc = { ((int64_t)t < 0) ? -1 : 0, (uint64_t)t };       \
+    unsigned int i;                                                         \
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {                             \
+        __DSP_EMU_WORD_VARS                                                 \
+        __dsp_emu_acc_add(&acc, sign (expr));                               \
+    }                                                                       \
+    return (rtype)__dsp_emu_acc_sat(&acc);                                  \
+}
+
+/* Scalar operation on bits[31:0], the 32-bit result is sign-extended on RV64 */
+#define __DSP_EMU_SE32(v)           ((long)(int32_t)(uint32_t)(v))
+
+/* Widening multiply of each w-bit lane of 32-bit a/b, b lanes are crossed when x is 1 */
+#define __DSP_EMU_MULW(name, w, x, lane)                                    \
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(name)(unsigned int a, unsigned int b) \
+{                                                                           \
+    uint64_t r = 0;                                                         \
+    unsigned int i;                                                         \
+    for (i = 0; i < 32 / (w); i++) {                                        \
+        r = __dsp_emu_lane_set(r, i, 2 * (w), (int64_t)(lane(a, i, w) * lane(b, i ^ (x), w))); \
+    }                                                                       \
+    return r;                                                               \
+}
+
+/* Register width of XLEN SIMD operations */
+#define __DSP_EMU_N                 __DSP_EMU_XLEN
+
+/* ===== OV flag ===== */
+__DSP_EMU_INLINE void __DSP_EMU_FUNC(CLROV)(void)
+{
+    __dsp_emu_ov = 0;
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(RDOV)(void)
+{
+    return __dsp_emu_ov;
+}
+
+/* ===== SIMD 8-bit and 16-bit add, subtract and compare ===== */
+#define __DSP_EMU_SIMD_ADDSUB(w)                                                                \
+__DSP_EMU_SIMD2(ADD##w,    unsigned long, __DSP_EMU_N, w, sa + sb)                              \
+__DSP_EMU_SIMD2(SUB##w,    unsigned long, __DSP_EMU_N, w, sa - sb)                              \
+__DSP_EMU_SIMD2(KADD##w,   unsigned long, __DSP_EMU_N, w, __dsp_emu_sat_s(sa + sb, w))          \
+__DSP_EMU_SIMD2(KSUB##w,   unsigned long, __DSP_EMU_N, w, __dsp_emu_sat_s(sa - sb, w))          \
+__DSP_EMU_SIMD2(UKADD##w,  unsigned long, __DSP_EMU_N, w, __dsp_emu_sat_u(ua + ub, w))          \
+__DSP_EMU_SIMD2(UKSUB##w,  unsigned long, __DSP_EMU_N, w, __dsp_emu_sat_u(ua - ub, w))          \
+__DSP_EMU_SIMD2(RADD##w,   unsigned long, __DSP_EMU_N, w, (sa + sb) >> 1)                       \
+__DSP_EMU_SIMD2(RSUB##w,   unsigned long, __DSP_EMU_N, w, (sa - sb) >> 1)                       \
+__DSP_EMU_SIMD2(URADD##w,  unsigned long, __DSP_EMU_N, w, (ua + ub) >> 1)                       \
+__DSP_EMU_SIMD2(URSUB##w,  unsigned long, __DSP_EMU_N, w, (ua - ub) >> 1)                       \
+__DSP_EMU_SIMD2(SMAX##w,   unsigned long, __DSP_EMU_N, w, (sa > sb) ? sa : sb)                  \
+__DSP_EMU_SIMD2(SMIN##w,   unsigned long, __DSP_EMU_N, w, (sa < sb) ? sa : sb)                  \
+__DSP_EMU_SIMD2(UMAX##w,   unsigned long, __DSP_EMU_N, w, (ua > ub) ? ua : ub)                  \
+__DSP_EMU_SIMD2(UMIN##w,   unsigned long, __DSP_EMU_N, w, (ua < ub) ? ua : ub)
+
+#define __DSP_EMU_SIMD_CMP(w)                                                                   \
+__DSP_EMU_SIMD2(CMPEQ##w,  unsigned long, __DSP_EMU_N, w, -(int64_t)(ua == ub))                 \
+__DSP_EMU_SIMD2(SCMPLE##w, unsigned long, __DSP_EMU_N, w, -(int64_t)(sa <= sb))                 \
+__DSP_EMU_SIMD2(SCMPLT##w, unsigned long, __DSP_EMU_N, w, -(int64_t)(sa < sb))                  \
+__DSP_EMU_SIMD2(UCMPLE##w, unsigned long, __DSP_EMU_N, w, -(int64_t)(ua <= ub))                 \
+__DSP_EMU_SIMD2(UCMPLT##w, unsigned long, __DSP_EMU_N, w, -(int64_t)(ua < ub))                  \
+__DSP_EMU_SIMD2(KHM##w,    unsigned long, __DSP_EMU_N, w, __dsp_emu_khm(sa, sb, w))             \
+__DSP_EMU_SIMD2(KHMX##w,   unsigned long, __DSP_EMU_N, w, __dsp_emu_khm(sa, __dsp_emu_lane_s(b, i ^ 1, w), w))
+
+__DSP_EMU_SIMD_ADDSUB(8)
+__DSP_EMU_SIMD_ADDSUB(16)
+__DSP_EMU_SIMD_CMP(8)
+__DSP_EMU_SIMD_CMP(16)
+
+/* ===== SIMD 16-bit cross and straight add/subtract ===== */
+#define __DSP_EMU_SIMD_PAIR(w)                                                                  \
+__DSP_EMU_PAIR(CRAS##w,   w, ah + bl, al - bh)                                                  \
+__DSP_EMU_PAIR(CRSA##w,   w, ah - bl, al + bh)                                                  \
+__DSP_EMU_PAIR(KCRAS##w,  w, __dsp_emu_sat_s(ah + bl, w), __dsp_emu_sat_s(al - bh, w))          \
+__DSP_EMU_PAIR(KCRSA##w,  w, __dsp_emu_sat_s(ah - bl, w), __dsp_emu_sat_s(al + bh, w))          \
+__DSP_EMU_PAIR(UKCRAS##w, w, __dsp_emu_sat_u(uah + ubl, w), __dsp_emu_sat_u(ual - ubh, w))      \
+__DSP_EMU_PAIR(UKCRSA##w, w, __dsp_emu_sat_u(uah - ubl, w), __dsp_emu_sat_u(ual + ubh, w))      \
+__DSP_EMU_PAIR(RCRAS##w,  w, (ah + bl) >> 1, (al - bh) >> 1)                                    \
+__DSP_EMU_PAIR(RCRSA##w,  w, (ah - bl) >> 1, (al + bh) >> 1)                                    \
+__DSP_EMU_PAIR(URCRAS##w, w, (uah + ubl) >> 1, (ual - ubh) >> 1)                                \
+__DSP_EMU_PAIR(URCRSA##w, w, (uah - ubl) >> 1, (ual + ubh) >> 1)                                \
+__DSP_EMU_PAIR(STAS##w,   w, ah + bh, al - bl)                                                  \
+__DSP_EMU_PAIR(STSA##w,   w, ah - bh, al + bl)                                                  \
+__DSP_EMU_PAIR(KSTAS##w,  w, __dsp_emu_sat_s(ah + bh, w), __dsp_emu_sat_s(al - bl, w))          \
+__DSP_EMU_PAIR(KSTSA##w,  w, __dsp_emu_sat_s(ah - bh, w), __dsp_emu_sat_s(al + bl, w))          \
+__DSP_EMU_PAIR(UKSTAS##w, w, __dsp_emu_sat_u(uah + ubh, w), __dsp_emu_sat_u(ual - ubl, w))      \
+__DSP_EMU_PAIR(UKSTSA##w, w, __dsp_emu_sat_u(uah - ubh, w), __dsp_emu_sat_u(ual + ubl, w))      \
+__DSP_EMU_PAIR(RSTAS##w,  w, (ah + bh) >> 1, (al - bl) >> 1)                                    \
+__DSP_EMU_PAIR(RSTSA##w,  w, (ah - bh) >> 1, (al + bl) >> 1)                                    \
+__DSP_EMU_PAIR(URSTAS##w, w, (uah + ubh) >> 1, (ual - ubl) >> 1)                                \
+__DSP_EMU_PAIR(URSTSA##w, w, (uah - ubh) >> 1, (ual + ubl) >> 1)
+
+__DSP_EMU_SIMD_PAIR(16)
+
+/* ===== SIMD 8-bit and 16-bit shift ===== */
+#define __DSP_EMU_SIMD_SHIFT(w)                                                                 \
+__DSP_EMU_SIMDS(SLL##w,    unsigned long, __DSP_EMU_N, w, unsigned int, ua << sh)               \
+__DSP_EMU_SIMDS(SLLI##w,   unsigned long, __DSP_EMU_N, w, unsigned int, ua << sh)               \
+__DSP_EMU_SIMDS(SRA##w,    unsigned long, __DSP_EMU_N, w, unsigned int, sa >> sh)               \
+__DSP_EMU_SIMDS(SRAI##w,   unsigned long, __DSP_EMU_N, w, unsigned int, sa >> sh)               \
+__DSP_EMU_SIMDS(SRA##w##_U, unsigned long, __DSP_EMU_N, w, unsigned int, sh ? __dsp_emu_rnd(sa, sh) : sa) \
+__DSP_EMU_SIMDS(SRAI##w##_U, unsigned long, __DSP_EMU_N, w, unsigned int, sh ? __dsp_emu_rnd(sa, sh) : sa) \
+__DSP_EMU_SIMDS(SRL##w,    unsigned long, __DSP_EMU_N, w, unsigned int, ua >> sh)               \
+__DSP_EMU_SIMDS(SRLI##w,   unsigned long, __DSP_EMU_N, w, unsigned int, ua >> sh)               \
+__DSP_EMU_SIMDS(SRL##w##_U, unsigned long, __DSP_EMU_N, w, unsigned int, sh ? __dsp_emu_rnd(ua, sh) : ua) \
+__DSP_EMU_SIMDS(SRLI##w##_U, unsigned long, __DSP_EMU_N, w, unsigned int, sh ? __dsp_emu_rnd(ua, sh) : ua) \
+__DSP_EMU_SIMDS(KSLL##w,   unsigned long, __DSP_EMU_N, w, unsigned int, __dsp_emu_sat_s(__dsp_emu_shl(sa, sh), w)) \
+__DSP_EMU_SIMDS(KSLLI##w,  unsigned long, __DSP_EMU_N, w, unsigned int, __dsp_emu_sat_s(__dsp_emu_shl(sa, sh), w))
+
+#define __DSP_EMU_SIMD_MISC(w, shbits)                                                          \
+__DSP_EMU_SIMDS(KSLRA##w,  unsigned long, __DSP_EMU_N, w, int, __dsp_emu_kslra(sa, b, w, shbits, 0)) \
+__DSP_EMU_SIMDS(KSLRA##w##_U, unsigned long, __DSP_EMU_N, w, int, __dsp_emu_kslra(sa, b, w, shbits, 1)) \
+__DSP_EMU_SIMDS(SCLIP##w,  unsigned long, __DSP_EMU_N, w, unsigned int, __dsp_emu_sat_s(sa, sh + 1)) \
+__DSP_EMU_SIMDS(UCLIP##w,  unsigned long, __DSP_EMU_N, w, unsigned int, __dsp_emu_sat_u(sa, sh)) \
+__DSP_EMU_SIMD1(KABS##w,   unsigned long, __DSP_EMU_N, w, __dsp_emu_kabs(sa, w))                \
+__DSP_EMU_SIMD1(CLRS##w,   unsigned long, __DSP_EMU_N, w, __dsp_emu_clz(((uint64_t)(ua ^ (ua >> 1))) & ((1ULL << (w - 1)) - 1), w - 1)) \
+__DSP_EMU_SIMD1(CLO##w,    unsigned long, __DSP_EMU_N, w, __dsp_emu_clz((uint64_t)~ua & ((1ULL << w) - 1), w)) \
+__DSP_EMU_SIMD1(CLZ##w,    unsigned long, __DSP_EMU_N, w, __dsp_emu_clz((uint64_t)ua, w))
+
+__DSP_EMU_SIMD_SHIFT(8)
+__DSP_EMU_SIMD_SHIFT(16)
+__DSP_EMU_SIMD_MISC(8, 4)
+__DSP_EMU_SIMD_MISC(16, 5)
+__DSP_EMU_SIMDS(SCLIP32,   unsigned long, __DSP_EMU_N, 32, unsigned int, __dsp_emu_sat_s(sa, sh + 1))
+__DSP_EMU_SIMDS(UCLIP32,   unsigned long, __DSP_EMU_N, 32, unsigned int, __dsp_emu_sat_u(sa, sh))
+__DSP_EMU_SIMD1(CLRS32,    unsigned long, __DSP_EMU_N, 32, __dsp_emu_clz(((uint64_t)(ua ^ (ua >> 1))) & 0x7FFFFFFFULL, 31))
+__DSP_EMU_SIMD1(CLO32,     unsigned long, __DSP_EMU_N, 32, __dsp_emu_clz((uint64_t)~ua & 0xFFFFFFFFULL, 32))
+__DSP_EMU_SIMD1(CLZ32,     unsigned long, __DSP_EMU_N, 32, __dsp_emu_clz((uint64_t)ua, 32))
+
+/* ===== SIMD data movement ===== */
+__DSP_EMU_SIMD1(SWAP8,     unsigned long, __DSP_EMU_N, 8, (int64_t)__dsp_emu_lane_u(a, i ^ 1, 8))
+__DSP_EMU_SIMD1(SWAP16,    unsigned long, __DSP_EMU_N, 16, (int64_t)__dsp_emu_lane_u(a, i ^ 1, 16))
+
+/* Unpack byte x to top halfword and byte y to bottom halfword of each word */
+#define __DSP_EMU_UNPKD(xy, x, y)                                                               \
+__DSP_EMU_SIMD1(SUNPKD##xy, unsigned long, __DSP_EMU_N, 16,                                     \
+                __dsp_emu_lane_s(a, (i >> 1) * 4 + ((i & 1) ? (x) : (y)), 8))                   \
+__DSP_EMU_SIMD1(ZUNPKD##xy, unsigned long, __DSP_EMU_N, 16,                                     \
+                (int64_t)__dsp_emu_lane_u(a, (i >> 1) * 4 + ((i & 1) ? (x) : (y)), 8))
+
+__DSP_EMU_UNPKD(810, 1, 0)
+__DSP_EMU_UNPKD(820, 2, 0)
+__DSP_EMU_UNPKD(830, 3, 0)
+__DSP_EMU_UNPKD(831, 3, 1)
+__DSP_EMU_UNPKD(832, 3, 2)
+
+__DSP_EMU_WORD2(PKBB16,    unsigned long, unsigned long, unsigned long, (int64_t)((__dsp_emu_lane_u(wa, 0, 16) << 16) | __dsp_emu_lane_u(wb, 0, 16)))
+__DSP_EMU_WORD2(PKBT16,    unsigned long, unsigned long, unsigned long, (int64_t)((__dsp_emu_lane_u(wa, 0, 16) << 16) | __dsp_emu_lane_u(wb, 1, 16)))
+__DSP_EMU_WORD2(PKTB16,    unsigned long, unsigned long, unsigned long, (int64_t)((__dsp_emu_lane_u(wa, 1, 16) << 16) | __dsp_emu_lane_u(wb, 0, 16)))
+__DSP_EMU_WORD2(PKTT16,    unsigned long, unsigned long, unsigned long, (int64_t)((__dsp_emu_lane_u(wa, 1, 16) << 16) | __dsp_emu_lane_u(wb, 1, 16)))
+
+/* ===== SIMD 8-bit and 16-bit widening multiply ===== */
+__DSP_EMU_MULW(SMUL8,      8, 0, __dsp_emu_lane_s)
+__DSP_EMU_MULW(SMULX8,     8, 1, __dsp_emu_lane_s)
+__DSP_EMU_MULW(UMUL8,      8, 0, __dsp_emu_lane_u)
+__DSP_EMU_MULW(UMULX8,     8, 1, __dsp_emu_lane_u)
+__DSP_EMU_MULW(SMUL16,     16, 0, __dsp_emu_lane_s)
+__DSP_EMU_MULW(SMULX16,    16, 1, __dsp_emu_lane_s)
+__DSP_EMU_MULW(UMUL16,     16, 0, __dsp_emu_lane_u)
+__DSP_EMU_MULW(UMULX16,    16, 1, __dsp_emu_lane_u)
+
+/* ===== Signed 16-bit multiply with 32-bit add/subtract ===== */
+__DSP_EMU_WORD2(SMBB16,    long, unsigned long, unsigned long, a0 * b0)
+__DSP_EMU_WORD2(SMBT16,    long, unsigned long, unsigned long, a0 * b1)
+__DSP_EMU_WORD2(SMTT16,    long, unsigned long, unsigned long, a1 * b1)
+__DSP_EMU_WORD2(SMDS,      long, unsigned long, unsigned long, a1 * b1 - a0 * b0)
+__DSP_EMU_WORD2(SMDRS,     long, unsigned long, unsigned long, a0 * b0 - a1 * b1)
+__DSP_EMU_WORD2(SMXDS,     long, unsigned long, unsigned long, a1 * b0 - a0 * b1)
+__DSP_EMU_WORD2(KMDA,      long, unsigned long, unsigned long,
+                (wa == 0x80008000ULL && wb == 0x80008000ULL) ? __dsp_emu_setov(0x7FFFFFFF) : a1 * b1 + a0 * b0)
+__DSP_EMU_WORD2(KMXDA,     long, unsigned long, unsigned long,
+                (wa == 0x80008000ULL && wb == 0x80008000ULL) ? __dsp_emu_setov(0x7FFFFFFF) : a1 * b0 + a0 * b1)
+__DSP_EMU_WORD3(KMABB,     long, long, unsigned long, __dsp_emu_sat_s(st + a0 * b0, 32))
+__DSP_EMU_WORD3(KMABT,     long, long, unsigned long, __dsp_emu_sat_s(st + a0 * b1, 32))
+__DSP_EMU_WORD3(KMATT,     long, long, unsigned long, __dsp_emu_sat_s(st + a1 * b1, 32))
+__DSP_EMU_WORD3(KMADA,     long, long, unsigned long, __dsp_emu_sat_s(st + a1 * b1 + a0 * b0, 32))
+__DSP_EMU_WORD3(KMAXDA,    long, long, unsigned long, __dsp_emu_sat_s(st + a1 * b0 + a0 * b1, 32))
+__DSP_EMU_WORD3(KMADS,     long, long, unsigned long, __dsp_emu_sat_s(st + a1 * b1 - a0 * b0, 32))
+__DSP_EMU_WORD3(KMADRS,    long, long, unsigned long, __dsp_emu_sat_s(st + a0 * b0 - a1 * b1, 32))
+__DSP_EMU_WORD3(KMAXDS,    long, long, unsigned long, __dsp_emu_sat_s(st + a1 * b0 - a0 * b1, 32))
+__DSP_EMU_WORD3(KMSDA,     long, long, unsigned long, __dsp_emu_sat_s(st - a1 * b1 - a0 * b0, 32))
+__DSP_EMU_WORD3(KMSXDA,    long, long, unsigned long, __dsp_emu_sat_s(st - a1 * b0 - a0 * b1, 32))
+
+/* ===== Signed 32-bit x 32-bit and 32-bit x 16-bit most significant word multiply ===== */
+__DSP_EMU_WORD2(SMMUL,     long, long, long, (sa * sb) >> 32)
+__DSP_EMU_WORD2(SMMUL_U,   long, long, long, __dsp_emu_rnd(sa * sb, 32))
+__DSP_EMU_WORD2(KWMMUL,    long, long, long,
+                (sa == INT32_MIN && sb == INT32_MIN) ? __dsp_emu_setov(0x7FFFFFFF) : (sa * sb) >> 31)
+__DSP_EMU_WORD2(KWMMUL_U,  long, long, long,
+                (sa == INT32_MIN && sb == INT32_MIN) ? __dsp_emu_setov(0x7FFFFFFF) : __dsp_emu_rnd(sa * sb, 31))
+__DSP_EMU_WORD3(KMMAC,     long, long, long, __dsp_emu_sat_s(st + ((sa * sb) >> 32), 32))
+__DSP_EMU_WORD3(KMMAC_U,   long, long, long, __dsp_emu_sat_s(st + __dsp_emu_rnd(sa * sb, 32), 32))
+__DSP_EMU_WORD3(KMMSB,     long, long, long, __dsp_emu_sat_s(st - ((sa * sb) >> 32), 32))
+__DSP_EMU_WORD3(KMMSB_U,   long, long, long, __dsp_emu_sat_s(st - __dsp_emu_rnd(sa * sb, 32), 32))
+__DSP_EMU_WORD2(SMMWB,     long, long, unsigned long, (sa * b0) >> 16)
+__DSP_EMU_WORD2(SMMWB_U,   long, long, unsigned long, __dsp_emu_rnd(sa * b0, 16))
+__DSP_EMU_WORD2(SMMWT,     long, long, unsigned long, (sa * b1) >> 16)
+__DSP_EMU_WORD2(SMMWT_U,   long, long, unsigned long, __dsp_emu_rnd(sa * b1, 16))
+__DSP_EMU_WORD2(KMMWB2,    long, long, unsigned long, __dsp_emu_kmmw2(sa, b0, 0))
+__DSP_EMU_WORD2(KMMWB2_U,  long, long, unsigned long, __dsp_emu_kmmw2(sa, b0, 1))
+__DSP_EMU_WORD2(KMMWT2,    long, long, unsigned long, __dsp_emu_kmmw2(sa, b1, 0))
+__DSP_EMU_WORD2(KMMWT2_U,  long, long, unsigned long, __dsp_emu_kmmw2(sa, b1, 1))
+__DSP_EMU_WORD3(KMMAWB,    long, long, unsigned long, __dsp_emu_sat_s(st + ((sa * b0) >> 16), 32))
+__DSP_EMU_WORD3(KMMAWB_U,  long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_rnd(sa * b0, 16), 32))
+__DSP_EMU_WORD3(KMMAWT,    long, long, unsigned long, __dsp_emu_sat_s(st + ((sa * b1) >> 16), 32))
+__DSP_EMU_WORD3(KMMAWT_U,  long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_rnd(sa * b1, 16), 32))
+__DSP_EMU_WORD3(KMMAWB2,   long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kmmw2(sa, b0, 0), 32))
+__DSP_EMU_WORD3(KMMAWB2_U, long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kmmw2(sa, b0, 1), 32))
+__DSP_EMU_WORD3(KMMAWT2,   long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kmmw2(sa, b1, 0), 32))
+__DSP_EMU_WORD3(KMMAWT2_U, long, long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kmmw2(sa, b1, 1), 32))
+
+/* ===== 8-bit multiply with 32-bit add ===== */
+#define __DSP_EMU_MAQA(la, lb)      (la(wa, 0, 8) * lb(wb, 0, 8) + la(wa, 1, 8) * lb(wb, 1, 8) + \
+                                     la(wa, 2, 8) * lb(wb, 2, 8) + la(wa, 3, 8) * lb(wb, 3, 8))
+__DSP_EMU_WORD3(SMAQA,     long, long, unsigned long, st + __DSP_EMU_MAQA(__dsp_emu_lane_s, __dsp_emu_lane_s))
+__DSP_EMU_WORD3(SMAQA_SU,  long, long, unsigned long, st + __DSP_EMU_MAQA(__dsp_emu_lane_s, (int64_t)__dsp_emu_lane_u))
+__DSP_EMU_WORD3(UMAQA,     unsigned long, unsigned long, unsigned long,
+                st + (int64_t)__DSP_EMU_MAQA(__dsp_emu_lane_u, __dsp_emu_lane_u))
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PBSAD)(unsigned long a, unsigned long b)
+{
+    unsigned long r = 0;
+    unsigned int i;
+
+    for (i = 0; i < __DSP_EMU_XLEN / 8; i++) {
+        int64_t d = (int64_t)__dsp_emu_lane_u(a, i, 8) - (int64_t)__dsp_emu_lane_u(b, i, 8);
+        r += (unsigned long)((d < 0) ? -d : d);
+    }
+    return r;
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PBSADA)(unsigned long t, unsigned long a, unsigned long b)
+{
+    return t + __DSP_EMU_FUNC(PBSAD)(a, b);
+}
+
+/* ===== 64-bit add/subtract ===== */
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(ADD64)(unsigned long long a, unsigned long long b)
+{
+    return a + b;
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(SUB64)(unsigned long long a, unsigned long long b)
+{
+    return a - b;
+}
+
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(KADD64)(long long a, long long b)
+{
+    __dsp_emu_acc_t acc = { (a < 0) ? -1 : 0, (uint64_t)a };
+
+    __dsp_emu_acc_add(&acc, b);
+    return __dsp_emu_acc_sat(&acc);
+}
+
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(KSUB64)(long long a, long long b)
+{
+    __dsp_emu_acc_t acc = { (a < 0) ? -1 : 0, (uint64_t)a };
+
+    if (b == INT64_MIN) {
+        /* -b is 2^63, add it as 2^62 twice */
+        __dsp_emu_acc_add(&acc, INT64_C(1) << 62);
+        __dsp_emu_acc_add(&acc, INT64_C(1) << 62);
+    } else {
+        __dsp_emu_acc_add(&acc, -b);
+    }
+    return __dsp_emu_acc_sat(&acc);
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(UKADD64)(unsigned long long a, unsigned long long b)
+{
+    if (a + b < a) {
+        return (unsigned long long)__dsp_emu_setov(-1);
+    }
+    return a + b;
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(UKSUB64)(unsigned long long a, unsigned long long b)
+{
+    if (a < b) {
+        return (unsigned long long)__dsp_emu_setov(0);
+    }
+    return a - b;
+}
+
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(RADD64)(long long a, long long b)
+{
+    return (a >> 1) + (b >> 1) + (a & b & 1);
+}
+
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(RSUB64)(long long a, long long b)
+{
+    return (a >> 1) - (b >> 1) - (~a & b & 1);
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(URADD64)(unsigned long long a, unsigned long long b)
+{
+    return (a >> 1) + (b >> 1) + (a & b & 1);
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(URSUB64)(unsigned long long a, unsigned long long b)
+{
+    return ((a - b) >> 1) | ((a < b) ? (1ULL << 63) : 0);
+}
+
+/* ===== 32-bit multiply with 64-bit add/subtract ===== */
+__DSP_EMU_WORD_SUM(SMAR64,  long long, long long, long, +, sa * sb)
+__DSP_EMU_WORD_SUM(SMSR64,  long long, long long, long, -, sa * sb)
+__DSP_EMU_WORD_SUM(UMAR64,  unsigned long long, unsigned long long, unsigned long, +, wa * wb)
+__DSP_EMU_WORD_SUM(UMSR64,  unsigned long long, unsigned long long, unsigned long, -, wa * wb)
+__DSP_EMU_WORD_KSUM(KMAR64, long long, long long, long, +, sa * sb)
+__DSP_EMU_WORD_KSUM(KMSR64, long long, long long, long, -, sa * sb)
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(UKMAR64)(unsigned long long t, unsigned long a, unsigned long b)
+{
+    unsigned int i, ov = 0;
+
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {
+        uint64_t p = __dsp_emu_lane_u(a, i, 32) * __dsp_emu_lane_u(b, i, 32);
+        ov |= (t + p < t);
+        t += p;
+    }
+    return ov ? (unsigned long long)__dsp_emu_setov(-1) : t;
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(UKMSR64)(unsigned long long t, unsigned long a, unsigned long b)
+{
+    unsigned int i, ov = 0;
+
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {
+        uint64_t p = __dsp_emu_lane_u(a, i, 32) * __dsp_emu_lane_u(b, i, 32);
+        ov |= (t < p);
+        t -= p;
+    }
+    return ov ? (unsigned long long)__dsp_emu_setov(0) : t;
+}
+
+__DSP_EMU_INLINE unsigned long long __DSP_EMU_FUNC(MULR64)(unsigned long a, unsigned long b)
+{
+    return (uint64_t)(uint32_t)a * (uint32_t)b;
+}
+
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(MULSR64)(long a, long b)
+{
+    return (int64_t)(int32_t)a * (int32_t)b;
+}
+
+/* ===== Signed 16-bit multiply with 64-bit add/subtract ===== */
+__DSP_EMU_INLINE long long __DSP_EMU_FUNC(SMAL)(long long a, unsigned long b)
+{
+    uint64_t r = (uint64_t)a;
+    unsigned int i;
+
+    for (i = 0; i < __DSP_EMU_XLEN / 32; i++) {
+        r += (uint64_t)(__dsp_emu_lane_s(b, 2 * i + 1, 16) * __dsp_emu_lane_s(b, 2 * i, 16));
+    }
+    return (long long)r;
+}
+
+__DSP_EMU_WORD_SUM(SMALBB,  long long, long long, unsigned long, +, a0 * b0)
+__DSP_EMU_WORD_SUM(SMALBT,  long long, long long, unsigned long, +, a0 * b1)
+__DSP_EMU_WORD_SUM(SMALTT,  long long, long long, unsigned long, +, a1 * b1)
+__DSP_EMU_WORD_SUM(SMALDA,  long long, long long, unsigned long, +, a0 * b0 + a1 * b1)
+__DSP_EMU_WORD_SUM(SMALXDA, long long, long long, unsigned long, +, a0 * b1 + a1 * b0)
+__DSP_EMU_WORD_SUM(SMALDS,  long long, long long, unsigned long, +, a1 * b1 - a0 * b0)
+__DSP_EMU_WORD_SUM(SMALDRS, long long, long long, unsigned long, +, a0 * b0 - a1 * b1)
+__DSP_EMU_WORD_SUM(SMALXDS, long long, long long, unsigned long, +, a1 * b0 - a0 * b1)
+__DSP_EMU_WORD_SUM(SMSLDA,  long long, long long, unsigned long, -, a0 * b0 + a1 * b1)
+__DSP_EMU_WORD_SUM(SMSLXDA, long long, long long, unsigned long, -, a0 * b1 + a1 * b0)
+
+/* ===== Q15/Q31 scalar operations on bits[31:0] ===== */
+#define __DSP_EMU_SCALAR_Q15(op, xa, xb)                                                        \
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KDM##op)(unsigned int a, unsigned int b)                   \
+{                                                                                               \
+    return __DSP_EMU_SE32(__dsp_emu_kdm(__dsp_emu_lane_s(a, xa, 16), __dsp_emu_lane_s(b, xb, 16))); \
+}                                                                                               \
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KDMA##op)(long t, unsigned int a, unsigned int b)          \
+{                                                                                               \
+    return __DSP_EMU_SE32(__dsp_emu_sat_s((int32_t)t +                                          \
+           __dsp_emu_kdm(__dsp_emu_lane_s(a, xa, 16), __dsp_emu_lane_s(b, xb, 16)), 32));        \
+}                                                                                               \
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KHM##op)(unsigned int a, unsigned int b)                   \
+{                                                                                               \
+    return __DSP_EMU_SE32(__dsp_emu_khm(__dsp_emu_lane_s(a, xa, 16), __dsp_emu_lane_s(b, xb, 16), 16)); \
+}
+
+__DSP_EMU_SCALAR_Q15(BB, 0, 0)
+__DSP_EMU_SCALAR_Q15(BT, 0, 1)
+__DSP_EMU_SCALAR_Q15(TT, 1, 1)
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KADDH)(int a, int b)
+{
+    return __dsp_emu_sat_s((int64_t)a + b, 16);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSUBH)(int a, int b)
+{
+    return __dsp_emu_sat_s((int64_t)a - b, 16);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KADDW)(int a, int b)
+{
+    return __dsp_emu_sat_s((int64_t)a + b, 32);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSUBW)(int a, int b)
+{
+    return __dsp_emu_sat_s((int64_t)a - b, 32);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(UKADDH)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)(long)(int16_t)__dsp_emu_sat_u((int64_t)a + b, 16);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(UKSUBH)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)(long)(int16_t)__dsp_emu_sat_u((int64_t)a - b, 16);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(UKADDW)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)__DSP_EMU_SE32(__dsp_emu_sat_u((int64_t)a + b, 32));
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(UKSUBW)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)__DSP_EMU_SE32(__dsp_emu_sat_u((int64_t)a - b, 32));
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSLLW)(long a, unsigned int b)
+{
+    return __DSP_EMU_SE32(__dsp_emu_sat_s(__dsp_emu_shl((int32_t)a, b & 0x1F), 32));
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSLLIW)(long a, unsigned int b)
+{
+    return __DSP_EMU_FUNC(KSLLW)(a, b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSLRAW)(int a, int b)
+{
+    return __DSP_EMU_SE32(__dsp_emu_kslra(a, b, 32, 6, 0));
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KSLRAW_U)(int a, int b)
+{
+    return __DSP_EMU_SE32(__dsp_emu_kslra(a, b, 32, 6, 1));
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(KABSW)(signed long a)
+{
+    return (unsigned long)__DSP_EMU_SE32(__dsp_emu_kabs((int32_t)a, 32));
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(MAXW)(int a, int b)
+{
+    return (a > b) ? a : b;
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(MINW)(int a, int b)
+{
+    return (a < b) ? a : b;
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(RADDW)(int a, int b)
+{
+    return (long)(((int64_t)a + b) >> 1);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(RSUBW)(int a, int b)
+{
+    return (long)(((int64_t)a - b) >> 1);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(URADDW)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)__DSP_EMU_SE32(((int64_t)a + b) >> 1);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(URSUBW)(unsigned int a, unsigned int b)
+{
+    return (unsigned long)__DSP_EMU_SE32(((int64_t)a - b) >> 1);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(MADDR32)(unsigned long t, unsigned long a, unsigned long b)
+{
+    return (unsigned long)__DSP_EMU_SE32((uint32_t)t + (uint32_t)a * (uint32_t)b);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(MSUBR32)(unsigned long t, unsigned long a, unsigned long b)
+{
+    return (unsigned long)__DSP_EMU_SE32((uint32_t)t - (uint32_t)a * (uint32_t)b);
+}
+
+/* ===== Miscellaneous XLEN operations ===== */
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(AVE)(long a, long b)
+{
+    return (a >> 1) + (b >> 1) + (((a & 1) + (b & 1) + 1) >> 1);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SRA_U)(long a, unsigned int b)
+{
+    unsigned int sh = b & (__DSP_EMU_XLEN - 1);
+
+    return sh ? (a >> sh) + ((a >> (sh - 1)) & 1) : a;
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SRAI_U)(long a, unsigned int b)
+{
+    return __DSP_EMU_FUNC(SRA_U)(a, b);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(BITREV)(unsigned long a, unsigned long b)
+{
+    unsigned int i, msb = b & (__DSP_EMU_XLEN - 1);
+    unsigned long r = 0;
+
+    for (i = 0; i <= msb; i++) {
+        r |= ((a >> i) & 1UL) << (msb - i);
+    }
+    return r;
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(BITREVI)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_FUNC(BITREV)(a, b);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(BPICK)(unsigned long a, unsigned long b, unsigned long c)
+{
+    return (a & c) | (b & ~c);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(INSB)(unsigned long t, unsigned long a, unsigned long b)
+{
+    unsigned int sh = (b & (__DSP_EMU_XLEN / 8 - 1)) * 8;
+
+    return (t & ~(0xFFUL << sh)) | ((a & 0xFFUL) << sh);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(WEXT)(long long a, unsigned int b)
+{
+    return (unsigned long)__DSP_EMU_SE32((unsigned long long)a >> (b & 0x1F));
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(WEXTI)(long long a, unsigned int b)
+{
+    return __DSP_EMU_FUNC(WEXT)(a, b);
+}
+
+#if __DSP_EMU_XLEN == 64
+/* ===== RV64 only: SIMD 32-bit operations ===== */
+__DSP_EMU_SIMD2(ADD32,     unsigned long, 64, 32, sa + sb)
+__DSP_EMU_SIMD2(SUB32,     unsigned long, 64, 32, sa - sb)
+__DSP_EMU_SIMD2(KADD32,    unsigned long, 64, 32, __dsp_emu_sat_s(sa + sb, 32))
+__DSP_EMU_SIMD2(KSUB32,    unsigned long, 64, 32, __dsp_emu_sat_s(sa - sb, 32))
+__DSP_EMU_SIMD2(UKADD32,   unsigned long, 64, 32, __dsp_emu_sat_u(ua + ub, 32))
+__DSP_EMU_SIMD2(UKSUB32,   unsigned long, 64, 32, __dsp_emu_sat_u(ua - ub, 32))
+__DSP_EMU_SIMD2(RADD32,    unsigned long, 64, 32, (sa + sb) >> 1)
+__DSP_EMU_SIMD2(RSUB32,    unsigned long, 64, 32, (sa - sb) >> 1)
+__DSP_EMU_SIMD2(URADD32,   unsigned long, 64, 32, (ua + ub) >> 1)
+__DSP_EMU_SIMD2(URSUB32,   unsigned long, 64, 32, (ua - ub) >> 1)
+__DSP_EMU_SIMD2(SMAX32,    unsigned long, 64, 32, (sa > sb) ? sa : sb)
+__DSP_EMU_SIMD2(SMIN32,    unsigned long, 64, 32, (sa < sb) ? sa : sb)
+__DSP_EMU_SIMD2(UMAX32,    unsigned long, 64, 32, (ua > ub) ? ua : ub)
+__DSP_EMU_SIMD2(UMIN32,    unsigned long, 64, 32, (ua < ub) ? ua : ub)
+__DSP_EMU_SIMD1(KABS32,    unsigned long, 64, 32, __dsp_emu_kabs(sa, 32))
+
+__DSP_EMU_SIMD_PAIR(32)
+
+__DSP_EMU_SIMDS(SLL32,     unsigned long, 64, 32, unsigned int, ua << sh)
+__DSP_EMU_SIMDS(SLLI32,    unsigned long, 64, 32, unsigned int, ua << sh)
+__DSP_EMU_SIMDS(SRA32,     unsigned long, 64, 32, unsigned int, sa >> sh)
+__DSP_EMU_SIMDS(SRAI32,    unsigned long, 64, 32, unsigned int, sa >> sh)
+__DSP_EMU_SIMDS(SRA32_U,   unsigned long, 64, 32, unsigned int, sh ? __dsp_emu_rnd(sa, sh) : sa)
+__DSP_EMU_SIMDS(SRAI32_U,  unsigned long, 64, 32, unsigned int, sh ? __dsp_emu_rnd(sa, sh) : sa)
+__DSP_EMU_SIMDS(SRL32,     unsigned long, 64, 32, unsigned int, ua >> sh)
+__DSP_EMU_SIMDS(SRLI32,    unsigned long, 64, 32, unsigned int, ua >> sh)
+__DSP_EMU_SIMDS(SRL32_U,   unsigned long, 64, 32, unsigned int, sh ? __dsp_emu_rnd(ua, sh) : ua)
+__DSP_EMU_SIMDS(SRLI32_U,  unsigned long, 64, 32, unsigned int, sh ? __dsp_emu_rnd(ua, sh) : ua)
+__DSP_EMU_SIMDS(KSLL32,    unsigned long, 64, 32, unsigned int, __dsp_emu_sat_s(__dsp_emu_shl(sa, sh), 32))
+__DSP_EMU_SIMDS(KSLLI32,   unsigned long, 64, 32, unsigned int, __dsp_emu_sat_s(__dsp_emu_shl(sa, sh), 32))
+__DSP_EMU_SIMDS(KSLRA32,   unsigned long, 64, 32, int, __dsp_emu_kslra(sa, b, 32, 6, 0))
+__DSP_EMU_SIMDS(KSLRA32_U, unsigned long, 64, 32, int, __dsp_emu_kslra(sa, b, 32, 6, 1))
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SRAIW_U)(int a, unsigned int b)
+{
+    unsigned int sh = b & 0x1F;
+
+    return __DSP_EMU_SE32(sh ? __dsp_emu_rnd(a, sh) : a);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PKBB32)(unsigned long a, unsigned long b)
+{
+    return (a << 32) | (b & 0xFFFFFFFFUL);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PKBT32)(unsigned long a, unsigned long b)
+{
+    return (a << 32) | (b >> 32);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PKTB32)(unsigned long a, unsigned long b)
+{
+    return (a & 0xFFFFFFFF00000000UL) | (b & 0xFFFFFFFFUL);
+}
+
+__DSP_EMU_INLINE unsigned long __DSP_EMU_FUNC(PKTT32)(unsigned long a, unsigned long b)
+{
+    return (a & 0xFFFFFFFF00000000UL) | (b >> 32);
+}
+
+/* Q15 operations on each 32-bit word */
+__DSP_EMU_WORD2(KDMBB16,   unsigned long, unsigned long, unsigned long, __dsp_emu_kdm(a0, b0))
+__DSP_EMU_WORD2(KDMBT16,   unsigned long, unsigned long, unsigned long, __dsp_emu_kdm(a0, b1))
+__DSP_EMU_WORD2(KDMTT16,   unsigned long, unsigned long, unsigned long, __dsp_emu_kdm(a1, b1))
+__DSP_EMU_WORD3(KDMABB16,  unsigned long, unsigned long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kdm(a0, b0), 32))
+__DSP_EMU_WORD3(KDMABT16,  unsigned long, unsigned long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kdm(a0, b1), 32))
+__DSP_EMU_WORD3(KDMATT16,  unsigned long, unsigned long, unsigned long, __dsp_emu_sat_s(st + __dsp_emu_kdm(a1, b1), 32))
+__DSP_EMU_WORD2(KHMBB16,   unsigned long, unsigned long, unsigned long, __dsp_emu_khm(a0, b0, 16))
+__DSP_EMU_WORD2(KHMBT16,   unsigned long, unsigned long, unsigned long, __dsp_emu_khm(a0, b1, 16))
+__DSP_EMU_WORD2(KHMTT16,   unsigned long, unsigned long, unsigned long, __dsp_emu_khm(a1, b1, 16))
+
+/* Signed 32-bit multiply with 64-bit add/subtract, using W[1] and W[0] */
+#define __DSP_EMU_W1(v)             __dsp_emu_lane_s(v, 1, 32)
+#define __DSP_EMU_W0(v)             __dsp_emu_lane_s(v, 0, 32)
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMBB32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W0(a) * __DSP_EMU_W0(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMBT32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W0(a) * __DSP_EMU_W1(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMTT32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W1(a) * __DSP_EMU_W1(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMDS32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W1(a) * __DSP_EMU_W1(b) - __DSP_EMU_W0(a) * __DSP_EMU_W0(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMDRS32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W0(a) * __DSP_EMU_W0(b) - __DSP_EMU_W1(a) * __DSP_EMU_W1(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(SMXDS32)(unsigned long a, unsigned long b)
+{
+    return __DSP_EMU_W1(a) * __DSP_EMU_W0(b) - __DSP_EMU_W0(a) * __DSP_EMU_W1(b);
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KMDA32)(unsigned long a, unsigned long b)
+{
+    if (a == 0x8000000080000000UL && b == 0x8000000080000000UL) {
+        return __dsp_emu_setov(INT64_MAX);
+    }
+    return (long)((uint64_t)(__DSP_EMU_W1(a) * __DSP_EMU_W1(b)) + (uint64_t)(__DSP_EMU_W0(a) * __DSP_EMU_W0(b)));
+}
+
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(KMXDA32)(unsigned long a, unsigned long b)
+{
+    if (a == 0x8000000080000000UL && b == 0x8000000080000000UL) {
+        return __dsp_emu_setov(INT64_MAX);
+    }
+    return (long)((uint64_t)(__DSP_EMU_W1(a) * __DSP_EMU_W0(b)) + (uint64_t)(__DSP_EMU_W0(a) * __DSP_EMU_W1(b)));
+}
+
+/* t + p1 + p0 with 64-bit saturation */
+__DSP_EMU_INLINE long __dsp_emu_kma32(long t, int64_t p1, int64_t p0)
+{
+    __dsp_emu_acc_t acc = { (t < 0) ? -1 : 0, (uint64_t)t };
+
+    __dsp_emu_acc_add(&acc, p1);
+    __dsp_emu_acc_add(&acc, p0);
+    return __dsp_emu_acc_sat(&acc);
+}
+
+#define __DSP_EMU_KMA32(name, p1, p0)                                                           \
+__DSP_EMU_INLINE long __DSP_EMU_FUNC(name)(long t, unsigned long a, unsigned long b)            \
+{                                                                                               \
+    return __dsp_emu_kma32(t, p1, p0);                                                          \
+}
+
+__DSP_EMU_KMA32(KMABB32,  0, __DSP_EMU_W0(a) * __DSP_EMU_W0(b))
+__DSP_EMU_KMA32(KMABT32,  0, __DSP_EMU_W0(a) * __DSP_EMU_W1(b))
+__DSP_EMU_KMA32(KMATT32,  0, __DSP_EMU_W1(a) * __DSP_EMU_W1(b))
+__DSP_EMU_KMA32(KMADA32,  __DSP_EMU_W1(a) * __DSP_EMU_W1(b), __DSP_EMU_W0(a) * __DSP_EMU_W0(b))
+__DSP_EMU_KMA32(KMAXDA32, __DSP_EMU_W1(a) * __DSP_EMU_W0(b), __DSP_EMU_W0(a) * __DSP_EMU_W1(b))
+__DSP_EMU_KMA32(KMADS32,  __DSP_EMU_W1(a) * __DSP_EMU_W1(b), -(__DSP_EMU_W0(a) * __DSP_EMU_W0(b)))
+__DSP_EMU_KMA32(KMADRS32, __DSP_EMU_W0(a) * __DSP_EMU_W0(b), -(__DSP_EMU_W1(a) * __DSP_EMU_W1(b)))
+__DSP_EMU_KMA32(KMAXDS32, __DSP_EMU_W1(a) * __DSP_EMU_W0(b), -(__DSP_EMU_W0(a) * __DSP_EMU_W1(b)))
+__DSP_EMU_KMA32(KMSDA32,  -(__DSP_EMU_W1(a) * __DSP_EMU_W1(b)), -(__DSP_EMU_W0(a) * __DSP_EMU_W0(b)))
+__DSP_EMU_KMA32(KMSXDA32, -(__DSP_EMU_W1(a) * __DSP_EMU_W0(b)), -(__DSP_EMU_W0(a) * __DSP_EMU_W1(b)))
+#endif /* __DSP_EMU_XLEN == 64 */
+
+#if __DSP_EMU_XLEN == 32
+/* ===== RV32 only: 64-bit SIMD operations on register pair ===== */
+__DSP_EMU_SIMD2(DKADD8,    unsigned long long, 64, 8, __dsp_emu_sat_s(sa + sb, 8))
+__DSP_EMU_SIMD2(DKADD16,   unsigned long long, 64, 16, __dsp_emu_sat_s(sa + sb, 16))
+__DSP_EMU_SIMD2(DKSUB8,    unsigned long long, 64, 8, __dsp_emu_sat_s(sa - sb, 8))
+__DSP_EMU_SIMD2(DKSUB16,   unsigned long long, 64, 16, __dsp_emu_sat_s(sa - sb, 16))
+__DSP_EMU_SIMD2(DKHM8,     unsigned long long, 64, 8, __dsp_emu_khm(sa, sb, 8))
+__DSP_EMU_SIMD2(DKHM16,    unsigned long long, 64, 16, __dsp_emu_khm(sa, sb, 16))
+__DSP_EMU_SIMD1(DKABS8,    unsigned long long, 64, 8, __dsp_emu_kabs(sa, 8))
+__DSP_EMU_SIMD1(DKABS16,   unsigned long long, 64, 16, __dsp_emu_kabs(sa, 16))
+__DSP_EMU_SIMDS(DKSLRA8,   unsigned long long, 64, 8, int, __dsp_emu_kslra(sa, b, 8, 4, 0))
+__DSP_EMU_SIMDS(DKSLRA16,  unsigned long long, 64, 16, int, __dsp_emu_kslra(sa, b, 16, 5, 0))
+
+__DSP_EMU_SIMD1(EXPD80,    unsigned long, 32, 8, (int64_t)__dsp_emu_lane_u(a, 0, 8))
+__DSP_EMU_SIMD1(EXPD81,    unsigned long, 32, 8, (int64_t)__dsp_emu_lane_u(a, 1, 8))
+__DSP_EMU_SIMD1(EXPD82,    unsigned long, 32, 8, (int64_t)__dsp_emu_lane_u(a, 2, 8))
+__DSP_EMU_SIMD1(EXPD83,    unsigned long, 32, 8, (int64_t)__dsp_emu_lane_u(a, 3, 8))
+#endif /* __DSP_EMU_XLEN == 32 */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __CORE_FEATURE_DSP_EMU__ */
@@ -43,6 +43,7 @@
 #define MSTATUS_HPIE        0x00000040
 #define MSTATUS_MPIE        0x00000080
 #define MSTATUS_SPP         0x00000100
+#define MSTATUS_VS          0x00000600
 #define MSTATUS_MPP         0x00001800
 #define MSTATUS_FS          0x00006000
 #define MSTATUS_XS          0x00018000
@@ -57,6 +58,10 @@
 #define MSTATUS_FS_CLEAN    0x00004000
 #define MSTATUS_FS_DIRTY    0x00006000
 
+#define MSTATUS_VS_INITIAL  0x00000200
+#define MSTATUS_VS_CLEAN    0x00000400
+#define MSTATUS_VS_DIRTY    0x00000600
+
 #define SSTATUS_UIE         0x00000001
 #define SSTATUS_SIE         0x00000002
 #define SSTATUS_UPIE        0x00000010
@@ -173,6 +178,11 @@
 
 #define MSUBM_PTYP                  (0x3<<8)
 #define MSUBM_TYP                   (0x3<<6)
+#define MSUBM_TYP_IRQ               (0x1<<6)
+#define MSUBM_TYP_EXC               (0x2<<6)
+#define MSUBM_TYP_NMI               (0x3<<6)
+
+#define MINTSTATUS_MIL              (0xFFUL<<24)
 
 #define MDCAUSE_MDCAUSE             (0x3)
 
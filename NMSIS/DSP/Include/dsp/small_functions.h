@@ -0,0 +1,283 @@
+/******************************************************************************
+ * @file     small_functions.h
+ * @brief    Public header file for NMSIS DSP Library
+ * @version  V1.0.0
+ * @date     19 October 2026
+ * Target Processor: RISC-V Cores
+ ******************************************************************************/
+/*
+ * Copyright (c) 2019 Nuclei Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#ifndef _SMALL_FUNCTIONS_H_
+#define _SMALL_FUNCTIONS_H_
+
+#include "riscv_math_types.h"
+#include "riscv_math_memory.h"
+
+#include "dsp/none.h"
+#include "dsp/utils.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/**
+ * @defgroup groupSmall Small Size Functions
+ *
+ * Header only versions of FIR, biquad and matrix functions for a few taps,
+ * stages or rows, which are used in latency critical control loops.
+ *
+ * They take pointers to coefficients and states instead of instance structures,
+ * and are always inlined, so when the size arguments are compile time constants,
+ * the loops are fully unrolled by compiler, and there is no function call or
+ * loop setup overhead. Coefficients use the same layout as the library functions,
+ * so they can be shared with the library functions. The biquad state has the same
+ * layout as \ref riscv_biquad_cascade_df2T_f32, but the FIR state only keeps the
+ * last numTaps samples, while the state of \ref riscv_fir_f32 is
+ * numTaps+blockSize-1 long, so FIR states can't be exchanged.
+ *
+ * For big sizes, please use the library functions, which are faster and smaller.
+ */
+
+#ifndef RISCV_SMALL_UNROLL
+#if defined(__GNUC__)
+/** Ask compiler to fully unroll the following loop with constant trip count */
+#define RISCV_SMALL_UNROLL          _Pragma("GCC unroll 16")
+#else
+#define RISCV_SMALL_UNROLL
+#endif
+#endif
+
+  /**
+   * @ingroup groupSmall
+   */
+
+  /**
+   * @addtogroup SmallFIR
+   * @{
+   */
+
+  /**
+   * @brief         Process one sample with small floating-point FIR filter.
+   * @param[in]     pCoeffs  points to the coefficients in time reversed order, same as \ref riscv_fir_f32, length numTaps.
+   * @param[in,out] pState   points to the state, oldest sample first, length numTaps, initialized to zero.
+   * @param[in]     in       input sample to process.
+   * @param[in]     numTaps  number of filter coefficients, must be at least 1, should be a compile time constant.
+   * @return        processed output sample, 0 when numTaps is 0.
+   */
+  __STATIC_FORCEINLINE float32_t riscv_fir_small_f32(
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t in,
+        uint32_t numTaps)
+  {
+    float32_t acc = 0.0f;
+    uint32_t i;
+
+    /* numTaps - 1 below would wrap around and write before pState */
+    if (numTaps == 0U)
+    {
+      return (acc);
+    }
+
+    /* Shift state, the newest sample is pState[numTaps - 1] */
+    RISCV_SMALL_UNROLL
+    for (i = 0; i < numTaps - 1; i++)
+    {
+      pState[i] = pState[i + 1];
+    }
+    pState[numTaps - 1] = in;
+
+    RISCV_SMALL_UNROLL
+    for (i = 0; i < numTaps; i++)
+    {
+      acc += pCoeffs[i] * pState[i];
+    }
+    return (acc);
+  }
+
+  /**
+   * @brief         Process a block of samples with small floating-point FIR filter.
+   * @param[in]     pCoeffs    points to the coefficients in time reversed order, length numTaps.
+   * @param[in,out] pState     points to the state, oldest sample first, length numTaps, initialized to zero.
+   * @param[in]     pSrc       points to the block of input data.
+   * @param[out]    pDst       points to the block of output data.
+   * @param[in]     blockSize  number of samples to process.
+   * @param[in]     numTaps    number of filter coefficients, must be at least 1, should be a compile time constant.
+   */
+  __STATIC_FORCEINLINE void riscv_fir_small_block_f32(
+  const float32_t * pCoeffs,
+        float32_t * pState,
+  const float32_t * pSrc,
+        float32_t * pDst,
+        uint32_t blockSize,
+        uint32_t numTaps)
+  {
+    uint32_t n;
+
+    for (n = 0; n < blockSize; n++)
+    {
+      pDst[n] = riscv_fir_small_f32(pCoeffs, pState, pSrc[n], numTaps);
+    }
+  }
+
+  /**
+   * @} end of SmallFIR group
+   */
+
+  /**
+   * @ingroup groupSmall
+   */
+
+  /**
+   * @addtogroup SmallBiquad
+   * @{
+   */
+
+  /**
+   * @brief         Process one sample with small floating-point transposed direct form II biquad cascade filter.
+   * @param[in]     pCoeffs    points to the coefficients {b10, b11, b12, a11, a12, b20, ...}, same as
+   *                           \ref riscv_biquad_cascade_df2T_f32, length 5*numStages.
+   * @param[in,out] pState     points to the state {d11, d12, d21, d22, ...}, length 2*numStages, initialized to zero.
+   * @param[in]     in         input sample to process.
+   * @param[in]     numStages  number of 2nd order stages, should be a compile time constant.
+   * @return        processed output sample.
+   */
+  __STATIC_FORCEINLINE float32_t riscv_biquad_cascade_df2T_small_f32(
+  const float32_t * pCoeffs,
+        float32_t * pState,
+        float32_t in,
+        uint32_t numStages)
+  {
+    float32_t out = in;
+    uint32_t i;
+
+    RISCV_SMALL_UNROLL
+    for (i = 0; i < numStages; i++)
+    {
+      const float32_t *c = pCoeffs + 5 * i;
+      float32_t *d = pState + 2 * i;
+
+      /* y[n] = b0 * x[n] + d1, feedback coefficients a1 and a2 are already negated */
+      in = out;
+      out = c[0] * in + d[0];
+      d[0] = c[1] * in + c[3] * out + d[1];
+      d[1] = c[2] * in + c[4] * out;
+    }
+    return (out);
+  }
+
+  /**
+   * @} end of SmallBiquad group
+   */
+
+  /**
+   * @ingroup groupSmall
+   */
+
+  /**
+   * @addtogroup SmallMatrix
+   * @{
+   */
+
+  /**
+   * @brief         Small floating-point matrix multiplication.
+   * @param[in]     pSrcA     points to the first input matrix in row order, numRowsA x numColsA.
+   * @param[in]     pSrcB     points to the second input matrix in row order, numColsA x numColsB.
+   * @param[out]    pDst      points to the output matrix in row order, numRowsA x numColsB.
+   * @param[in]     numRowsA  number of rows of first matrix, should be a compile time constant.
+   * @param[in]     numColsA  number of columns of first matrix, should be a compile time constant.
+   * @param[in]     numColsB  number of columns of second matrix, should be a compile time constant.
+   * @note          pDst must not overlap with pSrcA or pSrcB.
+   */
+  __STATIC_FORCEINLINE void riscv_mat_mult_small_f32(
+  const float32_t * pSrcA,
+  const float32_t * pSrcB,
+        float32_t * pDst,
+        uint32_t numRowsA,
+        uint32_t numColsA,
+        uint32_t numColsB)
+  {
+    uint32_t i, j, k;
+    float32_t acc;
+
+    RISCV_SMALL_UNROLL
+    for (i = 0; i < numRowsA; i++)
+    {
+      RISCV_SMALL_UNROLL
+      for (j = 0; j < numColsB; j++)
+      {
+        acc = 0.0f;
+        RISCV_SMALL_UNROLL
+        for (k = 0; k < numColsA; k++)
+        {
+          acc += pSrcA[i * numColsA + k] * pSrcB[k * numColsB + j];
+        }
+        pDst[i * numColsB + j] = acc;
+      }
+    }
+  }
+
+  /**
+   * @brief         Small floating-point matrix vector multiplication.
+   * @param[in]     pSrcMat  points to the input matrix in row order, numRows x numCols.
+   * @param[in]     pVec     points to the input vector, length numCols.
+   * @param[out]    pDst     points to the output vector, length numRows.
+   * @param[in]     numRows  number of rows of matrix, should be a compile time constant.
+   * @param[in]     numCols  number of columns of matrix, should be a compile time constant.
+   * @note          pDst must not overlap with pSrcMat or pVec.
+   */
+  __STATIC_FORCEINLINE void riscv_mat_vec_mult_small_f32(
+  const float32_t * pSrcMat,
+  const float32_t * pVec,
+        float32_t * pDst,
+        uint32_t numRows,
+        uint32_t numCols)
+  {
+    uint32_t i, j;
+    float32_t acc;
+
+    RISCV_SMALL_UNROLL
+    for (i = 0; i < numRows; i++)
+    {
+      acc = 0.0f;
+      RISCV_SMALL_UNROLL
+      for (j = 0; j < numCols; j++)
+      {
+        acc += pSrcMat[i * numCols + j] * pVec[j];
+      }
+      pDst[i] = acc;
+    }
+  }
+
+/** 3x3 floating-point matrix multiplication, see \ref riscv_mat_mult_small_f32 */
+#define riscv_mat_mult_3x3_f32(pSrcA, pSrcB, pDst)  riscv_mat_mult_small_f32(pSrcA, pSrcB, pDst, 3, 3, 3)
+/** 4x4 floating-point matrix multiplication, see \ref riscv_mat_mult_small_f32 */
+#define riscv_mat_mult_4x4_f32(pSrcA, pSrcB, pDst)  riscv_mat_mult_small_f32(pSrcA, pSrcB, pDst, 4, 4, 4)
+
+  /**
+   * @} end of SmallMatrix group
+   */
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif /* ifndef _SMALL_FUNCTIONS_H_ */
@@ -124,6 +124,7 @@
 #include "dsp/transform_functions.h"
 #include "dsp/filtering_functions.h"
 #include "dsp/quaternion_math_functions.h"
+#include "dsp/small_functions.h"
 
 
 
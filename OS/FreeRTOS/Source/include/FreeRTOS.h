@@ -278,6 +278,24 @@ hold explicit before calling the code. */
 
 #endif /* configUSE_TIMERS */
 
+/* Set configUSE_TIMER_WHEEL to 1 to keep active software timers in a hashed
+timer wheel of configTIMER_WHEEL_SIZE slots instead of a sorted list, making
+timer start/reset/stop O(1) in the number of active timers. */
+#ifndef configUSE_TIMER_WHEEL
+	#define configUSE_TIMER_WHEEL 0
+#endif
+
+#ifndef configTIMER_WHEEL_SIZE
+	#define configTIMER_WHEEL_SIZE 64
+#endif
+
+/* Set configUSE_TIMER_COMMAND_BATCH to 1 to coalesce timer commands per timer
+so that a burst of commands is handed to the timer service task as a single
+queue message. */
+#ifndef configUSE_TIMER_COMMAND_BATCH
+	#define configUSE_TIMER_COMMAND_BATCH 0
+#endif
+
 #ifndef portSET_INTERRUPT_MASK_FROM_ISR
 	#define portSET_INTERRUPT_MASK_FROM_ISR() 0
 #endif
@@ -1256,6 +1274,11 @@ typedef struct xSTATIC_TIMER
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t		uxDummy7;
 	#endif
+	#if( configUSE_TIMER_COMMAND_BATCH == 1 )
+		void			*pvDummy9;
+		TickType_t		xDummy10[ 2 ];
+		BaseType_t		xDummy11;
+	#endif
 	uint8_t 			ucDummy8;
 
 } StaticTimer_t;
@@ -64,7 +64,13 @@
 #define portMTH_MASK                ( 0xFFUL )
 
 /* Constants required to set up the initial stack. */
+#if( configPMP_STACK_GUARD == 1 )
+/* Loads and stores of tasks use the privilege in mstatus.MPP, which becomes
+user mode after the first mret, so they are checked by the PMP stack guard */
+#define portINITIAL_MSTATUS         ( MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_FS_INITIAL | MSTATUS_MPRV)
+#else
 #define portINITIAL_MSTATUS         ( MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_FS_INITIAL)
+#endif
 #define portINITIAL_EXC_RETURN      ( 0xfffffffd )
 
 /* The systick is a 64-bit counter. */
@@ -101,6 +107,13 @@ void xPortSysTickHandler(void);
  */
 extern void prvPortStartFirstTask(void) __attribute__((naked));
 
+#if( configPMP_STACK_GUARD == 1 )
+/* Set up the background region and the stack guard of the first task */
+static void prvStackGuardInit(void);
+/* Set when traceTASK_SWITCHED_IN has moved the stack guard */
+static volatile BaseType_t xStackGuardSwitched = pdFALSE;
+#endif
+
 /*
  * Used to catch tasks that attempt to return from their implementing function.
  */
@@ -349,6 +362,10 @@ BaseType_t xPortStartScheduler(void)
     /* Initialise the critical nesting count ready for the first task. */
     uxCriticalNesting = 0;
 
+#if( configPMP_STACK_GUARD == 1 )
+    prvStackGuardInit();
+#endif
+
     /* Start the first task. */
     prvPortStartFirstTask();
 
@@ -430,6 +447,69 @@ void xPortTaskSwitch(void)
 }
 /*-----------------------------------------------------------*/
 
+#if( configPMP_STACK_GUARD == 1 )
+/* Called by traceTASK_SWITCHED_IN with the lowest address of the stack of the
+task being switched in, see portSTACK_GUARD_SWITCH in portmacro.h */
+void vPortStackGuardSwitch(void *pvStack)
+{
+    UBaseType_t uxGuard = (UBaseType_t)pvStack;
+
+    uxGuard = (uxGuard + configPMP_STACK_GUARD_SIZE - 1) & ~((UBaseType_t)configPMP_STACK_GUARD_SIZE - 1);
+    /* NAPOT encoding of [uxGuard, uxGuard + configPMP_STACK_GUARD_SIZE) */
+    __set_PMPADDRx(configPMP_STACK_GUARD_ENTRY, (uxGuard + configPMP_STACK_GUARD_SIZE / 2 - 1) >> PMP_SHIFT);
+    xStackGuardSwitched = pdTRUE;
+}
+
+static void prvStackGuardInit(void)
+{
+    rv_csr_t mstatus;
+
+    /* traceTASK_SWITCHED_IN of the first task must have called portSTACK_GUARD_SWITCH */
+    configASSERT(xStackGuardSwitched == pdTRUE);
+    /* Tasks are only checked by PMP when mstatus.MPP can be user mode, it is
+    read as machine mode on a core without user mode */
+    mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MPP);
+    configASSERT((__RV_CSR_READ(CSR_MSTATUS) & MSTATUS_MPP) == 0);
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+    __set_PMPxCFG(configPMP_STACK_GUARD_ENTRY, PMP_A_NAPOT);
+    /* All ones NAPOT address covers the whole address space */
+    __set_PMPADDRx(configPMP_STACK_GUARD_ENTRY + 1, (rv_csr_t)(-1));
+    __set_PMPxCFG(configPMP_STACK_GUARD_ENTRY + 1, PMP_A_NAPOT | PMP_R | PMP_W | PMP_X);
+    /* PMP address registers are read as zero when PMP entry is not present */
+    configASSERT(__get_PMPADDRx(configPMP_STACK_GUARD_ENTRY + 1) != 0);
+}
+#endif /* configPMP_STACK_GUARD */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TRACE_FACILITY == 1 )
+void vPortShowStackWatermark(void)
+{
+    TaskStatus_t *pxTaskStatusArray;
+    UBaseType_t uxArraySize, x;
+    rv_csr_t mprv;
+
+    uxArraySize = uxTaskGetNumberOfTasks();
+    pxTaskStatusArray = pvPortMalloc(uxArraySize * sizeof(TaskStatus_t));
+    if (pxTaskStatusArray == NULL) {
+        return;
+    }
+    /* Scanning stack of current task will hit its stack guard, so access
+    memory with machine mode privilege here */
+    mprv = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MPRV) & MSTATUS_MPRV;
+    uxArraySize = uxTaskGetSystemState(pxTaskStatusArray, uxArraySize, NULL);
+    __RV_CSR_SET(CSR_MSTATUS, mprv);
+
+    printf("Task            StackBase   MinFree(words)\n");
+    for (x = 0; x < uxArraySize; x++) {
+        printf("%-15s 0x%08lx  %u\n", pxTaskStatusArray[x].pcTaskName, \
+               (unsigned long)pxTaskStatusArray[x].pxStackBase, \
+               (unsigned int)pxTaskStatusArray[x].usStackHighWaterMark);
+    }
+    vPortFree(pxTaskStatusArray);
+}
+#endif /* configUSE_TRACE_FACILITY */
+/*-----------------------------------------------------------*/
+
 void xPortSysTickHandler(void)
 {
     /* The SysTick runs at the lowest interrupt priority, so when this interrupt
@@ -118,6 +118,83 @@ extern void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime);
 
 /*-----------------------------------------------------------*/
 
+/* Run time stats are sampled from the free running mcycle counter at every
+task switch. The per task counters are only 32-bit wide, so the cycle count
+can be scaled down with configRUN_TIME_STATS_SHIFT for long running systems,
+when it is 0 only the low word of mcycle is read. */
+#if defined(configGENERATE_RUN_TIME_STATS) && ( configGENERATE_RUN_TIME_STATS == 1 )
+#ifndef configRUN_TIME_STATS_SHIFT
+#define configRUN_TIME_STATS_SHIFT                  0
+#endif
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    __enable_mcycle_counter()
+#endif
+#ifndef portGET_RUN_TIME_COUNTER_VALUE
+#if configRUN_TIME_STATS_SHIFT == 0
+#define portGET_RUN_TIME_COUNTER_VALUE()            ( ( uint32_t ) __RV_CSR_READ(CSR_MCYCLE) )
+#else
+#define portGET_RUN_TIME_COUNTER_VALUE()            ( ( uint32_t ) ( __get_rv_cycle() >> configRUN_TIME_STATS_SHIFT ) )
+#endif
+#endif
+#endif
+/*-----------------------------------------------------------*/
+
+/* Optional stack guard using PMP. When configPMP_STACK_GUARD is 1, PMP entry
+configPMP_STACK_GUARD_ENTRY is reprogrammed at every task switch as a no access
+region of configPMP_STACK_GUARD_SIZE bytes at the bottom of the stack of the
+task being switched in, and tasks run with mstatus.MPRV set, so their loads and
+stores are checked by PMP and a stack overflow raises an access fault at once.
+The next PMP entry is used as a background region allowing all other accesses,
+and the core must support PMP and user mode. */
+#ifndef configPMP_STACK_GUARD
+#define configPMP_STACK_GUARD                       0
+#endif
+#if ( configPMP_STACK_GUARD == 1 )
+#ifndef configPMP_STACK_GUARD_SIZE
+#define configPMP_STACK_GUARD_SIZE                  32
+#endif
+#ifndef configPMP_STACK_GUARD_ENTRY
+#define configPMP_STACK_GUARD_ENTRY                 0
+#endif
+#if ( configPMP_STACK_GUARD_SIZE < 8 ) || ( ( configPMP_STACK_GUARD_SIZE & ( configPMP_STACK_GUARD_SIZE - 1 ) ) != 0 )
+#error "configPMP_STACK_GUARD_SIZE must be power of 2 and at least 8"
+#endif
+/* The guard is moved by traceTASK_SWITCHED_IN, which is called in tasks.c
+when pxCurrentTCB is the task being switched in. If traceTASK_SWITCHED_IN
+is defined in FreeRTOSConfig.h, it must call portSTACK_GUARD_SWITCH() too. */
+extern void vPortStackGuardSwitch( void *pvStack );
+#define portSTACK_GUARD_SWITCH()                    vPortStackGuardSwitch( ( void * ) pxCurrentTCB->pxStack )
+#ifndef traceTASK_SWITCHED_IN
+#define traceTASK_SWITCHED_IN()                     portSTACK_GUARD_SWITCH()
+#endif
+#else
+#define portSTACK_GUARD_SWITCH()
+#endif
+
+/* Print stack base and high water mark of all tasks, it is safe to be called
+when the stack guard is enabled, requires configUSE_TRACE_FACILITY */
+extern void vPortShowStackWatermark(void);
+/*-----------------------------------------------------------*/
+
+/* Architecture specific optimisations, bitmap of ready priorities is searched
+using __RV_CLZ, which is clz instruction when bitmanip extension is present. */
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION     0
+#endif
+#if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 )
+#if ( configMAX_PRIORITIES > __RISCV_XLEN )
+#error "configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to XLEN"
+#endif
+/* Store/clear the ready priorities in a bit map. */
+#define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )      ( uxReadyPriorities ) = __RV_BSET( ( uxReadyPriorities ), ( uxPriority ) )
+#define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )       ( uxReadyPriorities ) = __RV_BCLR( ( uxReadyPriorities ), ( uxPriority ) )
+#define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( ( __RISCV_XLEN - 1 ) - __RV_CLZ( ( uxReadyPriorities ) ) )
+#endif
+
+/* Count trailing zeros of a non zero 32bit value, used by timer wheel */
+#define portCOUNT_TRAILING_ZEROS( ulBits )      __RV_CTZ( ( ulBits ) )
+/*-----------------------------------------------------------*/
+
 #ifdef configASSERT
 extern void vPortValidateInterruptPriority(void);
 #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()          vPortValidateInterruptPriority()
@@ -2068,6 +2068,18 @@ BaseType_t xReturn;
 		FreeRTOSConfig.h file. */
 		portCONFIGURE_TIMER_FOR_RUN_TIME_STATS();
 
+		#if ( configGENERATE_RUN_TIME_STATS == 1 )
+		{
+			/* Run time is counted from here, so the time before the
+			scheduler is started is not charged to the first task. */
+			#ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+				portALT_GET_RUN_TIME_COUNTER_VALUE( ulTaskSwitchedInTime );
+			#else
+				ulTaskSwitchedInTime = portGET_RUN_TIME_COUNTER_VALUE();
+			#endif
+		}
+		#endif /* configGENERATE_RUN_TIME_STATS */
+
 		traceTASK_SWITCHED_IN();
 
 		/* Setting up the timer tick is hardware specific and thus in the
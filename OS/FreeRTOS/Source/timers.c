@@ -69,6 +69,39 @@ defining trmTIMER_SERVICE_TASK_NAME in FreeRTOSConfig.h. */
 #define tmrSTATUS_IS_STATICALLY_ALLOCATED	( ( uint8_t ) 0x02 )
 #define tmrSTATUS_IS_AUTORELOAD				( ( uint8_t ) 0x04 )
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/* The wheel slot is selected by masking the expiry time, and occupied
+	slots are tracked in a bitmap of 32-bit words. */
+	#if ( ( configTIMER_WHEEL_SIZE & ( configTIMER_WHEEL_SIZE - 1 ) ) != 0 ) || ( configTIMER_WHEEL_SIZE < 32 )
+		#error configTIMER_WHEEL_SIZE must be a power of two and not less than 32.
+	#endif
+
+	#define tmrWHEEL_MASK			( ( TickType_t ) ( configTIMER_WHEEL_SIZE - 1 ) )
+	#define tmrWHEEL_MAP_WORDS		( ( UBaseType_t ) ( configTIMER_WHEEL_SIZE / 32 ) )
+	#define tmrWHEEL_SLOT( xTime )	( ( UBaseType_t ) ( ( xTime ) & tmrWHEEL_MASK ) )
+
+	/* Expiry times are compared using wrap-around arithmetic instead of a
+	pair of overflow lists, so a timer period must be below half of the tick
+	counter range. */
+	#define tmrWHEEL_HALF_RANGE		( ( ( TickType_t ) portMAX_DELAY >> 1 ) + ( TickType_t ) 1U )
+	#define tmrWHEEL_TIME_REACHED( xTime, xNow )	( ( ( TickType_t ) ( ( xNow ) - ( xTime ) ) ) < tmrWHEEL_HALF_RANGE )
+
+	#if defined( portCOUNT_TRAILING_ZEROS )
+		#define tmrCOUNT_TRAILING_ZEROS( ulBits )	( ( UBaseType_t ) portCOUNT_TRAILING_ZEROS( ulBits ) )
+	#elif defined( __GNUC__ )
+		#define tmrCOUNT_TRAILING_ZEROS( ulBits )	( ( UBaseType_t ) __builtin_ctz( ulBits ) )
+	#else
+		#define tmrCOUNT_TRAILING_ZEROS( ulBits )	prvCountTrailingZeros( ulBits )
+	#endif
+#endif /* configUSE_TIMER_WHEEL */
+
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+	/* Message telling the timer service task to drain the pending timer
+	commands, and the value of xPendingCommand for a timer without one. */
+	#define tmrCOMMAND_PROCESS_BATCH			( ( BaseType_t ) 10 )
+	#define tmrCOMMAND_NONE						( ( BaseType_t ) -1 )
+#endif /* configUSE_TIMER_COMMAND_BATCH */
+
 /* The definition of the timers themselves. */
 typedef struct tmrTimerControl /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 {
@@ -80,6 +113,12 @@ typedef struct tmrTimerControl /* The old naming convention is used to prevent b
 	#if( configUSE_TRACE_FACILITY == 1 )
 		UBaseType_t			uxTimerNumber;		/*<< An ID assigned by trace tools such as FreeRTOS+Trace */
 	#endif
+	#if( configUSE_TIMER_COMMAND_BATCH == 1 )
+		struct tmrTimerControl	*pxNextPending;	/*<< Next timer in the chain of timers with a pending command. */
+		TickType_t			xPendingValue;		/*<< Value of the latest pending command. */
+		TickType_t			xPendingPeriod;		/*<< New period requested by a pending change period command, 0 if none. */
+		BaseType_t			xPendingCommand;	/*<< Latest pending command, tmrCOMMAND_NONE if none. */
+	#endif
 	uint8_t 				ucStatus;			/*<< Holds bits to say if the timer was statically allocated or not, and if it is active or not. */
 } xTIMER;
 
@@ -132,10 +171,31 @@ timer service task is allowed to access these lists.
 xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
 breaks some kernel aware debuggers, and debuggers that reply on removing the
 static qualifier. */
-PRIVILEGED_DATA static List_t xActiveTimerList1;
-PRIVILEGED_DATA static List_t xActiveTimerList2;
-PRIVILEGED_DATA static List_t *pxCurrentTimerList;
-PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/* When the timer wheel is used, an active timer is held unsorted in the
+	slot selected by its expiry time, ulTimerWheelMap has one bit set for
+	every non-empty slot, and xTimerWheelTime is the last tick whose slot has
+	been processed by the timer service task. */
+	PRIVILEGED_DATA static List_t xTimerWheel[ configTIMER_WHEEL_SIZE ];
+	PRIVILEGED_DATA static uint32_t ulTimerWheelMap[ configTIMER_WHEEL_SIZE / 32 ];
+	PRIVILEGED_DATA static UBaseType_t uxTimerWheelCount = ( UBaseType_t ) 0U;
+	PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;
+#else
+	PRIVILEGED_DATA static List_t xActiveTimerList1;
+	PRIVILEGED_DATA static List_t xActiveTimerList2;
+	PRIVILEGED_DATA static List_t *pxCurrentTimerList;
+	PRIVILEGED_DATA static List_t *pxOverflowTimerList;
+#endif /* configUSE_TIMER_WHEEL */
+
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+	/* Chain of timers that have a command waiting to be processed, in the
+	order the commands were first issued, the link field of its last timer,
+	and whether a tmrCOMMAND_PROCESS_BATCH message for the chain is already in
+	the timer queue.  All are only accessed from within critical sections. */
+	PRIVILEGED_DATA static Timer_t *pxPendingTimers = NULL;
+	PRIVILEGED_DATA static Timer_t **ppxPendingTail = &pxPendingTimers;
+	PRIVILEGED_DATA static BaseType_t xBatchMessagePosted = pdFALSE;
+#endif /* configUSE_TIMER_COMMAND_BATCH */
 
 /* A queue that is used to send commands to the timer service task. */
 PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -174,6 +234,25 @@ static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION
  */
 static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Apply a single start, reset, stop, change period or delete command to a
+ * timer.
+ */
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+	/*
+	 * Take the chain of timers with pending commands and apply the latest
+	 * command of each timer.
+	 */
+	static void prvProcessPendingCommands( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Remove an active timer from the list or timer wheel slot it is held in.
+ */
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer ) PRIVILEGED_FUNCTION;
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
  * depending on if the expire time causes a timer counter overflow.
@@ -184,13 +263,31 @@ static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const Tic
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto-reload timer, then call its callback.
  */
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
-
-/*
- * The tick count has overflowed.  Switch the timer lists after ensuring the
- * current timer list does not still reference some timers.
- */
-static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+static void prvProcessExpiredTimer( Timer_t * const pxTimer, const TickType_t xNextExpireTime, const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+	/*
+	 * Process every timer wheel slot between the last processed tick and
+	 * xTimeNow, expiring the timers that are due.
+	 */
+	static void prvProcessTimerWheel( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Return the distance in slots from uxStartSlot to the first occupied
+	 * slot at or after it.  At least one slot must be occupied.
+	 */
+	static UBaseType_t prvGetNextOccupiedSlotDistance( const UBaseType_t uxStartSlot ) PRIVILEGED_FUNCTION;
+
+	#if !defined( __GNUC__ )
+		static UBaseType_t prvCountTrailingZeros( uint32_t ulBits ) PRIVILEGED_FUNCTION;
+	#endif
+#else
+	/*
+	 * The tick count has overflowed.  Switch the timer lists after ensuring the
+	 * current timer list does not still reference some timers.
+	 */
+	static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -369,6 +466,14 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 		pxNewTimer->pvTimerID = pvTimerID;
 		pxNewTimer->pxCallbackFunction = pxCallbackFunction;
 		vListInitialiseItem( &( pxNewTimer->xTimerListItem ) );
+		#if( configUSE_TIMER_COMMAND_BATCH == 1 )
+		{
+			pxNewTimer->pxNextPending = NULL;
+			pxNewTimer->xPendingValue = ( TickType_t ) 0U;
+			pxNewTimer->xPendingPeriod = ( TickType_t ) 0U;
+			pxNewTimer->xPendingCommand = tmrCOMMAND_NONE;
+		}
+		#endif /* configUSE_TIMER_COMMAND_BATCH */
 		if( uxAutoReload != pdFALSE )
 		{
 			pxNewTimer->ucStatus |= tmrSTATUS_IS_AUTORELOAD;
@@ -378,6 +483,181 @@ static void prvInitialiseNewTimer(	const char * const pcTimerName,			/*lint !e97
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait )
+{
+BaseType_t xReturn = pdFAIL;
+BaseType_t xPostBatch = pdFALSE;
+UBaseType_t uxSavedInterruptStatus = 0;
+DaemonTaskMessage_t xMessage;
+Timer_t * const pxTimer = xTimer;
+Timer_t **ppxPending;
+BaseType_t xPreviousCommand;
+TickType_t xPreviousValue, xPreviousPeriod;
+
+	configASSERT( xTimer );
+
+	if( xTimerQueue != NULL )
+	{
+		/* Record the command in the timer itself.  A later command for the
+		same timer overwrites an earlier one that has not been processed yet,
+		and only the first command of a batch posts a message to the timer
+		service task, so a burst of commands costs a single queue message and
+		a single wakeup of the timer service task. */
+		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+		{
+			taskENTER_CRITICAL();
+		}
+		else
+		{
+			uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+		}
+		{
+			/* Kept to withdraw the command if the batch message can't be
+			posted. */
+			xPreviousCommand = pxTimer->xPendingCommand;
+			xPreviousValue = pxTimer->xPendingValue;
+			xPreviousPeriod = pxTimer->xPendingPeriod;
+
+			if( pxTimer->xPendingCommand == tmrCOMMAND_NONE )
+			{
+				/* Appended, so timers are processed in the order their
+				commands were issued, as they were with one message each. */
+				pxTimer->pxNextPending = NULL;
+				*ppxPendingTail = pxTimer;
+				ppxPendingTail = &( pxTimer->pxNextPending );
+			}
+
+			if( ( xCommandID == tmrCOMMAND_CHANGE_PERIOD ) || ( xCommandID == tmrCOMMAND_CHANGE_PERIOD_FROM_ISR ) )
+			{
+				/* Kept apart from the command so a following start, reset or
+				stop still uses the new period. */
+				pxTimer->xPendingPeriod = xOptionalValue;
+			}
+
+			pxTimer->xPendingCommand = xCommandID;
+			pxTimer->xPendingValue = xOptionalValue;
+
+			if( xBatchMessagePosted == pdFALSE )
+			{
+				xBatchMessagePosted = pdTRUE;
+				xPostBatch = pdTRUE;
+			}
+		}
+		if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+		{
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+		}
+
+		if( xPostBatch != pdFALSE )
+		{
+			xMessage.xMessageID = tmrCOMMAND_PROCESS_BATCH;
+			xMessage.u.xTimerParameters.xMessageValue = ( TickType_t ) 0U;
+			xMessage.u.xTimerParameters.pxTimer = NULL;
+
+			if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+			{
+				if( xTaskGetSchedulerState() == taskSCHEDULER_RUNNING )
+				{
+					xReturn = xQueueSendToBack( xTimerQueue, &xMessage, xTicksToWait );
+				}
+				else
+				{
+					xReturn = xQueueSendToBack( xTimerQueue, &xMessage, tmrNO_DELAY );
+				}
+			}
+			else
+			{
+				xReturn = xQueueSendToBackFromISR( xTimerQueue, &xMessage, pxHigherPriorityTaskWoken );
+			}
+
+			if( xReturn == pdFAIL )
+			{
+				/* Withdraw the command, so pdFAIL means it is not applied,
+				the previous pending command of the timer is restored.
+				Commands of other timers which joined this batch in the
+				meantime stay pending and are processed together with the
+				batch posted by the next successful command. */
+				if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+				{
+					taskENTER_CRITICAL();
+				}
+				else
+				{
+					uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+				}
+				{
+					xBatchMessagePosted = pdFALSE;
+
+					if( pxTimer->xPendingCommand == tmrCOMMAND_NONE )
+					{
+						/* Already taken by the timer service task, which was
+						processing an earlier batch, so it is applied. */
+						xReturn = pdPASS;
+					}
+					else if( ( pxTimer->xPendingCommand == xCommandID ) && ( pxTimer->xPendingValue == xOptionalValue ) )
+					{
+						pxTimer->xPendingCommand = xPreviousCommand;
+						pxTimer->xPendingValue = xPreviousValue;
+						pxTimer->xPendingPeriod = xPreviousPeriod;
+
+						if( xPreviousCommand == tmrCOMMAND_NONE )
+						{
+							for( ppxPending = &pxPendingTimers; *ppxPending != NULL; ppxPending = &( ( *ppxPending )->pxNextPending ) )
+							{
+								if( *ppxPending == pxTimer )
+								{
+									*ppxPending = pxTimer->pxNextPending;
+									if( ppxPendingTail == &( pxTimer->pxNextPending ) )
+									{
+										ppxPendingTail = ppxPending;
+									}
+									pxTimer->pxNextPending = NULL;
+									break;
+								}
+							}
+						}
+					}
+					else
+					{
+						/* Overwritten by a later command of the same timer. */
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				if( xCommandID < tmrFIRST_FROM_ISR_COMMAND )
+				{
+					taskEXIT_CRITICAL();
+				}
+				else
+				{
+					taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+				}
+			}
+		}
+		else
+		{
+			/* A batch message is already queued and will pick this command
+			up. */
+			xReturn = pdPASS;
+		}
+
+		traceTIMER_COMMAND_SEND( xTimer, xCommandID, xOptionalValue, xReturn );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+
+#else /* configUSE_TIMER_COMMAND_BATCH */
+
 BaseType_t xTimerGenericCommand( TimerHandle_t xTimer, const BaseType_t xCommandID, const TickType_t xOptionalValue, BaseType_t * const pxHigherPriorityTaskWoken, const TickType_t xTicksToWait )
 {
 BaseType_t xReturn = pdFAIL;
@@ -419,6 +699,8 @@ DaemonTaskMessage_t xMessage;
 
 	return xReturn;
 }
+
+#endif /* configUSE_TIMER_COMMAND_BATCH */
 /*-----------------------------------------------------------*/
 
 TaskHandle_t xTimerGetTimerDaemonTaskHandle( void )
@@ -504,14 +786,13 @@ Timer_t *pxTimer = xTimer;
 }
 /*-----------------------------------------------------------*/
 
-static void prvProcessExpiredTimer( const TickType_t xNextExpireTime, const TickType_t xTimeNow )
+static void prvProcessExpiredTimer( Timer_t * const pxTimer, const TickType_t xNextExpireTime, const TickType_t xTimeNow )
 {
 BaseType_t xResult;
-Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 
 	/* Remove the timer from the list of active timers.  A check has already
 	been performed to ensure the list is not empty. */
-	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+	prvRemoveTimerFromActiveList( pxTimer );
 	traceTIMER_EXPIRED( pxTimer );
 
 	/* If the timer is an auto-reload timer then calculate the next
@@ -581,6 +862,231 @@ BaseType_t xListWasEmpty;
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
+{
+TickType_t xTimeNow;
+
+	vTaskSuspendAll();
+	{
+		/* The wheel has no overflow list to switch, expiry times are compared
+		with wrap-around arithmetic instead. */
+		xTimeNow = xTaskGetTickCount();
+
+		if( ( xListWasEmpty == pdFALSE ) && ( tmrWHEEL_TIME_REACHED( xNextExpireTime, xTimeNow ) != pdFALSE ) )
+		{
+			( void ) xTaskResumeAll();
+			prvProcessTimerWheel( xTimeNow );
+		}
+		else
+		{
+			/* Block until the next occupied slot is reached or a command is
+			received.  If the wheel is empty xListWasEmpty makes the task wait
+			indefinitely for a command. */
+			vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+			if( xTaskResumeAll() == pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGetNextOccupiedSlotDistance( const UBaseType_t uxStartSlot )
+{
+UBaseType_t uxWord = uxStartSlot >> 5;
+UBaseType_t uxCount;
+uint32_t ulBits;
+
+	/* Look at the bits at or after the start slot in its own word first,
+	then at whole words, ending with the start word again to wrap round.  The
+	cost is bounded by the wheel size, not by the number of active timers. */
+	ulBits = ulTimerWheelMap[ uxWord ] & ( 0xFFFFFFFFUL << ( uxStartSlot & 0x1FUL ) );
+
+	for( uxCount = 0; ( ulBits == 0UL ) && ( uxCount < tmrWHEEL_MAP_WORDS ); uxCount++ )
+	{
+		uxWord = ( uxWord + 1U ) & ( tmrWHEEL_MAP_WORDS - 1U );
+		ulBits = ulTimerWheelMap[ uxWord ];
+	}
+
+	configASSERT( ulBits != 0UL );
+
+	return ( ( uxWord << 5 ) + tmrCOUNT_TRAILING_ZEROS( ulBits ) - uxStartSlot ) & tmrWHEEL_MASK;
+}
+/*-----------------------------------------------------------*/
+
+static void prvProcessTimerWheel( const TickType_t xTimeNow )
+{
+TickType_t xTicks, xTick, xExpiryTime;
+UBaseType_t uxDistance, uxSlot, uxEntries;
+List_t *pxSlot;
+ListItem_t *pxItem, *pxNextItem;
+
+	/* Visit the slots of the ticks that passed since the wheel was last
+	processed.  Once a full turn has passed every slot has to be looked at,
+	so visiting more than one turn is pointless. */
+	xTicks = ( TickType_t ) ( xTimeNow - xTimerWheelTime );
+	if( xTicks > ( TickType_t ) configTIMER_WHEEL_SIZE )
+	{
+		xTicks = ( TickType_t ) configTIMER_WHEEL_SIZE;
+	}
+	xTick = ( TickType_t ) ( xTimeNow - xTicks ) + ( TickType_t ) 1U;
+
+	while( ( xTicks > ( TickType_t ) 0U ) && ( uxTimerWheelCount > ( UBaseType_t ) 0U ) )
+	{
+		/* Skip empty slots using the occupancy bitmap. */
+		uxDistance = prvGetNextOccupiedSlotDistance( tmrWHEEL_SLOT( xTick ) );
+		if( ( TickType_t ) uxDistance >= xTicks )
+		{
+			break;
+		}
+		xTick += ( TickType_t ) uxDistance;
+		xTicks -= ( TickType_t ) uxDistance;
+
+		/* A slot also holds timers that expire in a later turn of the wheel,
+		so the expiry time of every entry is checked.  Only the entries
+		present now are examined; an auto-reload timer re-inserted into this
+		slot by prvProcessExpiredTimer() is appended behind them. */
+		uxSlot = tmrWHEEL_SLOT( xTick );
+		pxSlot = &( xTimerWheel[ uxSlot ] );
+		pxItem = listGET_HEAD_ENTRY( pxSlot );
+		for( uxEntries = listCURRENT_LIST_LENGTH( pxSlot ); uxEntries > ( UBaseType_t ) 0U; uxEntries-- )
+		{
+			pxNextItem = listGET_NEXT( pxItem );
+			xExpiryTime = listGET_LIST_ITEM_VALUE( pxItem );
+
+			if( tmrWHEEL_TIME_REACHED( xExpiryTime, xTimeNow ) != pdFALSE )
+			{
+				prvProcessExpiredTimer( ( Timer_t * ) listGET_LIST_ITEM_OWNER( pxItem ), xExpiryTime, xTimeNow ); /*lint !e9087 !e9079 The owner of a timer list item is always its Timer_t. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			pxItem = pxNextItem;
+		}
+
+		xTick++;
+		xTicks--;
+	}
+
+	xTimerWheelTime = xTimeNow;
+}
+/*-----------------------------------------------------------*/
+
+#if !defined( __GNUC__ )
+
+	static UBaseType_t prvCountTrailingZeros( uint32_t ulBits )
+	{
+	UBaseType_t uxCount = 0;
+
+		while( ( ulBits & 1UL ) == 0UL )
+		{
+			ulBits >>= 1;
+			uxCount++;
+		}
+
+		return uxCount;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+{
+TickType_t xNextExpireTime;
+UBaseType_t uxStartSlot;
+
+	/* The wheel does not know the exact expiry time of the nearest timer,
+	only the nearest occupied slot.  Waking at that slot is early at most
+	once per turn of the wheel for timers that expire in a later turn. */
+	*pxListWasEmpty = ( uxTimerWheelCount == ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+	if( *pxListWasEmpty == pdFALSE )
+	{
+		uxStartSlot = tmrWHEEL_SLOT( xTimerWheelTime + ( TickType_t ) 1U );
+		xNextExpireTime = xTimerWheelTime + ( TickType_t ) 1U + ( TickType_t ) prvGetNextOccupiedSlotDistance( uxStartSlot );
+	}
+	else
+	{
+		xNextExpireTime = ( TickType_t ) 0U;
+	}
+
+	return xNextExpireTime;
+}
+/*-----------------------------------------------------------*/
+
+static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
+{
+	/* There are no timer lists to switch when the wheel is used. */
+	*pxTimerListsWereSwitched = pdFALSE;
+	return xTaskGetTickCount();
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer, const TickType_t xNextExpiryTime, const TickType_t xTimeNow, const TickType_t xCommandTime )
+{
+BaseType_t xProcessTimerNow = pdFALSE;
+UBaseType_t uxSlot;
+
+	configASSERT( pxTimer->xTimerPeriodInTicks < tmrWHEEL_HALF_RANGE );
+
+	listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
+	listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
+
+	if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks ) /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+	{
+		/* The time between a command being issued and the command being
+		processed actually exceeds the timers period.  */
+		xProcessTimerNow = pdTRUE;
+	}
+	else
+	{
+		if( uxTimerWheelCount == ( UBaseType_t ) 0U )
+		{
+			/* No slot holds a timer, so the wheel can jump straight to the
+			current time instead of walking the ticks it slept through. */
+			xTimerWheelTime = xTimeNow;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		uxSlot = tmrWHEEL_SLOT( xNextExpiryTime );
+		vListInsertEnd( &( xTimerWheel[ uxSlot ] ), &( pxTimer->xTimerListItem ) );
+		ulTimerWheelMap[ uxSlot >> 5 ] |= ( 1UL << ( uxSlot & 0x1FUL ) );
+		uxTimerWheelCount++;
+	}
+
+	return xProcessTimerNow;
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
+{
+UBaseType_t uxSlot = tmrWHEEL_SLOT( listGET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ) ) );
+
+	if( uxListRemove( &( pxTimer->xTimerListItem ) ) == ( UBaseType_t ) 0U )
+	{
+		ulTimerWheelMap[ uxSlot >> 5 ] &= ~( 1UL << ( uxSlot & 0x1FUL ) );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+	uxTimerWheelCount--;
+}
+
+#else /* configUSE_TIMER_WHEEL */
+
 static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime, BaseType_t xListWasEmpty )
 {
 TickType_t xTimeNow;
@@ -600,7 +1106,7 @@ BaseType_t xTimerListsWereSwitched;
 			if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
 			{
 				( void ) xTaskResumeAll();
-				prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
+				prvProcessExpiredTimer( ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ), xNextExpireTime, xTimeNow ); /*lint !e9087 !e9079 void * is used as this macro is used with tasks and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
 			}
 			else
 			{
@@ -731,12 +1237,17 @@ BaseType_t xProcessTimerNow = pdFALSE;
 }
 /*-----------------------------------------------------------*/
 
+static void prvRemoveTimerFromActiveList( Timer_t * const pxTimer )
+{
+	( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+}
+
+#endif /* configUSE_TIMER_WHEEL */
+/*-----------------------------------------------------------*/
+
 static void	prvProcessReceivedCommands( void )
 {
 DaemonTaskMessage_t xMessage;
-Timer_t *pxTimer;
-BaseType_t xTimerListsWereSwitched, xResult;
-TickType_t xTimeNow;
 
 	while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL ) /*lint !e603 xMessage does not have to be initialised as it is passed out, not in, and it is not used unless xQueueReceive() returns pdTRUE. */
 	{
@@ -764,121 +1275,200 @@ TickType_t xTimeNow;
 
 		/* Commands that are positive are timer commands rather than pended
 		function calls. */
-		if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+		#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
 		{
-			/* The messages uses the xTimerParameters member to work on a
-			software timer. */
-			pxTimer = xMessage.u.xTimerParameters.pxTimer;
-
-			if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+			if( xMessage.xMessageID == tmrCOMMAND_PROCESS_BATCH )
+			{
+				prvProcessPendingCommands();
+			}
+			else if( xMessage.xMessageID >= ( BaseType_t ) 0 )
 			{
-				/* The timer is in a list, remove it. */
-				( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
+				prvProcessTimerCommand( xMessage.u.xTimerParameters.pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
+		}
+		#else
+		{
+			if( xMessage.xMessageID >= ( BaseType_t ) 0 )
+			{
+				/* The messages uses the xTimerParameters member to work on a
+				software timer. */
+				prvProcessTimerCommand( xMessage.u.xTimerParameters.pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TIMER_COMMAND_BATCH */
+	}
+}
+/*-----------------------------------------------------------*/
 
-			traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
+static void prvProcessTimerCommand( Timer_t * const pxTimer, const BaseType_t xCommandID, const TickType_t xCommandValue )
+{
+BaseType_t xTimerListsWereSwitched, xResult;
+TickType_t xTimeNow;
 
-			/* In this case the xTimerListsWereSwitched parameter is not used, but
-			it must be present in the function call.  prvSampleTimeNow() must be
-			called after the message is received from xTimerQueue so there is no
-			possibility of a higher priority task adding a message to the message
-			queue with a time that is ahead of the timer daemon task (because it
-			pre-empted the timer daemon task after the xTimeNow value was set). */
-			xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+	if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE ) /*lint !e961. The cast is only redundant when NULL is passed into the macro. */
+	{
+		/* The timer is in a list, remove it. */
+		prvRemoveTimerFromActiveList( pxTimer );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
 
-			switch( xMessage.xMessageID )
-			{
-				case tmrCOMMAND_START :
-				case tmrCOMMAND_START_FROM_ISR :
-				case tmrCOMMAND_RESET :
-				case tmrCOMMAND_RESET_FROM_ISR :
-				case tmrCOMMAND_START_DONT_TRACE :
-					/* Start or restart a timer. */
-					pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
-					if( prvInsertTimerInActiveList( pxTimer,  xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
-					{
-						/* The timer expired before it was added to the active
-						timer list.  Process it now. */
-						pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
-						traceTIMER_EXPIRED( pxTimer );
+	traceTIMER_COMMAND_RECEIVED( pxTimer, xCommandID, xCommandValue );
 
-						if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
-						{
-							xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
-							configASSERT( xResult );
-							( void ) xResult;
-						}
-						else
-						{
-							mtCOVERAGE_TEST_MARKER();
-						}
-					}
-					else
-					{
-						mtCOVERAGE_TEST_MARKER();
-					}
-					break;
+	/* In this case the xTimerListsWereSwitched parameter is not used, but
+	it must be present in the function call.  prvSampleTimeNow() must be
+	called after the message is received from xTimerQueue so there is no
+	possibility of a higher priority task adding a message to the message
+	queue with a time that is ahead of the timer daemon task (because it
+	pre-empted the timer daemon task after the xTimeNow value was set). */
+	xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
 
-				case tmrCOMMAND_STOP :
-				case tmrCOMMAND_STOP_FROM_ISR :
-					/* The timer has already been removed from the active list. */
+	switch( xCommandID )
+	{
+		case tmrCOMMAND_START :
+		case tmrCOMMAND_START_FROM_ISR :
+		case tmrCOMMAND_RESET :
+		case tmrCOMMAND_RESET_FROM_ISR :
+		case tmrCOMMAND_START_DONT_TRACE :
+			/* Start or restart a timer. */
+			pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+			if( prvInsertTimerInActiveList( pxTimer,  xCommandValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xCommandValue ) != pdFALSE )
+			{
+				/* The timer expired before it was added to the active
+				timer list.  Process it now. */
+				pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+				traceTIMER_EXPIRED( pxTimer );
+
+				if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0 )
+				{
+					xResult = xTimerGenericCommand( pxTimer, tmrCOMMAND_START_DONT_TRACE, xCommandValue + pxTimer->xTimerPeriodInTicks, NULL, tmrNO_DELAY );
+					configASSERT( xResult );
+					( void ) xResult;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+			break;
+
+		case tmrCOMMAND_STOP :
+		case tmrCOMMAND_STOP_FROM_ISR :
+			/* The timer has already been removed from the active list. */
+			pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+			break;
+
+		case tmrCOMMAND_CHANGE_PERIOD :
+		case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
+			pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
+			pxTimer->xTimerPeriodInTicks = xCommandValue;
+			configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+			/* The new period does not really have a reference, and can
+			be longer or shorter than the old one.  The command time is
+			therefore set to the current time, and as the period cannot
+			be zero the next expiry time can only be in the future,
+			meaning (unlike for the xTimerStart() case above) there is
+			no fail case that needs to be handled here. */
+			( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+			break;
+
+		case tmrCOMMAND_DELETE :
+			#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+			{
+				/* The timer has already been removed from the active list,
+				just free up the memory if the memory was dynamically
+				allocated. */
+				if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
+				{
+					vPortFree( pxTimer );
+				}
+				else
+				{
 					pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
-					break;
-
-				case tmrCOMMAND_CHANGE_PERIOD :
-				case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR :
-					pxTimer->ucStatus |= tmrSTATUS_IS_ACTIVE;
-					pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-					configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-					/* The new period does not really have a reference, and can
-					be longer or shorter than the old one.  The command time is
-					therefore set to the current time, and as the period cannot
-					be zero the next expiry time can only be in the future,
-					meaning (unlike for the xTimerStart() case above) there is
-					no fail case that needs to be handled here. */
-					( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-					break;
-
-				case tmrCOMMAND_DELETE :
-					#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
-					{
-						/* The timer has already been removed from the active list,
-						just free up the memory if the memory was dynamically
-						allocated. */
-						if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
-						{
-							vPortFree( pxTimer );
-						}
-						else
-						{
-							pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
-						}
-					}
-					#else
-					{
-						/* If dynamic allocation is not enabled, the memory
-						could not have been dynamically allocated. So there is
-						no need to free the memory - just mark the timer as
-						"not active". */
-						pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
-					}
-					#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-					break;
+				}
+			}
+			#else
+			{
+				/* If dynamic allocation is not enabled, the memory
+				could not have been dynamically allocated. So there is
+				no need to free the memory - just mark the timer as
+				"not active". */
+				pxTimer->ucStatus &= ~tmrSTATUS_IS_ACTIVE;
+			}
+			#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+			break;
+
+		default	:
+			/* Don't expect to get here. */
+			break;
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TIMER_COMMAND_BATCH == 1 )
+
+static void prvProcessPendingCommands( void )
+{
+Timer_t *pxTimer, *pxNextTimer;
+BaseType_t xCommandID;
+TickType_t xCommandValue;
+
+	/* Take the whole chain.  Commands issued from now on start a new chain
+	and post a new batch message. */
+	taskENTER_CRITICAL();
+	{
+		pxTimer = pxPendingTimers;
+		pxPendingTimers = NULL;
+		ppxPendingTail = &pxPendingTimers;
+		xBatchMessagePosted = pdFALSE;
+	}
+	taskEXIT_CRITICAL();
 
-				default	:
-					/* Don't expect to get here. */
-					break;
+	while( pxTimer != NULL )
+	{
+		/* A command issued for this timer after the chain was taken but
+		before it is unlinked here simply overwrites the pending command, so
+		the latest command is always the one applied. */
+		taskENTER_CRITICAL();
+		{
+			pxNextTimer = pxTimer->pxNextPending;
+			xCommandID = pxTimer->xPendingCommand;
+			xCommandValue = pxTimer->xPendingValue;
+			if( pxTimer->xPendingPeriod != ( TickType_t ) 0U )
+			{
+				pxTimer->xTimerPeriodInTicks = pxTimer->xPendingPeriod;
+				pxTimer->xPendingPeriod = ( TickType_t ) 0U;
 			}
+			pxTimer->pxNextPending = NULL;
+			pxTimer->xPendingCommand = tmrCOMMAND_NONE;
 		}
+		taskEXIT_CRITICAL();
+
+		prvProcessTimerCommand( pxTimer, xCommandID, xCommandValue );
+		pxTimer = pxNextTimer;
 	}
 }
+
+#endif /* configUSE_TIMER_COMMAND_BATCH */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_TIMER_WHEEL == 0 )
+
 static void prvSwitchTimerLists( void )
 {
 TickType_t xNextExpireTime, xReloadTime;
@@ -936,6 +1526,8 @@ BaseType_t xResult;
 	pxCurrentTimerList = pxOverflowTimerList;
 	pxOverflowTimerList = pxTemp;
 }
+
+#endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
 static void prvCheckForValidListAndQueue( void )
@@ -947,10 +1539,23 @@ static void prvCheckForValidListAndQueue( void )
 	{
 		if( xTimerQueue == NULL )
 		{
-			vListInitialise( &xActiveTimerList1 );
-			vListInitialise( &xActiveTimerList2 );
-			pxCurrentTimerList = &xActiveTimerList1;
-			pxOverflowTimerList = &xActiveTimerList2;
+			#if ( configUSE_TIMER_WHEEL == 1 )
+			{
+			UBaseType_t uxSlot;
+
+				for( uxSlot = 0; uxSlot < ( UBaseType_t ) configTIMER_WHEEL_SIZE; uxSlot++ )
+				{
+					vListInitialise( &( xTimerWheel[ uxSlot ] ) );
+				}
+			}
+			#else
+			{
+				vListInitialise( &xActiveTimerList1 );
+				vListInitialise( &xActiveTimerList2 );
+				pxCurrentTimerList = &xActiveTimerList1;
+				pxOverflowTimerList = &xActiveTimerList2;
+			}
+			#endif /* configUSE_TIMER_WHEEL */
 
 			#if( configSUPPORT_STATIC_ALLOCATION == 1 )
 			{
@@ -228,7 +228,13 @@ long list_thread(void)
                             thread->error);
 #else
                     ptr = (rt_uint8_t *)thread->stack_addr;
+#ifdef RT_USING_PMP_STACK_GUARD
+                    level = rt_hw_stack_guard_suspend();
                     while (*ptr == '#')ptr ++;
+                    rt_hw_stack_guard_resume(level);
+#else
+                    while (*ptr == '#')ptr ++;
+#endif
 
                     rt_kprintf(" 0x%08x 0x%08x    %02d%%   0x%08x %03d\n",
                             thread->stack_size + ((rt_ubase_t)thread->stack_addr - (rt_ubase_t)thread->sp),
@@ -249,6 +255,75 @@ long list_thread(void)
 FINSH_FUNCTION_EXPORT(list_thread, list thread);
 MSH_CMD_EXPORT(list_thread, list thread);
 
+#ifdef RT_USING_CPU_USAGE
+long top(void)
+{
+    list_get_next_t find_arg;
+    rt_list_t *obj_list[LIST_FIND_OBJ_NR];
+    rt_list_t *next = (rt_list_t*)RT_NULL;
+    const char *item_title = "thread";
+    rt_uint64_t total = 0, cycles;
+    rt_uint32_t usage;
+    int maxlen, pass;
+
+    list_find_init(&find_arg, RT_Object_Class_Thread, obj_list, sizeof(obj_list)/sizeof(obj_list[0]));
+
+    maxlen = RT_NAME_MAX;
+
+    /* first pass sums the cycles of all threads, second pass prints them */
+    for (pass = 0; pass < 2; pass++)
+    {
+        if (pass == 1)
+        {
+            rt_kprintf("%-*.s pri   kcycles     cpu\n", maxlen, item_title); object_split(maxlen);
+            rt_kprintf(     " --- ----------  ------\n");
+            if (total == 0)
+            {
+                total = 1;
+            }
+        }
+
+        next = (rt_list_t*)RT_NULL;
+        do
+        {
+            next = list_get_next(next, &find_arg);
+            {
+                int i;
+                for (i = 0; i < find_arg.nr_out; i++)
+                {
+                    struct rt_object *obj;
+                    struct rt_thread *thread;
+
+                    obj = rt_list_entry(obj_list[i], struct rt_object, list);
+                    if ((obj->type & ~RT_Object_Class_Static) != find_arg.type)
+                    {
+                        continue;
+                    }
+
+                    thread = (struct rt_thread*)obj;
+                    cycles = rt_hw_thread_cycles(thread);
+                    if (pass == 0)
+                    {
+                        total += cycles;
+                        continue;
+                    }
+
+                    usage = (rt_uint32_t)(cycles * 1000 / total);
+                    rt_kprintf("%-*.*s %3d %10u  %3d.%d%%\n", maxlen, RT_NAME_MAX, thread->name,
+                            thread->current_priority, (rt_uint32_t)(cycles / 1000),
+                            usage / 10, usage % 10);
+                }
+            }
+        }
+        while (next != (rt_list_t*)RT_NULL);
+    }
+
+    return 0;
+}
+FINSH_FUNCTION_EXPORT(top, show cpu usage of threads);
+MSH_CMD_EXPORT(top, show cpu usage of threads);
+#endif
+
 static void show_wait_queue(struct rt_list_node *list)
 {
     struct rt_thread *thread;
@@ -562,6 +562,10 @@ struct rt_thread
     void        *lwp;
 #endif
 
+#ifdef RT_USING_CPU_USAGE
+    rt_uint64_t cpu_cycles;                             /**< cpu cycles consumed by this thread */
+#endif
+
     rt_uint32_t user_data;                             /**< private user data beyond this thread */
 };
 typedef struct rt_thread *rt_thread_t;
@@ -102,6 +102,21 @@ void rt_hw_context_switch(rt_uint32_t from, rt_uint32_t to);
 void rt_hw_context_switch_to(rt_uint32_t to);
 void rt_hw_context_switch_interrupt(rt_uint32_t from, rt_uint32_t to);
 
+#ifdef RT_USING_PMP_STACK_GUARD
+/*
+ * PMP stack guard interfaces
+ */
+rt_base_t rt_hw_stack_guard_suspend(void);
+void rt_hw_stack_guard_resume(rt_base_t level);
+#endif
+
+#ifdef RT_USING_CPU_USAGE
+/*
+ * CPU usage interfaces
+ */
+rt_uint64_t rt_hw_thread_cycles(rt_thread_t thread);
+#endif
+
 void rt_hw_console_output(const char *str);
 
 void rt_hw_backtrace(rt_uint32_t *fp, rt_uint32_t thread_entry);
@@ -14,6 +14,9 @@
 #include <stdio.h>
 
 #include "cpuport.h"
+#ifdef WITH_COMPONENT_NLOG
+#include "nuclei_log.h"
+#endif
 
 #define SYSTICK_TICK_CONST                          (SOC_TIMER_FREQ / RT_TICK_PER_SECOND)
 
@@ -26,12 +29,32 @@
 #define configMAX_SYSCALL_INTERRUPT_PRIORITY    255
 #endif
 
+#ifdef RT_USING_PMP_STACK_GUARD
+#ifdef RT_USING_OVERFLOW_CHECK
+#error "RT_USING_OVERFLOW_CHECK reads the stack bottom which is protected by RT_USING_PMP_STACK_GUARD"
+#endif
+#ifndef RT_PMP_STACK_GUARD_SIZE
+#define RT_PMP_STACK_GUARD_SIZE                     32
+#endif
+#ifndef RT_PMP_STACK_GUARD_ENTRY
+#define RT_PMP_STACK_GUARD_ENTRY                    0
+#endif
+/* Loads and stores of threads use the privilege in mstatus.MPP, which becomes
+ * user mode after the first mret, so they are checked by the PMP stack guard */
+#define portINITIAL_MSTATUS                         ( MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_FS_INITIAL | MSTATUS_MPRV)
+#else
 #define portINITIAL_MSTATUS                         ( MSTATUS_MPP | MSTATUS_MPIE | MSTATUS_FS_INITIAL)
+#endif
 
 volatile rt_ubase_t  rt_interrupt_from_thread = 0;
 volatile rt_ubase_t  rt_interrupt_to_thread   = 0;
 volatile rt_ubase_t rt_thread_switch_interrupt_flag = 0;
 
+#ifdef RT_USING_CPU_USAGE
+/* mcycle value when the running thread was switched in */
+static rt_uint64_t rt_thread_switch_in_cycle = 0;
+#endif
+
 struct rt_hw_stack_frame {
     rt_ubase_t epc;        /* epc - epc    - program counter                     */
     rt_ubase_t ra;         /* x1  - ra     - return address for jumps            */
@@ -136,13 +159,100 @@ void rt_hw_cpu_shutdown()
     }
 }
 
+#ifdef RT_USING_PMP_STACK_GUARD
+/*
+ * Program PMP entry RT_PMP_STACK_GUARD_ENTRY as a no access region at the
+ * bottom of the stack of the thread to be switched to
+ */
+static void rt_hw_stack_guard_switch(rt_ubase_t to)
+{
+    struct rt_thread *thread = rt_container_of((void *)to, struct rt_thread, sp);
+    rt_ubase_t guard = RT_ALIGN((rt_ubase_t)thread->stack_addr, RT_PMP_STACK_GUARD_SIZE);
+
+    /* NAPOT encoding of [guard, guard + RT_PMP_STACK_GUARD_SIZE) */
+    __set_PMPADDRx(RT_PMP_STACK_GUARD_ENTRY, (guard + RT_PMP_STACK_GUARD_SIZE / 2 - 1) >> PMP_SHIFT);
+}
+
+/**
+ * Access memory with machine mode privilege in current thread, used when
+ * the stack bottom of current thread need to be read, such as list_thread
+ */
+rt_base_t rt_hw_stack_guard_suspend(void)
+{
+    return __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MPRV) & MSTATUS_MPRV;
+}
+
+void rt_hw_stack_guard_resume(rt_base_t level)
+{
+    __RV_CSR_SET(CSR_MSTATUS, level);
+}
+#endif
+
+/*
+ * Called by rt_hw_context_switch_to before the first thread is started
+ */
+void xPortStartFirstThread(rt_ubase_t to)
+{
+#ifdef RT_USING_CPU_USAGE
+    rt_thread_switch_in_cycle = __get_rv_cycle();
+#endif
+#ifdef RT_USING_PMP_STACK_GUARD
+    rv_csr_t mstatus;
+
+    /* Threads are only checked by PMP when mstatus.MPP can be user mode,
+     * it is read as machine mode on a core without user mode */
+    mstatus = __RV_CSR_READ_CLEAR(CSR_MSTATUS, MSTATUS_MPP);
+    RT_ASSERT((__RV_CSR_READ(CSR_MSTATUS) & MSTATUS_MPP) == 0);
+    __RV_CSR_WRITE(CSR_MSTATUS, mstatus);
+    rt_hw_stack_guard_switch(to);
+    __set_PMPxCFG(RT_PMP_STACK_GUARD_ENTRY, PMP_A_NAPOT);
+    /* Background region, all ones NAPOT address covers the whole address space */
+    __set_PMPADDRx(RT_PMP_STACK_GUARD_ENTRY + 1, (rv_csr_t)(-1));
+    __set_PMPxCFG(RT_PMP_STACK_GUARD_ENTRY + 1, PMP_A_NAPOT | PMP_R | PMP_W | PMP_X);
+    /* PMP address registers are read as zero when PMP entry is not present */
+    RT_ASSERT(__get_PMPADDRx(RT_PMP_STACK_GUARD_ENTRY + 1) != 0);
+#endif
+}
+
 void xPortTaskSwitch(void)
 {
+#ifdef RT_USING_CPU_USAGE
+    rt_uint64_t cycle = __get_rv_cycle();
+    struct rt_thread *from;
+
+    /* Charge the cycles since last switch to the thread being switched out */
+    from = rt_container_of((void *)rt_interrupt_from_thread, struct rt_thread, sp);
+    from->cpu_cycles += cycle - rt_thread_switch_in_cycle;
+    rt_thread_switch_in_cycle = cycle;
+#endif
+#ifdef RT_USING_PMP_STACK_GUARD
+    rt_hw_stack_guard_switch(rt_interrupt_to_thread);
+#endif
     /* Clear Software IRQ, A MUST */
     SysTimer_ClearSWIRQ();
     rt_thread_switch_interrupt_flag = 0;
 }
 
+#ifdef RT_USING_CPU_USAGE
+/**
+ * Get cpu cycles consumed by a thread, including the cycles of
+ * current running slice when the thread is the calling thread
+ */
+rt_uint64_t rt_hw_thread_cycles(rt_thread_t thread)
+{
+    rt_uint64_t cycles;
+    rt_base_t level;
+
+    level = rt_hw_interrupt_disable();
+    cycles = thread->cpu_cycles;
+    if (thread == rt_thread_self()) {
+        cycles += __get_rv_cycle() - rt_thread_switch_in_cycle;
+    }
+    rt_hw_interrupt_enable(level);
+    return cycles;
+}
+#endif
+
 void vPortSetupTimerInterrupt(void)
 {
     uint64_t ticks = SYSTICK_TICK_CONST;
@@ -222,6 +332,13 @@ void rt_hw_console_output(const char* str)
 {
     rt_size_t size = 0;
 
+#ifdef WITH_COMPONENT_NLOG
+    /* Defer rt_kprintf output in interrupt handler, flushed later by NLOG_Flush in idle hook */
+    if ((__RV_CSR_READ(CSR_MSUBM) & MSUBM_TYP) == MSUBM_TYP_IRQ) {
+        NLOG_Puts(str);
+        return;
+    }
+#endif
     size = rt_strlen(str);
     for (int i = 0; i < size; i ++) {
         putchar(str[i]);
@@ -244,3 +361,21 @@ void rt_hw_interrupt_enable(rt_base_t level)
 {
     __RV_CSR_WRITE(CSR_MSTATUS, level);
 }
+
+#ifdef RT_USING_CPU_FFS
+/**
+ * This function finds the first bit set (beginning with the least significant bit)
+ * in value and return the index of that bit, using ctz instruction when bitmanip
+ * extension is present.
+ *
+ * @return return the index of the first bit set, starting at 1. If value is 0,
+ * then this function shall return 0.
+ */
+int __rt_ffs(int value)
+{
+    if (value == 0) {
+        return 0;
+    }
+    return (int)__RV_CTZ((unsigned long)(unsigned int)value) + 1;
+}
+#endif
@@ -240,6 +240,15 @@ void  OSTaskStatHook(void)
 #if (OS_CPU_HOOKS_EN > 0u) && (OS_TASK_SW_HOOK_EN > 0u)
 void  OSTaskSwHook(void)
 {
+#if OS_TASK_PROFILE_EN > 0u
+    INT32U  cycles;
+
+    /* Charge the cycles since last switch to the task being switched out */
+    cycles = (INT32U)__RV_CSR_READ(CSR_MCYCLE);
+    OSTCBCur->OSTCBCyclesTot       += cycles - OSTCBCur->OSTCBCyclesStart;
+    OSTCBHighRdy->OSTCBCyclesStart  = cycles;
+#endif
+
 #if OS_APP_HOOKS_EN > 0u
     App_TaskSwHook();
 #endif
@@ -318,6 +318,10 @@ void OSStartHighRdy(void)
     /* Mark OSRunning to True */
     OSRunning = OS_TRUE;
 
+#if OS_TASK_PROFILE_EN > 0u
+    /* Cycles are counted from here, boot time is not charged to the first task */
+    OSTCBHighRdy->OSTCBCyclesStart = (INT32U)__RV_CSR_READ(CSR_MCYCLE);
+#endif
 #if (OS_CPU_HOOKS_EN > 0) && (OS_TASK_SW_HOOK_EN > 0)
     /* Call OSTaskSwHook */
     OSTaskSwHook();
@@ -64,6 +64,11 @@ typedef struct IRegion_Info {
     unsigned long idu_base;             /*!< idu base address */
 } IRegion_Info_Type;
 
+/** \brief Hart id of boot hart, which does the initialization of sections and devices */
+#ifndef BOOT_HARTID
+#define BOOT_HARTID               0
+#endif
+
 /* Simulation mode macros */
 #define SIMULATION_MODE_XLSPIKE   0     /*!< xlspike simulation mode */
 #define SIMULATION_MODE_QEMU      1     /*!< qemu simulation mode */
@@ -153,6 +158,9 @@ typedef enum IRQn {
     SOC_INT_MAX,
 } IRQn_Type;
 
+/** \brief ECLIC IRQn of device interrupt 0, device interrupt id of CIDU is IRQn minus it */
+#define SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET   19
+
 /* =========================================================================================================================== */
 /* ================                                  Exception Code Definition                                ================ */
 /* =========================================================================================================================== */
@@ -228,7 +236,8 @@ extern volatile IRegion_Info_Type SystemIRegionInfo;
 #else
 #define __BITMANIP_PRESENT        0                     /*!< Set to 1 if Bitmainpulation extension is present */
 #endif
-#if defined(__riscv_dsp)
+/* Define __DSP_EMULATION=1 to use C emulation of DSP intrinsics when P extension is not present */
+#if defined(__riscv_dsp) || (defined(__DSP_EMULATION) && (__DSP_EMULATION == 1))
 #define __DSP_PRESENT             1                     /*!< Set to 1 if Partial SIMD(DSP) extension is present */
 #else
 #define __DSP_PRESENT             0                     /*!< Set to 1 if Partial SIMD(DSP) extension is present */
@@ -102,6 +102,16 @@ extern void ECLIC_Init(void);
  */
 extern int32_t ECLIC_Register_IRQ(IRQn_Type IRQn, uint8_t shv, ECLIC_TRIGGER_Type trig_mode, uint8_t lvl, uint8_t priority, void* handler);
 
+/**
+ * \brief  Set harts which receive a device interrupt
+ */
+extern int32_t ECLIC_SetAffinityIRQ(IRQn_Type IRQn, unsigned long hartmask);
+
+/**
+ * \brief  Get harts which receive a device interrupt
+ */
+extern unsigned long ECLIC_GetAffinityIRQ(IRQn_Type IRQn);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,220 @@
+#include "nuclei_sdk_soc.h"
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+/*
+ * String routines which override the C library ones, they are weak,
+ * so application can still provide its own version.
+ */
+
+#if defined(STR_USE_VECTOR) && (defined(RTOS_FREERTOS) || defined(RTOS_UCOSII) || defined(RTOS_RTTHREAD))
+#error "STR_USE_VECTOR is only for baremetal applications, RTOS tasks run with vector unit off"
+#endif
+
+#if defined(__riscv_vector) && defined(STR_USE_VECTOR)
+/*
+ * Vector version using e8 and LMUL=8, so each loop handles up to 8*VLEN/8
+ * bytes, vector registers v0, v8-v23 are used.
+ * Vector registers are not saved by interrupt entry and RTOS context switch,
+ * and RTOS tasks run with vector unit off, so this version is only built
+ * when STR_USE_VECTOR is defined, which is meant for baremetal applications
+ * that don't use vector unit in interrupt handlers.
+ * Buffers shorter than STR_VECTOR_MIN bytes are handled without vector unit.
+ */
+#ifndef STR_VECTOR_MIN
+#define STR_VECTOR_MIN          16
+#endif
+
+/* Avoid compiler converting the byte loops into calls of these functions themselves */
+#define STR_NO_LIBCALL          __attribute__((optimize("no-tree-loop-distribute-patterns")))
+
+__WEAK STR_NO_LIBCALL void *memcpy(void *dst, const void *src, size_t n)
+{
+    unsigned char *d = (unsigned char *)dst;
+    const unsigned char *s = (const unsigned char *)src;
+    size_t vl;
+
+    if (n < STR_VECTOR_MIN) {
+        while (n > 0) {
+            *d++ = *s++;
+            n --;
+        }
+        return dst;
+    }
+    __ASM volatile("1:\n"
+                   "vsetvli %0, %3, e8, m8, ta, ma\n"
+                   "vle8.v v8, (%2)\n"
+                   "add %2, %2, %0\n"
+                   "sub %3, %3, %0\n"
+                   "vse8.v v8, (%1)\n"
+                   "add %1, %1, %0\n"
+                   "bnez %3, 1b"
+                   : "=&r"(vl), "+r"(d), "+r"(s), "+r"(n)
+                   :
+                   : "memory", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15");
+    return dst;
+}
+
+__WEAK STR_NO_LIBCALL void *memset(void *dst, int c, size_t n)
+{
+    unsigned char *d = (unsigned char *)dst;
+    size_t vl;
+
+    if (n < STR_VECTOR_MIN) {
+        while (n > 0) {
+            *d++ = (unsigned char)c;
+            n --;
+        }
+        return dst;
+    }
+    /* vl only decreases in the loop, so first vmv.v.x fills all used elements */
+    __ASM volatile("vsetvli %0, %2, e8, m8, ta, ma\n"
+                   "vmv.v.x v8, %3\n"
+                   "1:\n"
+                   "vsetvli %0, %2, e8, m8, ta, ma\n"
+                   "vse8.v v8, (%1)\n"
+                   "add %1, %1, %0\n"
+                   "sub %2, %2, %0\n"
+                   "bnez %2, 1b"
+                   : "=&r"(vl), "+r"(d), "+r"(n)
+                   : "r"(c)
+                   : "memory", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15");
+    return dst;
+}
+
+__WEAK STR_NO_LIBCALL int memcmp(const void *src1, const void *src2, size_t n)
+{
+    const unsigned char *s1 = (const unsigned char *)src1;
+    const unsigned char *s2 = (const unsigned char *)src2;
+    size_t vl;
+    long idx = -1;
+
+    if (n < STR_VECTOR_MIN) {
+        while (n > 0) {
+            if (*s1 != *s2) {
+                return *s1 - *s2;
+            }
+            s1 ++;
+            s2 ++;
+            n --;
+        }
+        return 0;
+    }
+    /* idx is the first different byte in current vl bytes, or -1 */
+    __ASM volatile("1:\n"
+                   "vsetvli %0, %4, e8, m8, ta, ma\n"
+                   "vle8.v v8, (%2)\n"
+                   "vle8.v v16, (%3)\n"
+                   "vmsne.vv v0, v8, v16\n"
+                   "vfirst.m %1, v0\n"
+                   "bgez %1, 2f\n"
+                   "add %2, %2, %0\n"
+                   "add %3, %3, %0\n"
+                   "sub %4, %4, %0\n"
+                   "bnez %4, 1b\n"
+                   "2:"
+                   : "=&r"(vl), "=&r"(idx), "+r"(s1), "+r"(s2), "+r"(n)
+                   :
+                   : "memory", "v0", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", \
+                     "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23");
+    if (idx < 0) {
+        return 0;
+    }
+    return s1[idx] - s2[idx];
+}
+
+__WEAK size_t strlen(const char *str)
+{
+    const char *s = str;
+    size_t vl;
+    long idx;
+
+    /* fault-only-first load stops at the end of accessible memory, vl is VLMAX or less */
+    __ASM volatile("1:\n"
+                   "vsetvli %0, zero, e8, m8, ta, ma\n"
+                   "vle8ff.v v8, (%2)\n"
+                   "csrr %0, vl\n"
+                   "vmseq.vi v0, v8, 0\n"
+                   "vfirst.m %1, v0\n"
+                   "add %2, %2, %0\n"
+                   "bltz %1, 1b\n"
+                   "sub %2, %2, %0\n"
+                   "add %2, %2, %1"
+                   : "=&r"(vl), "=&r"(idx), "+r"(s)
+                   :
+                   : "memory", "v0", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15");
+    return s - str;
+}
+#endif /* __riscv_vector && STR_USE_VECTOR */
+
+#if defined(__riscv_bitmanip) || defined(__riscv_zbb)
+/*
+ * Word at a time scanning using orc.b, which sets each zero byte of a word
+ * to 0x00 and others to 0xFF, so the first zero byte is found using ctz,
+ * aligned word loads never cross a page or memory region boundary.
+ */
+typedef unsigned long __attribute__((__may_alias__)) str_word_t;
+
+#define STR_WORD_SIZE           sizeof(unsigned long)
+#define STR_WORD_ALIGNED(p)     (((uintptr_t)(p) & (STR_WORD_SIZE - 1)) == 0)
+/* Byte index of the first zero byte in orc.b result, little endian */
+#define STR_ZERO_BYTE(orcb)     (__RV_CTZ(~(orcb)) >> 3)
+
+#if !defined(__riscv_vector) || !defined(STR_USE_VECTOR)
+__WEAK size_t strlen(const char *str)
+{
+    const char *s = str;
+    const str_word_t *w;
+    unsigned long orcb;
+
+    while (!STR_WORD_ALIGNED(s)) {
+        if (*s == '\0') {
+            return s - str;
+        }
+        s ++;
+    }
+    w = (const str_word_t *)s;
+    while ((orcb = __RV_ORCB(*w)) == ~0UL) {
+        w ++;
+    }
+    return (const char *)w - str + STR_ZERO_BYTE(orcb);
+}
+#endif /* !__riscv_vector || !STR_USE_VECTOR */
+
+__WEAK void *memchr(const void *src, int c, size_t n)
+{
+    const unsigned char *s = (const unsigned char *)src;
+    unsigned char ch = (unsigned char)c;
+    unsigned long pattern = (~0UL / 0xFF) * ch;
+    const str_word_t *w;
+    unsigned long orcb;
+
+    while ((n > 0) && !STR_WORD_ALIGNED(s)) {
+        if (*s == ch) {
+            return (void *)s;
+        }
+        s ++;
+        n --;
+    }
+    w = (const str_word_t *)s;
+    while (n >= STR_WORD_SIZE) {
+        /* matched bytes become zero after xor */
+        orcb = __RV_ORCB(*w ^ pattern);
+        if (orcb != ~0UL) {
+            return (void *)((const unsigned char *)w + STR_ZERO_BYTE(orcb));
+        }
+        w ++;
+        n -= STR_WORD_SIZE;
+    }
+    s = (const unsigned char *)w;
+    while (n > 0) {
+        if (*s == ch) {
+            return (void *)s;
+        }
+        s ++;
+        n --;
+    }
+    return NULL;
+}
+#endif /* __riscv_bitmanip || __riscv_zbb */
@@ -138,15 +138,35 @@ void SystemInit(void)
  */
 /** \brief Max exception handler number, don't include the NMI(0xFFF) one */
 #define MAX_SYSTEM_EXCEPTION_NUM        12
+/** \brief Number of harts which have their own exception handlers */
+#if defined(SMP_CPU_CNT) && (SMP_CPU_CNT > 1)
+#define SYSTEM_HART_NUM                 SMP_CPU_CNT
+#else
+#define SYSTEM_HART_NUM                 1
+#endif
 /**
- * \brief      Store the exception handlers for each exception ID
+ * \brief      Store the exception handlers for each exception ID of each hart
  * \note
  * - This SystemExceptionHandlers are used to store all the handlers for all
  * the exception codes Nuclei N/NX core provided.
- * - Exception code 0 - 11, totally 12 exceptions are mapped to SystemExceptionHandlers[0:11]
- * - Exception for NMI is also re-routed to exception handling(exception code 0xFFF) in startup code configuration, the handler itself is mapped to SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM]
+ * - Exception code 0 - 11, totally 12 exceptions are mapped to SystemExceptionHandlers[hart][0:11]
+ * - Exception for NMI is also re-routed to exception handling(exception code 0xFFF) in startup code configuration, the handler itself is mapped to SystemExceptionHandlers[hart][MAX_SYSTEM_EXCEPTION_NUM]
+ * - When SMP_CPU_CNT is defined, each hart uses the handlers indexed by its hartid
  */
-static unsigned long SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM + 1];
+static unsigned long SystemExceptionHandlers[SYSTEM_HART_NUM][MAX_SYSTEM_EXCEPTION_NUM + 1];
+
+/* Exception handlers of current hart, hart id must be less than SMP_CPU_CNT, same as stack setup of startup code */
+static unsigned long *Exception_GetHandlers(void)
+{
+#if SYSTEM_HART_NUM > 1
+    unsigned long hartid = __RV_CSR_READ(CSR_MHARTID);
+
+    if (hartid < SYSTEM_HART_NUM) {
+        return SystemExceptionHandlers[hartid];
+    }
+#endif
+    return SystemExceptionHandlers[0];
+}
 
 /**
  * \brief      Exception Handler Function Typedef
@@ -180,16 +200,18 @@ static void system_default_exception_handler(unsigned long mcause, unsigned long
 }
 
 /**
- * \brief      Initialize all the default core exception handlers
+ * \brief      Initialize all the default core exception handlers of current hart
  * \details
  * The core exception handler for each exception id will be initialized to \ref system_default_exception_handler.
  * \note
- * Called in \ref _init function, used to initialize default exception handlers for all exception IDs
+ * Called in \ref _premain_init function by each hart, used to initialize default exception handlers for all exception IDs
  */
 static void Exception_Init(void)
 {
+    unsigned long *handlers = Exception_GetHandlers();
+
     for (int i = 0; i < MAX_SYSTEM_EXCEPTION_NUM + 1; i++) {
-        SystemExceptionHandlers[i] = (unsigned long)system_default_exception_handler;
+        handlers[i] = (unsigned long)system_default_exception_handler;
     }
 }
 
@@ -219,36 +241,41 @@ void Exception_DumpFrame(unsigned long sp)
 }
 
 /**
- * \brief       Register an exception handler for exception code EXCn
+ * \brief       Register an exception handler for exception code EXCn of current hart
  * \details
- * * For EXCn < \ref MAX_SYSTEM_EXCEPTION_NUM, it will be registered into SystemExceptionHandlers[EXCn-1].
- * * For EXCn == NMI_EXCn, it will be registered into SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM].
+ * * For EXCn < \ref MAX_SYSTEM_EXCEPTION_NUM, it will be registered into SystemExceptionHandlers[hart][EXCn-1].
+ * * For EXCn == NMI_EXCn, it will be registered into SystemExceptionHandlers[hart][MAX_SYSTEM_EXCEPTION_NUM].
+ * * When SMP_CPU_CNT is defined, it must be called by each hart which needs this handler.
  * \param   EXCn    See \ref EXCn_Type
  * \param   exc_handler     The exception handler for this exception code EXCn
  */
 void Exception_Register_EXC(uint32_t EXCn, unsigned long exc_handler)
 {
+    unsigned long *handlers = Exception_GetHandlers();
+
     if ((EXCn < MAX_SYSTEM_EXCEPTION_NUM) && (EXCn >= 0)) {
-        SystemExceptionHandlers[EXCn] = exc_handler;
+        handlers[EXCn] = exc_handler;
     } else if (EXCn == NMI_EXCn) {
-        SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM] = exc_handler;
+        handlers[MAX_SYSTEM_EXCEPTION_NUM] = exc_handler;
     }
 }
 
 /**
- * \brief       Get current exception handler for exception code EXCn
+ * \brief       Get current exception handler for exception code EXCn of current hart
  * \details
- * * For EXCn < \ref MAX_SYSTEM_EXCEPTION_NUM, it will return SystemExceptionHandlers[EXCn-1].
- * * For EXCn == NMI_EXCn, it will return SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM].
+ * * For EXCn < \ref MAX_SYSTEM_EXCEPTION_NUM, it will return SystemExceptionHandlers[hart][EXCn-1].
+ * * For EXCn == NMI_EXCn, it will return SystemExceptionHandlers[hart][MAX_SYSTEM_EXCEPTION_NUM].
  * \param   EXCn    See \ref EXCn_Type
  * \return  Current exception handler for exception code EXCn, if not found, return 0.
  */
 unsigned long Exception_Get_EXC(uint32_t EXCn)
 {
+    unsigned long *handlers = Exception_GetHandlers();
+
     if ((EXCn < MAX_SYSTEM_EXCEPTION_NUM) && (EXCn >= 0)) {
-        return SystemExceptionHandlers[EXCn];
+        return handlers[EXCn];
     } else if (EXCn == NMI_EXCn) {
-        return SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM];
+        return handlers[MAX_SYSTEM_EXCEPTION_NUM];
     } else {
         return 0;
     }
@@ -268,12 +295,13 @@ unsigned long Exception_Get_EXC(uint32_t EXCn)
 uint32_t core_exception_handler(unsigned long mcause, unsigned long sp)
 {
     uint32_t EXCn = (uint32_t)(mcause & 0X00000fff);
+    unsigned long *handlers = Exception_GetHandlers();
     EXC_HANDLER exc_handler;
 
     if ((EXCn < MAX_SYSTEM_EXCEPTION_NUM) && (EXCn >= 0)) {
-        exc_handler = (EXC_HANDLER)SystemExceptionHandlers[EXCn];
+        exc_handler = (EXC_HANDLER)handlers[EXCn];
     } else if (EXCn == NMI_EXCn) {
-        exc_handler = (EXC_HANDLER)SystemExceptionHandlers[MAX_SYSTEM_EXCEPTION_NUM];
+        exc_handler = (EXC_HANDLER)handlers[MAX_SYSTEM_EXCEPTION_NUM];
     } else {
         exc_handler = (EXC_HANDLER)system_default_exception_handler;
     }
@@ -302,6 +330,8 @@ void SystemBannerPrint(void)
  * ECLIC needs be initialized after boot up,
  * Vendor could also change the initialization
  * configuration.
+ * Each hart has its own ECLIC, so it is called
+ * by each hart in \ref _premain_init.
  */
 void ECLIC_Init(void)
 {
@@ -351,6 +381,56 @@ int32_t ECLIC_Register_IRQ(IRQn_Type IRQn, uint8_t shv, ECLIC_TRIGGER_Type trig_
     ECLIC_EnableIRQ(IRQn);
     return 0;
 }
+
+/* Register of CIDU which indicates harts receiving external interrupt n */
+#define CIDU_INT_INDICATOR(base, n) (*(volatile uint32_t *)((uintptr_t)((base) + 0x4000 + ((n) * 4))))
+
+/**
+ * \brief  Set harts which receive a device interrupt
+ * \details
+ * This function routes external interrupt IRQn to the ECLIC of harts set in hartmask
+ * using Cluster Interrupt Distribution Unit(CIDU), so device interrupts can be handled
+ * by different harts.
+ * \param [in]  IRQn        device interrupt, from \ref SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET
+ * \param [in]  hartmask    bit n is set when hart n receives this interrupt
+ * \return       -1 means invalid input parameter or CIDU not present. 0 means successful.
+ * \remarks
+ * - Only available when SMP_CPU_CNT is defined and CIDU is present in internal region
+ * - The interrupt still need to be enabled by \ref ECLIC_Register_IRQ on each receiving hart,
+ *   since it configures ECLIC of the calling hart
+ */
+int32_t ECLIC_SetAffinityIRQ(IRQn_Type IRQn, unsigned long hartmask)
+{
+#if defined(SMP_CPU_CNT) && (SMP_CPU_CNT > 1)
+    if ((IRQn < SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET) || (IRQn >= SOC_INT_MAX) \
+        || (SystemIRegionInfo.idu_base == 0) || (hartmask >> SMP_CPU_CNT) != 0) {
+        return -1;
+    }
+    CIDU_INT_INDICATOR(SystemIRegionInfo.idu_base, IRQn - SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET) = hartmask;
+    __SMP_RWMB();
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * \brief  Get harts which receive a device interrupt
+ * \param [in]  IRQn        device interrupt, from \ref SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET
+ * \return      bit n is set when hart n receives this interrupt, 0 when CIDU not present
+ */
+unsigned long ECLIC_GetAffinityIRQ(IRQn_Type IRQn)
+{
+#if defined(SMP_CPU_CNT) && (SMP_CPU_CNT > 1)
+    if ((IRQn < SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET) || (IRQn >= SOC_INT_MAX) \
+        || (SystemIRegionInfo.idu_base == 0)) {
+        return 0;
+    }
+    return CIDU_INT_INDICATOR(SystemIRegionInfo.idu_base, IRQn - SOC_EXTERNAL_MAP_TO_ECLIC_IRQn_OFFSET);
+#else
+    return 0;
+#endif
+}
 /** @} */ /* End of Doxygen Group NMSIS_Core_ExceptionAndNMI */
 
 volatile IRegion_Info_Type SystemIRegionInfo;
@@ -412,7 +492,7 @@ __attribute__((section(".init"))) void __sync_harts(void)
     __SMP_RWMB();
     
     // pre-condition: interrupt must be disabled, this is done before calling this function
-    if (hartid == 0) { // boot hart
+    if (hartid == BOOT_HARTID) { // boot hart
         // clear msip pending
         for (int i = 0; i < SMP_CPU_CNT; i ++) {
             CLINT_MSIP(clint_base, i) = 0;
@@ -438,12 +518,20 @@ __attribute__((section(".init"))) void __sync_harts(void)
  */
 void _premain_init(void)
 {
-    // TODO to make it possible for configurable boot hartid
+#if defined(SMP_CPU_CNT) && (SMP_CPU_CNT > 1)
     unsigned long hartid = __RV_CSR_READ(CSR_MHARTID);
+#else
+    // the only hart is always the boot hart, same as startup code
+    unsigned long hartid = BOOT_HARTID;
+#endif
 
-    if (hartid == 0) { // only done in boot hart
+    if (hartid == BOOT_HARTID) { // only done in boot hart
         // IREGION INFO MUST BE SET BEFORE ANY PREMAIN INIT STEPS
         _get_iregion_info((IRegion_Info_Type *)(&SystemIRegionInfo));
+        __SMP_RWMB();
+    } else {
+        // wait for iregion info set by boot hart, eclic base is never 0
+        while (SystemIRegionInfo.eclic_base == 0);
     }
     /* TODO: Add your own initialization code here, called before main */
     // This code located in RUNMODE_CONTROL ifdef endif block just for internal usage
@@ -469,16 +557,23 @@ void _premain_init(void)
     __RWMB();
     __FENCE_I();
 
-    if (hartid == 0) { // only required for boot hartid
+    if (hartid == BOOT_HARTID) { // only required for boot hartid
         SystemCoreClock = get_cpu_freq();
         gpio_iof_config(GPIO, IOF0_UART0_MASK, IOF_SEL_0);
         uart_init(SOC_DEBUG_UART, 115200);
         /* Display banner after UART initialized */
         SystemBannerPrint();
-        /* Initialize exception default handlers */
-        Exception_Init();
-        /* ECLIC initialization, mainly MTH and NLBIT */
-        ECLIC_Init();
+    }
+    /* Initialize exception default handlers of this hart */
+    Exception_Init();
+    /* ECLIC initialization of this hart, mainly MTH and NLBIT */
+    ECLIC_Init();
+    if (hartid == BOOT_HARTID) {
+#if defined(WITH_COMPONENT_FUNCPROF)
+        /* Start recording of function profiler component, used by PROFILE=func */
+        extern void NFPROF_Start(void);
+        NFPROF_Start();
+#endif
 #ifdef RUNMODE_CONTROL
         printf("Current RUNMODE=%s, ilm:%d, dlm %d, icache %d, dcache %d, ccm %d\n", \
             RUNMODE_STRING, RUNMODE_ILM_EN, RUNMODE_DLM_EN, \
@@ -502,6 +597,21 @@ void _premain_init(void)
 void _postmain_fini(int status)
 {
     /* TODO: Add your own finishing code here, called after main */
+#if defined(WITH_COMPONENT_PROFILER)
+    /* Dump samples of profiler component before exit */
+    extern void NPROF_Dump(void);
+    NPROF_Dump();
+#endif
+#if defined(WITH_COMPONENT_FUNCPROF)
+    /* Dump records of function profiler component before exit */
+    extern void NFPROF_Dump(void);
+    NFPROF_Dump();
+#endif
+#if defined(WITH_COMPONENT_GCOV)
+    /* Dump gcda data of gcov component, used by PGO=gen */
+    extern void NGCOV_Dump(void);
+    NGCOV_Dump();
+#endif
 #if defined(SIMULATION_MODE)
     extern void simulation_exit(int status);
     simulation_exit(status);
@@ -34,6 +34,9 @@ CORE ?= n307fd
 # it will define c macro SMP_CPU_CNT to be SMP value
 # and define a ld symbol __SMP_CPU_CNT to be used by linker script
 SMP ?=
+# BOOT_HARTID is the hart which initializes sections and devices when SMP is set,
+# it will define c macro BOOT_HARTID, and must be less than SMP
+BOOT_HARTID ?= 0
 
 ifeq ($(BOARD),hbird_eval)
 $(warning BOARD hbird_eval is renamed to nuclei_fpga_eval since Nuclei SDK 0.3.1, please use BOARD=nuclei_fpga_eval now)
@@ -71,6 +74,8 @@ $(call assert,$(call gt,$(SMP),1),SMP must be a integer number >= 2)
 QEMU_OPT += -smp $(SMP)
 COMMON_FLAGS += -DSMP_CPU_CNT=$(SMP)
 LDFLAGS += -Wl,--defsym=__SMP_CPU_CNT=$(SMP)
+$(call assert,$(call lt,$(BOOT_HARTID),$(SMP)),BOOT_HARTID must be less than SMP)
+COMMON_FLAGS += -DBOOT_HARTID=$(BOOT_HARTID)
 endif
 
 # Set RISCV_ARCH and RISCV_ABI
@@ -119,6 +124,10 @@ C_SRCDIRS += $(NUCLEI_SDK_SOC_COMMON)/Source/Stubs/newlib
 else
 # no stubs will be used
 endif
+# Stubs are only referenced by system library, and string routines may be called by code
+# generated in link time, they are not compiled with LTO
+LTO_EXCLUDE_SRCS += $(NUCLEI_SDK_SOC_COMMON)/Source/Stubs/*/*.c \
+		$(NUCLEI_SDK_SOC_COMMON)/Source/demosoc_string.c
 
 ASM_SRCS += $(NUCLEI_SDK_SOC_COMMON)/Source/GCC/startup_demosoc.S \
 		$(NUCLEI_SDK_SOC_COMMON)/Source/GCC/intexc_demosoc.S
@@ -1300,6 +1300,11 @@ void _premain_init(void)
     Exception_Init();
     /* ECLIC initialization, mainly MTH and NLBIT */
     ECLIC_Init();
+#if defined(WITH_COMPONENT_FUNCPROF)
+    /* Start recording of function profiler component, used by PROFILE=func */
+    extern void NFPROF_Start(void);
+    NFPROF_Start();
+#endif
 }
 
 /**
@@ -1314,6 +1319,21 @@ void _premain_init(void)
 void _postmain_fini(int status)
 {
     /* TODO: Add your own finishing code here, called after main */
+#if defined(WITH_COMPONENT_PROFILER)
+    /* Dump samples of profiler component before exit */
+    extern void NPROF_Dump(void);
+    NPROF_Dump();
+#endif
+#if defined(WITH_COMPONENT_FUNCPROF)
+    /* Dump records of function profiler component before exit */
+    extern void NFPROF_Dump(void);
+    NFPROF_Dump();
+#endif
+#if defined(WITH_COMPONENT_GCOV)
+    /* Dump gcda data of gcov component, used by PGO=gen */
+    extern void NGCOV_Dump(void);
+    NGCOV_Dump();
+#endif
 #if defined(SIMULATION_MODE)
     extern void simulation_exit(int status);
     simulation_exit(status);
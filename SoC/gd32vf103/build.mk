@@ -79,6 +79,8 @@ C_SRCDIRS += $(NUCLEI_SDK_SOC_COMMON)/Source/Stubs/newlib
 else
 # no stubs will be used
 endif
+# Stubs are only referenced by system library, they are not compiled with LTO
+LTO_EXCLUDE_SRCS += $(NUCLEI_SDK_SOC_COMMON)/Source/Stubs/*/*.c
 
 # GD32VF103 USB Driver Handling
 USBDRV_ROOT := $(NUCLEI_SDK_SOC_COMMON)/Source/Drivers/Usb
@@ -0,0 +1,380 @@
+/* This file is generated by tools/scripts/misc/gen_dspbench.py, don't edit it */
+#ifndef __DSPBENCH_LIST_H__
+#define __DSPBENCH_LIST_H__
+
+/*
+ * X(name, rettype, type of a...) lists of __RV_ intrinsics in core_feature_dsp.h
+ * X(name, imm) lists of intrinsic macros which need an immediate
+ * Skipped: CLROV RDOV KSLLI32 SLLI32 SRAI32 SRAI32_U SRAIW_U SRLI32 SRLI32_U
+ */
+#define DSPBENCH_UNARY_FUNCS(X) \
+    X(CLRS8, unsigned long, unsigned long) \
+    X(CLRS16, unsigned long, unsigned long) \
+    X(CLRS32, unsigned long, unsigned long) \
+    X(CLO8, unsigned long, unsigned long) \
+    X(CLO16, unsigned long, unsigned long) \
+    X(CLO32, unsigned long, unsigned long) \
+    X(CLZ8, unsigned long, unsigned long) \
+    X(CLZ16, unsigned long, unsigned long) \
+    X(CLZ32, unsigned long, unsigned long) \
+    X(KABS8, unsigned long, unsigned long) \
+    X(KABS16, unsigned long, unsigned long) \
+    X(KABSW, unsigned long, signed long) \
+    X(SUNPKD810, unsigned long, unsigned long) \
+    X(SUNPKD820, unsigned long, unsigned long) \
+    X(SUNPKD830, unsigned long, unsigned long) \
+    X(SUNPKD831, unsigned long, unsigned long) \
+    X(SUNPKD832, unsigned long, unsigned long) \
+    X(SWAP8, unsigned long, unsigned long) \
+    X(SWAP16, unsigned long, unsigned long) \
+    X(ZUNPKD810, unsigned long, unsigned long) \
+    X(ZUNPKD820, unsigned long, unsigned long) \
+    X(ZUNPKD830, unsigned long, unsigned long) \
+    X(ZUNPKD831, unsigned long, unsigned long) \
+    X(ZUNPKD832, unsigned long, unsigned long)
+
+#define DSPBENCH_BINARY_FUNCS(X) \
+    X(ADD8, unsigned long, unsigned long, unsigned long) \
+    X(ADD16, unsigned long, unsigned long, unsigned long) \
+    X(ADD64, unsigned long long, unsigned long long, unsigned long long) \
+    X(AVE, long, long, long) \
+    X(BITREV, unsigned long, unsigned long, unsigned long) \
+    X(CMPEQ8, unsigned long, unsigned long, unsigned long) \
+    X(CMPEQ16, unsigned long, unsigned long, unsigned long) \
+    X(CRAS16, unsigned long, unsigned long, unsigned long) \
+    X(CRSA16, unsigned long, unsigned long, unsigned long) \
+    X(KADD8, unsigned long, unsigned long, unsigned long) \
+    X(KADD16, unsigned long, unsigned long, unsigned long) \
+    X(KADD64, long long, long long, long long) \
+    X(KADDH, long, int, int) \
+    X(KADDW, long, int, int) \
+    X(KCRAS16, unsigned long, unsigned long, unsigned long) \
+    X(KCRSA16, unsigned long, unsigned long, unsigned long) \
+    X(KDMBB, long, unsigned int, unsigned int) \
+    X(KDMBT, long, unsigned int, unsigned int) \
+    X(KDMTT, long, unsigned int, unsigned int) \
+    X(KHM8, unsigned long, unsigned long, unsigned long) \
+    X(KHMX8, unsigned long, unsigned long, unsigned long) \
+    X(KHM16, unsigned long, unsigned long, unsigned long) \
+    X(KHMX16, unsigned long, unsigned long, unsigned long) \
+    X(KHMBB, long, unsigned int, unsigned int) \
+    X(KHMBT, long, unsigned int, unsigned int) \
+    X(KHMTT, long, unsigned int, unsigned int) \
+    X(KMDA, long, unsigned long, unsigned long) \
+    X(KMXDA, long, unsigned long, unsigned long) \
+    X(KMMWB2, long, long, unsigned long) \
+    X(KMMWB2_U, long, long, unsigned long) \
+    X(KMMWT2, long, long, unsigned long) \
+    X(KMMWT2_U, long, long, unsigned long) \
+    X(KSLLW, long, long, unsigned int) \
+    X(KSLL8, unsigned long, unsigned long, unsigned int) \
+    X(KSLL16, unsigned long, unsigned long, unsigned int) \
+    X(KSLRA8, unsigned long, unsigned long, int) \
+    X(KSLRA8_U, unsigned long, unsigned long, int) \
+    X(KSLRA16, unsigned long, unsigned long, int) \
+    X(KSLRA16_U, unsigned long, unsigned long, int) \
+    X(KSLRAW, long, int, int) \
+    X(KSLRAW_U, long, int, int) \
+    X(KSTAS16, unsigned long, unsigned long, unsigned long) \
+    X(KSTSA16, unsigned long, unsigned long, unsigned long) \
+    X(KSUB8, unsigned long, unsigned long, unsigned long) \
+    X(KSUB16, unsigned long, unsigned long, unsigned long) \
+    X(KSUB64, long long, long long, long long) \
+    X(KSUBH, long, int, int) \
+    X(KSUBW, long, int, int) \
+    X(KWMMUL, long, long, long) \
+    X(KWMMUL_U, long, long, long) \
+    X(MAXW, long, int, int) \
+    X(MINW, long, int, int) \
+    X(MULR64, unsigned long long, unsigned long, unsigned long) \
+    X(MULSR64, long long, long, long) \
+    X(PBSAD, unsigned long, unsigned long, unsigned long) \
+    X(PKBB16, unsigned long, unsigned long, unsigned long) \
+    X(PKBT16, unsigned long, unsigned long, unsigned long) \
+    X(PKTT16, unsigned long, unsigned long, unsigned long) \
+    X(PKTB16, unsigned long, unsigned long, unsigned long) \
+    X(RADD8, unsigned long, unsigned long, unsigned long) \
+    X(RADD16, unsigned long, unsigned long, unsigned long) \
+    X(RADD64, long long, long long, long long) \
+    X(RADDW, long, int, int) \
+    X(RCRAS16, unsigned long, unsigned long, unsigned long) \
+    X(RCRSA16, unsigned long, unsigned long, unsigned long) \
+    X(RSTAS16, unsigned long, unsigned long, unsigned long) \
+    X(RSTSA16, unsigned long, unsigned long, unsigned long) \
+    X(RSUB8, unsigned long, unsigned long, unsigned long) \
+    X(RSUB16, unsigned long, unsigned long, unsigned long) \
+    X(RSUB64, long long, long long, long long) \
+    X(RSUBW, long, int, int) \
+    X(SCMPLE8, unsigned long, unsigned long, unsigned long) \
+    X(SCMPLE16, unsigned long, unsigned long, unsigned long) \
+    X(SCMPLT8, unsigned long, unsigned long, unsigned long) \
+    X(SCMPLT16, unsigned long, unsigned long, unsigned long) \
+    X(SLL8, unsigned long, unsigned long, unsigned int) \
+    X(SLL16, unsigned long, unsigned long, unsigned int) \
+    X(SMAL, long long, long long, unsigned long) \
+    X(SMAX8, unsigned long, unsigned long, unsigned long) \
+    X(SMAX16, unsigned long, unsigned long, unsigned long) \
+    X(SMBB16, long, unsigned long, unsigned long) \
+    X(SMBT16, long, unsigned long, unsigned long) \
+    X(SMTT16, long, unsigned long, unsigned long) \
+    X(SMDS, long, unsigned long, unsigned long) \
+    X(SMDRS, long, unsigned long, unsigned long) \
+    X(SMXDS, long, unsigned long, unsigned long) \
+    X(SMIN8, unsigned long, unsigned long, unsigned long) \
+    X(SMIN16, unsigned long, unsigned long, unsigned long) \
+    X(SMMUL, long, long, long) \
+    X(SMMUL_U, long, long, long) \
+    X(SMMWB, long, long, unsigned long) \
+    X(SMMWB_U, long, long, unsigned long) \
+    X(SMMWT, long, long, unsigned long) \
+    X(SMMWT_U, long, long, unsigned long) \
+    X(SMUL8, unsigned long long, unsigned int, unsigned int) \
+    X(SMULX8, unsigned long long, unsigned int, unsigned int) \
+    X(SMUL16, unsigned long long, unsigned int, unsigned int) \
+    X(SMULX16, unsigned long long, unsigned int, unsigned int) \
+    X(SRA_U, long, long, unsigned int) \
+    X(SRA8, unsigned long, unsigned long, unsigned int) \
+    X(SRA8_U, unsigned long, unsigned long, unsigned int) \
+    X(SRA16, unsigned long, unsigned long, unsigned long) \
+    X(SRA16_U, unsigned long, unsigned long, unsigned long) \
+    X(SRL8, unsigned long, unsigned long, unsigned int) \
+    X(SRL8_U, unsigned long, unsigned long, unsigned int) \
+    X(SRL16, unsigned long, unsigned long, unsigned int) \
+    X(SRL16_U, unsigned long, unsigned long, unsigned int) \
+    X(STAS16, unsigned long, unsigned long, unsigned long) \
+    X(STSA16, unsigned long, unsigned long, unsigned long) \
+    X(SUB8, unsigned long, unsigned long, unsigned long) \
+    X(SUB16, unsigned long, unsigned long, unsigned long) \
+    X(SUB64, unsigned long long, unsigned long long, unsigned long long) \
+    X(UCMPLE8, unsigned long, unsigned long, unsigned long) \
+    X(UCMPLE16, unsigned long, unsigned long, unsigned long) \
+    X(UCMPLT8, unsigned long, unsigned long, unsigned long) \
+    X(UCMPLT16, unsigned long, unsigned long, unsigned long) \
+    X(UKADD8, unsigned long, unsigned long, unsigned long) \
+    X(UKADD16, unsigned long, unsigned long, unsigned long) \
+    X(UKADD64, unsigned long long, unsigned long long, unsigned long long) \
+    X(UKADDH, unsigned long, unsigned int, unsigned int) \
+    X(UKADDW, unsigned long, unsigned int, unsigned int) \
+    X(UKCRAS16, unsigned long, unsigned long, unsigned long) \
+    X(UKCRSA16, unsigned long, unsigned long, unsigned long) \
+    X(UKSTAS16, unsigned long, unsigned long, unsigned long) \
+    X(UKSTSA16, unsigned long, unsigned long, unsigned long) \
+    X(UKSUB8, unsigned long, unsigned long, unsigned long) \
+    X(UKSUB16, unsigned long, unsigned long, unsigned long) \
+    X(UKSUB64, unsigned long long, unsigned long long, unsigned long long) \
+    X(UKSUBH, unsigned long, unsigned int, unsigned int) \
+    X(UKSUBW, unsigned long, unsigned int, unsigned int) \
+    X(UMAX8, unsigned long, unsigned long, unsigned long) \
+    X(UMAX16, unsigned long, unsigned long, unsigned long) \
+    X(UMIN8, unsigned long, unsigned long, unsigned long) \
+    X(UMIN16, unsigned long, unsigned long, unsigned long) \
+    X(UMUL8, unsigned long long, unsigned int, unsigned int) \
+    X(UMULX8, unsigned long long, unsigned int, unsigned int) \
+    X(UMUL16, unsigned long long, unsigned int, unsigned int) \
+    X(UMULX16, unsigned long long, unsigned int, unsigned int) \
+    X(URADD8, unsigned long, unsigned long, unsigned long) \
+    X(URADD16, unsigned long, unsigned long, unsigned long) \
+    X(URADD64, unsigned long long, unsigned long long, unsigned long long) \
+    X(URADDW, unsigned long, unsigned int, unsigned int) \
+    X(URCRAS16, unsigned long, unsigned long, unsigned long) \
+    X(URCRSA16, unsigned long, unsigned long, unsigned long) \
+    X(URSTAS16, unsigned long, unsigned long, unsigned long) \
+    X(URSTSA16, unsigned long, unsigned long, unsigned long) \
+    X(URSUB8, unsigned long, unsigned long, unsigned long) \
+    X(URSUB16, unsigned long, unsigned long, unsigned long) \
+    X(URSUB64, unsigned long long, unsigned long long, unsigned long long) \
+    X(URSUBW, unsigned long, unsigned int, unsigned int) \
+    X(WEXT, unsigned long, long long, unsigned int)
+
+#define DSPBENCH_TERNARY_FUNCS(X) \
+    X(BPICK, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(KDMABB, long, long, unsigned int, unsigned int) \
+    X(KDMABT, long, long, unsigned int, unsigned int) \
+    X(KDMATT, long, long, unsigned int, unsigned int) \
+    X(KMABB, long, long, unsigned long, unsigned long) \
+    X(KMABT, long, long, unsigned long, unsigned long) \
+    X(KMATT, long, long, unsigned long, unsigned long) \
+    X(KMADA, long, long, unsigned long, unsigned long) \
+    X(KMAXDA, long, long, unsigned long, unsigned long) \
+    X(KMADS, long, long, unsigned long, unsigned long) \
+    X(KMADRS, long, long, unsigned long, unsigned long) \
+    X(KMAXDS, long, long, unsigned long, unsigned long) \
+    X(KMAR64, long long, long long, long, long) \
+    X(KMMAC, long, long, long, long) \
+    X(KMMAC_U, long, long, long, long) \
+    X(KMMAWB, long, long, unsigned long, unsigned long) \
+    X(KMMAWB_U, long, long, unsigned long, unsigned long) \
+    X(KMMAWB2, long, long, unsigned long, unsigned long) \
+    X(KMMAWB2_U, long, long, unsigned long, unsigned long) \
+    X(KMMAWT, long, long, unsigned long, unsigned long) \
+    X(KMMAWT_U, long, long, unsigned long, unsigned long) \
+    X(KMMAWT2, long, long, unsigned long, unsigned long) \
+    X(KMMAWT2_U, long, long, unsigned long, unsigned long) \
+    X(KMMSB, long, long, long, long) \
+    X(KMMSB_U, long, long, long, long) \
+    X(KMSDA, long, long, unsigned long, unsigned long) \
+    X(KMSXDA, long, long, unsigned long, unsigned long) \
+    X(KMSR64, long long, long long, long, long) \
+    X(MADDR32, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(MSUBR32, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(PBSADA, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(SMALBB, long long, long long, unsigned long, unsigned long) \
+    X(SMALBT, long long, long long, unsigned long, unsigned long) \
+    X(SMALTT, long long, long long, unsigned long, unsigned long) \
+    X(SMALDA, long long, long long, unsigned long, unsigned long) \
+    X(SMALXDA, long long, long long, unsigned long, unsigned long) \
+    X(SMALDS, long long, long long, unsigned long, unsigned long) \
+    X(SMALDRS, long long, long long, unsigned long, unsigned long) \
+    X(SMALXDS, long long, long long, unsigned long, unsigned long) \
+    X(SMAR64, long long, long long, long, long) \
+    X(SMAQA, long, long, unsigned long, unsigned long) \
+    X(SMAQA_SU, long, long, unsigned long, unsigned long) \
+    X(SMSLDA, long long, long long, unsigned long, unsigned long) \
+    X(SMSLXDA, long long, long long, unsigned long, unsigned long) \
+    X(SMSR64, long long, long long, long, long) \
+    X(UKMAR64, unsigned long long, unsigned long long, unsigned long, unsigned long) \
+    X(UKMSR64, unsigned long long, unsigned long long, unsigned long, unsigned long) \
+    X(UMAR64, unsigned long long, unsigned long long, unsigned long, unsigned long) \
+    X(UMAQA, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(UMSR64, unsigned long long, unsigned long long, unsigned long, unsigned long)
+
+#define DSPBENCH_IMM_FUNCS(X) \
+    X(BITREVI, 7) \
+    X(KSLLIW, 5) \
+    X(KSLLI8, 3) \
+    X(KSLLI16, 9) \
+    X(SCLIP8, 3) \
+    X(SCLIP16, 11) \
+    X(SCLIP32, 17) \
+    X(SLLI8, 5) \
+    X(SLLI16, 12) \
+    X(SRAI_U, 5) \
+    X(SRAI8, 3) \
+    X(SRAI8_U, 3) \
+    X(SRAI16, 7) \
+    X(SRAI16_U, 7) \
+    X(SRLI8, 2) \
+    X(SRLI8_U, 2) \
+    X(SRLI16, 9) \
+    X(SRLI16_U, 9) \
+    X(UCLIP8, 5) \
+    X(UCLIP16, 10) \
+    X(UCLIP32, 20) \
+    X(WEXTI, 9)
+
+#define DSPBENCH_TERNARY_IMM_FUNCS(X) \
+    X(INSB, 1)
+
+#if __RISCV_XLEN == 64
+#define DSPBENCH_XLEN_UNARY_FUNCS(X) \
+    X(KABS32, unsigned long, unsigned long)
+
+#define DSPBENCH_XLEN_BINARY_FUNCS(X) \
+    X(ADD32, unsigned long, unsigned long, unsigned long) \
+    X(CRAS32, unsigned long, unsigned long, unsigned long) \
+    X(CRSA32, unsigned long, unsigned long, unsigned long) \
+    X(KADD32, unsigned long, unsigned long, unsigned long) \
+    X(KCRAS32, unsigned long, unsigned long, unsigned long) \
+    X(KCRSA32, unsigned long, unsigned long, unsigned long) \
+    X(KDMBB16, unsigned long, unsigned long, unsigned long) \
+    X(KDMBT16, unsigned long, unsigned long, unsigned long) \
+    X(KDMTT16, unsigned long, unsigned long, unsigned long) \
+    X(KHMBB16, unsigned long, unsigned long, unsigned long) \
+    X(KHMBT16, unsigned long, unsigned long, unsigned long) \
+    X(KHMTT16, unsigned long, unsigned long, unsigned long) \
+    X(KMDA32, long, unsigned long, unsigned long) \
+    X(KMXDA32, long, unsigned long, unsigned long) \
+    X(KSLL32, unsigned long, unsigned long, unsigned int) \
+    X(KSLRA32, unsigned long, unsigned long, int) \
+    X(KSLRA32_U, unsigned long, unsigned long, int) \
+    X(KSTAS32, unsigned long, unsigned long, unsigned long) \
+    X(KSTSA32, unsigned long, unsigned long, unsigned long) \
+    X(KSUB32, unsigned long, unsigned long, unsigned long) \
+    X(PKBB32, unsigned long, unsigned long, unsigned long) \
+    X(PKBT32, unsigned long, unsigned long, unsigned long) \
+    X(PKTT32, unsigned long, unsigned long, unsigned long) \
+    X(PKTB32, unsigned long, unsigned long, unsigned long) \
+    X(RADD32, unsigned long, unsigned long, unsigned long) \
+    X(RCRAS32, unsigned long, unsigned long, unsigned long) \
+    X(RCRSA32, unsigned long, unsigned long, unsigned long) \
+    X(RSTAS32, unsigned long, unsigned long, unsigned long) \
+    X(RSTSA32, unsigned long, unsigned long, unsigned long) \
+    X(RSUB32, unsigned long, unsigned long, unsigned long) \
+    X(SLL32, unsigned long, unsigned long, unsigned int) \
+    X(SMAX32, unsigned long, unsigned long, unsigned long) \
+    X(SMBB32, long, unsigned long, unsigned long) \
+    X(SMBT32, long, unsigned long, unsigned long) \
+    X(SMTT32, long, unsigned long, unsigned long) \
+    X(SMDS32, long, unsigned long, unsigned long) \
+    X(SMDRS32, long, unsigned long, unsigned long) \
+    X(SMXDS32, long, unsigned long, unsigned long) \
+    X(SMIN32, unsigned long, unsigned long, unsigned long) \
+    X(SRA32, unsigned long, unsigned long, unsigned int) \
+    X(SRA32_U, unsigned long, unsigned long, unsigned int) \
+    X(SRL32, unsigned long, unsigned long, unsigned int) \
+    X(SRL32_U, unsigned long, unsigned long, unsigned int) \
+    X(STAS32, unsigned long, unsigned long, unsigned long) \
+    X(STSA32, unsigned long, unsigned long, unsigned long) \
+    X(SUB32, unsigned long, unsigned long, unsigned long) \
+    X(UKADD32, unsigned long, unsigned long, unsigned long) \
+    X(UKCRAS32, unsigned long, unsigned long, unsigned long) \
+    X(UKCRSA32, unsigned long, unsigned long, unsigned long) \
+    X(UKSTAS32, unsigned long, unsigned long, unsigned long) \
+    X(UKSTSA32, unsigned long, unsigned long, unsigned long) \
+    X(UKSUB32, unsigned long, unsigned long, unsigned long) \
+    X(UMAX32, unsigned long, unsigned long, unsigned long) \
+    X(UMIN32, unsigned long, unsigned long, unsigned long) \
+    X(URADD32, unsigned long, unsigned long, unsigned long) \
+    X(URCRAS32, unsigned long, unsigned long, unsigned long) \
+    X(URCRSA32, unsigned long, unsigned long, unsigned long) \
+    X(URSTAS32, unsigned long, unsigned long, unsigned long) \
+    X(URSTSA32, unsigned long, unsigned long, unsigned long) \
+    X(URSUB32, unsigned long, unsigned long, unsigned long)
+
+#define DSPBENCH_XLEN_TERNARY_FUNCS(X) \
+    X(KDMABB16, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(KDMABT16, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(KDMATT16, unsigned long, unsigned long, unsigned long, unsigned long) \
+    X(KMABB32, long, long, unsigned long, unsigned long) \
+    X(KMABT32, long, long, unsigned long, unsigned long) \
+    X(KMATT32, long, long, unsigned long, unsigned long) \
+    X(KMADA32, long, long, unsigned long, unsigned long) \
+    X(KMAXDA32, long, long, unsigned long, unsigned long) \
+    X(KMADS32, long, long, unsigned long, unsigned long) \
+    X(KMADRS32, long, long, unsigned long, unsigned long) \
+    X(KMAXDS32, long, long, unsigned long, unsigned long) \
+    X(KMSDA32, long, long, unsigned long, unsigned long) \
+    X(KMSXDA32, long, long, unsigned long, unsigned long)
+
+#define DSPBENCH_XLEN_IMM_FUNCS(X)
+
+#define DSPBENCH_XLEN_TERNARY_IMM_FUNCS(X)
+
+#else
+#define DSPBENCH_XLEN_UNARY_FUNCS(X) \
+    X(DKABS8, unsigned long long, unsigned long long) \
+    X(DKABS16, unsigned long long, unsigned long long) \
+    X(EXPD80, unsigned long, unsigned long) \
+    X(EXPD81, unsigned long, unsigned long) \
+    X(EXPD82, unsigned long, unsigned long) \
+    X(EXPD83, unsigned long, unsigned long)
+
+#define DSPBENCH_XLEN_BINARY_FUNCS(X) \
+    X(DKHM8, unsigned long long, unsigned long long, unsigned long long) \
+    X(DKHM16, unsigned long long, unsigned long long, unsigned long long) \
+    X(DKSLRA8, unsigned long long, unsigned long long, int) \
+    X(DKSLRA16, unsigned long long, unsigned long long, int) \
+    X(DKADD8, unsigned long long, unsigned long long, unsigned long long) \
+    X(DKADD16, unsigned long long, unsigned long long, unsigned long long) \
+    X(DKSUB8, unsigned long long, unsigned long long, unsigned long long) \
+    X(DKSUB16, unsigned long long, unsigned long long, unsigned long long)
+
+#define DSPBENCH_XLEN_TERNARY_FUNCS(X)
+
+#define DSPBENCH_XLEN_IMM_FUNCS(X)
+
+#define DSPBENCH_XLEN_TERNARY_IMM_FUNCS(X)
+
+#endif
+
+#endif /* __DSPBENCH_LIST_H__ */
@@ -0,0 +1,258 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "nuclei_sdk_soc.h"
+
+#if defined(__DSP_PRESENT) && (__DSP_PRESENT == 1)
+#include "dspbench_list.h"
+
+/*
+ * When DSPBENCH_CHECK is defined, the result and OV flag of each intrinsic
+ * are compared with the C emulation in core_feature_dsp_emu.h
+ */
+#if defined(DSPBENCH_CHECK) && defined(__riscv_dsp)
+#include "core_feature_dsp_emu.h"
+#define DSPBENCH_DO_CHECK       1
+#else
+#define DSPBENCH_DO_CHECK       0
+#endif
+
+#ifndef DSPBENCH_LOOPS
+#define DSPBENCH_LOOPS          32
+#endif
+/* Each loop of kernel executes 4 operations */
+#define DSPBENCH_OPS            (DSPBENCH_LOOPS * 4)
+#define DSPBENCH_REPEAT         3
+
+#define DSPBENCH_IN_V           0x7F8001FF80017FFFULL
+#define DSPBENCH_IN_A           0x0123456789ABCDEFULL
+#define DSPBENCH_IN_B           0x00050003FFF90007ULL
+
+/* Make compiler think x is changed, it generates no instruction */
+#define DSPBENCH_KEEP(x)        __ASM volatile("" : "+r"(x))
+
+typedef unsigned long long (*dspbench_kernel_t)(unsigned long long v, unsigned long long a, \
+                                                unsigned long long b, unsigned long n);
+
+typedef struct {
+    const char *name;
+    dspbench_kernel_t lat;
+    dspbench_kernel_t thr;
+#if DSPBENCH_DO_CHECK
+    dspbench_kernel_t emu;
+#endif
+} dspbench_item_t;
+
+/*
+ * Latency kernel runs op as one dependent chain, throughput kernel runs op
+ * as 4 independent chains, op uses x as chained operand, a and b as the
+ * other operands.
+ */
+#define DSPBENCH_KERNELS(name, type, op)                                                    \
+    static unsigned long long dspbench_lat_##name(unsigned long long v, unsigned long long a, \
+                                                  unsigned long long b, unsigned long n)    \
+    {                                                                                       \
+        type x = (type)v;                                                                   \
+        for (; n > 0; n --) {                                                               \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+        }                                                                                   \
+        return (unsigned long long)x;                                                       \
+    }                                                                                       \
+    static unsigned long long dspbench_thr_##name(unsigned long long v, unsigned long long a, \
+                                                  unsigned long long b, unsigned long n)    \
+    {                                                                                       \
+        type x0 = (type)v, x1 = (type)(v + 1), x2 = (type)(v + 2), x3 = (type)(v + 3);      \
+        for (; n > 0; n --) {                                                               \
+            { type x = x0; x0 = (type)(op); }                                               \
+            { type x = x1; x1 = (type)(op); }                                               \
+            { type x = x2; x2 = (type)(op); }                                               \
+            { type x = x3; x3 = (type)(op); }                                               \
+        }                                                                                   \
+        return (unsigned long long)x0 ^ (unsigned long long)x1 ^                            \
+               (unsigned long long)x2 ^ (unsigned long long)x3;                             \
+    }
+
+#if DSPBENCH_DO_CHECK
+#define DSPBENCH_EMU_KERNEL(name, type, op)                                                 \
+    static unsigned long long dspbench_emu_##name(unsigned long long v, unsigned long long a, \
+                                                  unsigned long long b, unsigned long n)    \
+    {                                                                                       \
+        type x = (type)v;                                                                   \
+        for (; n > 0; n --) {                                                               \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+            x = (type)(op);                                                                 \
+        }                                                                                   \
+        return (unsigned long long)x;                                                       \
+    }
+#define DSPBENCH_ITEM(name)     { #name, dspbench_lat_##name, dspbench_thr_##name, dspbench_emu_##name },
+#else
+#define DSPBENCH_EMU_KERNEL(name, type, op)
+#define DSPBENCH_ITEM(name)     { #name, dspbench_lat_##name, dspbench_thr_##name },
+#endif
+
+#define DSPBENCH_DEFINE(name, type, op, emuop)                                              \
+    DSPBENCH_KERNELS(name, type, op)                                                        \
+    DSPBENCH_EMU_KERNEL(name, type, emuop)
+
+#define DSPBENCH_UNARY(name, rt, ta)                                                        \
+    DSPBENCH_DEFINE(name, ta, __RV_##name(x), __RV_EMU_##name(x))
+#define DSPBENCH_BINARY(name, rt, ta, tb)                                                   \
+    DSPBENCH_DEFINE(name, ta, __RV_##name(x, (tb)a), __RV_EMU_##name(x, (tb)a))
+#define DSPBENCH_TERNARY(name, rt, tt, ta, tb)                                              \
+    DSPBENCH_DEFINE(name, tt, __RV_##name(x, (ta)a, (tb)b), __RV_EMU_##name(x, (ta)a, (tb)b))
+#define DSPBENCH_IMM(name, imm)                                                             \
+    DSPBENCH_DEFINE(name, unsigned long, __RV_##name(x, imm), __RV_EMU_##name(x, imm))
+#define DSPBENCH_TERNARY_IMM(name, imm)                                                     \
+    DSPBENCH_DEFINE(name, unsigned long, __RV_##name(x, (unsigned long)a, imm),             \
+                    __RV_EMU_##name(x, (unsigned long)a, imm))
+
+#define DSPBENCH_ITEM_FUNC(name, ...)       DSPBENCH_ITEM(name)
+
+DSPBENCH_UNARY_FUNCS(DSPBENCH_UNARY)
+DSPBENCH_BINARY_FUNCS(DSPBENCH_BINARY)
+DSPBENCH_TERNARY_FUNCS(DSPBENCH_TERNARY)
+DSPBENCH_IMM_FUNCS(DSPBENCH_IMM)
+DSPBENCH_TERNARY_IMM_FUNCS(DSPBENCH_TERNARY_IMM)
+DSPBENCH_XLEN_UNARY_FUNCS(DSPBENCH_UNARY)
+DSPBENCH_XLEN_BINARY_FUNCS(DSPBENCH_BINARY)
+DSPBENCH_XLEN_TERNARY_FUNCS(DSPBENCH_TERNARY)
+DSPBENCH_XLEN_IMM_FUNCS(DSPBENCH_IMM)
+DSPBENCH_XLEN_TERNARY_IMM_FUNCS(DSPBENCH_TERNARY_IMM)
+
+static const dspbench_item_t dspbench_items[] = {
+    DSPBENCH_UNARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_BINARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_TERNARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_IMM_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_TERNARY_IMM_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_XLEN_UNARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_XLEN_BINARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_XLEN_TERNARY_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_XLEN_IMM_FUNCS(DSPBENCH_ITEM_FUNC)
+    DSPBENCH_XLEN_TERNARY_IMM_FUNCS(DSPBENCH_ITEM_FUNC)
+};
+
+#define DSPBENCH_ITEMS          (sizeof(dspbench_items) / sizeof(dspbench_items[0]))
+
+static unsigned long long dspbench_sink;
+
+/* Empty kernel used to measure the call and loop overhead */
+static unsigned long long dspbench_empty(unsigned long long v, unsigned long long a, \
+                                         unsigned long long b, unsigned long n)
+{
+    unsigned long x = (unsigned long)v;
+
+    for (; n > 0; n --) {
+        DSPBENCH_KEEP(x);
+    }
+    return x;
+}
+
+/* Return the minimal cycles of several runs, first run is used to warm up cache */
+static unsigned long dspbench_measure(dspbench_kernel_t kernel)
+{
+    unsigned long cycle, best = (unsigned long)(-1);
+    uint64_t start;
+    int i;
+
+    dspbench_sink ^= kernel(DSPBENCH_IN_V, DSPBENCH_IN_A, DSPBENCH_IN_B, DSPBENCH_LOOPS);
+    for (i = 0; i < DSPBENCH_REPEAT; i ++) {
+        start = __get_rv_cycle();
+        dspbench_sink ^= kernel(DSPBENCH_IN_V, DSPBENCH_IN_A, DSPBENCH_IN_B, DSPBENCH_LOOPS);
+        cycle = (unsigned long)(__get_rv_cycle() - start);
+        if (cycle < best) {
+            best = cycle;
+        }
+    }
+    return best;
+}
+
+/* Print cycles per operation in x.xx format, no float printf in newlib_small */
+static void dspbench_report(const char *name, const char *type, unsigned long cycle, unsigned long overhead)
+{
+    unsigned long percent = 0;
+
+    if (cycle > overhead) {
+        percent = (cycle - overhead) * 100 / DSPBENCH_OPS;
+    }
+    printf("CSV, %s.%s, %lu.%02lu\n", name, type, percent / 100, percent % 100);
+}
+
+#if DSPBENCH_DO_CHECK
+static const unsigned long long dspbench_edges[] = {
+    0, 1, 0xFFFFFFFFFFFFFFFFULL, 0x7F7F7F7F7F7F7F7FULL, 0x8080808080808080ULL,
+    0x7FFF80007FFF8000ULL, 0x7FFFFFFF80000000ULL, 0x0123456789ABCDEFULL
+};
+
+#define DSPBENCH_EDGES          (sizeof(dspbench_edges) / sizeof(dspbench_edges[0]))
+
+/* Compare result and OV flag of one intrinsic with C emulation using edge values */
+static unsigned long dspbench_check(const dspbench_item_t *item)
+{
+    unsigned long long v, a, b, res, emures;
+    unsigned long ov, emuov, errs = 0;
+    unsigned int i, j, k;
+
+    for (i = 0; i < DSPBENCH_EDGES; i ++) {
+        for (j = 0; j < DSPBENCH_EDGES; j ++) {
+            for (k = 0; k < DSPBENCH_EDGES; k ++) {
+                v = dspbench_edges[i];
+                a = dspbench_edges[j];
+                b = dspbench_edges[k];
+                __RV_CLROV();
+                res = item->lat(v, a, b, 1);
+                ov = __RV_RDOV();
+                __RV_EMU_CLROV();
+                emures = item->emu(v, a, b, 1);
+                emuov = __RV_EMU_RDOV();
+                if ((res != emures) || (ov != emuov)) {
+                    if (errs == 0) {
+                        printf("MISMATCH, %s, 0x%llx 0x%llx 0x%llx: 0x%llx ov %lu, expect 0x%llx ov %lu\n", \
+                               item->name, v, a, b, res, ov, emures, emuov);
+                    }
+                    errs ++;
+                }
+            }
+        }
+    }
+    return errs;
+}
+#endif
+
+int main(void)
+{
+    unsigned long overhead, errs = 0;
+    unsigned int i;
+
+    printf("Benchmark %u DSP intrinsics, cycles per operation\n", (unsigned int)DSPBENCH_ITEMS);
+    overhead = dspbench_measure(dspbench_empty);
+    for (i = 0; i < DSPBENCH_ITEMS; i ++) {
+        dspbench_report(dspbench_items[i].name, "lat", dspbench_measure(dspbench_items[i].lat), overhead);
+        dspbench_report(dspbench_items[i].name, "thr", dspbench_measure(dspbench_items[i].thr), overhead);
+    }
+#if DSPBENCH_DO_CHECK
+    for (i = 0; i < DSPBENCH_ITEMS; i ++) {
+        errs += dspbench_check(&dspbench_items[i]);
+    }
+    printf("Check %u DSP intrinsics with C emulation, %lu errors\n", (unsigned int)DSPBENCH_ITEMS, errs);
+#endif
+    if (errs) {
+        printf("DSP benchmark failed\n");
+        return 1;
+    }
+    printf("DSP benchmark finished\n");
+    return 0;
+}
+#else
+int main(void)
+{
+    printf("DSP is not present, please build with ARCH_EXT=p\n");
+    printf("DSP benchmark finished\n");
+    return 0;
+}
+#endif
@@ -0,0 +1,758 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "nuclei_sdk_soc.h"
+#include "riscv_math.h"
+#include "riscv_const_structs.h"
+#include "ref_dsp.h"
+
+/*
+ * Benchmark NMSIS DSP library functions of each family at several sizes,
+ * outputs of each function are checked against reference in ref_dsp.c
+ * using SNR, results are printed as below, which are parsed by nsdk_bench.py
+ *   CSV, <function>.<size>, <cycles>
+ *   CSV, <function>.<size>.snr, <snr in dB>
+ */
+#ifndef READ_CYCLE
+#define READ_CYCLE              __get_rv_cycle
+#endif
+
+/* Max samples, or max complex samples of complex functions */
+#define DSPLIB_MAX_SIZE         512
+#define DSPLIB_SIZES            3
+/* SNR returned when output is same as reference */
+#define DSPLIB_SNR_MAX          200.0f
+#define DSPLIB_FIR_TAPS         32
+#define DSPLIB_BIQUAD_STAGES    4
+
+typedef union {
+    float32_t f32[2 * DSPLIB_MAX_SIZE];
+    q31_t q31[2 * DSPLIB_MAX_SIZE];
+    q15_t q15[2 * DSPLIB_MAX_SIZE];
+} dsplib_buf_t;
+
+static dsplib_buf_t dsplib_a;
+static dsplib_buf_t dsplib_b;
+static dsplib_buf_t dsplib_out;
+static dsplib_buf_t dsplib_state;
+static float32_t dsplib_test[2 * DSPLIB_MAX_SIZE];
+static float32_t dsplib_ref[2 * DSPLIB_MAX_SIZE];
+static float64_t dsplib_f64[2 * DSPLIB_MAX_SIZE];
+
+static uint32_t dsplib_seed;
+static uint64_t dsplib_start;
+static uint64_t dsplib_cycle;
+
+#define DSPLIB_START()          dsplib_start = READ_CYCLE()
+#define DSPLIB_END()            dsplib_cycle = READ_CYCLE() - dsplib_start
+
+/*
+ * Each case runs the library function of size once, measured by
+ * DSPLIB_START and DSPLIB_END, and returns SNR of the output
+ */
+typedef float32_t (*dsplib_case_t)(uint32_t size);
+
+typedef struct {
+    const char *name;
+    dsplib_case_t func;
+    uint32_t sizes[DSPLIB_SIZES];
+    /* Minimal SNR in dB of output */
+    float32_t snr;
+} dsplib_item_t;
+
+/* Uniform random value in [-0.5, 0.5), same sequence in each run */
+static float32_t dsplib_rand(void)
+{
+    dsplib_seed = dsplib_seed * 1664525UL + 1013904223UL;
+    return (float32_t)((int32_t)dsplib_seed) / 4294967296.0f;
+}
+
+static void dsplib_fill(float32_t *pDst, uint32_t n, float32_t scale, float32_t offset)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        pDst[i] = dsplib_rand() * scale + offset;
+    }
+}
+
+static void dsplib_f32_to_q31(const float32_t *pSrc, q31_t *pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        pDst[i] = (q31_t)(pSrc[i] * 2147483648.0f);
+    }
+}
+
+static void dsplib_q31_to_f32(const q31_t *pSrc, float32_t *pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        pDst[i] = (float32_t)pSrc[i] / 2147483648.0f;
+    }
+}
+
+static void dsplib_f32_to_q15(const float32_t *pSrc, q15_t *pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        pDst[i] = (q15_t)(pSrc[i] * 32768.0f);
+    }
+}
+
+static void dsplib_q15_to_f32(const q15_t *pSrc, float32_t *pDst, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        pDst[i] = (float32_t)pSrc[i] / 32768.0f;
+    }
+}
+
+static float32_t dsplib_snr(const float32_t *pRef, const float32_t *pTest, uint32_t n)
+{
+    float64_t signal = 0.0, noise = 0.0, diff;
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        if (isnan(pTest[i]) || isinf(pTest[i])) {
+            return 0.0f;
+        }
+        diff = (float64_t)pRef[i] - pTest[i];
+        signal += (float64_t)pRef[i] * pRef[i];
+        noise += diff * diff;
+    }
+    if (noise == 0.0) {
+        return DSPLIB_SNR_MAX;
+    }
+    return (float32_t)(10.0 * log10(signal / noise));
+}
+
+/* Filtering functions, size is block size */
+static float32_t dsplib_fir_f32(uint32_t size)
+{
+    riscv_fir_instance_f32 S;
+    float32_t *coeffs = dsplib_b.f32;
+
+    dsplib_fill(coeffs, DSPLIB_FIR_TAPS, 0.2f, 0.0f);
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 0.0f);
+    riscv_fir_init_f32(&S, DSPLIB_FIR_TAPS, coeffs, dsplib_state.f32, size);
+    DSPLIB_START();
+    riscv_fir_f32(&S, dsplib_a.f32, dsplib_out.f32, size);
+    DSPLIB_END();
+    ref_fir(coeffs, DSPLIB_FIR_TAPS, dsplib_a.f32, dsplib_ref, size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_fir_q31(uint32_t size)
+{
+    riscv_fir_instance_q31 S;
+
+    dsplib_fill(dsplib_test, DSPLIB_FIR_TAPS, 0.2f, 0.0f);
+    dsplib_f32_to_q31(dsplib_test, dsplib_b.q31, DSPLIB_FIR_TAPS);
+    dsplib_q31_to_f32(dsplib_b.q31, dsplib_test, DSPLIB_FIR_TAPS);
+    /* Small input, so output doesn't overflow */
+    dsplib_fill(dsplib_test + DSPLIB_FIR_TAPS, size, 0.5f, 0.0f);
+    dsplib_f32_to_q31(dsplib_test + DSPLIB_FIR_TAPS, dsplib_a.q31, size);
+    dsplib_q31_to_f32(dsplib_a.q31, dsplib_test + DSPLIB_FIR_TAPS, size);
+    riscv_fir_init_q31(&S, DSPLIB_FIR_TAPS, dsplib_b.q31, dsplib_state.q31, size);
+    DSPLIB_START();
+    riscv_fir_q31(&S, dsplib_a.q31, dsplib_out.q31, size);
+    DSPLIB_END();
+    ref_fir(dsplib_test, DSPLIB_FIR_TAPS, dsplib_test + DSPLIB_FIR_TAPS, dsplib_ref, size);
+    dsplib_q31_to_f32(dsplib_out.q31, dsplib_test, size);
+    return dsplib_snr(dsplib_ref, dsplib_test, size);
+}
+
+static float32_t dsplib_fir_q15(uint32_t size)
+{
+    riscv_fir_instance_q15 S;
+
+    dsplib_fill(dsplib_test, DSPLIB_FIR_TAPS, 0.2f, 0.0f);
+    dsplib_f32_to_q15(dsplib_test, dsplib_b.q15, DSPLIB_FIR_TAPS);
+    dsplib_q15_to_f32(dsplib_b.q15, dsplib_test, DSPLIB_FIR_TAPS);
+    dsplib_fill(dsplib_test + DSPLIB_FIR_TAPS, size, 0.5f, 0.0f);
+    dsplib_f32_to_q15(dsplib_test + DSPLIB_FIR_TAPS, dsplib_a.q15, size);
+    dsplib_q15_to_f32(dsplib_a.q15, dsplib_test + DSPLIB_FIR_TAPS, size);
+    if (riscv_fir_init_q15(&S, DSPLIB_FIR_TAPS, dsplib_b.q15, dsplib_state.q15, size) != RISCV_MATH_SUCCESS) {
+        return 0.0f;
+    }
+    DSPLIB_START();
+    riscv_fir_q15(&S, dsplib_a.q15, dsplib_out.q15, size);
+    DSPLIB_END();
+    ref_fir(dsplib_test, DSPLIB_FIR_TAPS, dsplib_test + DSPLIB_FIR_TAPS, dsplib_ref, size);
+    dsplib_q15_to_f32(dsplib_out.q15, dsplib_test, size);
+    return dsplib_snr(dsplib_ref, dsplib_test, size);
+}
+
+/* 2nd order butterworth lowpass stage, a1 and a2 are negated */
+static const float32_t dsplib_biquad_stage[5] = {
+    0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f
+};
+
+static float32_t dsplib_biquad_cascade_df2T_f32(uint32_t size)
+{
+    riscv_biquad_cascade_df2T_instance_f32 S;
+    float32_t *coeffs = dsplib_b.f32;
+    uint32_t i;
+
+    for (i = 0; i < 5 * DSPLIB_BIQUAD_STAGES; i++) {
+        coeffs[i] = dsplib_biquad_stage[i % 5];
+    }
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 0.0f);
+    riscv_fill_f32(0.0f, dsplib_state.f32, 2 * DSPLIB_BIQUAD_STAGES);
+    riscv_biquad_cascade_df2T_init_f32(&S, DSPLIB_BIQUAD_STAGES, coeffs, dsplib_state.f32);
+    DSPLIB_START();
+    riscv_biquad_cascade_df2T_f32(&S, dsplib_a.f32, dsplib_out.f32, size);
+    DSPLIB_END();
+    ref_biquad_cascade_df2T(coeffs, DSPLIB_BIQUAD_STAGES, dsplib_a.f32, dsplib_ref, size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+/*
+ * Transform functions, size is fft length. Instances of fixed lengths are
+ * used, because init functions link twiddle tables of all lengths.
+ */
+static const riscv_cfft_instance_f32 *dsplib_cfft_f32_instance(uint32_t size)
+{
+    switch (size) {
+        case 32: return &riscv_cfft_sR_f32_len32;
+        case 64: return &riscv_cfft_sR_f32_len64;
+        case 128: return &riscv_cfft_sR_f32_len128;
+        case 256: return &riscv_cfft_sR_f32_len256;
+        case 512: return &riscv_cfft_sR_f32_len512;
+        default: return NULL;
+    }
+}
+
+static const float32_t *dsplib_rfft_twiddle(uint32_t size)
+{
+    switch (size) {
+        case 64: return twiddleCoef_rfft_64;
+        case 256: return twiddleCoef_rfft_256;
+        case 512: return twiddleCoef_rfft_512;
+        default: return NULL;
+    }
+}
+
+static const riscv_cfft_instance_q15 *dsplib_cfft_q15_instance(uint32_t size)
+{
+    switch (size) {
+        case 64: return &riscv_cfft_sR_q15_len64;
+        case 256: return &riscv_cfft_sR_q15_len256;
+        case 512: return &riscv_cfft_sR_q15_len512;
+        default: return NULL;
+    }
+}
+
+/* Reference complex FFT of size samples in pSrc, divided by scale */
+static void dsplib_ref_cfft(const float32_t *pSrc, uint32_t size, float64_t scale)
+{
+    uint32_t i;
+
+    for (i = 0; i < 2 * size; i++) {
+        dsplib_f64[i] = pSrc[i];
+    }
+    ref_cfft(dsplib_f64, size);
+    for (i = 0; i < 2 * size; i++) {
+        dsplib_ref[i] = (float32_t)(dsplib_f64[i] / scale);
+    }
+}
+
+static float32_t dsplib_cfft_f32(uint32_t size)
+{
+    const riscv_cfft_instance_f32 *S = dsplib_cfft_f32_instance(size);
+
+    if (S == NULL) {
+        return 0.0f;
+    }
+    dsplib_fill(dsplib_a.f32, 2 * size, 1.0f, 0.0f);
+    riscv_copy_f32(dsplib_a.f32, dsplib_out.f32, 2 * size);
+    DSPLIB_START();
+    riscv_cfft_f32(S, dsplib_out.f32, 0, 1);
+    DSPLIB_END();
+    dsplib_ref_cfft(dsplib_a.f32, size, 1.0);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 2 * size);
+}
+
+static float32_t dsplib_rfft_fast_f32(uint32_t size)
+{
+    riscv_rfft_fast_instance_f32 S;
+    const riscv_cfft_instance_f32 *cfft = dsplib_cfft_f32_instance(size / 2);
+    uint32_t i;
+
+    S.pTwiddleRFFT = dsplib_rfft_twiddle(size);
+    if ((cfft == NULL) || (S.pTwiddleRFFT == NULL)) {
+        return 0.0f;
+    }
+    S.Sint = *cfft;
+    S.fftLenRFFT = size;
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 0.0f);
+    riscv_copy_f32(dsplib_a.f32, dsplib_b.f32, size);
+    DSPLIB_START();
+    riscv_rfft_fast_f32(&S, dsplib_b.f32, dsplib_out.f32, 0);
+    DSPLIB_END();
+    /* Output is X[0].re, X[N/2].re, then X[1] to X[N/2-1] */
+    for (i = 0; i < size; i++) {
+        dsplib_test[2 * i] = dsplib_a.f32[i];
+        dsplib_test[2 * i + 1] = 0.0f;
+    }
+    dsplib_ref_cfft(dsplib_test, size, 1.0);
+    dsplib_ref[1] = dsplib_ref[size];
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_cfft_q15(uint32_t size)
+{
+    const riscv_cfft_instance_q15 *S = dsplib_cfft_q15_instance(size);
+
+    if (S == NULL) {
+        return 0.0f;
+    }
+    dsplib_fill(dsplib_test, 2 * size, 1.0f, 0.0f);
+    dsplib_f32_to_q15(dsplib_test, dsplib_a.q15, 2 * size);
+    dsplib_q15_to_f32(dsplib_a.q15, dsplib_test, 2 * size);
+    riscv_copy_q15(dsplib_a.q15, dsplib_out.q15, 2 * size);
+    DSPLIB_START();
+    riscv_cfft_q15(S, dsplib_out.q15, 0, 1);
+    DSPLIB_END();
+    /* Output of q15 cfft is scaled down by fft length */
+    dsplib_ref_cfft(dsplib_test, size, (float64_t)size);
+    dsplib_q15_to_f32(dsplib_out.q15, dsplib_test, 2 * size);
+    return dsplib_snr(dsplib_ref, dsplib_test, 2 * size);
+}
+
+/* Matrix functions, size is rows and columns of square matrix */
+static float32_t dsplib_mat_mult_f32(uint32_t size)
+{
+    riscv_matrix_instance_f32 A, B, D;
+
+    dsplib_fill(dsplib_a.f32, size * size, 1.0f, 0.0f);
+    dsplib_fill(dsplib_b.f32, size * size, 1.0f, 0.0f);
+    riscv_mat_init_f32(&A, size, size, dsplib_a.f32);
+    riscv_mat_init_f32(&B, size, size, dsplib_b.f32);
+    riscv_mat_init_f32(&D, size, size, dsplib_out.f32);
+    DSPLIB_START();
+    riscv_mat_mult_f32(&A, &B, &D);
+    DSPLIB_END();
+    ref_mat_mult(dsplib_a.f32, dsplib_b.f32, dsplib_ref, size, size, size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size * size);
+}
+
+static float32_t dsplib_mat_mult_q31(uint32_t size)
+{
+    riscv_matrix_instance_q31 A, B, D;
+    float32_t *fa = dsplib_test, *fb = dsplib_test + size * size;
+
+    /* Small values, so sum of products doesn't saturate */
+    dsplib_fill(fa, size * size, 0.25f, 0.0f);
+    dsplib_fill(fb, size * size, 0.25f, 0.0f);
+    dsplib_f32_to_q31(fa, dsplib_a.q31, size * size);
+    dsplib_f32_to_q31(fb, dsplib_b.q31, size * size);
+    riscv_mat_init_q31(&A, size, size, dsplib_a.q31);
+    riscv_mat_init_q31(&B, size, size, dsplib_b.q31);
+    riscv_mat_init_q31(&D, size, size, dsplib_out.q31);
+    DSPLIB_START();
+    riscv_mat_mult_q31(&A, &B, &D);
+    DSPLIB_END();
+    dsplib_q31_to_f32(dsplib_a.q31, fa, size * size);
+    dsplib_q31_to_f32(dsplib_b.q31, fb, size * size);
+    ref_mat_mult(fa, fb, dsplib_ref, size, size, size);
+    dsplib_q31_to_f32(dsplib_out.q31, dsplib_test, size * size);
+    return dsplib_snr(dsplib_ref, dsplib_test, size * size);
+}
+
+static float32_t dsplib_mat_trans_f32(uint32_t size)
+{
+    riscv_matrix_instance_f32 A, D;
+
+    dsplib_fill(dsplib_a.f32, size * size, 1.0f, 0.0f);
+    riscv_mat_init_f32(&A, size, size, dsplib_a.f32);
+    riscv_mat_init_f32(&D, size, size, dsplib_out.f32);
+    DSPLIB_START();
+    riscv_mat_trans_f32(&A, &D);
+    DSPLIB_END();
+    ref_mat_trans(dsplib_a.f32, dsplib_ref, size, size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size * size);
+}
+
+static float32_t dsplib_mat_inverse_f32(uint32_t size)
+{
+    riscv_matrix_instance_f32 A, D;
+    uint32_t i;
+
+    /* Diagonally dominant matrix is well conditioned */
+    dsplib_fill(dsplib_a.f32, size * size, 0.2f, 0.0f);
+    for (i = 0; i < size; i++) {
+        dsplib_a.f32[i * size + i] += 1.0f;
+    }
+    /* Source matrix is modified by library function */
+    riscv_copy_f32(dsplib_a.f32, dsplib_b.f32, size * size);
+    riscv_mat_init_f32(&A, size, size, dsplib_b.f32);
+    riscv_mat_init_f32(&D, size, size, dsplib_out.f32);
+    DSPLIB_START();
+    riscv_mat_inverse_f32(&A, &D);
+    DSPLIB_END();
+    if (ref_mat_inverse(dsplib_a.f32, dsplib_ref, dsplib_f64, size) != 0) {
+        return 0.0f;
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size * size);
+}
+
+/*
+ * Statistics functions, size is block size, input has an offset, so
+ * the single output value is not close to zero
+ */
+static float32_t dsplib_mean_f32(uint32_t size)
+{
+    float64_t sum = 0.0;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 1.0f);
+    DSPLIB_START();
+    riscv_mean_f32(dsplib_a.f32, size, dsplib_out.f32);
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        sum += dsplib_a.f32[i];
+    }
+    dsplib_ref[0] = (float32_t)(sum / size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 1);
+}
+
+/* Reference sample variance */
+static float64_t dsplib_ref_var(const float32_t *pSrc, uint32_t size)
+{
+    float64_t mean = 0.0, sum = 0.0;
+    uint32_t i;
+
+    for (i = 0; i < size; i++) {
+        mean += pSrc[i];
+    }
+    mean /= size;
+    for (i = 0; i < size; i++) {
+        sum += (pSrc[i] - mean) * (pSrc[i] - mean);
+    }
+    return sum / (size - 1);
+}
+
+static float32_t dsplib_var_f32(uint32_t size)
+{
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 1.0f);
+    DSPLIB_START();
+    riscv_var_f32(dsplib_a.f32, size, dsplib_out.f32);
+    DSPLIB_END();
+    dsplib_ref[0] = (float32_t)dsplib_ref_var(dsplib_a.f32, size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 1);
+}
+
+static float32_t dsplib_std_f32(uint32_t size)
+{
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 1.0f);
+    DSPLIB_START();
+    riscv_std_f32(dsplib_a.f32, size, dsplib_out.f32);
+    DSPLIB_END();
+    dsplib_ref[0] = (float32_t)sqrt(dsplib_ref_var(dsplib_a.f32, size));
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 1);
+}
+
+static float32_t dsplib_rms_f32(uint32_t size)
+{
+    float64_t sum = 0.0;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 1.0f);
+    DSPLIB_START();
+    riscv_rms_f32(dsplib_a.f32, size, dsplib_out.f32);
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        sum += (float64_t)dsplib_a.f32[i] * dsplib_a.f32[i];
+    }
+    dsplib_ref[0] = (float32_t)sqrt(sum / size);
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 1);
+}
+
+static float32_t dsplib_max_f32(uint32_t size)
+{
+    uint32_t i, index, refindex = 0;
+
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 1.0f);
+    DSPLIB_START();
+    riscv_max_f32(dsplib_a.f32, size, dsplib_out.f32, &index);
+    DSPLIB_END();
+    for (i = 1; i < size; i++) {
+        if (dsplib_a.f32[i] > dsplib_a.f32[refindex]) {
+            refindex = i;
+        }
+    }
+    if (index != refindex) {
+        return 0.0f;
+    }
+    dsplib_ref[0] = dsplib_a.f32[refindex];
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 1);
+}
+
+/* Fast math functions, size is number of calls */
+static float32_t dsplib_sin_f32(uint32_t size)
+{
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, size, 4.0f * PI, 0.0f);
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        dsplib_out.f32[i] = riscv_sin_f32(dsplib_a.f32[i]);
+    }
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        dsplib_ref[i] = (float32_t)sin(dsplib_a.f32[i]);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_cos_f32(uint32_t size)
+{
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, size, 4.0f * PI, 0.0f);
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        dsplib_out.f32[i] = riscv_cos_f32(dsplib_a.f32[i]);
+    }
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        dsplib_ref[i] = (float32_t)cos(dsplib_a.f32[i]);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_sqrt_f32(uint32_t size)
+{
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 0.5f);
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        riscv_sqrt_f32(dsplib_a.f32[i], &dsplib_out.f32[i]);
+    }
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        dsplib_ref[i] = (float32_t)sqrt(dsplib_a.f32[i]);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+/* Complex functions, size is number of complex samples */
+static float32_t dsplib_cmplx_mag_f32(uint32_t size)
+{
+    float64_t re, im;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, 2 * size, 1.0f, 0.0f);
+    DSPLIB_START();
+    riscv_cmplx_mag_f32(dsplib_a.f32, dsplib_out.f32, size);
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        re = dsplib_a.f32[2 * i];
+        im = dsplib_a.f32[2 * i + 1];
+        dsplib_ref[i] = (float32_t)sqrt(re * re + im * im);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_cmplx_mult_cmplx_f32(uint32_t size)
+{
+    float64_t ar, ai, br, bi;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, 2 * size, 1.0f, 0.0f);
+    dsplib_fill(dsplib_b.f32, 2 * size, 1.0f, 0.0f);
+    DSPLIB_START();
+    riscv_cmplx_mult_cmplx_f32(dsplib_a.f32, dsplib_b.f32, dsplib_out.f32, size);
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        ar = dsplib_a.f32[2 * i];
+        ai = dsplib_a.f32[2 * i + 1];
+        br = dsplib_b.f32[2 * i];
+        bi = dsplib_b.f32[2 * i + 1];
+        dsplib_ref[2 * i] = (float32_t)(ar * br - ai * bi);
+        dsplib_ref[2 * i + 1] = (float32_t)(ar * bi + ai * br);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 2 * size);
+}
+
+static float32_t dsplib_cmplx_dot_prod_f32(uint32_t size)
+{
+    float64_t re = 0.0, im = 0.0, ar, ai, br, bi;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, 2 * size, 1.0f, 0.0f);
+    dsplib_fill(dsplib_b.f32, 2 * size, 1.0f, 0.0f);
+    DSPLIB_START();
+    riscv_cmplx_dot_prod_f32(dsplib_a.f32, dsplib_b.f32, size, &dsplib_out.f32[0], &dsplib_out.f32[1]);
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        ar = dsplib_a.f32[2 * i];
+        ai = dsplib_a.f32[2 * i + 1];
+        br = dsplib_b.f32[2 * i];
+        bi = dsplib_b.f32[2 * i + 1];
+        re += ar * br - ai * bi;
+        im += ar * bi + ai * br;
+    }
+    dsplib_ref[0] = (float32_t)re;
+    dsplib_ref[1] = (float32_t)im;
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 2);
+}
+
+/* Controller functions, size is number of samples */
+static float32_t dsplib_pid_f32(uint32_t size)
+{
+    riscv_pid_instance_f32 S;
+    float64_t x1 = 0.0, x2 = 0.0, y = 0.0;
+    uint32_t i;
+
+    S.Kp = 0.5f;
+    S.Ki = 0.1f;
+    S.Kd = 0.05f;
+    riscv_pid_init_f32(&S, 1);
+    dsplib_fill(dsplib_a.f32, size, 1.0f, 0.0f);
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        dsplib_out.f32[i] = riscv_pid_f32(&S, dsplib_a.f32[i]);
+    }
+    DSPLIB_END();
+    /* y[n] = y[n-1] + A0 * x[n] + A1 * x[n-1] + A2 * x[n-2] */
+    for (i = 0; i < size; i++) {
+        y += (0.5 + 0.1 + 0.05) * dsplib_a.f32[i] + (-0.5 - 2 * 0.05) * x1 + 0.05 * x2;
+        x2 = x1;
+        x1 = dsplib_a.f32[i];
+        dsplib_ref[i] = (float32_t)y;
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, size);
+}
+
+static float32_t dsplib_sin_cos_f32(uint32_t size)
+{
+    uint32_t i;
+
+    /* Angle in degrees */
+    dsplib_fill(dsplib_a.f32, size, 720.0f, 0.0f);
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        riscv_sin_cos_f32(dsplib_a.f32[i], &dsplib_out.f32[2 * i], &dsplib_out.f32[2 * i + 1]);
+    }
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        dsplib_ref[2 * i] = (float32_t)sin(dsplib_a.f32[i] * PI / 180.0);
+        dsplib_ref[2 * i + 1] = (float32_t)cos(dsplib_a.f32[i] * PI / 180.0);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 2 * size);
+}
+
+static float32_t dsplib_park_f32(uint32_t size)
+{
+    float64_t ia, ib, s, c;
+    uint32_t i;
+
+    dsplib_fill(dsplib_a.f32, 2 * size, 1.0f, 0.0f);
+    for (i = 0; i < size; i++) {
+        dsplib_b.f32[2 * i] = (float32_t)sin(i * 0.1);
+        dsplib_b.f32[2 * i + 1] = (float32_t)cos(i * 0.1);
+    }
+    DSPLIB_START();
+    for (i = 0; i < size; i++) {
+        riscv_park_f32(dsplib_a.f32[2 * i], dsplib_a.f32[2 * i + 1], &dsplib_out.f32[2 * i], \
+                       &dsplib_out.f32[2 * i + 1], dsplib_b.f32[2 * i], dsplib_b.f32[2 * i + 1]);
+    }
+    DSPLIB_END();
+    for (i = 0; i < size; i++) {
+        ia = dsplib_a.f32[2 * i];
+        ib = dsplib_a.f32[2 * i + 1];
+        s = dsplib_b.f32[2 * i];
+        c = dsplib_b.f32[2 * i + 1];
+        dsplib_ref[2 * i] = (float32_t)(ia * c + ib * s);
+        dsplib_ref[2 * i + 1] = (float32_t)(-ia * s + ib * c);
+    }
+    return dsplib_snr(dsplib_ref, dsplib_out.f32, 2 * size);
+}
+
+#define DSPLIB_BLOCK_SIZES      {64, 256, DSPLIB_MAX_SIZE}
+#define DSPLIB_FFT_SIZES        {64, 256, DSPLIB_MAX_SIZE}
+#define DSPLIB_MATRIX_SIZES     {4, 8, 16}
+
+static const dsplib_item_t dsplib_items[] = {
+    /* Filtering */
+    { "riscv_fir_f32", dsplib_fir_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_fir_q31", dsplib_fir_q31, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_fir_q15", dsplib_fir_q15, DSPLIB_BLOCK_SIZES, 50.0f },
+    { "riscv_biquad_cascade_df2T_f32", dsplib_biquad_cascade_df2T_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    /* Transform */
+    { "riscv_cfft_f32", dsplib_cfft_f32, DSPLIB_FFT_SIZES, 100.0f },
+    { "riscv_rfft_fast_f32", dsplib_rfft_fast_f32, DSPLIB_FFT_SIZES, 100.0f },
+    { "riscv_cfft_q15", dsplib_cfft_q15, DSPLIB_FFT_SIZES, 25.0f },
+    /* Matrix */
+    { "riscv_mat_mult_f32", dsplib_mat_mult_f32, DSPLIB_MATRIX_SIZES, 100.0f },
+    { "riscv_mat_mult_q31", dsplib_mat_mult_q31, DSPLIB_MATRIX_SIZES, 100.0f },
+    { "riscv_mat_trans_f32", dsplib_mat_trans_f32, DSPLIB_MATRIX_SIZES, 100.0f },
+    { "riscv_mat_inverse_f32", dsplib_mat_inverse_f32, DSPLIB_MATRIX_SIZES, 80.0f },
+    /* Statistics */
+    { "riscv_mean_f32", dsplib_mean_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_var_f32", dsplib_var_f32, DSPLIB_BLOCK_SIZES, 80.0f },
+    { "riscv_std_f32", dsplib_std_f32, DSPLIB_BLOCK_SIZES, 80.0f },
+    { "riscv_rms_f32", dsplib_rms_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_max_f32", dsplib_max_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    /* Fast math, using interpolated tables */
+    { "riscv_sin_f32", dsplib_sin_f32, DSPLIB_BLOCK_SIZES, 60.0f },
+    { "riscv_cos_f32", dsplib_cos_f32, DSPLIB_BLOCK_SIZES, 60.0f },
+    { "riscv_sqrt_f32", dsplib_sqrt_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    /* Complex */
+    { "riscv_cmplx_mag_f32", dsplib_cmplx_mag_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_cmplx_mult_cmplx_f32", dsplib_cmplx_mult_cmplx_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_cmplx_dot_prod_f32", dsplib_cmplx_dot_prod_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    /* Controller */
+    { "riscv_pid_f32", dsplib_pid_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+    { "riscv_sin_cos_f32", dsplib_sin_cos_f32, DSPLIB_BLOCK_SIZES, 60.0f },
+    { "riscv_park_f32", dsplib_park_f32, DSPLIB_BLOCK_SIZES, 100.0f },
+};
+
+#define DSPLIB_ITEMS            (sizeof(dsplib_items) / sizeof(dsplib_items[0]))
+
+/* Print SNR in x.y format, no float printf in newlib_small */
+static void dsplib_report(const char *name, uint32_t size, uint64_t cycle, float32_t snr)
+{
+    unsigned long snr10 = (snr > 0.0f) ? (unsigned long)(snr * 10.0f) : 0;
+
+    printf("CSV, %s.%lu, %lu\n", name, (unsigned long)size, (unsigned long)cycle);
+    printf("CSV, %s.%lu.snr, %lu.%lu\n", name, (unsigned long)size, snr10 / 10, snr10 % 10);
+}
+
+int main(void)
+{
+    uint32_t i, j, size, errs = 0;
+    float32_t snr;
+
+    printf("Benchmark %u NMSIS DSP functions, cycles per call\n", (unsigned int)DSPLIB_ITEMS);
+    for (i = 0; i < DSPLIB_ITEMS; i++) {
+        for (j = 0; j < DSPLIB_SIZES; j++) {
+            size = dsplib_items[i].sizes[j];
+            dsplib_seed = i * DSPLIB_SIZES + j + 1;
+            dsplib_cycle = 0;
+            snr = dsplib_items[i].func(size);
+            dsplib_report(dsplib_items[i].name, size, dsplib_cycle, snr);
+            if (snr < dsplib_items[i].snr) {
+                printf("ERROR, %s.%lu\n", dsplib_items[i].name, (unsigned long)size);
+                errs++;
+            } else {
+                printf("SUCCESS, %s.%lu\n", dsplib_items[i].name, (unsigned long)size);
+            }
+        }
+    }
+    if (errs) {
+        printf("DSP library benchmark failed, %lu errors\n", (unsigned long)errs);
+        return 1;
+    }
+    printf("DSP library benchmark finished\n");
+    return 0;
+}
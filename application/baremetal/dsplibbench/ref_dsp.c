@@ -0,0 +1,170 @@
+#include <math.h>
+#include "ref_dsp.h"
+
+#ifndef M_PI
+#define M_PI    3.14159265358979323846
+#endif
+
+void ref_fir(const float32_t* pCoeffs, uint32_t numTaps, const float32_t* pSrc,
+             float32_t* pDst, uint32_t blockSize)
+{
+    float64_t sum;
+    uint32_t n, k;
+
+    /* Coefficients are in time reversed order, pCoeffs[numTaps - 1] is b[0] */
+    for (n = 0; n < blockSize; n++) {
+        sum = 0.0;
+        for (k = 0; k < numTaps; k++) {
+            if (n + k + 1 >= numTaps) {
+                sum += (float64_t)pCoeffs[k] * pSrc[n + k + 1 - numTaps];
+            }
+        }
+        pDst[n] = (float32_t)sum;
+    }
+}
+
+void ref_biquad_cascade_df2T(const float32_t* pCoeffs, uint32_t numStages,
+                             const float32_t* pSrc, float32_t* pDst,
+                             uint32_t blockSize)
+{
+    float64_t d1[8] = {0}, d2[8] = {0};
+    float64_t in, out;
+    const float32_t* c;
+    uint32_t n, s;
+
+    for (n = 0; n < blockSize; n++) {
+        out = pSrc[n];
+        for (s = 0; (s < numStages) && (s < 8); s++) {
+            c = pCoeffs + 5 * s;
+            in = out;
+            /* a1 and a2 are already negated */
+            out = c[0] * in + d1[s];
+            d1[s] = c[1] * in + c[3] * out + d2[s];
+            d2[s] = c[2] * in + c[4] * out;
+        }
+        pDst[n] = (float32_t)out;
+    }
+}
+
+void ref_cfft(float64_t* pData, uint32_t fftLen)
+{
+    uint32_t i, j, k, len;
+    float64_t tr, ti, wr, wi, ur, ui, angle;
+
+    /* Bit reversal */
+    for (i = 1, j = 0; i < fftLen; i++) {
+        for (k = fftLen >> 1; j & k; k >>= 1) {
+            j ^= k;
+        }
+        j ^= k;
+        if (i < j) {
+            tr = pData[2 * i];
+            ti = pData[2 * i + 1];
+            pData[2 * i] = pData[2 * j];
+            pData[2 * i + 1] = pData[2 * j + 1];
+            pData[2 * j] = tr;
+            pData[2 * j + 1] = ti;
+        }
+    }
+    /* Radix-2 butterflies, twiddle of each butterfly is computed directly */
+    for (len = 2; len <= fftLen; len <<= 1) {
+        for (k = 0; k < len / 2; k++) {
+            angle = -2.0 * M_PI * k / len;
+            wr = cos(angle);
+            wi = sin(angle);
+            for (i = k; i < fftLen; i += len) {
+                j = i + len / 2;
+                ur = pData[2 * j] * wr - pData[2 * j + 1] * wi;
+                ui = pData[2 * j] * wi + pData[2 * j + 1] * wr;
+                pData[2 * j] = pData[2 * i] - ur;
+                pData[2 * j + 1] = pData[2 * i + 1] - ui;
+                pData[2 * i] += ur;
+                pData[2 * i + 1] += ui;
+            }
+        }
+    }
+}
+
+void ref_mat_mult(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst,
+                  uint32_t numRowsA, uint32_t numColsA, uint32_t numColsB)
+{
+    float64_t sum;
+    uint32_t i, j, k;
+
+    for (i = 0; i < numRowsA; i++) {
+        for (j = 0; j < numColsB; j++) {
+            sum = 0.0;
+            for (k = 0; k < numColsA; k++) {
+                sum += (float64_t)pSrcA[i * numColsA + k] * pSrcB[k * numColsB + j];
+            }
+            pDst[i * numColsB + j] = (float32_t)sum;
+        }
+    }
+}
+
+void ref_mat_trans(const float32_t* pSrc, float32_t* pDst, uint32_t numRows,
+                   uint32_t numCols)
+{
+    uint32_t i, j;
+
+    for (i = 0; i < numRows; i++) {
+        for (j = 0; j < numCols; j++) {
+            pDst[j * numRows + i] = pSrc[i * numCols + j];
+        }
+    }
+}
+
+int32_t ref_mat_inverse(const float32_t* pSrc, float32_t* pDst, float64_t* pTemp,
+                        uint32_t size)
+{
+    /* Gauss-Jordan elimination with partial pivoting on [A | I] */
+    float64_t* a = pTemp;
+    float64_t* b = pTemp + size * size;
+    float64_t t, f;
+    uint32_t i, j, k, p;
+
+    for (i = 0; i < size * size; i++) {
+        a[i] = pSrc[i];
+        b[i] = ((i / size) == (i % size)) ? 1.0 : 0.0;
+    }
+    for (k = 0; k < size; k++) {
+        p = k;
+        for (i = k + 1; i < size; i++) {
+            if (fabs(a[i * size + k]) > fabs(a[p * size + k])) {
+                p = i;
+            }
+        }
+        if (a[p * size + k] == 0.0) {
+            return -1;
+        }
+        if (p != k) {
+            for (j = 0; j < size; j++) {
+                t = a[k * size + j];
+                a[k * size + j] = a[p * size + j];
+                a[p * size + j] = t;
+                t = b[k * size + j];
+                b[k * size + j] = b[p * size + j];
+                b[p * size + j] = t;
+            }
+        }
+        f = a[k * size + k];
+        for (j = 0; j < size; j++) {
+            a[k * size + j] /= f;
+            b[k * size + j] /= f;
+        }
+        for (i = 0; i < size; i++) {
+            if (i == k) {
+                continue;
+            }
+            f = a[i * size + k];
+            for (j = 0; j < size; j++) {
+                a[i * size + j] -= f * a[k * size + j];
+                b[i * size + j] -= f * b[k * size + j];
+            }
+        }
+    }
+    for (i = 0; i < size * size; i++) {
+        pDst[i] = (float32_t)b[i];
+    }
+    return 0;
+}
@@ -0,0 +1,41 @@
+#ifndef __REF_DSP_H__
+#define __REF_DSP_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <riscv_math.h>
+
+/*
+ * Reference implementations used to check NMSIS DSP library functions,
+ * they use float64_t internally and plain loops, and have no alignment
+ * or size requirements.
+ */
+
+void ref_fir(const float32_t* pCoeffs, uint32_t numTaps, const float32_t* pSrc,
+             float32_t* pDst, uint32_t blockSize);
+
+void ref_biquad_cascade_df2T(const float32_t* pCoeffs, uint32_t numStages,
+                             const float32_t* pSrc, float32_t* pDst,
+                             uint32_t blockSize);
+
+/* In place complex FFT of fftLen interleaved samples, fftLen is power of 2 */
+void ref_cfft(float64_t* pData, uint32_t fftLen);
+
+void ref_mat_mult(const float32_t* pSrcA, const float32_t* pSrcB, float32_t* pDst,
+                  uint32_t numRowsA, uint32_t numColsA, uint32_t numColsB);
+
+void ref_mat_trans(const float32_t* pSrc, float32_t* pDst, uint32_t numRows,
+                   uint32_t numCols);
+
+/* Return -1 if matrix is singular, pTemp has 2*size*size elements */
+int32_t ref_mat_inverse(const float32_t* pSrc, float32_t* pDst, float64_t* pTemp,
+                        uint32_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __REF_DSP_H__ */
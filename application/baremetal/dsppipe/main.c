@@ -0,0 +1,178 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <math.h>
+
+#include "nuclei_sdk_soc.h"
+#include "riscv_math.h"
+#include "nuclei_dsppipe.h"
+
+/*
+ * Stream a synthetic 500Hz + 6000Hz signal sampled at 16kHz through a
+ * FIR lowpass -> biquad lowpass -> rfft pipeline. The system timer interrupt
+ * acts as the ADC, it writes DPP_IRQ_SAMPLES samples into the pipeline each
+ * time, the main loop processes the blocks, and the sink checks that 500Hz
+ * is kept and 6000Hz is removed in the spectrum of each block.
+ */
+/* Define the interrupt handler name same as vector table in case download mode is flashxip. */
+#define mtimer_irq_handler      eclic_mtip_handler
+
+#define DPP_SAMPLE_RATE         16000
+#define DPP_BLOCK_SIZE          256
+#define DPP_IRQ_SAMPLES         64
+#define DPP_NUM_BLOCKS          16
+/* Frequencies are exact rfft bins, bin width is DPP_SAMPLE_RATE / DPP_BLOCK_SIZE */
+#define DPP_PASS_BIN            8
+#define DPP_STOP_BIN            96
+#define DPP_STOP_AMPLITUDE      0.5f
+/* First block contains the transient of filters */
+#define DPP_SKIP_BLOCKS         1
+
+#define DPP_FIR_TAPS            31
+#define DPP_FIR_CUTOFF          1500.0f
+#define DPP_BIQUAD_CUTOFF       2000.0f
+
+#define DPP_PI                  3.14159265358979f
+
+static float32_t dpp_signal[DPP_BLOCK_SIZE];
+static float32_t dpp_buffers[DSPPIPE_BUFFER_SIZE(DPP_BLOCK_SIZE)];
+
+static float32_t dpp_fir_coeffs[DPP_FIR_TAPS];
+static float32_t dpp_fir_state[DPP_FIR_TAPS + DPP_BLOCK_SIZE - 1];
+static riscv_fir_instance_f32 dpp_fir;
+
+static float32_t dpp_biquad_coeffs[5];
+static float32_t dpp_biquad_state[4];
+static riscv_biquad_casd_df1_inst_f32 dpp_biquad;
+
+static riscv_rfft_fast_instance_f32 dpp_rfft;
+
+static DSPPIPE_Stage dpp_stages[] = {
+    DSPPIPE_STAGE("fir", DSPPIPE_FirF32, &dpp_fir, 0),
+    DSPPIPE_STAGE("biquad", DSPPIPE_BiquadF32, &dpp_biquad, DSPPIPE_INPLACE),
+    DSPPIPE_STAGE("rfft", DSPPIPE_RfftF32, &dpp_rfft, 0),
+};
+
+static DSPPIPE_Pipeline dpp_pipe;
+
+static uint64_t dpp_timer_period;
+static uint32_t dpp_signal_pos;
+static unsigned long dpp_errs;
+
+/* Acts as ADC with DMA, no float operation is done here */
+void mtimer_irq_handler(void)
+{
+    DSPPIPE_Write(&dpp_pipe, &dpp_signal[dpp_signal_pos], DPP_IRQ_SAMPLES);
+    dpp_signal_pos = (dpp_signal_pos + DPP_IRQ_SAMPLES) % DPP_BLOCK_SIZE;
+    SysTimer_SetCompareValue(SysTimer_GetCompareValue() + dpp_timer_period);
+}
+
+static float32_t dpp_bin_magnitude(const float32_t *spectrum, uint32_t bin)
+{
+    float32_t re = spectrum[2 * bin];
+    float32_t im = spectrum[2 * bin + 1];
+
+    return sqrtf(re * re + im * im);
+}
+
+static void dpp_sink(void *arg, const float32_t *data, uint32_t block_size)
+{
+    /* Magnitude of a full scale sine in rfft of block_size samples */
+    float32_t full = (float32_t)block_size / 2;
+    float32_t pass, stop;
+
+    (void)arg;
+    if (dpp_pipe.blocks < DPP_SKIP_BLOCKS) {
+        return;
+    }
+    pass = dpp_bin_magnitude(data, DPP_PASS_BIN);
+    stop = dpp_bin_magnitude(data, DPP_STOP_BIN);
+    /* 500Hz is kept within 1dB, 6000Hz is attenuated by more than 40dB */
+    if ((pass < full * 0.89f) || (pass > full * 1.12f) || (stop > full * DPP_STOP_AMPLITUDE * 0.01f)) {
+        printf("MISMATCH, block %lu, pass %d, stop %d\n", (unsigned long)dpp_pipe.blocks, \
+               (int)pass, (int)stop);
+        dpp_errs++;
+    }
+}
+
+static void dpp_init_signal(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < DPP_BLOCK_SIZE; i++) {
+        dpp_signal[i] = sinf(2 * DPP_PI * DPP_PASS_BIN * i / DPP_BLOCK_SIZE) + \
+                        DPP_STOP_AMPLITUDE * sinf(2 * DPP_PI * DPP_STOP_BIN * i / DPP_BLOCK_SIZE);
+    }
+}
+
+/* Hamming windowed sinc lowpass, normalized to unity gain at DC */
+static void dpp_init_fir(void)
+{
+    float32_t fc = DPP_FIR_CUTOFF / DPP_SAMPLE_RATE;
+    float32_t sum = 0, x;
+    int32_t i, m;
+
+    for (i = 0; i < DPP_FIR_TAPS; i++) {
+        m = i - (DPP_FIR_TAPS - 1) / 2;
+        x = (m == 0) ? (2 * fc) : (sinf(2 * DPP_PI * fc * m) / (DPP_PI * m));
+        dpp_fir_coeffs[i] = x * (0.54f - 0.46f * cosf(2 * DPP_PI * i / (DPP_FIR_TAPS - 1)));
+        sum += dpp_fir_coeffs[i];
+    }
+    for (i = 0; i < DPP_FIR_TAPS; i++) {
+        dpp_fir_coeffs[i] /= sum;
+    }
+    riscv_fir_init_f32(&dpp_fir, DPP_FIR_TAPS, dpp_fir_coeffs, dpp_fir_state, DPP_BLOCK_SIZE);
+}
+
+/* Butterworth lowpass of audio EQ cookbook, a1 and a2 are negated for NMSIS DSP */
+static void dpp_init_biquad(void)
+{
+    float32_t w0 = 2 * DPP_PI * DPP_BIQUAD_CUTOFF / DPP_SAMPLE_RATE;
+    float32_t alpha = sinf(w0) / (2 * 0.70710678f);
+    float32_t cosw0 = cosf(w0);
+    float32_t a0 = 1 + alpha;
+
+    dpp_biquad_coeffs[0] = (1 - cosw0) / 2 / a0;
+    dpp_biquad_coeffs[1] = (1 - cosw0) / a0;
+    dpp_biquad_coeffs[2] = (1 - cosw0) / 2 / a0;
+    dpp_biquad_coeffs[3] = 2 * cosw0 / a0;
+    dpp_biquad_coeffs[4] = -(1 - alpha) / a0;
+    riscv_biquad_cascade_df1_init_f32(&dpp_biquad, 1, dpp_biquad_coeffs, dpp_biquad_state);
+}
+
+int main(void)
+{
+    dpp_init_signal();
+    dpp_init_fir();
+    dpp_init_biquad();
+    if (riscv_rfft_fast_init_f32(&dpp_rfft, DPP_BLOCK_SIZE) != RISCV_MATH_SUCCESS) {
+        printf("DSP pipeline failed\n");
+        return 1;
+    }
+    DSPPIPE_Init(&dpp_pipe, dpp_stages, sizeof(dpp_stages) / sizeof(dpp_stages[0]), DPP_BLOCK_SIZE, dpp_buffers);
+    DSPPIPE_SetSink(&dpp_pipe, dpp_sink, NULL);
+
+    printf("Process %d blocks of %d samples with fir, biquad and rfft stages\n", DPP_NUM_BLOCKS, DPP_BLOCK_SIZE);
+    dpp_timer_period = (uint64_t)SOC_TIMER_FREQ * DPP_IRQ_SAMPLES / DPP_SAMPLE_RATE;
+    if (dpp_timer_period == 0) {
+        dpp_timer_period = 1;
+    }
+    ECLIC_Register_IRQ(SysTimer_IRQn, ECLIC_NON_VECTOR_INTERRUPT, ECLIC_LEVEL_TRIGGER, 1, 0, \
+                       mtimer_irq_handler);
+    SysTimer_SetCompareValue(SysTimer_GetLoadValue() + dpp_timer_period);
+    __enable_irq();
+
+    while (dpp_pipe.blocks < DPP_NUM_BLOCKS) {
+        if (DSPPIPE_Process(&dpp_pipe) == 0) {
+            __WFI();
+        }
+    }
+    ECLIC_DisableIRQ(SysTimer_IRQn);
+
+    DSPPIPE_PrintStats(&dpp_pipe);
+    if (dpp_errs) {
+        printf("DSP pipeline failed\n");
+        return 1;
+    }
+    printf("DSP pipeline finished\n");
+    return 0;
+}
@@ -0,0 +1,170 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "nuclei_sdk_soc.h"
+#include "riscv_math.h"
+
+/*
+ * Compare small size functions in dsp/small_functions.h with the library
+ * functions, one sample is processed in each call as in a control loop.
+ */
+#define SMALL_SAMPLES           64
+#define SMALL_MAX_TAPS          16
+#define SMALL_BIQUAD_STAGES     2
+#define SMALL_MAT_RUNS          16
+/* Allowed difference, library may use a different order of accumulation */
+#define SMALL_TOLERANCE         1e-4f
+
+static float32_t small_input[SMALL_SAMPLES];
+static float32_t small_coeffs[SMALL_MAX_TAPS];
+static float32_t small_lib_state[SMALL_MAX_TAPS];
+static float32_t small_state[SMALL_MAX_TAPS];
+static float32_t small_lib_out[SMALL_SAMPLES];
+static float32_t small_out[SMALL_SAMPLES];
+
+static float32_t small_mat_a[16];
+static float32_t small_mat_b[16];
+static float32_t small_mat_lib_out[16];
+static float32_t small_mat_out[16];
+
+/* Coefficients of two 2nd order lowpass stages, a1 and a2 are negated */
+static const float32_t small_biquad_coeffs[5 * SMALL_BIQUAD_STAGES] = {
+    0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f,
+    0.0675f, 0.1349f, 0.0675f, 1.1430f, -0.4128f,
+};
+
+static unsigned long small_errs;
+
+static void small_compare(const char *name, const float32_t *expect, const float32_t *actual, uint32_t n)
+{
+    uint32_t i;
+    float32_t diff;
+
+    for (i = 0; i < n; i++) {
+        diff = expect[i] - actual[i];
+        if ((diff > SMALL_TOLERANCE) || (diff < -SMALL_TOLERANCE)) {
+            printf("MISMATCH, %s, index %lu\n", name, (unsigned long)i);
+            small_errs++;
+            return;
+        }
+    }
+}
+
+/* Print cycles per call */
+static void small_report(const char *name, const char *type, uint64_t cycle, uint32_t calls)
+{
+    printf("CSV, %s.%s, %lu\n", name, type, (unsigned long)(cycle / calls));
+}
+
+#define SMALL_FIR_BENCH(taps)                                                               \
+    static void small_fir_bench_##taps(void)                                                \
+    {                                                                                       \
+        riscv_fir_instance_f32 S;                                                           \
+        uint64_t start, cycle;                                                              \
+        uint32_t i;                                                                         \
+                                                                                            \
+        riscv_fill_f32(0.0f, small_lib_state, SMALL_MAX_TAPS);                              \
+        riscv_fill_f32(0.0f, small_state, SMALL_MAX_TAPS);                                  \
+        riscv_fir_init_f32(&S, taps, small_coeffs, small_lib_state, 1);                     \
+        start = __get_rv_cycle();                                                           \
+        for (i = 0; i < SMALL_SAMPLES; i++) {                                               \
+            riscv_fir_f32(&S, &small_input[i], &small_lib_out[i], 1);                       \
+        }                                                                                   \
+        cycle = __get_rv_cycle() - start;                                                   \
+        small_report("fir_f32_" #taps, "lib", cycle, SMALL_SAMPLES);                        \
+        start = __get_rv_cycle();                                                           \
+        for (i = 0; i < SMALL_SAMPLES; i++) {                                               \
+            small_out[i] = riscv_fir_small_f32(small_coeffs, small_state, small_input[i], taps); \
+        }                                                                                   \
+        cycle = __get_rv_cycle() - start;                                                   \
+        small_report("fir_f32_" #taps, "small", cycle, SMALL_SAMPLES);                      \
+        small_compare("fir_f32_" #taps, small_lib_out, small_out, SMALL_SAMPLES);           \
+    }
+
+SMALL_FIR_BENCH(4)
+SMALL_FIR_BENCH(8)
+SMALL_FIR_BENCH(16)
+
+static void small_biquad_bench(void)
+{
+    riscv_biquad_cascade_df2T_instance_f32 S;
+    uint64_t start, cycle;
+    uint32_t i;
+
+    riscv_fill_f32(0.0f, small_lib_state, 2 * SMALL_BIQUAD_STAGES);
+    riscv_fill_f32(0.0f, small_state, 2 * SMALL_BIQUAD_STAGES);
+    riscv_biquad_cascade_df2T_init_f32(&S, SMALL_BIQUAD_STAGES, small_biquad_coeffs, small_lib_state);
+    start = __get_rv_cycle();
+    for (i = 0; i < SMALL_SAMPLES; i++) {
+        riscv_biquad_cascade_df2T_f32(&S, &small_input[i], &small_lib_out[i], 1);
+    }
+    cycle = __get_rv_cycle() - start;
+    small_report("biquad_df2T_f32_2", "lib", cycle, SMALL_SAMPLES);
+    start = __get_rv_cycle();
+    for (i = 0; i < SMALL_SAMPLES; i++) {
+        small_out[i] = riscv_biquad_cascade_df2T_small_f32(small_biquad_coeffs, small_state, \
+                                                           small_input[i], SMALL_BIQUAD_STAGES);
+    }
+    cycle = __get_rv_cycle() - start;
+    small_report("biquad_df2T_f32_2", "small", cycle, SMALL_SAMPLES);
+    small_compare("biquad_df2T_f32_2", small_lib_out, small_out, SMALL_SAMPLES);
+}
+
+#define SMALL_MAT_BENCH(dim)                                                                \
+    static void small_mat_bench_##dim(void)                                                 \
+    {                                                                                       \
+        riscv_matrix_instance_f32 A, B, D;                                                  \
+        uint64_t start, cycle;                                                              \
+        uint32_t i;                                                                         \
+                                                                                            \
+        riscv_mat_init_f32(&A, dim, dim, small_mat_a);                                      \
+        riscv_mat_init_f32(&B, dim, dim, small_mat_b);                                      \
+        riscv_mat_init_f32(&D, dim, dim, small_mat_lib_out);                                \
+        start = __get_rv_cycle();                                                           \
+        for (i = 0; i < SMALL_MAT_RUNS; i++) {                                              \
+            riscv_mat_mult_f32(&A, &B, &D);                                                 \
+        }                                                                                   \
+        cycle = __get_rv_cycle() - start;                                                   \
+        small_report("mat_mult_f32_" #dim "x" #dim, "lib", cycle, SMALL_MAT_RUNS);          \
+        start = __get_rv_cycle();                                                           \
+        for (i = 0; i < SMALL_MAT_RUNS; i++) {                                              \
+            riscv_mat_mult_small_f32(small_mat_a, small_mat_b, small_mat_out, dim, dim, dim); \
+            __ASM volatile("" : : : "memory");                                              \
+        }                                                                                   \
+        cycle = __get_rv_cycle() - start;                                                   \
+        small_report("mat_mult_f32_" #dim "x" #dim, "small", cycle, SMALL_MAT_RUNS);        \
+        small_compare("mat_mult_f32_" #dim "x" #dim, small_mat_lib_out, small_mat_out, dim * dim); \
+    }
+
+SMALL_MAT_BENCH(3)
+SMALL_MAT_BENCH(4)
+
+int main(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < SMALL_SAMPLES; i++) {
+        small_input[i] = riscv_sin_f32((float32_t)i * 0.3f) + 0.25f * riscv_sin_f32((float32_t)i * 2.1f);
+    }
+    for (i = 0; i < SMALL_MAX_TAPS; i++) {
+        small_coeffs[i] = 0.05f * (float32_t)(i + 1);
+    }
+    for (i = 0; i < 16; i++) {
+        small_mat_a[i] = 0.1f * (float32_t)i - 0.7f;
+        small_mat_b[i] = 0.9f - 0.05f * (float32_t)i;
+    }
+
+    printf("Benchmark small size DSP functions, cycles per call\n");
+    small_fir_bench_4();
+    small_fir_bench_8();
+    small_fir_bench_16();
+    small_biquad_bench();
+    small_mat_bench_3();
+    small_mat_bench_4();
+    if (small_errs) {
+        printf("Small DSP benchmark failed\n");
+        return 1;
+    }
+    printf("Small DSP benchmark finished\n");
+    return 0;
+}
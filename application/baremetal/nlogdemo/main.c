@@ -0,0 +1,56 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "nuclei_sdk_soc.h"
+#include "nuclei_log.h"
+
+/*
+ * The system timer interrupt records a message with NLOG each time, and
+ * the main loop outputs them with NLOG_Flush, so the interrupt handler
+ * never waits for UART.
+ */
+/* Define the interrupt handler name same as vector table in case download mode is flashxip. */
+#define mtimer_irq_handler      eclic_mtip_handler
+
+#define NLOG_DEMO_TICKS         20
+#define NLOG_DEMO_TICK_HZ       100
+
+static uint64_t nlog_demo_period;
+static volatile uint32_t nlog_demo_ticks;
+
+void mtimer_irq_handler(void)
+{
+    uint32_t tick = nlog_demo_ticks + 1;
+
+    NLOG("tick %u in %s, mcycle 0x%lx\n", (unsigned int)tick, "irq", (unsigned long)__RV_CSR_READ(CSR_MCYCLE));
+    nlog_demo_ticks = tick;
+    if (tick < NLOG_DEMO_TICKS) {
+        SysTimer_SetCompareValue(SysTimer_GetCompareValue() + nlog_demo_period);
+    } else {
+        ECLIC_DisableIRQ(SysTimer_IRQn);
+    }
+}
+
+int main(void)
+{
+    unsigned long msgs = 0;
+
+    printf("Log %d system timer interrupts with NLOG\n", NLOG_DEMO_TICKS);
+    nlog_demo_period = SOC_TIMER_FREQ / NLOG_DEMO_TICK_HZ;
+    ECLIC_Register_IRQ(SysTimer_IRQn, ECLIC_NON_VECTOR_INTERRUPT, ECLIC_LEVEL_TRIGGER, 1, 0, \
+                       mtimer_irq_handler);
+    SysTimer_SetCompareValue(SysTimer_GetLoadValue() + nlog_demo_period);
+    __enable_irq();
+
+    while (nlog_demo_ticks < NLOG_DEMO_TICKS) {
+        msgs += NLOG_Flush();
+    }
+    msgs += NLOG_Flush();
+
+    if (msgs != NLOG_DEMO_TICKS) {
+        printf("NLOG demo failed, %lu messages output\n", msgs);
+        return 1;
+    }
+    printf("NLOG demo finished\n");
+    return 0;
+}
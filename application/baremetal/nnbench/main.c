@@ -0,0 +1,285 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nuclei_sdk_soc.h"
+#include "riscv_nnfunctions.h"
+#include "nuclei_nnsmp.h"
+#include "nnbench_model.h"
+
+/*
+ * Run int8 DS-CNN keyword spotting model in nnbench_model.h with NMSIS NN
+ * library, and report cycles of each layer, total latency and peak scratch
+ * buffer size required by the kernels of selected library variant.
+ * Activations and scratch buffers of all layers share nnb_arena, the layout
+ * is planned offline in nnbench_arena.h.
+ * When SMP_CPU_CNT > 1, convolution and fully connected layers are split
+ * between harts by nnsmp component, model is run with 1 to SMP_CPU_CNT harts
+ * to report the scaling.
+ */
+/* Inference is run twice, the last one is reported, so caches are warm */
+#define NNB_RUNS                2
+/* Allowed difference of softmax output with python float reference */
+#define NNB_PROB_TOLERANCE      2
+
+#define NNB_NUM_LAYERS          (sizeof(nnb_layers) / sizeof(nnb_layers[0]))
+/* Scratch buffer size of each hart other than boot hart */
+#define NNB_HART_SCRATCH_SIZE   2048
+
+static q7_t nnb_arena[NNB_ARENA_SIZE] __ALIGNED(8);
+#if NNSMP_HART_NUM > 1
+/* Boot hart uses scratch buffers planned in nnb_arena */
+static q7_t nnb_hart_scratch[NNSMP_HART_NUM - 1][NNB_HART_SCRATCH_SIZE] __ALIGNED(8);
+#endif
+static uint64_t nnb_cycles[NNB_NUM_LAYERS];
+
+static unsigned long nnb_errs;
+
+static int32_t nnb_tensor_size(const nmsis_nn_dims *dims)
+{
+    return dims->n * dims->h * dims->w * dims->c;
+}
+
+/* Same as checksum in tools/scripts/misc/gen_nnmodel.py */
+static uint32_t nnb_checksum(const q7_t *data, int32_t size)
+{
+    uint32_t cs = 0;
+    int32_t i;
+
+    for (i = 0; i < size; i++) {
+        cs = cs * 31 + (uint8_t)data[i];
+    }
+    return cs;
+}
+
+static int32_t nnb_buffer_size(const nnb_layer_t *layer)
+{
+    switch (layer->type) {
+        case NNB_CONV:
+            return riscv_convolve_s8_get_buffer_size(&layer->input_dims, &layer->filter_dims);
+        case NNB_DW_CONV:
+            return riscv_depthwise_conv_s8_opt_get_buffer_size(&layer->input_dims, &layer->filter_dims);
+        case NNB_PW_CONV:
+            return riscv_convolve_1x1_s8_fast_get_buffer_size(&layer->input_dims);
+        case NNB_AVGPOOL:
+            return riscv_avgpool_s8_get_buffer_size(layer->output_dims.w, layer->input_dims.c);
+        case NNB_FC:
+            return riscv_fully_connected_s8_get_buffer_size(&layer->filter_dims);
+        default:
+            return 0;
+    }
+}
+
+/* ctx is an array of NNSMP_HART_NUM contexts, one for each hart */
+static riscv_status nnb_run_layer(const nnb_layer_t *layer, const nmsis_nn_context *ctx,
+                                  const q7_t *input, q7_t *output)
+{
+    nmsis_nn_dims bias_dims = {1, 1, 1, layer->output_dims.c};
+    nmsis_nn_per_channel_quant_params quant_params = {layer->mult, layer->shift};
+    nmsis_nn_conv_params conv_params = {layer->input_offset, layer->output_offset, layer->stride, \
+                                        layer->padding, {1, 1}, layer->activation};
+    nmsis_nn_dw_conv_params dw_conv_params = {layer->input_offset, layer->output_offset, 1, layer->stride, \
+                                              layer->padding, {1, 1}, layer->activation};
+    nmsis_nn_pool_params pool_params = {layer->stride, layer->padding, layer->activation};
+    nmsis_nn_fc_params fc_params = {layer->input_offset, 0, layer->output_offset, layer->activation};
+    nmsis_nn_per_tensor_quant_params fc_quant_params;
+
+    switch (layer->type) {
+        case NNB_CONV:
+            return NNSMP_convolve_s8(ctx, &conv_params, &quant_params, &layer->input_dims, input, \
+                                     &layer->filter_dims, layer->weights, &bias_dims, layer->bias, \
+                                     &layer->output_dims, output);
+        case NNB_DW_CONV:
+            return NNSMP_depthwise_conv_s8_opt(ctx, &dw_conv_params, &quant_params, &layer->input_dims, input, \
+                                               &layer->filter_dims, layer->weights, &bias_dims, layer->bias, \
+                                               &layer->output_dims, output);
+        case NNB_PW_CONV:
+            return NNSMP_convolve_1x1_s8_fast(ctx, &conv_params, &quant_params, &layer->input_dims, input, \
+                                              &layer->filter_dims, layer->weights, &bias_dims, layer->bias, \
+                                              &layer->output_dims, output);
+        case NNB_AVGPOOL:
+            return riscv_avgpool_s8(ctx, &pool_params, &layer->input_dims, input, &layer->filter_dims, \
+                                    &layer->output_dims, output);
+        case NNB_FC:
+            fc_quant_params.multiplier = layer->mult[0];
+            fc_quant_params.shift = layer->shift[0];
+            return NNSMP_fully_connected_s8(ctx, &fc_params, &fc_quant_params, &layer->input_dims, input, \
+                                            &layer->filter_dims, layer->weights, &bias_dims, layer->bias, \
+                                            &layer->output_dims, output);
+        case NNB_SOFTMAX:
+            riscv_softmax_s8(input, layer->output_dims.n, layer->output_dims.c, NNB_SOFTMAX_MULT, \
+                             NNB_SOFTMAX_SHIFT, NNB_SOFTMAX_DIFF_MIN, output);
+            return RISCV_MATH_SUCCESS;
+        default:
+            return RISCV_MATH_ARGUMENT_ERROR;
+    }
+}
+
+/* Output of each layer is compared with checksum of python reference */
+static void nnb_check_layer(const nnb_layer_t *layer, const q7_t *output)
+{
+    uint32_t cs;
+
+    /* softmax is checked with nnb_expected_probs in nnb_check_probs */
+    if (layer->type == NNB_SOFTMAX) {
+        return;
+    }
+    cs = nnb_checksum(output, nnb_tensor_size(&layer->output_dims));
+    if (cs != layer->checksum) {
+        printf("MISMATCH, %s, checksum 0x%08lx, expected 0x%08lx\n", layer->name, \
+               (unsigned long)cs, (unsigned long)layer->checksum);
+        nnb_errs++;
+    }
+}
+
+/* Run all layers, return output of last layer, or NULL when failed */
+static const q7_t *nnb_inference(int32_t *scratch_peak, int check)
+{
+    const nnb_layer_t *layer;
+    q7_t *output = NULL;
+    nmsis_nn_context ctx[NNSMP_HART_NUM];
+    riscv_status status;
+    uint64_t start;
+    uint32_t i;
+#if NNSMP_HART_NUM > 1
+    uint32_t hart;
+#endif
+
+    *scratch_peak = 0;
+    memcpy(nnb_arena + NNB_INPUT_OFFSET, nnb_input, NNB_INPUT_SIZE);
+    for (i = 0; i < NNB_NUM_LAYERS; i++) {
+        layer = &nnb_layers[i];
+        output = nnb_arena + layer->output_buf;
+        ctx[0].size = nnb_buffer_size(layer);
+        /* Planned size is an upper bound of all library variants */
+        if (ctx[0].size > layer->scratch_size) {
+            printf("ERROR, %s, scratch buffer %ld bytes required, %ld bytes planned\n", layer->name, \
+                   (long)ctx[0].size, (long)layer->scratch_size);
+            return NULL;
+        }
+        ctx[0].buf = (ctx[0].size > 0) ? (nnb_arena + layer->scratch_buf) : NULL;
+        if (ctx[0].size > *scratch_peak) {
+            *scratch_peak = ctx[0].size;
+        }
+#if NNSMP_HART_NUM > 1
+        if (ctx[0].size > NNB_HART_SCRATCH_SIZE) {
+            printf("ERROR, %s, scratch buffer %ld bytes required, %d bytes per hart\n", layer->name, \
+                   (long)ctx[0].size, NNB_HART_SCRATCH_SIZE);
+            return NULL;
+        }
+        for (hart = 1; hart < NNSMP_HART_NUM; hart++) {
+            ctx[hart].size = ctx[0].size;
+            ctx[hart].buf = (ctx[0].size > 0) ? nnb_hart_scratch[hart - 1] : NULL;
+        }
+#endif
+        start = __get_rv_cycle();
+        status = nnb_run_layer(layer, ctx, nnb_arena + layer->input_buf, output);
+        nnb_cycles[i] = __get_rv_cycle() - start;
+        if (status != RISCV_MATH_SUCCESS) {
+            printf("ERROR, %s, status %d\n", layer->name, (int)status);
+            return NULL;
+        }
+        if (check) {
+            nnb_check_layer(layer, output);
+        }
+    }
+    return output;
+}
+
+static void nnb_check_probs(const q7_t *probs)
+{
+    int32_t diff, best = 0;
+    uint32_t i;
+
+    for (i = 0; i < NNB_NUM_CLASSES; i++) {
+        diff = (int32_t)probs[i] - nnb_expected_probs[i];
+        if ((diff > NNB_PROB_TOLERANCE) || (diff < -NNB_PROB_TOLERANCE)) {
+            printf("MISMATCH, softmax, index %lu, %d, expected %d\n", (unsigned long)i, \
+                   (int)probs[i], (int)nnb_expected_probs[i]);
+            nnb_errs++;
+        }
+        if (probs[i] > probs[best]) {
+            best = i;
+        }
+    }
+    printf("Predicted class %d, expected %d\n", (int)best, NNB_EXPECTED_CLASS);
+    if (probs[best] != probs[NNB_EXPECTED_CLASS]) {
+        nnb_errs++;
+    }
+}
+
+/* Print cycles of each layer and return total cycles, suffix is hart number when harts > 1 */
+static uint64_t nnb_report(uint32_t harts)
+{
+    uint64_t total = 0;
+    uint32_t i;
+
+    for (i = 0; i < NNB_NUM_LAYERS; i++) {
+        if (harts > 1) {
+            printf("CSV, %s.%luh, %lu\n", nnb_layers[i].name, (unsigned long)harts, (unsigned long)nnb_cycles[i]);
+        } else {
+            printf("CSV, %s, %lu\n", nnb_layers[i].name, (unsigned long)nnb_cycles[i]);
+        }
+        total += nnb_cycles[i];
+    }
+    if (harts > 1) {
+        printf("CSV, total.%luh, %lu\n", (unsigned long)harts, (unsigned long)total);
+    } else {
+        printf("CSV, total, %lu\n", (unsigned long)total);
+    }
+    return total;
+}
+
+int main(void)
+{
+    const q7_t *probs = NULL;
+    int32_t scratch_peak = 0;
+    uint64_t total, single = 0;
+    uint32_t i, harts;
+
+    printf("Run %lu layers DS-CNN model with NMSIS NN library, cycles per layer\n", \
+           (unsigned long)NNB_NUM_LAYERS);
+    for (harts = 1; harts <= NNSMP_HART_NUM; harts++) {
+        NNSMP_SetHarts(harts);
+        for (i = 0; i < NNB_RUNS; i++) {
+            probs = nnb_inference(&scratch_peak, i == 0);
+            if (probs == NULL) {
+                printf("NN benchmark failed\n");
+                return 1;
+            }
+        }
+        total = nnb_report(harts);
+        if (harts == 1) {
+            single = total;
+            if (SystemCoreClock >= 1000000) {
+                printf("CSV, latency_us, %lu\n", (unsigned long)(total / (SystemCoreClock / 1000000)));
+            }
+            printf("CSV, scratch_peak, %ld\n", (long)scratch_peak);
+            printf("CSV, arena, %lu\n", (unsigned long)sizeof(nnb_arena));
+            printf("CSV, weight, %lu\n", (unsigned long)NNB_WEIGHT_BYTES);
+        } else if (total > 0) {
+            /* Speedup against one hart in percent */
+            printf("CSV, speedup.%luh, %lu\n", (unsigned long)harts, (unsigned long)(single * 100 / total));
+        }
+        nnb_check_probs(probs);
+    }
+    if (nnb_errs) {
+        printf("NN benchmark failed\n");
+        return 1;
+    }
+    printf("NN benchmark finished\n");
+    return 0;
+}
+
+#if NNSMP_HART_NUM > 1
+/* Reimplementation of smp_main, other harts run layers started by boot hart */
+void smp_main(void)
+{
+    if (__RV_CSR_READ(CSR_MHARTID) == BOOT_HARTID) {
+        main();
+        NNSMP_Stop();
+    } else {
+        NNSMP_Worker();
+    }
+}
+#endif
@@ -0,0 +1,53 @@
+#ifndef __NNBENCH_H__
+#define __NNBENCH_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include "riscv_nnfunctions.h"
+
+/* Kernel used by each layer type */
+typedef enum {
+    NNB_CONV = 0,       /* riscv_convolve_s8 */
+    NNB_DW_CONV,        /* riscv_depthwise_conv_s8_opt */
+    NNB_PW_CONV,        /* riscv_convolve_1x1_s8_fast */
+    NNB_AVGPOOL,        /* riscv_avgpool_s8 */
+    NNB_FC,             /* riscv_fully_connected_s8 */
+    NNB_SOFTMAX,        /* riscv_softmax_s8 */
+} nnb_layer_type_t;
+
+/*
+ * One layer of the model, dims use the format of each kernel,
+ * mult and shift are per-channel, except one value for NNB_FC
+ */
+typedef struct {
+    const char *name;
+    nnb_layer_type_t type;
+    nmsis_nn_dims input_dims;
+    nmsis_nn_dims filter_dims;
+    nmsis_nn_dims output_dims;
+    nmsis_nn_tile stride;
+    nmsis_nn_tile padding;
+    int32_t input_offset;
+    int32_t output_offset;
+    nmsis_nn_activation activation;
+    const int8_t *weights;
+    const int32_t *bias;
+    int32_t *mult;
+    int32_t *shift;
+    /* Checksum of output calculated by python reference, 0 for NNB_SOFTMAX */
+    uint32_t checksum;
+    /* Offsets of buffers in nnb_arena, planned by tools/scripts/misc/nn_arena_planner.py */
+    uint32_t input_buf;
+    uint32_t output_buf;
+    uint32_t scratch_buf;
+    int32_t scratch_size;
+} nnb_layer_t;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __NNBENCH_H__ */
@@ -0,0 +1,83 @@
+/* This file is generated by tools/scripts/misc/gen_nnmodel.py, don't edit it */
+#ifndef __NNBENCH_ARENA_H__
+#define __NNBENCH_ARENA_H__
+
+/*
+ * Arena layout, lifetime is the first and last layer which use the buffer
+ * buffer                 offset     size  lifetime
+ * conv1                       0     8000  0-1
+ * input                    8000      490  0-0
+ * conv1_scratch            8496      160  0-0
+ * dw1                      8000     8000  1-2
+ * dw1_scratch             16000     1152  1-1
+ * pw1                         0     8000  2-3
+ * dw2                      8000     8000  3-4
+ * dw2_scratch             16000     1152  3-3
+ * pw2                         0     8000  4-5
+ * dw3                      8000     8000  5-6
+ * dw3_scratch             16000     1152  5-5
+ * pw3                         0     8000  6-7
+ * dw4                      8000     8000  7-8
+ * dw4_scratch             16000     1152  7-7
+ * pw4                         0     8000  8-9
+ * avgpool                  8256       64  9-10
+ * avgpool_scratch          8000      256  9-9
+ * fc                        128       12  10-11
+ * fc_scratch                  0      128  10-10
+ * softmax                     0       12  11-11
+ * Arena is 17152 bytes, 77744 bytes are required without sharing
+ */
+#define NNB_ARENA_SIZE                           17152
+
+#define NNB_CONV1_OFFSET                         0
+#define NNB_CONV1_SIZE                           8000
+#define NNB_INPUT_OFFSET                         8000
+#define NNB_INPUT_SIZE                           490
+#define NNB_CONV1_SCRATCH_OFFSET                 8496
+#define NNB_CONV1_SCRATCH_SIZE                   160
+#define NNB_DW1_OFFSET                           8000
+#define NNB_DW1_SIZE                             8000
+#define NNB_DW1_SCRATCH_OFFSET                   16000
+#define NNB_DW1_SCRATCH_SIZE                     1152
+#define NNB_PW1_OFFSET                           0
+#define NNB_PW1_SIZE                             8000
+#define NNB_DW2_OFFSET                           8000
+#define NNB_DW2_SIZE                             8000
+#define NNB_DW2_SCRATCH_OFFSET                   16000
+#define NNB_DW2_SCRATCH_SIZE                     1152
+#define NNB_PW2_OFFSET                           0
+#define NNB_PW2_SIZE                             8000
+#define NNB_DW3_OFFSET                           8000
+#define NNB_DW3_SIZE                             8000
+#define NNB_DW3_SCRATCH_OFFSET                   16000
+#define NNB_DW3_SCRATCH_SIZE                     1152
+#define NNB_PW3_OFFSET                           0
+#define NNB_PW3_SIZE                             8000
+#define NNB_DW4_OFFSET                           8000
+#define NNB_DW4_SIZE                             8000
+#define NNB_DW4_SCRATCH_OFFSET                   16000
+#define NNB_DW4_SCRATCH_SIZE                     1152
+#define NNB_PW4_OFFSET                           0
+#define NNB_PW4_SIZE                             8000
+#define NNB_AVGPOOL_OFFSET                       8256
+#define NNB_AVGPOOL_SIZE                         64
+#define NNB_AVGPOOL_SCRATCH_OFFSET               8000
+#define NNB_AVGPOOL_SCRATCH_SIZE                 256
+#define NNB_FC_OFFSET                            128
+#define NNB_FC_SIZE                              12
+#define NNB_FC_SCRATCH_OFFSET                    0
+#define NNB_FC_SCRATCH_SIZE                      128
+#define NNB_SOFTMAX_OFFSET                       0
+#define NNB_SOFTMAX_SIZE                         12
+#define NNB_PW1_SCRATCH_OFFSET                   0
+#define NNB_PW1_SCRATCH_SIZE                     0
+#define NNB_PW2_SCRATCH_OFFSET                   0
+#define NNB_PW2_SCRATCH_SIZE                     0
+#define NNB_PW3_SCRATCH_OFFSET                   0
+#define NNB_PW3_SCRATCH_SIZE                     0
+#define NNB_PW4_SCRATCH_OFFSET                   0
+#define NNB_PW4_SCRATCH_SIZE                     0
+#define NNB_SOFTMAX_SCRATCH_OFFSET               0
+#define NNB_SOFTMAX_SCRATCH_SIZE                 0
+
+#endif /* __NNBENCH_ARENA_H__ */
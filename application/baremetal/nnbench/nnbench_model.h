@@ -0,0 +1,1680 @@
+/* This file is generated by tools/scripts/misc/gen_nnmodel.py, don't edit it */
+#ifndef __NNBENCH_MODEL_H__
+#define __NNBENCH_MODEL_H__
+
+#include "nnbench.h"
+#include "nnbench_arena.h"
+
+/*
+ * DS-CNN keyword spotting model, 64 channels, 4 depthwise separable blocks,
+ * int8 weights are random with seed 2026, quantization is calibrated on nnb_input.
+ * Checksum of each layer output is calculated by the python reference.
+ */
+#define NNB_NUM_CLASSES         12
+#define NNB_WEIGHT_BYTES        28984
+#define NNB_SOFTMAX_MULT        1073741824
+#define NNB_SOFTMAX_SHIFT       23
+#define NNB_SOFTMAX_DIFF_MIN    (-248)
+#define NNB_EXPECTED_CLASS      2
+
+static const int8_t nnb_input[490] = {
+    37, 69, 63, 72, 51, 16, -22, -25, 1, 21, 43, 58, 80, 53, 32, 9,
+    -10, -9, -10, 39, 53, 67, 77, 57, 34, -18, -18, -51, -2, 22, 64, 89,
+    65, 44, 8, -36, -37, -25, -7, 6, 69, 81, 47, 15, -8, -30, -39, -37,
+    -22, 21, 79, 79, 49, 0, -28, -42, -39, -17, 20, 46, 82, 57, 20, -16,
+    -41, -43, -27, -17, 22, 69, 95, 37, 1, -23, -42, -48, -24, 0, 39, 75,
+    58, 35, -3, -26, -45, -45, -24, 33, 55, 54, 51, 26, -28, -32, -32, -37,
+    14, 44, 68, 32, 47, 10, -18, -39, -49, -11, 34, 66, 56, -20, 21, 1,
+    -13, -17, -27, 0, 37, 75, 12, -46, 20, -9, -22, -5, -9, -13, 46, 60,
+    -2, -26, -16, -27, -8, -8, 0, 13, 63, 62, -17, -23, -17, -20, -16, -10,
+    13, 9, 62, 33, -42, -23, -18, -13, 18, 28, 23, 35, 53, 5, -34, -27,
+    -23, 0, 17, 32, 30, 33, 52, -39, -42, -54, -22, 15, 31, 34, 16, 39,
+    35, -57, -38, -76, -21, 24, 51, 52, 20, 29, -3, -70, -40, -69, 11, 48,
+    50, 46, 8, 28, -16, -60, -28, -28, 18, 41, 57, 38, -3, 18, -33, -70,
+    -33, -12, 33, 82, 76, 20, -21, 16, -50, -49, -42, 30, 51, 80, 58, 12,
+    -11, 6, -81, -25, -46, 45, 58, 88, 66, 5, -27, -13, -84, -17, -31, 22,
+    63, 72, 49, 0, -43, -13, -76, 8, -14, 25, 78, 68, 42, -32, -44, -25,
+    -69, 1, 42, 15, 82, 58, 17, -57, -44, -31, -44, 19, 79, 36, 72, 43,
+    0, -78, -63, -16, -30, 19, 73, 63, 71, 38, 6, -76, -33, -17, -3, 25,
+    62, 70, 51, 25, -14, -71, -29, -19, 23, 22, 48, 54, 44, 11, -38, -75,
+    -24, -12, 60, 29, 16, 3, 33, -6, -42, -71, 4, -6, 63, 35, -1, -1,
+    9, -19, -56, -72, 25, -1, 76, 57, -1, -46, 6, -19, -35, -58, 45, 7,
+    88, 40, 7, -41, 14, -25, -37, -27, 47, 20, 60, 63, -2, -25, -11, -31,
+    -26, -16, 73, 34, 64, 41, 14, -26, -16, -27, -12, -7, 72, 18, 27, -3,
+    3, -25, -14, -16, -23, -5, 63, 37, -6, -2, -18, -41, -5, 12, 5, 21,
+    88, 23, -17, -34, -52, -59, -21, 36, 26, 37, 83, 17, -47, -55, -64, -83,
+    30, 30, 36, 38, 65, 19, -45, -59, -94, -42, 17, 48, 33, 35, 47, 8,
+    -65, -82, -56, -1, 41, 51, 33, 34, 24, -9, -59, -75, -53, 30, 43, 62,
+    37, 18, 9, -13, -64, -54, -5, 36, 55, 84, 25, 25, -14, -31, -49, -27,
+    27, 27, 67, 69, 26, -10, -27, -26, -23, 8, 39, 15, 76, 88, 5, 0,
+    -50, -19, -17, 17, 53, 16, 85, 70, -12, -23, -46, -18, 0, 30, 27, 18,
+    91, 46, -9, -38, -72, -18, 13, 50, 35, 53,
+};
+
+static const int8_t nnb_expected_probs[12] = {
+    -128, -128, 105, -128, -128, -128, -128, -123, -128, -111, -128, -128,
+};
+
+static const int8_t nnb_conv1_weights[2560] = {
+    51, 3, 0, 36, -26, -33, 8, -45, 28, -23, 27, 7, 57, 54, -1, 8,
+    11, 43, -9, 56, 54, 29, -6, -1, 30, 20, 9, 44, -19, -15, -19, 48,
+    -14, -59, -18, -7, -5, 41, 26, 60, 119, -9, 50, -31, -20, 31, -24, -19,
+    57, -51, 45, 11, 72, 10, -2, 67, 10, 30, 22, -34, 3, 13, -12, 8,
+    -10, -58, -28, -62, -14, 44, 40, 26, -35, -5, -15, 33, 50, 109, 16, -19,
+    -5, 97, 34, -35, -14, 13, -22, -18, -27, 6, -49, -2, -71, -6, -11, 81,
+    -51, 4, 19, -30, 40, -1, -37, -33, 29, 41, 64, -8, 50, 54, -8, -12,
+    -5, -9, 23, -92, 14, 28, -36, -9, -25, 7, 24, 8, 33, 47, -50, 3,
+    28, 5, -33, 38, -65, 14, 20, 29, -3, -11, 18, 1, -54, -32, 12, -28,
+    1, -24, 27, 69, -38, 20, 12, -21, 17, 104, 5, 23, 42, -2, -70, 37,
+    -29, -101, -30, -31, 52, -18, 71, 46, -1, -20, 56, 30, -17, -16, 27, 51,
+    36, 90, 10, -1, 57, -10, 60, -36, -9, 37, 48, 3, 58, -50, -22, 2,
+    14, -49, 43, -8, -42, -34, 54, -25, -14, 27, -18, -40, -42, 62, -49, -8,
+    26, 19, 52, 12, 82, 39, -36, -16, -32, -41, -44, 12, 85, 12, 13, 14,
+    41, 27, -3, 107, 0, -15, -16, -12, 85, -20, -7, -34, -35, 6, 49, -37,
+    -39, 28, 24, -34, -54, 4, -63, 26, -45, -28, -7, 1, 37, -13, 44, 10,
+    19, 23, -31, -4, -59, 27, 54, 9, -98, -12, 28, 27, 3, 16, 20, 36,
+    14, 12, 40, -3, 26, 1, -6, 72, -87, -14, 21, 12, 24, -15, 39, -60,
+    -79, -33, -10, -3, 108, -28, -26, -72, -93, -9, 83, -23, 57, -12, 12, -2,
+    49, 31, -1, 5, -9, -8, 14, -7, -15, -48, -46, -14, -45, -12, 35, 12,
+    -43, -10, 0, 7, -13, 11, -11, -22, 4, 51, -36, -1, -10, 57, 9, 15,
+    -37, 55, 65, 69, 45, -53, 20, -41, -21, -57, -21, 42, 2, 1, -76, 71,
+    -42, 1, -44, -20, -41, 52, -49, -31, 3, 39, 1, 34, -27, -54, -31, -14,
+    -105, -21, -36, 55, -12, -52, 2, 45, 51, -20, -59, -1, 16, 14, -26, -23,
+    -26, 17, -31, 11, 33, 46, 53, 2, 62, 43, -14, 5, -24, 21, 8, -64,
+    15, -27, -3, -41, -10, 33, 27, 48, 27, 5, -20, -60, 3, -41, 40, -44,
+    9, 16, -41, 36, -25, -32, -25, -23, -102, -28, -13, -35, 26, -14, -11, -1,
+    -19, -18, 20, 37, -38, -21, -33, 33, 32, 12, 53, 12, -18, 29, -99, 59,
+    -34, -36, 46, -85, -13, 58, 46, -13, 18, -32, -22, 18, -37, 20, -63, -61,
+    44, -57, -36, -14, 52, -61, 29, 5, 25, 49, -72, 12, -24, 10, 16, 3,
+    22, 17, 39, 38, -83, -96, -29, -30, -37, 77, 12, 8, -12, 19, -13, -13,
+    58, 45, 36, -36, -54, 5, 26, 26, 26, 36, 11, -14, 71, -1, -86, 45,
+    51, 33, -109, 57, -13, 5, -66, 10, 41, -1, -14, 7, -11, -47, -33, 17,
+    38, 69, -57, -43, -4, 72, 14, -60, -44, 50, -48, 30, -49, -26, -33, 72,
+    23, -26, -3, -54, 17, 38, 54, 12, -33, -6, -6, -80, 24, 90, -6, -43,
+    -30, 38, 33, -10, 21, -22, 47, -27, -18, 30, 50, -27, -22, -35, -40, 20,
+    -14, 13, -52, 53, -55, 26, -45, -26, -43, 53, -28, 24, 0, 46, -29, 34,
+    -64, -48, -30, 105, 5, -19, -15, 27, -25, 76, -1, -3, 3, 16, 28, 56,
+    94, -40, -18, -5, -37, -31, -24, -22, 32, 26, 106, 95, 60, -39, 48, 23,
+    -4, -39, 69, 80, -8, -3, 4, -33, 45, -24, 22, -37, 38, -17, 34, 46,
+    24, -2, -10, 8, -50, 15, 19, -39, -46, -53, -16, 68, 12, -41, -8, 65,
+    -23, -3, -29, 61, -4, -9, 36, 27, 35, 19, 115, 58, -40, 44, -5, 28,
+    -9, 15, -19, -5, -59, -17, -36, 8, 5, -21, 30, 41, -16, -36, -38, -24,
+    24, 63, 42, -17, 45, -29, -24, -23, 49, -6, 37, -3, 59, -25, -89, 15,
+    20, -11, -81, 24, 60, -20, 5, 20, 73, -15, 31, 15, -32, 102, -22, -72,
+    30, -15, -75, 32, -53, -78, 115, 8, 17, 54, -13, 28, 76, -10, -20, -46,
+    -9, -8, 29, -44, -61, 3, -5, -13, -47, -66, 28, 90, -46, -16, 15, -47,
+    5, -57, 53, -46, -85, 38, 51, 17, -79, 14, -20, 3, 69, -40, 30, -8,
+    1, 29, 31, 113, -59, 15, 48, 45, -37, -6, -57, 45, -46, -57, -10, -32,
+    -15, 40, -38, 20, -16, 7, -27, 27, 11, 49, -56, -39, 30, -8, -26, 58,
+    -8, -72, 22, -29, 22, 14, -2, 16, 29, 57, 5, 34, -64, 43, 31, 9,
+    81, -20, -4, 17, 73, 22, 6, -36, 25, -63, 37, -31, -1, -42, 44, 42,
+    10, 9, 20, -23, -24, 47, -12, 26, -24, -21, -38, -79, -29, -13, -44, 5,
+    -63, -7, -4, -68, 50, 52, -20, 15, 54, -13, -42, 29, 51, 2, 75, 35,
+    12, -1, -8, 20, 13, 2, 95, 11, -12, 4, 1, -54, -106, 5, 43, 11,
+    11, 33, 45, -4, -21, -58, 34, 24, -19, -76, 27, -20, 1, 17, 10, 0,
+    -97, -7, 32, 11, -2, -2, 24, 1, 14, 41, 36, 22, 71, 51, 23, 48,
+    14, -8, 42, 0, 60, 16, 14, -68, 28, -33, 36, 5, -64, 0, -48, -28,
+    22, 74, 75, 34, 17, 43, 65, -103, -7, -17, -34, 19, 15, -15, -71, -41,
+    -72, -52, 91, -8, -23, -39, -17, 26, 11, -8, -83, 64, 7, -16, -70, 1,
+    -118, -14, 21, -49, 17, 48, 26, 17, -111, 32, -24, -55, 17, 27, 26, -61,
+    -61, 40, -24, -3, 58, 9, -86, -73, 65, 6, -5, -21, -4, -23, 37, 55,
+    16, 18, 7, 44, 69, -10, -22, -49, -4, -11, 127, 55, 85, 80, -43, -27,
+    20, 1, 64, 60, 18, 6, 7, 56, -14, 21, -70, -46, -89, 37, 45, -4,
+    67, -26, 35, -20, 47, 10, 65, 44, -16, 11, 41, 27, -8, 12, 23, 6,
+    9, 40, 4, -53, -29, -21, -1, 21, -11, 38, -15, 32, 74, 32, 0, -20,
+    -14, -112, 25, 9, 34, -31, 57, 27, 32, -32, 20, -5, 6, -79, 8, 56,
+    33, 16, -36, 40, -38, -14, -66, -19, -13, 25, -9, 8, 81, -46, 23, 29,
+    21, 31, 21, 32, -3, -16, -21, -4, -43, -61, 41, -109, -13, 50, 14, -16,
+    11, 47, -1, -15, 10, 71, -10, -86, 17, 18, 15, 71, -59, -8, -33, 32,
+    57, -42, -39, 9, -2, 6, -8, 23, 27, -40, -27, 54, -3, 67, -69, 32,
+    57, 27, -64, -56, -32, -33, -2, 57, -9, 6, 43, -79, -28, 6, 9, 64,
+    -19, -31, -9, 39, 6, -2, -31, 19, -3, 28, 13, 43, 14, -58, 25, 43,
+    -19, 2, -64, -63, -25, 18, -44, 32, 4, -11, 1, 25, -19, 46, 38, -81,
+    18, -35, -2, -3, -25, 40, 35, -13, -29, 18, 48, 18, 27, 52, 40, -33,
+    12, 22, -43, -24, -49, 19, 1, 88, -9, -46, 7, 6, -49, -23, -59, 0,
+    66, 12, 9, -22, 46, 4, 53, -20, 33, -96, 34, 44, -2, 26, -22, 0,
+    -19, -62, 12, -30, -1, 14, -42, 9, -64, 33, -3, 24, 11, 41, -42, 7,
+    -14, -10, 32, 21, 76, -22, 2, -33, -66, 25, 40, -5, 25, 28, 23, 44,
+    -9, -6, 6, 24, 30, 31, -33, 25, -93, -59, 38, 66, 5, 25, 3, -24,
+    -60, -26, -38, 3, 101, 18, 46, 48, -17, -16, 20, 42, 19, 35, -22, 47,
+    7, 17, -9, -26, -20, 38, 18, -60, 24, -19, 79, 2, 34, 18, 31, -10,
+    85, 18, -34, 16, -22, -24, -6, -89, 56, 10, -8, -34, 41, -28, 19, -3,
+    5, -14, 8, -41, -3, 61, -71, -25, 38, -29, 45, -31, 33, -61, 38, -18,
+    6, -3, 48, 20, 73, -19, -23, -94, 32, -13, 17, 7, -28, 37, -1, -30,
+    -14, -16, 54, 25, -31, 42, -2, -78, -59, -49, 73, -25, -45, -15, 30, -58,
+    -11, 53, 0, 16, -9, 27, -20, -20, -38, 35, -33, 12, 42, -1, -45, 86,
+    28, 34, -6, 63, 53, 4, 47, -5, -4, -38, -37, -5, -67, 28, 23, 27,
+    -35, -7, 2, -16, -108, -14, -9, -30, -25, -32, 10, 46, -27, 31, -7, -22,
+    -34, -46, -20, -5, -10, 26, 49, 25, 77, -48, 2, 9, -7, 43, -45, 39,
+    10, -47, -43, 29, -33, -8, 17, -59, 38, 19, 68, 31, -34, -47, 85, 25,
+    -51, 25, -25, 13, 26, -4, -68, -39, -21, 25, -55, 39, -65, -5, 33, -17,
+    -18, 7, -102, 3, -7, 39, -7, 23, 68, 89, 24, -10, 26, -43, 80, 83,
+    4, -8, 21, 32, -48, -48, 14, -41, 43, 18, -46, -5, -1, 52, 67, -16,
+    39, 37, -83, -22, -26, 38, -5, 3, -72, 75, -13, 47, 55, -34, -31, -52,
+    -17, -60, -12, 7, -45, -13, -8, 13, 24, -19, -16, 46, 40, 18, -92, -12,
+    -27, 18, 9, -20, 15, 7, 10, 19, 64, 23, -10, 3, -45, -9, -47, 2,
+    36, -1, -15, 43, 17, 10, 37, -15, 20, -16, -50, -42, 26, 0, -94, 33,
+    23, -23, 13, -116, -5, 35, 26, 24, 15, 55, -39, 12, -71, 9, -11, -32,
+    95, 49, 10, 27, 34, 58, -80, 85, 80, -31, 36, -30, 19, 16, -29, 10,
+    4, -5, 2, 11, 6, -32, -34, -4, 68, -31, 48, -88, 13, -23, -73, -38,
+    -68, -5, 16, -9, -14, 54, -23, 39, 61, -63, 63, 31, 37, -14, 28, 51,
+    19, 10, -8, -21, 22, -59, -27, -30, 12, -10, -31, -63, -6, -25, 46, -32,
+    50, 0, -58, 72, -11, -9, -16, 3, 38, -1, -67, -17, -32, 42, -32, 15,
+    62, 41, -13, -1, 56, -8, -33, 10, -60, 53, 43, -10, 11, 22, 28, -40,
+    -29, -4, 22, -10, -30, 22, -8, -7, -21, -13, 6, 72, 18, 69, -39, 61,
+    -1, -3, -78, 40, 51, 52, -20, 21, -25, 45, 2, 31, -34, 0, -32, 44,
+    29, -20, 60, -25, -36, 44, -7, -78, -79, -55, -43, -11, 1, -26, -47, 31,
+    -16, -40, 30, 2, -52, 60, -4, 2, -68, 3, 62, 21, 46, 40, -17, -22,
+    0, -59, -19, 12, 5, 72, 23, -59, 13, -43, -16, -41, -6, -45, 5, 1,
+    38, 12, 25, 37, 22, 24, -4, 23, -8, 28, -46, -52, -2, 20, -15, 59,
+    -41, 3, -10, 60, 48, 85, 28, 21, 32, -25, -28, -37, -67, 23, -38, -61,
+    8, -2, -82, -34, 80, 49, -3, -50, -23, -12, 4, 23, -8, -6, 43, -16,
+    -23, -17, 31, 19, 112, 20, -15, 13, -68, -47, 34, -6, -5, 43, -46, 14,
+    -47, 0, -46, -78, -43, 9, -13, 6, 69, -45, 13, 32, -11, -40, -3, -11,
+    -46, 20, 33, -14, -1, -32, -16, 29, -25, 4, -30, -33, 5, -67, -52, 28,
+    -10, -24, 68, -17, -1, 18, 18, -9, -75, -3, 11, 44, 5, 12, -22, 55,
+    28, -20, 21, 18, 47, 36, -45, 5, -9, -32, -20, -55, 57, -5, 25, 15,
+    1, -37, 25, -79, 58, -19, -40, 40, -9, -60, -20, 38, 0, -21, -10, 6,
+    21, -7, -14, -21, -20, 16, -22, -16, -40, 14, 45, -32, 35, 17, -38, -57,
+    29, 14, -17, -8, -32, -2, 50, -24, -60, -42, 41, -18, -33, -83, -54, 11,
+    16, -15, -36, 45, 31, 2, 53, 46, -29, 72, 9, -4, 9, -22, 14, -53,
+    99, -38, -18, 51, 92, -77, 22, -25, 36, -10, 34, 25, -93, 13, -41, -9,
+    4, 19, -10, -7, -48, 9, 84, -68, 28, -58, -12, 1, 52, -14, -55, -28,
+    -34, -22, 21, -6, -19, 16, -18, -8, -54, 19, -80, 25, -5, -33, -3, -52,
+    28, -42, -3, -72, 26, -16, -9, 19, 36, -4, 30, 5, 4, 35, 45, -27,
+    -11, 6, 9, 26, 37, 23, 11, -39, -52, -15, 9, -38, 17, -8, -12, -41,
+    39, 79, -1, 20, 3, 35, 18, 42, -26, 8, 12, 2, 37, -41, 51, -101,
+    -11, -90, -24, 25, -49, -10, 15, 4, -12, 0, 21, -3, -49, -41, 36, 14,
+    -10, 91, 33, -33, 21, 21, 5, -23, 25, -43, -58, 4, 2, -11, -9, 78,
+    1, 94, 18, 8, -29, -10, 7, -81, 15, 37, 6, -8, 20, 13, 23, 51,
+    -13, -37, -20, 10, 35, 2, -26, 44, 4, -29, 12, 17, 8, -1, -33, -62,
+    35, 22, -14, 5, 41, -11, -10, -29, 50, 32, -19, -7, -12, -61, -42, -65,
+    13, 24, 9, -35, -29, -37, -56, -14, -38, 6, 19, -72, 15, 50, -19, -4,
+    24, -5, -15, 53, 34, 0, 82, -5, 1, 71, -19, 41, -18, 3, 47, -18,
+    36, -77, 10, -43, 2, -67, -67, -43, 40, 38, -8, -25, -30, -21, 12, 16,
+    -39, -57, 7, -40, -22, 2, -21, -23, 28, 22, -21, 14, 55, -56, 60, 50,
+    -44, -90, -13, -83, 36, -35, -8, 36, -43, -44, 0, 15, -6, 12, 5, -32,
+    49, 9, -1, -54, 33, -8, -35, -41, 13, -6, -13, -14, 9, 0, 20, -41,
+    -5, 71, -6, -9, 52, -57, 3, -33, -3, -14, -36, -5, 27, -25, 0, -15,
+    42, 32, -17, 14, 55, 15, -26, 19, 27, 0, 43, 9, -8, 37, -14, 43,
+    -35, 10, 4, 36, 37, 48, -4, -14, 8, 0, 22, -28, 7, 46, 61, 5,
+    113, 9, 46, 40, -80, 1, 5, -4, -82, 25, 32, 32, 44, 48, 35, -64,
+    -17, 80, 36, 13, -27, -13, 22, 14, 35, 99, 58, 2, 18, 26, -6, 56,
+    31, 28, -13, 24, 38, 9, -80, 64, 17, 73, -76, -57, -27, 26, -14, -39,
+    -22, -41, -49, -28, -31, 8, -25, 87, 9, 7, 44, -96, 52, 55, 15, -32,
+    -40, 45, -8, -6, 1, -30, 30, -14, -4, 28, 50, 69, -35, 12, -43, 2,
+    30, -10, 11, -36, -8, 27, 42, 32, -9, 62, 23, 12, -9, 64, -18, 3,
+    47, 68, -29, -39, -43, 67, -38, -40, 73, 30, 21, -25, -29, 31, 24, 33,
+    35, -10, 62, -14, 19, 20, -30, 30, 57, -36, -33, 22, -19, 31, 22, 28,
+    36, 23, 10, 57, -53, 26, -21, -31, -34, -4, 30, 34, -32, 16, -78, -22,
+    -5, 21, -71, 1, -8, 9, -27, -63, -1, 41, 8, -8, 26, -10, 47, -44,
+    -12, -37, -13, -26, -34, 4, -85, 8, 18, -16, -36, -35, -6, 49, -13, 21,
+    9, -71, -10, -19, -89, -17, -42, -32, -55, -5, 22, -12, 40, -39, 3, 13,
+    -32, 50, -103, 38, 22, 2, -37, 3, 11, -12, -20, 13, -4, 31, -26, 14,
+    14, -25, 25, -72, 22, -51, -52, -29, -45, -44, -81, 74, 6, -41, 9, -5,
+    -15, 29, -66, -43, -32, 0, 17, 22, -4, -39, -62, 38, -25, 45, -14, -88,
+    -9, -63, 10, -92, 58, -36, 8, 29, 51, -4, 1, 71, -33, 23, -4, -63,
+    -12, -3, -18, 9, 6, 95, -32, -14, -25, 31, -5, -20, -65, -3, 61, 71,
+    -8, -13, -69, 9, 5, 4, -31, -81, -1, 9, -67, 13, -6, 86, -8, -6,
+};
+
+static const int32_t nnb_conv1_bias[64] = {
+    -5658, -4041, 1526, 933, -2185, 499, -263, -39, 4652, -2752, -1377, 2457, 6459, -3194, -1473, 48,
+    2320, -3393, 1724, 3220, -1704, 1782, -3918, -3501, -369, -738, 2586, -893, -517, 2630, 1355, -648,
+    -3746, -1903, -2236, 3639, 79, -2326, 1552, -1116, 3022, -37, -5144, 1677, 4227, 1097, 1632, 2110,
+    2336, -678, 17, -1232, -3729, -4501, 1032, -2295, -3069, -5804, -279, -7188, -3013, 182, -790, 403,
+};
+
+static const int32_t nnb_conv1_mult[64] = {
+    1159599991, 1507381712, 1263648018, 1779878135, 2040805195, 1297205790, 1100792550, 1135176819, 1689193842, 1370713530, 1151430684, 1567880206, 1832130746, 2005343531, 1206855982, 1144370970,
+    1827038265, 1602871595, 1160133897, 1261486494, 1743646258, 1418358653, 1658252153, 1179457394, 1136414093, 2065903919, 1350087952, 1996735770, 1583729822, 1409367473, 1405436914, 2081118436,
+    1675991894, 2053208146, 1259384804, 1930630512, 1691272500, 1089959618, 1890140011, 1544810186, 1497082228, 1096799542, 2128136948, 1262118369, 1921917671, 2077971944, 1310871836, 1541188122,
+    1391594706, 1487580919, 2145502715, 1641507588, 1745558813, 2082695259, 1878631237, 1262592691, 1277961528, 1274513984, 1891795643, 1915404141, 1280722172, 1313605429, 1891736463, 1963031212,
+};
+
+static const int32_t nnb_conv1_shift[64] = {
+    -6, -6, -6, -6, -7, -6, -6, -5, -6, -6, -6, -6, -7, -6, -6, -6,
+    -7, -6, -6, -6, -6, -6, -7, -6, -6, -7, -6, -6, -6, -6, -5, -6,
+    -7, -7, -6, -7, -6, -6, -6, -6, -6, -5, -7, -6, -7, -6, -6, -6,
+    -6, -6, -6, -6, -6, -7, -7, -6, -6, -7, -6, -7, -6, -6, -7, -6,
+};
+
+static const int8_t nnb_dw1_weights[576] = {
+    57, -8, 75, -68, -30, 30, -1, -9, 43, 12, -55, -5, -43, -31, 7, 5,
+    -26, 32, -41, -30, -30, 20, -87, -26, -6, -16, -15, 22, 0, 19, 31, 38,
+    -24, 45, 28, -47, 26, -18, -46, 31, -24, 21, -19, -93, 73, 65, -5, 98,
+    -66, -5, 25, -3, 5, -67, -76, 87, -9, 72, 61, -15, -23, -15, 23, -41,
+    -40, 25, -2, 20, 64, 15, 26, -39, 20, 11, 40, 66, 16, -76, 56, 102,
+    -37, -32, -53, -52, -31, -38, -29, 6, 8, -30, -2, -11, -35, 2, -8, 49,
+    54, -8, 90, -15, -56, 1, 34, 65, 32, 41, 64, 57, -11, 0, 11, -6,
+    -8, -45, 74, -19, -19, 2, -37, 20, 10, 30, -33, -38, 90, 2, 15, 58,
+    7, -6, 35, 4, 40, 18, -11, -36, 49, 88, -8, 26, 34, 62, -65, 21,
+    -36, -22, -18, 2, -62, 4, 28, -61, -1, 69, 50, 37, -30, -25, -14, 1,
+    25, 15, -13, 12, -1, 18, 12, -103, -48, 75, -4, 61, -59, 28, 100, 19,
+    45, -72, -5, -70, -7, -57, 30, 86, -11, 82, -1, 3, -4, 65, -12, 33,
+    86, 58, 107, 5, -17, -55, 41, 34, 14, 59, 4, -32, 8, -36, 12, -23,
+    -26, -88, 18, 63, 51, 82, 42, -20, -32, 98, -54, 54, 22, 42, 51, 62,
+    -11, 49, -57, 15, 81, 9, 3, -35, 2, 11, 19, 49, 3, -36, -18, -39,
+    48, 14, -19, 24, -29, -7, -8, -5, 6, -17, -78, 34, 34, -6, -21, -92,
+    42, 3, -25, -31, -26, 21, -61, -7, 13, -11, 17, -26, 8, -30, 108, 59,
+    -66, 62, -15, 16, -63, -1, 10, 28, 16, -65, 0, -84, -18, -9, 1, -36,
+    -27, -33, 41, 73, 3, 14, 36, -9, -25, -24, -24, 47, -37, -27, -41, -10,
+    -26, 9, 51, 3, -23, -20, 32, 54, -8, 29, -68, 116, -36, 3, 81, 4,
+    54, 78, 27, -2, -1, -19, 61, 45, 21, 30, 61, 23, 35, -28, -58, -7,
+    33, -21, -14, -101, 96, -1, -9, -50, -54, 16, -1, -77, 14, -75, -40, 7,
+    13, -9, 17, -16, -43, 0, -40, -61, -18, -10, -25, 25, 25, 27, -7, 39,
+    -25, -52, -63, 26, -16, 87, -20, -1, 13, 24, 9, -36, -7, -14, -90, -23,
+    4, 39, -14, 40, -21, 110, 7, 24, -8, 27, 13, 2, -71, -44, 46, -60,
+    -124, 4, -28, 37, -14, -19, 19, -8, 98, 41, -67, 57, -79, 6, 10, -61,
+    -25, 63, 14, -65, 11, -48, -30, 17, -27, 64, 5, -68, -2, -68, 20, -71,
+    11, 33, 13, 31, -89, -12, 9, 17, 61, -36, -45, 8, 54, 39, -38, -46,
+    -33, 100, 56, 79, 82, 18, 8, -69, 66, -82, 28, -98, -79, -14, 41, 25,
+    20, 22, 65, -28, 78, -19, -24, -50, -33, -67, 4, -33, 31, 27, -25, 26,
+    -25, -1, 14, -73, 9, 50, 13, -65, -39, 7, -23, -44, 27, 46, -24, 42,
+    55, -26, -3, -14, -3, -3, -9, -27, -59, 4, 33, 30, -42, -41, -13, 36,
+    35, -81, 6, 38, -2, 38, 17, -19, 8, -95, 71, -30, 43, -1, -23, 50,
+    12, -6, -22, -19, 20, 30, 25, 74, 59, 52, 18, 82, -28, -39, -4, 39,
+    7, -23, -7, -51, -19, 49, 80, -34, -18, -42, 36, -37, -22, 10, -47, -67,
+    14, -17, 32, 56, 23, 5, -38, -34, 30, 16, -13, -2, -5, 17, 67, 6,
+};
+
+static const int32_t nnb_dw1_bias[64] = {
+    -2183, -4015, -12692, -5284, -3985, -6296, -2242, 1828, -7733, 212, -3247, 1791, 1735, 1938, -4855, -3270,
+    7243, -1519, 1218, 5967, 1417, -3197, 1675, 1299, -1309, -1580, 587, -1027, 3576, 1841, 318, -4354,
+    350, -2669, -4118, 6771, -786, -264, -779, 6519, 6256, -5684, -254, -902, 1091, -2371, 1189, -794,
+    -4862, 723, -3467, 883, 3632, 482, 1119, -5063, 129, -7289, 6254, -4585, -524, 409, -1076, 3879,
+};
+
+static const int32_t nnb_dw1_mult[64] = {
+    1631058893, 1546390312, 1342773326, 1599818506, 1592991400, 1084914595, 1171869226, 1824227437, 1253173482, 1533761274, 1227532063, 1443962262, 1825328691, 2141855193, 1338078938, 1660483251,
+    1529532831, 1690610554, 1115493609, 1278447836, 1280288342, 2137615395, 1738333320, 1263859295, 1942600049, 1135176819, 1516681870, 1121659301, 1920879853, 1549480873, 1780297325, 1349364948,
+    1409498870, 1238899032, 1583315168, 1299603274, 1909838919, 1802048380, 2033530820, 1239051336, 1843918146, 1673579995, 1567961510, 1408973428, 1736436557, 1802263203, 1234548823, 1691083320,
+    1540324491, 1296816339, 1256610829, 1101193451, 1378650819, 1147497904, 1188450977, 1238188770, 1412395822, 2142614071, 2056210117, 1430707380, 2126341052, 1244815552, 1329664458, 1323784850,
+};
+
+static const int32_t nnb_dw1_shift[64] = {
+    -5, -6, -6, -6, -6, -5, -5, -6, -6, -6, -6, -6, -6, -6, -7, -7,
+    -7, -6, -5, -6, -6, -6, -5, -5, -6, -6, -6, -6, -6, -6, -6, -5,
+    -4, -5, -6, -5, -6, -6, -6, -6, -6, -6, -5, -6, -6, -6, -5, -6,
+    -6, -6, -6, -5, -6, -5, -5, -5, -5, -6, -6, -5, -6, -5, -5, -6,
+};
+
+static const int8_t nnb_pw1_weights[4096] = {
+    -78, 1, -22, 4, -22, 52, -2, 17, 55, 74, -74, -3, 15, -30, 42, 14,
+    27, -19, 13, -32, -18, 27, -25, -2, -25, -1, -7, 9, 3, 27, 56, -76,
+    -5, 60, 7, 8, -88, -65, 6, -56, 48, -40, -21, -25, 44, 29, 14, -6,
+    20, -103, -3, 6, -16, 0, 35, 26, -32, 54, -59, -27, 12, -29, -22, -10,
+    -37, 46, -22, -35, 5, -19, -27, -7, -66, 16, -52, -12, 43, -2, -72, -25,
+    -80, -23, 22, 28, -17, -54, -24, 9, -28, -24, -75, -15, 19, -57, 13, -95,
+    -31, 14, -3, -31, -23, -31, -39, 2, -12, 64, -58, 55, 27, 54, -44, 3,
+    33, -16, -31, 42, -25, -56, -25, 4, -36, 9, 16, -49, 22, -5, 23, -35,
+    15, -13, -23, -64, -28, 40, -72, 13, 41, -23, 4, 63, 23, 58, -57, 61,
+    -7, 19, -9, -36, -22, -51, 65, 19, 81, 85, -86, 1, -34, -19, -72, 48,
+    -8, -33, -7, -23, 8, -42, -16, 4, -54, 19, -8, 0, 65, -41, 21, -94,
+    30, -44, 22, -60, 35, 0, -36, 14, -36, 13, 17, -31, -6, -7, 32, 19,
+    -34, -19, -4, -51, -3, -19, 110, 64, -13, -43, -15, -9, -10, 15, 8, 8,
+    10, -16, -37, -8, -5, -40, 101, 31, -80, 38, 24, 72, -6, 15, 17, 40,
+    14, 22, 23, -20, -22, 40, -115, -13, -31, 10, -7, 1, -99, -34, 9, 19,
+    -32, -13, -26, 8, -29, 2, 32, 43, 15, -6, -4, 32, 44, -13, -32, 36,
+    25, -19, -57, 1, -48, 5, -24, 33, 6, -18, 12, 3, -27, 68, -41, 11,
+    -30, -57, -47, 26, 27, 25, -35, 6, -27, -117, -19, 7, 32, -79, 12, 40,
+    -7, -44, -22, 40, -21, -37, 10, 19, -9, 23, 43, 18, -9, -26, 38, -39,
+    22, -7, -26, -30, -41, 12, -43, 7, 55, -16, 20, -19, -1, 24, -12, 2,
+    -90, -103, 28, 32, -12, 80, 12, 34, -13, 0, 11, 36, -48, -1, 6, -4,
+    56, 5, 82, 46, 62, 78, 5, 1, -1, -30, 51, 9, -47, -10, -16, 14,
+    31, 22, 93, -26, 22, -60, -9, 23, 16, -10, -38, -13, 29, -13, 27, 10,
+    -2, 11, 35, 23, -38, 8, 17, -59, -39, -16, -40, 1, -2, -17, -21, 41,
+    -21, 20, -19, -117, 9, -36, 65, 46, -63, 61, -32, -26, 2, -28, -68, -82,
+    85, -20, 35, 38, 96, 7, -61, 22, 44, -26, -1, 14, 18, 32, -1, 79,
+    -58, 17, 11, 11, -26, 35, 2, -4, -28, -72, -20, 27, 9, 21, -61, -11,
+    -26, -9, 2, 21, 63, 26, 1, -11, -76, -102, -1, 12, 38, 25, 52, -11,
+    24, 3, -19, -56, -1, 8, -68, -65, 1, -25, 56, -34, -8, -55, -45, -3,
+    5, -44, 2, 14, 66, 12, -39, 32, -68, 16, 60, 60, -9, -9, -82, -65,
+    -40, 18, -23, 0, -32, 58, 4, -20, 55, -49, 14, 56, -6, 83, 75, -29,
+    -100, 17, 25, -3, -1, -29, 46, 7, 53, -112, -28, 13, -2, 25, -87, 39,
+    -53, -39, -36, 34, 57, 5, 52, 22, 21, -5, -3, -49, -35, 1, -67, -8,
+    -1, 65, -111, -11, -9, -55, 23, 29, -25, -36, -48, 20, -54, -47, -17, -32,
+    -3, -27, -21, -76, -29, -53, -31, -57, -9, -56, -88, -8, -20, 43, -19, -4,
+    -18, 33, -32, 20, 32, -20, -12, 2, 78, -84, 35, 50, 60, -22, 30, -6,
+    31, -13, 1, -34, -4, -2, -55, 92, 13, -2, 23, 60, -40, -43, 23, -5,
+    -27, -2, -55, 23, -13, -42, -37, 39, -31, -32, -6, -19, 9, 37, 8, 8,
+    58, -47, -24, 31, -3, 57, 0, 19, -23, 42, 38, -39, -21, 46, 8, -46,
+    -23, 37, 32, 63, 38, -48, -8, 44, -85, -4, 10, 9, 6, -29, 23, 23,
+    -20, -28, 11, -28, -13, -40, -52, -70, -11, -32, 24, -75, -7, -15, 8, 28,
+    30, 43, -34, 5, -84, 6, -20, -54, -2, 83, 33, 55, 26, 41, -14, -24,
+    -33, -34, -32, 21, 5, -41, -19, 7, -25, -34, -1, -33, 8, -44, -5, -25,
+    20, -54, 26, -61, -50, -29, 18, -52, 60, -18, 20, 12, -120, -35, -15, 46,
+    54, 24, -36, -2, -42, 34, -28, 37, 104, -5, -12, -60, 63, 12, 9, -12,
+    -58, 1, -9, 63, 39, -42, -6, -34, -25, 27, -9, 38, -68, -98, 14, -33,
+    -14, 78, -18, 11, -22, 25, -24, 1, -2, 47, -57, 89, 2, 29, -52, -11,
+    -10, -52, -21, 10, 24, 13, -77, -87, -34, 17, -45, 25, -68, -11, 9, -70,
+    40, 30, -93, -45, 1, -26, -16, 66, -92, 55, 13, 1, 13, -6, -35, -38,
+    -34, -11, 56, 0, -16, 16, -19, -9, -56, 45, 29, -12, 34, 9, -4, 61,
+    10, -68, 3, 37, -68, -23, -9, -34, 54, 49, -20, 29, -24, 4, -3, -62,
+    27, 29, 11, 8, -7, -15, 76, 12, -45, 3, 85, -42, -49, -6, 63, 46,
+    -5, 46, 78, -14, 44, 11, -36, -66, -16, -64, 27, 25, -35, 20, -28, 42,
+    31, 12, 4, 20, -18, 56, 25, 13, -5, -32, -68, 14, 6, 22, -81, -35,
+    -57, -5, 21, -7, 54, -15, -32, 70, 10, 19, -6, -12, 20, -54, -34, -39,
+    -1, -62, 51, -15, -37, -6, 1, 87, -6, 7, 70, 0, -19, -62, 18, -8,
+    -28, -36, -4, 4, 55, -24, 13, 9, 41, 5, 37, 23, 12, 24, -29, -13,
+    57, -6, -36, 7, 39, -11, 11, 11, -73, 36, 10, -62, 61, 8, -14, 54,
+    19, -27, -44, 64, -17, 36, 46, 20, -72, -14, 48, 32, 14, 17, -28, 20,
+    -28, -50, 27, 11, 49, -33, 32, -19, -59, 31, 34, -19, -54, -11, 20, 20,
+    -14, 12, 1, 3, 38, -12, 8, 22, -16, -43, 51, 11, -50, 18, 109, 71,
+    -41, -15, 59, -30, -37, 52, 13, -3, -30, 11, -65, -16, -21, 56, -7, -2,
+    -35, -11, 48, 49, 25, 54, 79, -7, 12, 55, -4, -12, 21, -39, 60, 3,
+    -17, -50, -15, -12, 12, -29, 22, 28, 52, 25, 77, -20, -28, 34, -14, -4,
+    49, -38, 18, 53, -59, 21, 20, 44, 3, -29, -24, 3, 1, 3, 7, 21,
+    -61, 0, -43, -55, -26, 11, -42, -2, -16, -37, 3, 32, -30, 15, 38, 29,
+    -58, 39, -7, -3, 34, 28, -46, -58, 16, -7, 12, -75, 40, 67, 7, 47,
+    36, -13, 26, 23, -101, -5, 35, -57, -40, 70, -3, 66, -37, 42, -7, 32,
+    -2, -33, 24, 3, -25, -66, -71, 34, 83, 26, 4, 68, 3, -22, -67, 39,
+    59, 18, 83, 10, -50, 17, -33, -46, 7, -34, 19, -44, -127, 22, 89, 54,
+    66, -34, 95, 40, 13, 52, -57, -38, 10, -14, -16, -23, 29, -18, -28, 6,
+    -68, 31, 53, -53, 12, 55, 26, 29, 22, -62, 36, -13, 69, -23, -29, 9,
+    33, -22, 36, 31, -43, 9, -53, 56, 50, 7, -7, 16, 22, -27, 49, -37,
+    -93, 52, -6, -35, 47, -1, 23, -104, 34, -39, 53, -43, 16, 19, -41, -38,
+    -40, -3, 1, -26, 48, 25, -18, 14, -2, -53, 22, -19, 41, 64, 73, 29,
+    -50, 1, 21, -17, -127, 63, 25, -47, 35, 53, -40, -55, -28, 11, -34, 17,
+    54, 15, 57, 19, 3, 13, -9, 53, 63, -5, 39, -29, 34, 42, -35, 14,
+    -50, 25, -83, -7, 41, 1, 103, -3, 19, -45, -22, -17, 19, -22, 102, 24,
+    -101, 70, -65, 15, 7, -11, 9, -48, -9, 29, -13, 19, -20, -29, 73, 57,
+    15, 46, -19, 9, 9, 45, 31, 40, 59, 10, -37, 14, 9, -8, -43, 26,
+    30, -30, -1, 7, -58, 29, 6, -35, 40, -11, 17, -58, 7, -20, -9, -44,
+    53, 8, -4, 49, -43, 6, -8, -7, -43, 21, 35, 30, 83, -29, -13, 22,
+    -12, 26, 13, 11, -8, 43, -5, 6, -29, -24, 20, 15, 21, -8, 27, -10,
+    34, -64, 33, -4, -24, 18, -8, 0, -12, -55, 20, -52, 16, 31, 94, 46,
+    43, 66, -27, 29, 77, -2, -34, -23, -24, -10, -6, 9, 27, -31, 92, -7,
+    18, 39, -10, 42, 18, 46, 1, -14, -3, 41, 19, 20, -11, 38, -102, 70,
+    48, 24, 29, 61, -83, 9, 6, -9, -78, -13, 22, 47, -7, -74, -37, 36,
+    -25, 14, -51, 24, -5, 39, 88, -11, -10, -70, 11, 2, -32, -7, 5, -19,
+    -38, -6, -59, -6, 18, -107, -37, -43, 18, -37, -30, -33, -2, -24, 70, -33,
+    -10, -73, 33, 7, 71, -18, -25, -27, 8, -10, 107, -29, -34, 44, 66, 6,
+    21, -7, -17, 27, -29, -19, 10, 18, -12, 23, 100, -20, -30, -68, -11, 17,
+    -37, 9, -35, -103, 4, -7, -18, 60, 21, 87, 33, 37, 33, 6, 35, 30,
+    20, 107, 13, 33, -82, 15, 27, 25, 21, -34, 0, 49, -20, 20, 7, 59,
+    5, -3, 31, 36, -44, -66, 16, -7, 7, -79, -25, 7, 24, -46, 54, 11,
+    47, 47, -51, 30, 74, 4, 118, -1, 119, 57, 29, 23, 33, 38, 31, 64,
+    61, -20, -44, -38, -7, 63, 24, 95, 109, -8, 49, 49, -32, 73, -2, -23,
+    89, 21, -35, 15, 35, 45, 10, -17, -35, 12, 12, 13, 71, -55, -32, 42,
+    -22, 38, -23, -17, -18, -93, 71, 36, -35, -66, -3, 31, -56, 107, -36, -12,
+    -47, -62, -27, -21, 16, -41, -10, -1, 23, 9, -20, 22, 8, -37, -58, -23,
+    0, -60, -72, 40, 7, 33, 5, 50, -37, 12, 29, 6, 9, -16, 47, 17,
+    -25, 19, -15, -72, 33, 96, 48, -2, -10, 52, 82, -1, -27, -32, 3, 54,
+    -33, 62, 18, -9, 46, -9, 2, -39, 2, -21, -2, 1, -31, 52, -13, -105,
+    -43, 50, -1, 13, -14, 23, -50, -64, 11, -11, 55, -15, -3, -27, -68, 19,
+    32, -10, -42, -21, 65, 43, 15, 12, -20, 0, -46, -53, -44, -1, -81, 45,
+    -18, -1, 24, -30, 25, -14, -72, 52, -12, 44, 34, 78, 32, 57, -10, -27,
+    28, -9, 42, -49, 11, 21, -18, -11, 42, 8, -25, 6, -33, -40, 7, -24,
+    4, 45, -21, 8, -9, 15, 12, -83, 47, 65, 48, -8, 4, 37, 65, 38,
+    13, -5, -8, 25, 42, 104, -53, 15, -33, 21, 1, -8, 40, 2, -43, 22,
+    48, -44, -34, -62, 21, -4, -103, -33, -25, -49, -39, -28, 11, -54, 13, -12,
+    -43, -23, -10, 45, -9, -7, 57, 38, 44, 0, 9, 70, -69, 23, -26, -23,
+    32, -25, 63, 60, -64, -20, 6, -86, -15, -23, -34, 18, -27, -27, -6, -47,
+    28, -19, 7, -34, -48, -63, -4, -77, 15, -109, -2, -67, -52, 19, 5, 20,
+    -22, 56, -27, -22, -36, -78, -52, 0, -25, 22, 4, -98, -38, 23, 18, -57,
+    -1, -25, -7, 29, -21, -11, 3, -17, -4, -20, -17, -12, 75, -18, 56, -26,
+    -38, -57, 42, 101, -3, 19, 21, 30, -3, 46, -7, -49, -5, 6, -47, -16,
+    11, -1, -31, 79, 13, -16, 9, 39, 2, 24, -38, 24, 8, 70, 60, 40,
+    -2, -15, 40, 33, -40, -36, -66, 37, -15, 0, -32, -19, -85, 36, -28, -6,
+    21, 127, 9, 42, -60, -115, 66, -27, 96, -22, 25, -71, 39, 60, 47, 22,
+    -93, 23, 34, 30, 14, 22, 19, 18, -15, -30, 19, 31, -16, 17, -45, 71,
+    7, -16, -27, 5, -71, 38, 7, 30, -17, 11, 13, -29, 61, -15, 5, -66,
+    14, 11, 86, -8, -17, -63, 58, 35, 13, -19, -46, -6, 52, 23, -10, 16,
+    -36, -41, 17, 32, -17, -50, 1, -14, 0, -20, 11, 14, -21, -15, 3, -30,
+    37, 27, -15, 7, 14, 6, -69, -30, -28, -78, 59, -95, 2, -31, -19, -22,
+    53, -29, -14, 40, -24, -52, -23, 20, 55, -74, 16, -2, -10, 107, -14, 14,
+    90, 6, -49, 67, 16, -13, -29, 34, 32, -44, 29, -28, 72, -42, 53, 46,
+    -26, -30, 59, 0, 40, 8, -19, -22, 43, -26, 35, -76, -42, -1, -62, 54,
+    20, 19, 22, 53, -25, -11, -7, -41, -12, 45, -5, -20, 91, 52, -62, 3,
+    -19, 14, 20, -13, -30, -65, -41, -55, 58, -9, 37, 11, 7, 55, -22, 1,
+    -19, 7, 28, 1, -58, -33, 33, 74, -29, -22, 24, -9, -74, -20, -11, 37,
+    -51, 68, -27, -8, -25, 52, -37, -12, 20, 21, 28, 50, -10, -95, 38, -18,
+    -35, -7, 12, 2, 19, 31, -28, 36, -19, 73, 45, -14, 1, 42, -44, 65,
+    -20, 63, 44, -2, 36, -34, -7, 24, -39, 51, 31, -10, 0, 11, 71, 25,
+    63, -12, -19, 16, 30, 15, -50, -55, -28, -33, 12, 6, -21, -33, 34, -32,
+    -50, 46, -46, 6, 42, 28, 23, -24, 81, -3, -56, 76, 12, 42, -49, -40,
+    -40, -48, 20, -10, 2, -10, 37, -74, 32, -47, -23, -24, 18, 4, -23, 25,
+    -15, 45, 76, 14, -8, -23, 34, 46, -42, 50, 6, 7, 65, -50, -109, 6,
+    5, 52, -83, -1, -38, -63, 19, 37, -66, -68, -2, 14, -89, -40, 25, -55,
+    74, 20, -18, 14, 10, 13, -27, 68, -57, 66, -81, -56, 56, -33, -24, 27,
+    -43, -57, 27, 29, -53, 62, 21, 112, 34, 6, 44, 8, 50, 60, -38, -63,
+    32, 51, 26, -36, 33, 51, -17, -88, -33, -8, -70, -31, 6, -21, -18, -24,
+    35, -45, 17, 1, 26, 43, -82, 67, -11, -57, -51, 15, 19, -45, -10, -62,
+    -35, 21, 22, 17, 45, -4, 39, -53, -10, -13, 4, -1, -103, 27, 25, 43,
+    18, 1, 24, -73, 85, 19, 64, 16, -6, -68, -25, -34, 89, 1, -48, 90,
+    34, 49, -43, -65, 16, 26, 40, -5, -16, 55, -5, -59, -15, -74, 26, -10,
+    -12, -73, 78, -21, -13, 45, 73, 6, -40, 35, -8, 22, -22, 10, 25, 6,
+    -54, -11, 33, 17, 59, -30, 24, 32, -13, 48, -3, 13, -18, 26, -16, -12,
+    -23, -11, 38, -1, -25, 4, 28, -16, 47, 20, 31, -6, -35, -18, -29, 18,
+    1, 63, -51, -29, -19, 10, -58, 20, 2, 6, -47, 66, -48, 6, -12, 68,
+    -52, -10, 43, 69, -62, 7, 74, -35, 15, 17, -73, 12, -14, -28, 31, -7,
+    -89, 35, -22, 3, -2, -4, -59, -63, 1, 11, 27, -41, -24, -27, 49, 11,
+    -14, 34, -45, -34, 26, -20, -29, -34, 82, -39, -8, -21, 34, 48, 18, 31,
+    -53, 5, -70, -33, -3, -1, 26, -21, 119, 3, 66, 55, 3, -28, -13, -38,
+    34, -80, 4, -11, 6, 18, 25, 32, -37, 18, -26, -79, 15, 41, -34, -29,
+    35, -22, 17, -44, -65, 22, -21, -25, 5, 23, -51, 9, -3, -62, -4, 12,
+    22, -5, -15, 42, 21, -60, 1, -19, -13, 59, 101, 27, -7, 9, 17, 29,
+    22, -40, 61, -29, -19, -58, -20, 12, -42, 39, 16, -17, 54, -61, -5, -2,
+    2, 97, 17, 7, 19, 2, -11, 35, -14, -8, -54, 23, 64, -21, 49, -46,
+    -14, 64, 73, 27, -60, -38, 0, 16, -16, -36, -20, 51, -60, 23, -34, 71,
+    -21, -23, 2, 7, -43, -58, -4, -33, 83, 0, 21, 27, -40, -66, -11, 4,
+    -21, -33, -19, 25, -10, 7, 15, 6, 6, 29, 28, 72, 13, -21, 29, -12,
+    -61, 3, 57, -47, 102, 53, -12, -18, -27, 13, -23, 10, -27, 19, 0, 8,
+    42, 0, -51, 3, 2, 18, 38, 51, 40, 14, 13, -48, -98, 87, 25, -30,
+    -13, -73, -28, -19, 13, 21, 15, 0, -22, -49, -2, -6, -24, 9, -3, 9,
+    13, 22, 34, -30, -14, -2, -100, 107, -4, -44, -46, -2, -17, -33, 23, 24,
+    17, -37, 8, -13, -7, -10, -33, 59, 27, -28, -79, -65, 58, -2, -51, 37,
+    13, -17, -3, 48, -15, -36, -39, -41, 11, 32, -2, -15, -23, -4, 30, 51,
+    -2, -24, 40, 31, -13, 32, 71, 21, -38, 37, 11, -19, -39, 51, -23, 13,
+    23, -34, 3, -49, 81, 13, 17, -23, -48, 28, -33, 4, 70, -30, -49, -35,
+    14, 43, -54, -82, 18, 57, -22, 7, 1, 13, -18, -16, 78, -31, 9, -50,
+    74, -17, -14, -5, 34, -32, 73, 7, -91, -6, -48, -2, 39, 86, 52, -10,
+    75, 21, -31, -101, 32, 5, -58, -66, -59, 27, -16, -68, -2, -40, -23, 25,
+    -11, -64, -23, -46, 11, 0, -14, -10, 14, 34, 46, -7, -60, -1, 1, 2,
+    61, -34, 71, -34, 1, -23, 43, -6, -55, 25, -104, 1, -25, -17, -48, 37,
+    -28, 8, 33, 31, 28, 2, -22, 49, -26, -53, 8, -46, 23, 6, -12, -30,
+    -53, -44, -49, 44, 88, -50, -40, -22, 21, -101, 11, 5, 16, -12, -25, -17,
+    26, -27, -44, -68, 18, -10, 35, -39, 34, 19, -42, -46, 15, -10, -16, -2,
+    -22, -78, 69, 33, 52, 11, 30, -15, 28, -28, 44, 55, -56, 0, 8, -28,
+    -17, -11, 8, -57, 47, -59, 63, 7, -27, 33, 4, 15, 101, -37, -75, -59,
+    55, 7, -35, 127, 24, -3, 61, 4, 22, -32, 45, -34, 47, 33, 25, -102,
+    -26, -40, 56, 50, 45, -14, 52, 2, -80, -61, 25, -27, -25, -46, -44, 0,
+    8, -35, -8, 13, 21, -49, -13, 40, -6, 23, 70, 5, 27, -40, 12, 42,
+    12, 70, 13, 122, -9, -48, -4, -33, 32, -11, 0, 17, -54, -54, -23, -1,
+    -49, 13, 21, 9, 19, 40, -29, -14, -74, 47, 22, -63, 10, 59, -57, 49,
+    32, -19, 4, -30, -58, -10, -38, 48, -32, 23, -83, -11, -9, 45, -19, 1,
+    -22, 81, 0, 60, 62, -30, 42, 20, 58, 34, -40, 47, 27, -49, 36, 8,
+    -53, -24, -53, -63, 20, -14, 1, -12, 65, 44, 15, -19, -20, -18, -42, -35,
+    -57, -1, 11, 3, -39, -34, -25, -36, -62, 3, -26, -20, -36, 23, 29, -57,
+    19, 64, -16, -14, -15, 5, 38, -12, 54, -19, -91, 37, -18, 35, 2, -19,
+    10, -9, -45, -30, -20, -76, 25, 63, -7, -23, 23, -59, 0, 27, 45, -9,
+    23, 81, 21, -78, 97, -48, 0, -8, 39, 30, 51, 20, -25, -94, 20, -33,
+    1, -12, 35, 0, -8, 27, 10, -27, 17, 35, -73, -14, -3, -40, -16, -15,
+    -36, 41, -28, -12, -2, 9, -70, 33, 14, -48, 4, 72, -44, -24, -72, -62,
+    44, -9, -9, 4, 40, -5, -23, -59, 21, 82, -4, -35, 31, 57, 14, 65,
+    -14, -29, -26, 18, -43, 8, 15, 41, 68, 71, 0, 0, 38, -57, -14, 13,
+    64, -26, 15, 51, 50, -18, 40, -18, 18, 55, 53, -4, -85, 47, -39, 46,
+    -24, -7, 62, 23, 2, -21, -75, 11, 64, -26, 36, -42, 39, -10, 53, 50,
+    -48, 19, -8, -31, -42, 31, 42, 18, 3, -17, -50, -3, -6, -46, 31, 10,
+    11, -51, -13, 14, -3, -39, 15, -7, -77, 27, 24, 11, 91, -9, 26, -30,
+    -50, -2, 56, 71, 44, 11, 52, 16, -42, 13, -45, 9, -38, 3, -11, 3,
+    48, -43, -52, 17, -11, 3, 4, 48, -36, 27, 18, 1, -32, 38, -18, 37,
+    28, -26, 19, 24, -15, -35, 5, -44, -13, 80, 5, -28, 52, 52, 29, 16,
+    55, 17, -27, 14, 11, -7, 37, -60, -40, -28, 42, 82, 28, -56, 17, -5,
+    45, 22, -57, 27, -73, 26, 5, -26, -16, 16, -40, -67, 54, 58, 13, 4,
+    87, -4, 2, 28, -53, -17, -52, 63, -49, 40, -6, 14, -39, 19, -9, -84,
+    25, 6, 13, -23, -47, -62, 3, 19, -2, -15, -70, 20, -54, -62, 27, -3,
+    -21, -50, -60, 2, -40, -16, -14, 66, -12, -35, 7, 25, -2, 22, 71, 27,
+    37, 77, 8, -3, -29, 22, 46, -71, -60, -63, 2, 26, 5, -5, 35, -60,
+    -34, 34, 39, 37, 101, 36, -27, 17, -7, 83, -18, 21, 11, 16, -82, 25,
+    -8, 55, 33, 44, -24, 30, 37, 16, 16, -25, -71, 8, 6, 38, 17, 2,
+    -37, 14, -71, 49, -2, 74, 12, 49, -29, -108, 31, 8, -55, 34, -32, -6,
+    -47, -48, 82, -16, -39, 45, -59, 0, -124, 30, 7, 31, 56, -35, -36, 78,
+    20, -42, 7, -11, -4, 29, 25, 54, 7, -35, 20, -23, 43, 42, -73, 41,
+    49, 27, -11, -45, -44, -34, -23, -31, -18, -17, 7, -80, 3, 28, -30, 11,
+    45, -47, -7, -36, -2, -7, -44, -78, -18, -36, -7, -5, 63, -19, 22, -27,
+    68, 12, 33, 30, -7, -24, 9, -12, -3, 29, -9, -28, -43, -53, -2, -29,
+    -39, 33, -42, -4, -35, 15, 25, -22, -28, -13, -30, 32, -28, -4, 31, 23,
+    69, 19, 35, -23, 0, -42, -32, -23, -109, 38, -54, -4, -72, -59, 13, 72,
+    -3, 60, 60, 3, -19, 8, -43, -42, 14, 7, 21, -51, 0, 20, 5, 33,
+    -83, -11, 58, 14, 1, 45, -29, 59, 56, 41, -62, 19, 14, 3, -44, 53,
+    31, 34, -19, 2, 37, -13, -47, 38, 100, -29, -24, 20, -83, 20, -32, 48,
+    -16, 41, 19, 14, 46, -7, 14, 5, 23, 34, -9, -37, 3, -19, -16, -33,
+    17, 41, -46, 26, -18, 1, -2, -14, -19, -9, 108, 47, 51, -7, 11, 32,
+    47, 41, -71, -8, -29, -34, -64, -7, -72, -90, 9, -35, -71, 5, 0, 47,
+    17, 24, -15, 42, 56, -47, -20, -53, -17, 57, -6, 54, 15, -59, 2, 7,
+    37, -86, 57, -2, -4, 77, 94, 4, 9, -76, -55, 4, -9, 46, -5, -23,
+    -111, 65, -3, 14, -9, 6, -57, -1, 48, -12, -15, 27, -30, -13, -15, -39,
+    54, 43, 41, 50, -50, 20, 35, -20, 48, -7, 24, -42, -13, -70, 3, 41,
+    -21, -14, -75, -85, 26, -73, 16, -29, -6, 60, 0, 8, -19, 81, 61, 36,
+    40, -21, -8, 35, 19, -20, 49, -47, 36, -18, -34, -3, -8, -49, -11, 17,
+    -78, -14, 120, 10, -19, -14, -63, 85, -45, -58, -23, -8, 21, 16, 37, -2,
+    32, 44, -15, -35, 31, 14, 2, 58, -23, 5, 37, -40, -32, 14, 59, 13,
+    4, 49, -18, 18, -53, -21, 31, -82, 3, -19, -39, 47, -12, -25, -82, 29,
+    43, 14, 40, 38, -1, 40, -14, 69, -101, 66, 9, -8, 0, 69, 7, -21,
+    25, -11, 85, 27, 0, -17, -36, 2, 26, -8, -3, 10, 21, 86, -26, 1,
+    21, 5, -16, 44, -21, -29, 62, 14, -59, 21, 6, 12, 40, 25, 23, 65,
+    21, -9, -55, -68, -2, 9, -24, 4, 47, 21, -14, -59, -77, -43, -18, 21,
+    12, 73, 85, -36, -11, -82, 0, -63, -50, -36, 3, -49, 13, 34, 32, 0,
+    17, -31, -42, 15, -17, -42, -73, -61, 59, 12, -36, -41, 18, -4, -68, -15,
+    -28, 6, 12, 81, -1, -1, -13, 15, 39, -41, -48, -55, 11, 69, 61, -72,
+    25, -55, 70, -56, 37, 35, 29, 30, -3, 9, -33, -36, -9, -32, -30, -31,
+    65, 5, -46, 23, 35, -4, -19, 10, 59, -8, 41, 9, -78, 54, 75, 16,
+    8, -25, 14, 68, -35, -58, -31, 49, 68, -5, -11, -50, -63, -20, 11, -8,
+    -60, 27, 11, 26, -57, -19, 46, -26, 93, 83, 0, 18, 6, -54, -45, -13,
+    0, 59, 21, 51, 27, 3, -53, 10, -18, 9, 29, -23, 7, 63, 33, 4,
+    34, 71, 41, 13, 25, -35, -14, 19, 25, 15, 13, 2, 55, -29, -67, 27,
+    44, 27, -10, 38, -7, -2, -7, 1, 114, 53, -8, -28, 39, 19, 12, 47,
+    22, 32, 6, 1, 22, 1, -10, -50, -23, -44, 36, 7, -3, 18, 15, -27,
+    12, 3, -23, 12, -24, -12, 42, -94, 27, -18, 3, 90, -55, 42, -34, -2,
+    32, 53, -15, -52, 64, -17, 109, 11, -21, 9, -14, 11, -21, -26, 10, 36,
+    45, -33, -13, -44, -13, -39, 39, 80, -27, -16, -8, -81, -10, 64, 26, 12,
+    26, 21, 1, 1, 26, 26, 28, -43, 55, -5, -10, -44, -19, -37, -48, 38,
+    59, -3, -8, -15, -41, 2, -41, -36, -46, -68, 70, 8, -53, -43, 30, -43,
+    -42, 70, -14, -49, -65, 47, 14, 79, 38, 54, 15, 50, 25, -2, 39, 24,
+    19, 24, 84, -53, 38, 15, 56, -58, -25, -50, 57, 17, -84, -94, -58, -19,
+    42, -27, 12, 63, -58, 8, -2, 46, -11, 19, 32, 34, -19, -26, 46, 64,
+    46, 53, -19, -16, -56, -13, 22, 49, -41, -5, 39, -36, 0, 19, -29, -21,
+};
+
+static const int32_t nnb_pw1_bias[64] = {
+    -1737, 21804, 3105, -5454, 5935, -4420, -1794, 4175, 20660, -983, 19826, 11988, -1523, -2830, -12326, -17443,
+    7064, -9143, 1065, -14637, -11884, -10808, 1135, -35882, -4570, 6898, -11517, 13337, -3125, 302, 5630, -6818,
+    -6088, 9676, 15221, 8541, -6575, 5403, 6843, 1437, 2230, 8021, 4765, 29895, -19506, 585, 10724, 11714,
+    -13973, -3405, -3974, -3760, -10282, 17111, -2290, 680, -5372, 8225, -11472, 5389, -14424, -13524, 4855, -7840,
+};
+
+static const int32_t nnb_pw1_mult[64] = {
+    1584850474, 1391050526, 1411967114, 1596777026, 1411736379, 1483202677, 1075441296, 1408448377, 1732903674, 1591189042, 1351868632, 1327621065, 1432062601, 1401820615, 1595934222, 1480443095,
+    1626977845, 1344504859, 1967886089, 1812418016, 2002886084, 1643247182, 1657479499, 1295982588, 1997593219, 1467367260, 1590686786, 1153385202, 1133687142, 1469649546, 1762500059, 1269084374,
+    1670390286, 1432910919, 1224400476, 1589390757, 1869859916, 1611199199, 1133984765, 1333887849, 1950368946, 1436450736, 1676084798, 1357543652, 1976181809, 1109313929, 1679389584, 1349033831,
+    1477152337, 2078114760, 1934212043, 1540246027, 1708329036, 1588639193, 1742164399, 1540481443, 1199364144, 1461480485, 1529919790, 1204596222, 2001427752, 1424338496, 2033188970, 1474666883,
+};
+
+static const int32_t nnb_pw1_shift[64] = {
+    -7, -7, -7, -7, -6, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -6, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -6, -7, -7, -7, -7, -7, -8, -6, -7, -7,
+    -7, -7, -7, -7, -7, -7, -8, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+};
+
+static const int8_t nnb_dw2_weights[576] = {
+    -33, -6, 27, 28, -49, -16, 36, 6, 32, 65, -52, 44, -13, 8, 7, -33,
+    -11, -2, -8, 13, -22, 56, -2, 5, 22, 3, 2, -18, -27, -3, 28, -51,
+    5, -50, -36, 52, 33, 42, -6, 10, -4, -10, 61, 127, 28, 12, -45, 48,
+    9, 12, -11, 3, -13, 23, 21, -7, 4, 72, -23, 3, 29, 68, -11, 0,
+    -21, -21, 13, -4, -1, -98, -8, 23, 7, 72, -1, 16, -44, 11, -54, 43,
+    -1, -36, 16, 19, -18, 18, -22, 10, -12, -24, -16, -26, 12, 73, -15, -43,
+    -26, -15, -20, 10, 81, 6, 79, 64, 66, -3, -23, 34, -7, -78, 11, 38,
+    -26, 10, -53, -58, -29, -41, 1, -15, 16, -23, 40, 55, 6, 47, -83, 53,
+    18, 29, 27, 61, -2, 6, -1, -79, 86, -29, 54, -31, 14, -20, 9, -1,
+    26, -113, 12, 7, -39, 33, 11, 39, -41, 39, -14, -64, 35, 13, 60, 21,
+    27, 1, 35, -5, -6, -34, 13, -14, -35, -23, -33, 3, -30, 4, 18, -51,
+    0, -39, -10, 72, -50, 3, 17, -7, -34, 55, 57, 55, 8, -36, 25, -49,
+    45, -3, -18, -23, 11, -10, 63, 18, 41, -1, 3, -36, 2, 13, -26, 65,
+    -46, -62, -59, -90, -8, 40, 62, 4, 90, 35, 1, -11, -7, 17, -9, -25,
+    34, 63, -48, 68, -27, 52, -39, 46, -4, -32, 4, 16, 34, 25, 1, 16,
+    -34, -20, 23, 20, -33, -36, -19, 54, 26, -57, -77, -32, -22, 127, 22, 36,
+    27, 4, 56, 42, 16, 12, -59, -50, -27, 14, 23, -1, -22, -62, 28, 5,
+    16, 24, -34, -13, -23, -71, 2, -68, 32, -14, 43, -12, 3, -31, -4, -19,
+    -91, 85, -52, -2, 3, 85, -70, 11, 19, -73, -39, 12, 15, 22, -93, 30,
+    24, -35, -1, 6, 16, -9, 0, -37, 46, 71, 14, 40, 55, -24, 40, -119,
+    -30, 41, 15, 8, -54, -62, -58, -12, 38, 51, -20, 57, -40, -66, 33, -12,
+    -9, 79, -61, 49, -44, -7, -16, -7, -25, -44, 19, 38, 43, 10, 86, 0,
+    -16, -19, -11, 19, -17, -5, 94, 7, -66, -83, 32, 51, -44, -20, 62, 0,
+    4, -71, 50, 27, -29, -29, 13, 15, -12, 22, 73, -32, 82, 33, -7, 49,
+    -118, 55, 4, -44, 8, -7, 4, -48, -25, 20, 13, 1, -65, 19, 127, 114,
+    0, -9, 5, 81, -25, 29, 11, 61, -89, 65, 42, -22, -18, -56, 48, -2,
+    -38, -61, 17, 68, -18, 28, -83, 15, -44, -5, -68, 22, -32, 26, -15, 36,
+    -85, 45, -59, 34, 38, -30, 82, 19, 9, -9, 39, -40, 33, -45, -10, -36,
+    31, -51, -16, 6, -74, 90, -26, 32, -56, -26, -62, -2, 21, -4, 57, -64,
+    11, 23, -6, 36, -24, -19, -51, -9, 5, 0, 46, -94, -22, -1, -12, 13,
+    23, 29, -76, 42, -63, -12, 5, -15, -1, -19, -9, -16, -13, -16, -29, -4,
+    48, 15, 0, 56, -2, -51, -22, -63, 69, 29, 7, -4, -51, 5, 1, -32,
+    12, 23, 81, -18, 8, 37, 52, -18, -28, 16, 20, -20, 73, -8, 28, 10,
+    13, 45, -39, 68, -36, -26, -7, -44, -21, -50, -127, -5, 13, 40, -30, 26,
+    19, -87, 27, -6, -78, -6, 71, 41, 69, -65, 9, -29, 45, 49, 8, 10,
+    -53, 22, -12, 20, 55, -41, -12, -6, -29, -14, -4, 16, 60, 11, -2, 0,
+};
+
+static const int32_t nnb_dw2_bias[64] = {
+    -468, -1536, -3490, -353, 5596, -545, 1597, 3406, -1335, -5491, -1356, -1147, 2900, 2979, -9027, -3894,
+    388, 189, 5030, -6951, 2917, -2460, 2072, -865, 1580, 1372, -2253, 1286, -2652, -2548, -3704, 1836,
+    837, 2203, 3632, -5125, 1695, -421, 654, -499, 80, 13683, -407, -7923, -194, -840, 4259, -2577,
+    2336, 1602, 7021, -1995, -341, 6569, -1185, -663, -2749, -4255, -5160, -75, -3747, -3691, 1502, 6043,
+};
+
+static const int32_t nnb_dw2_mult[64] = {
+    1454240562, 1609012865, 1518815037, 1643113236, 1159644464, 1856712912, 1538756731, 2081261685, 1475530439, 1768220454, 1224946109, 1943973882, 1184447264, 1432469669, 1294096716, 1989706167,
+    1472225619, 1285022089, 1677386540, 1369037841, 1636355112, 1648937654, 1921246014, 1103846735, 1765639110, 1598803393, 1600326546, 1124705020, 2058449844, 1264916740, 1522409232, 1145671786,
+    1449917031, 1265975957, 1147410814, 1397705809, 1245123117, 2064211480, 2076616171, 1949991601, 1164019470, 1673857936, 1845719068, 1079453421, 2135954349, 1235153994, 1398352207, 1152747608,
+    1461409848, 1140400157, 1904785798, 1273869640, 2119781952, 2125743094, 1811006814, 2128886134, 1443686486, 1367057137, 1626059143, 1739533412, 1210721941, 2129260925, 1086552025, 1718572795,
+};
+
+static const int32_t nnb_dw2_shift[64] = {
+    -5, -5, -5, -5, -6, -6, -5, -6, -6, -6, -5, -5, -5, -6, -6, -7,
+    -5, -6, -6, -6, -6, -6, -6, -5, -6, -6, -6, -5, -6, -5, -6, -5,
+    -5, -6, -6, -6, -6, -7, -7, -6, -5, -6, -6, -6, -5, -5, -6, -5,
+    -6, -5, -6, -5, -6, -6, -5, -6, -5, -6, -6, -5, -6, -7, -5, -6,
+};
+
+static const int8_t nnb_pw2_weights[4096] = {
+    -31, -43, 43, 43, 15, -70, -52, -39, 0, -38, 8, 66, 40, -7, 14, -11,
+    22, 18, -6, 86, -29, -50, 5, 20, -9, 0, 29, -84, 5, 19, 21, 41,
+    -80, -13, 29, -33, 40, 32, 29, 72, 62, 16, -102, -35, -15, 23, -21, 70,
+    -63, 0, 95, 13, 29, 41, -41, 39, -60, -3, 69, 37, 27, -7, 21, 36,
+    50, 56, 38, -55, -45, 4, -42, -27, -39, 99, -4, -14, 29, -40, 39, 0,
+    -12, 6, -27, -6, -5, -36, -91, 53, 94, -12, 58, 51, -7, 123, -4, 37,
+    -13, 4, 68, -22, -8, 45, -98, 0, -16, 47, 23, 12, -66, 24, 34, 41,
+    -1, 19, 39, 69, 28, 40, 4, 15, 51, -16, 23, 8, 77, -21, 29, -3,
+    -12, 38, -23, 7, -38, 45, -3, 0, 22, -11, 59, -17, 19, 9, 96, -29,
+    -37, -36, -23, 31, -18, 49, -71, -12, 52, 5, 45, -51, -72, 30, -28, 49,
+    -42, 6, 13, 61, 11, 33, -57, -23, 62, 28, 3, 0, 6, -36, -53, 15,
+    11, -11, -13, -48, -30, 61, -29, -2, -28, 29, 12, -67, -3, 17, -23, -39,
+    -7, 11, -4, 28, -17, -39, 8, 31, 69, -2, -45, 37, 3, -2, 16, -17,
+    -3, -26, 77, 65, -27, -6, 71, 115, -12, -80, -2, -54, 14, -36, -101, 36,
+    -77, 38, -17, -10, -23, 88, 14, 78, 98, -4, 23, 11, -75, 26, -67, 19,
+    -80, 43, -45, -19, -33, 21, 18, -41, -4, 6, 28, -40, -24, 14, 127, 6,
+    -9, -62, 17, -56, 127, 65, 7, 14, 12, 30, 11, 53, -13, 31, -17, 60,
+    -47, -32, -43, -26, 37, 35, 28, 74, -12, -1, 32, -17, -26, 67, 6, 51,
+    -1, 12, -39, -26, 9, -23, 59, -54, 78, -35, 18, 95, -5, -2, 10, -25,
+    25, 64, 16, 28, -24, -17, -56, 56, 15, 1, 11, -96, -11, -23, 8, 7,
+    -51, -28, 25, -2, 1, -1, -7, -41, -13, -11, -13, -19, -7, 3, 5, 6,
+    65, 13, 4, -20, -43, -41, 20, 0, 3, -23, 48, -57, -18, 42, -127, 36,
+    40, 23, -12, -75, -1, -42, 45, 69, -58, 24, -9, 21, 46, 66, 1, 18,
+    -22, -77, -35, 30, 55, -91, -29, 34, 73, 9, -74, 24, 19, -1, -15, -37,
+    68, -32, 57, 9, 28, -11, -24, 6, 2, 30, 38, -78, 27, -5, -77, -32,
+    35, 27, 16, -23, 74, -11, -5, -56, -93, 39, -35, 2, 22, -29, 49, -31,
+    -28, -38, -32, -66, 37, -36, -36, -1, -45, 20, -38, -14, -39, -18, 5, -43,
+    8, 5, 0, -5, 83, 8, -67, 1, -59, -28, -79, 27, 29, -44, 14, -46,
+    11, -5, -118, -35, -19, -6, -22, -64, 27, -30, -48, -4, -7, -34, 5, -13,
+    -28, -22, 3, -17, 56, 17, 47, 42, 32, -104, 18, -30, -17, 66, 109, -1,
+    -43, 24, 2, 51, 12, -55, 21, 15, -36, -10, -75, -52, 53, -24, -46, -61,
+    59, -6, -5, 25, 12, 21, -81, -2, -47, -110, 4, 62, 13, -35, 13, -87,
+    -7, -37, 31, -7, -18, 51, 55, -15, 30, 34, -12, 35, 67, 62, -63, 22,
+    18, -95, 30, 64, -18, 48, -36, -32, 11, 10, -43, -61, 78, -10, -28, 2,
+    -12, 26, -21, -1, -15, -55, -11, 5, -24, -87, 1, -17, 19, 10, -23, -81,
+    17, 25, -36, -18, -4, 28, 13, -24, 57, 29, -8, -11, -44, 28, 5, 15,
+    67, -12, -35, -67, 41, 50, -55, 40, -14, 13, 54, -33, -7, 65, -57, 22,
+    -67, -55, 10, -59, -34, -28, -5, 74, 1, 6, 28, -14, -52, 82, -34, -43,
+    23, -8, 20, -47, 19, 19, -33, -36, 39, 21, 17, 45, 29, -81, 60, 30,
+    -96, 4, -21, -44, 12, 11, 22, 3, 23, 10, -50, -29, -39, -75, 7, 46,
+    39, -27, -6, 8, 8, -5, -26, -33, 4, -79, -63, -67, -95, 27, -32, 27,
+    -61, -43, -65, -18, -50, -10, 68, -55, -56, 62, -57, 57, -43, -40, 80, -15,
+    40, -46, -41, -38, -26, 23, -34, 78, -8, 6, -19, -26, 3, -73, 3, -97,
+    -95, 31, -19, -98, -19, -19, 52, -36, -37, -1, -30, -31, -24, -88, 42, -20,
+    34, -43, 50, 6, 1, 0, -23, -77, -32, 2, 12, 40, -94, -7, 19, 17,
+    17, 31, 12, 47, 44, 34, 23, 37, -2, 39, 31, -6, 36, -72, -12, 0,
+    39, -13, 34, -1, -45, -22, -2, 25, -39, 22, 31, -74, 10, 62, -53, 1,
+    -42, 4, -7, -31, -16, 54, -7, -4, -19, -10, 76, -27, -1, 30, -7, 66,
+    38, 15, 24, 18, -26, -28, -12, -13, -38, 16, -18, -56, -37, 38, 5, -58,
+    45, 7, -1, 16, -14, 52, 11, -46, -6, -24, -31, -21, 5, 44, 3, -5,
+    -17, 19, 1, -44, 21, 25, 60, -49, -27, 9, 35, 21, 39, -45, 68, 28,
+    41, 85, -40, 52, 1, 15, 0, 4, -3, 23, -21, -6, -7, 51, -37, 0,
+    -60, -35, 24, 62, -19, 127, 4, 80, -1, -74, 12, -21, 38, -76, -41, -43,
+    -10, -47, 59, 62, -38, -13, 26, -1, 9, 33, 29, -58, -41, -64, -56, -27,
+    31, 4, 16, 53, 10, -2, -31, -103, 0, 37, -81, -7, -36, 11, -6, 42,
+    -13, -57, 77, -5, -60, -46, 63, -3, 5, 6, 21, 0, -66, 0, -35, 28,
+    -11, -62, 31, -26, -1, 17, -3, 23, -63, -50, -19, -1, 23, 34, 55, -65,
+    -6, -9, 48, -36, 35, 19, 41, 24, 0, -33, -16, -34, -1, 2, -14, -3,
+    0, -28, 9, -47, -3, -1, 24, 15, 32, -8, 39, -27, 27, 14, -14, 11,
+    -13, 87, 0, -34, -39, 2, 1, 34, 21, 75, -67, -9, -72, 12, 28, -18,
+    -4, 40, 19, -46, -42, 6, 5, 11, 20, 27, -15, 48, 14, -47, -36, 12,
+    39, 51, 10, 19, -37, -1, -17, 36, -20, -18, -2, 55, -8, -99, -24, -24,
+    31, -27, 11, 4, 25, 77, 45, -55, 22, -23, 22, -42, -8, -70, -48, -4,
+    27, -40, 4, -41, -7, 19, -18, 5, 4, 41, 7, -47, 50, -72, 72, 42,
+    30, 53, -20, -9, -17, -15, -24, -26, -12, -39, 39, -74, 76, 21, 54, 63,
+    55, 24, -22, -60, 30, 41, -61, -77, 8, -24, -23, -73, 61, 39, -45, -25,
+    -7, 14, -11, 17, 7, 1, 13, 30, 31, 15, 1, -13, -39, -11, 46, 20,
+    25, -15, -15, 85, -15, 45, -54, 81, 51, 2, -49, -3, 30, 5, 54, 49,
+    -14, -4, 6, 21, 22, -22, -75, -7, -5, 2, -7, 13, 27, 49, -11, -8,
+    -23, -8, 34, 27, -40, 36, 33, -49, -14, 18, -22, 6, -28, 7, -74, 22,
+    14, 16, -22, -11, 7, 58, 10, 52, 69, -63, -38, -3, 20, -6, -41, -19,
+    -40, 48, 27, 26, 13, 27, -30, -14, -50, -51, -83, -41, 24, -50, -47, -48,
+    0, 12, 7, -33, 29, -31, -44, 11, 66, 30, -23, -30, -4, 42, -18, -20,
+    -39, 13, 51, 34, -15, -29, 15, 30, 28, -21, -75, 70, -44, 47, -10, 23,
+    -30, 21, -44, -23, -25, -26, 16, -80, -102, -15, 1, 40, -32, 57, -42, 7,
+    -13, 23, -25, -7, 0, -12, 37, 46, -40, 24, -19, 60, 38, -56, -4, -28,
+    35, -68, 32, 53, 47, -42, -50, 23, -34, 18, -51, -34, 21, -42, -8, -6,
+    -6, -41, 56, 39, -54, -40, 32, 11, -4, -17, -19, 8, -14, 60, 27, 79,
+    7, 39, 25, 15, -5, 58, -30, 14, -7, -10, -21, 40, 56, -23, -61, -40,
+    -23, -40, -33, 34, -4, 7, 69, 84, -31, -68, 7, -23, 36, -12, 56, -13,
+    23, -18, -60, -31, 34, 24, 58, 3, 12, 61, -17, 46, -3, 11, -54, -7,
+    -50, -58, 4, 61, -55, -4, 6, 8, 41, 1, 28, 39, 12, 15, 13, -12,
+    34, 47, -19, 25, 51, 16, 30, 7, 17, 44, -32, 13, 31, -20, 20, -23,
+    17, 22, -65, -13, -25, 36, -7, -22, 79, -64, 21, 16, 3, -40, 27, -5,
+    18, 11, -9, 54, 31, -11, -3, -4, 18, -9, 4, -14, 18, 82, -18, 29,
+    -27, 38, -85, 37, -32, 39, -2, 31, -35, -19, 76, 0, -19, 3, -20, -42,
+    -22, -54, -9, -26, 49, 18, -65, -30, -42, -58, 23, 4, -1, 21, 0, 39,
+    2, 4, 4, 15, 32, 24, -19, -52, -23, 26, -12, 19, -53, 43, -21, 40,
+    -19, -31, -17, 43, 12, 24, -3, 84, 37, -57, 17, -62, 32, 0, 6, 50,
+    -36, 8, -30, 48, 37, -39, -23, -41, 12, -36, -51, -12, -13, -21, 30, -49,
+    29, 15, -2, 38, 28, 3, 17, -38, 8, 82, -21, -56, -1, 48, 3, 62,
+    2, 16, 39, -55, -51, -73, 26, -22, 5, 28, 5, -43, 30, 16, -39, -30,
+    38, 29, -16, 83, -59, 23, 3, 15, 7, 93, -60, -2, -26, -42, -10, 16,
+    -46, 33, -21, -54, 16, -1, -18, 45, 11, 7, -53, -4, 30, 13, 12, -42,
+    13, 35, -36, -57, -80, 30, -1, 6, 53, 30, -15, -18, 48, 25, -21, 28,
+    -54, 92, 34, -11, 12, 41, 31, -56, -31, -28, 22, -43, -18, 9, 99, -61,
+    -38, 14, -12, -35, 52, -5, -103, 37, 8, 17, -19, 35, 1, 1, 8, -20,
+    -11, -29, 28, 20, 3, -24, 5, 18, -16, 11, -32, -84, 33, 11, -5, 36,
+    -10, -12, 27, 0, 33, -44, 26, 47, -4, 57, -7, -111, -27, 44, 7, 69,
+    21, -93, 7, 11, -37, -57, 92, 68, -5, 5, -35, 34, 27, -17, 40, 1,
+    3, -1, -58, 10, 8, -40, 10, 63, -33, -19, 33, 55, 13, 16, 3, -62,
+    21, -5, -114, 12, 32, -39, 10, 11, 2, -2, -18, 18, -34, -31, -41, -56,
+    -27, -49, 35, -13, -55, -68, 5, 28, -49, 17, -4, 81, -17, 83, -109, 21,
+    43, 11, -27, -6, 1, -32, 48, -39, 84, 42, 32, 4, -10, 73, -43, 7,
+    33, -32, -12, -67, -43, 60, -9, 37, 41, -121, -43, -15, 17, -10, -45, 125,
+    -14, 40, 34, 9, -4, 63, -22, -32, -13, 20, 22, -48, 21, 16, -27, -1,
+    -15, -36, -51, 15, -70, 41, -38, 4, 38, 29, 36, 5, -5, -5, 18, -13,
+    -11, -12, -32, 24, 19, 23, -10, -28, 101, -102, 25, -50, -52, 73, 82, 2,
+    7, 12, -46, 28, -32, -54, -6, 4, -77, 85, 19, 0, 31, -30, 3, -14,
+    -29, -51, 90, -16, 53, -15, -29, 56, -53, 46, 15, 10, -24, -24, -58, 72,
+    3, -4, -65, -59, -33, -22, -79, -66, -45, -37, -10, -5, -9, -56, 28, 43,
+    9, -14, -56, 61, -40, -30, -20, -14, 26, 8, 38, -58, 43, 2, 35, 35,
+    -6, 116, 1, 31, 37, 4, 32, -15, 51, -42, -36, -15, 21, 2, 14, -57,
+    42, -26, -16, 21, -4, 6, -48, -55, 37, -49, -12, -42, -17, 65, 43, -12,
+    -26, 11, -27, -21, 2, 17, -13, -7, 9, -28, 55, -29, 12, 18, 5, 50,
+    44, -53, 77, -23, 125, 71, 1, 17, -44, 21, 15, -18, -11, 35, 13, 45,
+    -74, -57, -32, 84, 92, -25, -19, 32, 11, 34, -37, -3, -76, 79, -36, -43,
+    37, 90, 39, -31, 34, -13, 7, -1, 32, -39, 7, -22, 23, 74, -52, 60,
+    -54, -36, -45, -28, -32, 49, 36, 1, 16, -7, -30, 27, 30, -17, 17, -21,
+    -40, 19, 24, -32, -5, -16, -14, 17, -8, -16, -72, -39, -81, -22, -21, -7,
+    46, 14, 9, 23, -42, -13, 31, 23, 48, -8, 92, 20, -15, 21, 2, 44,
+    -45, -27, -16, -10, 22, -34, -6, -27, -47, -109, -72, 27, 31, 94, -72, 38,
+    -21, -35, 35, 31, 27, -9, -6, -3, -7, 0, -9, 11, 8, -18, 0, 31,
+    3, 9, -13, -38, -22, 18, -46, 22, 13, 25, -72, 21, -65, 18, 2, 27,
+    -127, -51, 1, 29, -46, 47, 31, -24, 23, 9, 27, -57, -55, -7, 20, -13,
+    -33, -4, -66, -55, -24, -21, -12, 0, -89, 35, -12, 11, -54, 8, -23, -14,
+    -76, -19, -5, -10, 26, -13, -6, -81, 24, -28, -24, -29, -27, -34, -57, 47,
+    13, -18, -17, 14, 65, -42, 32, 24, 60, -82, -12, 62, -33, 58, 13, 40,
+    -41, -10, -41, 13, 33, -23, 14, 46, 1, -54, 87, -26, 27, -40, -5, 64,
+    2, -33, 12, 45, 17, 33, -3, -64, 54, -28, -29, -83, -17, -9, 68, -37,
+    105, 60, -5, -30, -30, 41, 13, 31, -67, -11, -48, 20, 43, 17, 41, -46,
+    -11, 1, 7, -12, 22, 48, 35, 112, 7, -7, -30, 29, -99, -12, 10, 22,
+    10, 24, -26, 58, 41, -2, -9, -57, -22, 9, -44, 53, 33, 42, 59, 22,
+    -40, -22, -16, -48, -41, 5, -12, 64, 11, 10, -13, 14, 5, -8, -39, -32,
+    20, -55, 69, 47, 24, 13, -32, -2, -8, 1, 69, 17, -7, 40, -39, 15,
+    -55, 24, 26, 13, -19, 13, 82, -55, -13, -13, -1, -5, -42, 20, -41, -4,
+    -12, -5, 35, 33, -19, 31, -8, 47, -33, 25, -6, 9, 44, 43, 2, 34,
+    -27, 4, -99, 39, 45, 39, 53, 38, -71, -13, 33, 12, 6, -90, -59, -15,
+    1, 31, -27, 52, 42, -34, 15, -20, -31, 21, 6, 20, 105, 3, -10, 44,
+    9, -8, -41, -61, -17, -11, 1, 38, -15, -72, -43, 0, -63, -97, -20, -12,
+    -1, 19, 18, -16, -24, 21, 45, 42, 37, 16, 38, 43, -57, -46, -85, -104,
+    -42, -17, -81, 27, 9, -4, 64, -67, 58, 10, -25, 12, -9, -70, -12, -12,
+    2, 31, 22, 15, 26, -17, 19, 2, -60, -43, 27, -28, -10, -13, 20, 0,
+    -19, 13, 8, -37, -23, 2, 7, 49, -32, -8, 37, 28, -29, 8, -19, 59,
+    -9, -23, -5, -9, 29, -3, 1, 47, -16, -4, -54, -9, -35, 44, -24, 30,
+    34, 9, -16, 11, 2, -5, 24, 38, 32, 43, 37, -52, 0, -30, 7, 25,
+    -17, -50, -11, 78, 33, 30, -4, 8, -24, 25, 1, 17, -23, 34, 5, 51,
+    12, -34, -22, -18, -57, 44, 51, -21, -103, 85, 30, 57, -2, 17, -25, 18,
+    3, 63, -6, 46, 66, -29, -16, -17, -22, -57, 35, 33, -18, -11, 9, -18,
+    -48, -5, 38, 66, 39, 32, -15, 45, -51, -10, -36, -26, -21, -34, 16, -61,
+    -55, -17, -30, 7, 15, 36, -32, -15, -44, -46, 36, 22, -29, 15, -32, 21,
+    21, 28, -8, -2, -9, 89, -109, 9, -58, -27, 15, -31, 29, -47, -51, -33,
+    42, -22, -34, 20, -21, 6, 36, 2, -34, -44, -57, 3, 16, -47, 11, 23,
+    8, 11, 93, 65, 45, -36, -101, 44, 68, -78, -19, -13, -10, 34, -38, -46,
+    6, -25, -29, 9, -42, 23, -48, 16, -27, -109, 6, 114, -22, 47, -23, 26,
+    -10, 10, 5, -19, 51, -20, 43, -13, 55, 18, -16, 14, 26, 15, -4, 10,
+    -6, 23, 25, 5, 20, -1, 9, -25, 3, 71, 6, 87, 37, -40, -5, -31,
+    -24, 8, -1, 33, 45, -54, 22, 17, -53, 42, -25, -54, -3, -2, 11, 13,
+    -30, 47, 25, 40, 5, 57, 39, 63, -21, 83, -20, 42, -10, -85, -32, -16,
+    33, 14, 6, 4, -23, -28, 26, 52, 12, 14, 16, -58, -42, -39, -33, -15,
+    -12, -64, -10, -5, 54, 59, 1, 63, 49, 16, -102, -72, -65, 52, -58, 24,
+    -66, -79, 86, 2, -59, -37, 8, 42, -24, -24, -4, -32, -14, -8, -14, -30,
+    -44, 27, 94, 29, 25, -36, 37, 62, 31, -3, -44, 28, 82, 61, 52, 14,
+    -30, 124, -49, 101, 24, 62, -34, 12, 33, -29, -100, 35, 3, -33, 69, 4,
+    -32, 10, -6, 1, 21, -4, -48, -30, 2, 29, 62, 53, -24, -52, -66, 16,
+    -50, 33, -6, -35, 35, -23, -42, 7, 40, 62, -9, -40, 3, -55, 19, 26,
+    14, 16, 49, 103, 20, 27, -4, -81, -4, 3, -13, 84, -57, 8, 48, 13,
+    -8, 55, -1, -11, 4, 30, 5, -25, -11, -82, 9, 66, -74, 8, 47, -24,
+    -52, -78, 32, 27, 43, 42, 13, 13, 30, -20, 9, 34, 1, -48, 30, -31,
+    -6, -44, 55, 31, -92, -6, -2, -38, 31, 16, -6, -6, -86, 26, -29, -23,
+    -44, 36, 54, -24, -20, -27, 1, -1, 27, -3, -27, -15, -87, -1, 31, 52,
+    33, 26, -9, 20, 24, 5, -31, -17, 28, 26, 7, 56, 32, 19, 78, 29,
+    -79, -26, -11, 5, -48, -79, -38, 74, -36, -31, 22, 3, -83, 25, -48, -45,
+    49, 72, 33, -37, 34, -68, 37, -3, -13, -127, 21, 12, -7, -5, -21, 69,
+    -30, 51, 26, 6, 44, 11, 20, -37, -1, -6, 39, -83, -44, 80, 6, 3,
+    23, -45, -5, 11, -17, 10, -13, 24, 20, -10, -3, 20, -16, -4, 5, 14,
+    -59, 21, 12, 32, -2, 0, -24, -59, 27, -12, -36, -77, -14, 50, -2, 1,
+    54, 3, 2, 22, 3, -83, 26, -61, -44, -12, -9, -23, -5, 72, 29, 5,
+    -27, 19, -27, 122, -33, -30, -47, 34, 17, -30, 20, 16, 22, -27, -64, 6,
+    -26, -23, 35, 18, -27, -65, -21, -37, -27, -92, 118, 52, 9, 67, -8, 40,
+    3, 2, 39, 7, 5, 89, 4, -33, -77, -116, 11, -46, 13, 24, -16, -61,
+    62, -23, -7, -20, 67, -23, -2, -37, 14, -40, -2, -23, -24, -52, 16, 26,
+    -48, 31, 61, -18, 62, 8, -77, -33, 14, 8, -43, -6, -2, 27, -37, -7,
+    -16, -8, 15, 33, 57, 13, 52, -24, -41, -29, -7, 29, -25, 19, 10, -1,
+    0, -13, -45, 20, -25, 8, 34, -13, 35, 53, 30, 53, -22, 28, -62, -89,
+    -33, 0, 86, -42, 80, -44, 65, -61, -19, -14, -1, -36, 69, 31, 8, 6,
+    24, -19, 29, -14, 69, 20, -35, -36, 35, -62, 18, -114, -28, 20, 42, -8,
+    24, 20, -16, -76, -35, 15, 18, -4, -53, 8, -72, 50, 49, 43, 49, -27,
+    -9, 9, 7, -42, -53, -45, -7, 40, -67, -36, 55, 33, -24, -100, -35, 35,
+    0, -21, -56, 11, -38, -1, 44, -1, 25, 127, -52, -12, -4, 42, -46, 1,
+    25, -1, 0, -22, -74, -33, -40, 68, 14, 11, -26, 25, -42, -68, 18, 44,
+    1, 42, 22, -37, -3, -36, -6, 6, -60, -36, 35, 66, -22, 50, 33, 3,
+    -12, -33, 27, 19, -16, -13, -10, 4, 0, -32, -68, 107, -44, 24, 14, -39,
+    -46, 42, 12, 74, 13, -4, -12, 16, 51, -20, -6, -40, 14, -3, 25, 13,
+    -75, 77, 41, -76, 5, 44, -11, -20, -6, -54, 5, 4, -7, 20, -16, 18,
+    -12, 83, -13, -31, -59, -19, 33, 43, -49, -56, 17, -18, 46, -32, -45, -42,
+    14, 51, 77, -30, 42, 35, 7, 78, -6, -63, -21, 69, 31, 33, 6, 40,
+    24, -26, 18, -11, 56, 66, -32, -3, -4, -23, 28, 22, -39, -2, -55, 2,
+    57, -24, -31, -5, 46, 95, 16, 9, 35, 57, 31, -23, -4, -104, -24, 55,
+    -34, 10, -30, 7, 3, 35, -59, 16, 13, 54, -75, -1, 35, 35, 13, 25,
+    7, 2, -8, 35, 18, -57, 31, 10, -19, 48, -5, 24, -8, -61, 10, 16,
+    -65, 28, 11, -15, 6, -127, -18, 12, -19, 31, -10, 23, 20, 14, 32, -43,
+    -31, 11, 32, -25, -27, -51, -15, 39, 59, -46, 10, 37, 13, 2, 64, -12,
+    -10, -17, -20, 39, 36, -65, -24, -26, 50, -42, 20, 52, -17, 18, -79, 24,
+    33, 25, -56, -2, -6, 31, -17, 89, 8, -32, 79, -25, 33, 30, 5, -41,
+    9, 55, 8, 23, -58, -67, 32, 15, 9, 0, -21, 23, -30, 20, 10, 32,
+    48, 47, -50, 31, -86, 47, 21, -44, -8, 23, -18, 77, 10, 13, 12, 2,
+    -30, -11, 61, 83, 5, -20, 40, 35, 18, 23, -40, 19, 54, -6, -66, 23,
+    10, -2, 52, 1, 50, -12, 35, -48, -8, -30, 13, 32, -61, -15, -14, -48,
+    -63, 7, 29, 26, 68, 5, 64, 0, 26, -90, 1, -26, -50, 39, 100, 60,
+    22, -12, -28, -43, 43, 72, 19, 23, 59, 68, -45, 10, -34, 29, -12, -83,
+    -8, -10, 4, 0, 19, 14, 97, -29, 18, 19, 21, -37, 45, -17, -12, -24,
+    36, 94, -25, -12, -28, -55, -34, 10, 65, -25, -21, -54, -56, -11, -58, 61,
+    36, 50, -11, 12, 16, 3, -6, 75, 0, 23, -41, 10, -11, -50, -18, 15,
+    14, -41, -5, 17, -57, -12, -34, -107, -44, 37, 7, -7, 16, -16, 58, 15,
+    38, 23, 13, 34, -21, 5, 27, 6, 3, -1, -2, 43, -4, -22, 37, -1,
+    -68, 35, -28, -52, -14, 23, -31, -26, 64, -63, -21, -18, 2, -17, 36, 4,
+    2, 65, -32, 33, -17, -95, -25, 31, 20, 45, -67, -49, -11, 26, -48, -58,
+    47, -20, -15, 15, -40, -22, -20, 19, -22, 38, 0, -37, -44, -3, -28, 18,
+    -27, 17, -28, -8, 31, 46, 22, 20, -21, 25, -32, 21, 18, -44, -81, 88,
+    34, 30, -64, -16, -50, -52, 23, -18, 17, 52, 61, -64, -22, -53, 2, 18,
+    52, -27, -6, 5, 18, -11, 24, -66, 32, 23, 39, 39, 38, 45, -31, 51,
+    -43, -19, 37, 60, -77, 31, 9, -1, -28, 17, 15, -51, -21, -70, -16, -38,
+    -73, 24, 65, 43, 2, -45, -98, 51, 48, -64, -52, -31, 17, -36, -57, -69,
+    21, 1, 4, -58, -1, -28, 51, -9, -113, -69, -31, 8, 29, -14, -15, 7,
+    -27, -49, 31, -43, -17, 32, 0, -2, 24, -11, 19, -24, -10, -26, -36, -49,
+    17, -5, -17, -16, -111, 4, -48, 47, 19, -8, -12, 0, 26, -6, 29, -79,
+    6, -29, 29, 27, -40, -28, 15, -9, 27, -69, -28, -21, -12, -36, 21, 28,
+    -29, 23, 36, 30, 67, -61, -25, -19, 105, 65, -37, -51, -25, 41, 24, 38,
+    9, 30, -39, -60, -49, 7, 5, -11, 4, 45, -23, 86, -27, -10, -24, 44,
+    -1, 92, -15, 64, 53, 39, 25, 45, -40, -14, 23, 29, 15, 38, -1, 8,
+    -20, 6, 22, -16, 21, -29, -46, 2, -4, 22, -41, -19, -11, 8, -36, -19,
+    50, 52, -36, -81, -5, -10, 48, -27, -67, -11, 38, 4, -2, -50, -10, -18,
+    68, -41, 48, 33, 3, 49, 80, 53, -16, -16, -24, -18, 44, -73, 1, 61,
+    11, -67, -17, 62, -78, -42, 60, -51, 18, 19, 13, 0, 14, 25, -4, 10,
+    -24, -69, -87, 10, -29, 52, -27, 25, -15, -6, -21, 7, -64, -31, -23, -29,
+    53, -43, 15, 9, 61, -51, 89, 97, 47, 51, 0, 43, -79, -47, 0, 10,
+    -28, -3, -29, 44, -51, 6, 82, 40, 51, 29, 89, -56, 27, -9, -63, 7,
+    -59, 84, -12, 6, -8, -17, 70, 11, -21, 19, 8, -38, -10, -22, 45, -69,
+    15, 23, -47, -5, -13, 28, -29, 5, -7, 3, -35, 4, -35, 2, 105, -84,
+    34, -39, -8, -35, 15, 19, 10, 26, -50, -51, -43, 42, -74, 16, -19, 13,
+    9, -23, -16, -15, 47, -15, 0, -48, -7, -3, 36, 13, -40, 61, -7, 44,
+    33, -48, 7, 43, -25, 19, 16, 36, -9, -70, -48, -33, 84, -11, 8, -19,
+    101, -92, -38, -45, 23, 22, 2, 53, 9, -13, 0, -34, -2, 18, 92, -14,
+    -53, 8, 59, 7, -80, 44, 29, 3, 27, 25, -51, 3, -35, -26, 12, 36,
+    91, 29, 40, -18, 3, 5, -21, 37, 87, -38, -67, 20, -18, -20, -16, -45,
+    60, 47, 72, 52, -9, 19, -15, 39, -1, 11, -20, -25, 48, 52, 37, -6,
+    -68, 40, -25, -28, -3, 3, -9, 17, -14, -10, -8, -62, -4, -33, -33, 93,
+    -2, 36, 17, 18, -68, 9, 32, 41, 12, -39, -35, 22, -25, 15, -29, 63,
+    -42, -8, 14, 3, -11, -40, -14, -23, -11, -28, 45, -25, 22, 30, 51, 13,
+    -81, 15, 69, 31, -50, -20, 30, -49, 2, -30, 73, -23, -18, -28, 49, 5,
+    1, 29, -37, -43, -59, 6, -45, 10, -23, 4, -46, 42, 71, -30, 13, -20,
+    -49, 55, 55, -17, 42, 9, -8, -67, -29, 21, 16, -1, 26, 12, -27, -29,
+    72, 6, -15, -99, 33, -5, 55, -50, -14, -37, 28, -16, -14, -4, 19, -6,
+    77, -28, -4, -47, 7, -5, -66, 15, 7, 29, 57, 64, -33, -91, 25, -26,
+    44, 16, -18, 7, -5, 29, -7, 107, 18, -48, -3, 26, 7, -30, -49, 27,
+};
+
+static const int32_t nnb_pw2_bias[64] = {
+    -25897, -15766, 1234, -6964, -11132, 4830, 21170, 17058, 365, 2093, 28286, -2405, 3738, -4130, 4274, 1605,
+    -10886, -756, 8677, -4492, -10057, 3954, 2610, -4341, 2023, 5479, 5498, 20647, -16010, 3879, 8000, 16293,
+    -5843, -4493, 1638, 884, -14025, 9756, 9931, -14480, -11102, -2538, -10200, 16128, -1622, 7060, 3043, 2039,
+    9820, -25797, -582, -16642, -13511, 2482, 633, 15586, 16916, -13076, 3321, -13146, 9121, -7112, 6752, -6443,
+};
+
+static const int32_t nnb_pw2_mult[64] = {
+    1392812647, 1398352207, 1776792700, 1696539193, 1838815931, 1541502410, 1613649790, 1439151345, 1446898900, 1382812118, 1509790271, 1187937365, 2126490595, 1498194914, 1764763169, 1713362786,
+    1744501357, 1614037407, 1259175020, 1733847684, 1097994399, 2031344962, 1610040988, 2069367947, 1693735703, 1797976438, 1421826849, 1464666235, 1587096542, 1994694050, 1533333490, 1748991773,
+    1851369689, 1985264421, 1646513274, 1884896660, 1948860442, 2016309000, 1349154218, 1929952752, 1660528846, 1581493267, 1996472087, 1869455284, 1699256478, 1867088812, 1394386302, 1422361923,
+    1929090836, 1438022009, 1257943950, 1082894125, 1619418612, 1886660828, 2011078800, 1374202144, 2070147184, 1748840034, 1559148650, 1648533095, 1613348439, 1615891928, 1728544791, 1646020293,
+};
+
+static const int32_t nnb_pw2_shift[64] = {
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -6, -7, -6, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -6, -8, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+};
+
+static const int8_t nnb_dw3_weights[576] = {
+    -51, -67, -31, -19, -27, -15, -36, 77, 13, -34, -116, 10, 4, -50, 5, 12,
+    5, 17, 125, 36, -48, -26, -39, 42, -7, -38, -33, 10, 31, -18, 22, 9,
+    1, 0, 2, 100, 22, -73, 0, -24, 5, -56, 27, 21, -8, 31, 2, -23,
+    16, -11, 26, 39, 60, -56, 83, -49, 47, -13, -2, -23, 47, 6, -8, -1,
+    -28, 23, 61, 11, 69, -26, 32, 32, 46, 56, -47, 30, 57, -61, -21, 119,
+    17, 70, -21, -2, -15, -2, 1, 23, 28, 31, -46, -53, 20, -33, -9, -64,
+    10, -30, 10, -3, -29, 38, 42, -67, 17, 12, 1, -36, -24, -17, -64, -11,
+    -14, 17, 29, -8, 8, 17, -13, -38, -8, 3, -16, 13, -2, -66, -31, 8,
+    26, 18, 49, -44, 1, 24, -70, -44, -20, 27, 61, 5, 16, 79, -20, -17,
+    -95, 1, 33, 2, -42, -33, -52, 48, 18, 2, 47, 78, 31, 1, -67, -8,
+    -21, 25, 54, 23, -11, -11, 67, -14, 13, -23, 66, 34, -6, -91, -6, 5,
+    -49, 12, 45, 46, 4, -86, 40, 52, -29, -25, -46, -47, 40, 50, 7, 32,
+    -7, 27, 76, 14, 63, -9, -38, -38, -11, -3, -77, 8, -13, -48, 45, 41,
+    -18, 3, 59, 5, -41, -8, -66, 29, 84, 49, 14, -54, 48, 50, 10, 15,
+    -8, -6, -44, -28, 62, -13, 21, 30, 8, -16, 13, 1, -26, 11, 20, 12,
+    26, 16, -46, 4, 77, 54, -17, 11, -21, -104, -38, 1, -22, 64, -5, -19,
+    11, 32, 8, -2, 71, 29, 7, -84, -27, 6, -10, -33, -24, -2, -20, -31,
+    -42, -20, 4, -47, 44, -39, -41, 92, -67, -17, 24, -32, 36, 8, 3, 24,
+    28, -42, -35, -1, -46, -19, -49, 26, -86, 48, 29, -47, -51, -46, 34, 8,
+    22, -18, 8, 20, 7, -32, 14, 67, 14, -29, -4, -23, 0, -67, -75, -9,
+    -7, 20, 46, -27, 22, 23, -39, -8, -45, -14, -6, 2, 35, -32, -18, -9,
+    3, -51, -12, 38, 46, 17, -11, -20, 17, 25, 68, 24, 6, 31, 5, -11,
+    17, -9, -24, -63, -35, 84, -51, -52, -47, 13, -96, 11, -40, 89, 14, -18,
+    -76, -31, -27, 15, 36, 22, -2, -50, 1, -96, -69, -7, 46, -68, 0, 85,
+    -2, -110, -1, -14, -52, -33, 22, 61, -38, -34, 82, 7, 51, -10, 14, -14,
+    56, 0, 28, 4, -8, 35, -23, -49, 27, -49, 27, 8, -4, 77, 3, -3,
+    6, -5, 1, -5, 61, 52, -64, -28, 24, -9, 113, 19, -8, 29, 19, -55,
+    -94, 40, 39, 7, -48, -7, 43, 13, 4, -2, 34, 63, 59, 9, -48, -64,
+    20, -25, 53, 7, -106, 23, 32, 6, -45, -17, -42, -2, 24, -63, -17, -35,
+    14, 29, -13, 55, 29, -44, -23, -14, 95, 10, -71, -22, -14, -91, -3, 2,
+    24, 32, 41, -28, -31, 29, -21, 72, 25, -23, 20, -90, 4, 21, -14, -31,
+    -25, -43, 87, 23, 21, 4, -2, -19, -25, 40, 37, -19, 55, 81, 52, 15,
+    46, -9, -2, -51, 16, -8, 16, 29, -3, 30, 25, -6, -6, -2, -7, -3,
+    24, -14, 18, -84, -20, 14, -4, -50, -29, -20, 23, 19, -76, -2, 8, -49,
+    11, 30, -22, -24, -34, 16, 22, -18, 56, 0, 46, 92, -22, -88, -47, -1,
+    16, -13, 59, -3, 33, -13, -17, -26, -127, -5, -53, 28, 34, 127, -57, 74,
+};
+
+static const int32_t nnb_dw3_bias[64] = {
+    -1064, 755, -12599, 6759, -2852, 641, 2948, -115, 198, -795, 6879, 575, -6430, 3147, 221, -2217,
+    1504, -2274, -6258, -791, 476, 1559, 9821, -1839, -7214, 523, -3332, 969, -1258, -787, 2607, 1900,
+    -3661, 336, 515, 989, 6023, -2640, 1315, 276, -305, -1049, -7446, 858, 5117, 1915, 880, 3908,
+    7015, -131, -1891, -4814, -1748, 3250, -4449, 528, 3219, 5526, 2762, -31, -4446, -5136, 5043, -3527,
+};
+
+static const int32_t nnb_dw3_mult[64] = {
+    1658070288, 1230829999, 1642042455, 1439562453, 1155302222, 1299379878, 1306341042, 1347140555, 1287868207, 2035584338, 1220151316, 2038054042, 1773093870, 1750611959, 1936751842, 1801189597,
+    2012953183, 1241952262, 1803123011, 1795307550, 1265975957, 1809922768, 1704140775, 1499234915, 1465305053, 1689949126, 2016846969, 1596861355, 2018732125, 1496341355, 1599987817, 1472368999,
+    1957819850, 1610383988, 1680182805, 2012685200, 1309566017, 1866915891, 1292161101, 1466868955, 1090942768, 1897137016, 1380728333, 1238442341, 1530810539, 1704236826, 1525250694, 1562613424,
+    1628511325, 1109680335, 1089056684, 1607815046, 1645079965, 1688533521, 1327329665, 1184725718, 1440934510, 1713120100, 1326747247, 1635646963, 1274836401, 1266347102, 1888487275, 1821699588,
+};
+
+static const int32_t nnb_dw3_shift[64] = {
+    -5, -6, -6, -5, -6, -5, -5, -6, -5, -5, -6, -4, -6, -6, -5, -6,
+    -6, -5, -7, -6, -5, -6, -6, -6, -6, -5, -6, -6, -6, -6, -5, -5,
+    -5, -5, -5, -6, -6, -6, -5, -6, -5, -6, -6, -6, -5, -6, -5, -5,
+    -6, -4, -5, -6, -6, -6, -5, -5, -6, -6, -6, -5, -5, -6, -6, -6,
+};
+
+static const int8_t nnb_pw3_weights[4096] = {
+    -23, -30, 15, 31, -30, -5, 35, 8, -63, 15, -28, 61, -22, 53, 4, 76,
+    -16, 41, 31, 11, -27, 59, 8, -14, 64, 7, -47, -28, 10, 9, -46, 7,
+    32, 31, -9, -62, -61, -21, -4, 49, 72, -21, 39, -44, 42, 30, -52, 53,
+    26, 15, 86, -66, -35, -14, -14, 61, -37, 48, 20, 5, 8, 34, 41, 70,
+    -6, -27, -51, 11, -54, 7, 31, -3, 55, -45, 71, 2, 7, -1, -27, -2,
+    42, 44, -8, 21, -95, 31, -18, -43, -43, 48, 11, -38, 11, -30, 11, 3,
+    15, 33, -71, 47, 39, -67, 21, -41, -27, 0, 32, 2, 9, 29, -33, 7,
+    -18, -52, -10, 29, 41, -28, -33, -27, 26, 17, 17, -46, 3, 27, -106, -7,
+    23, -57, -51, -8, -30, 20, -7, 6, 32, 18, 110, 61, 42, -91, 17, 5,
+    -57, -79, -26, 60, 22, 17, 45, 41, 15, 33, 71, 15, -13, 43, -9, 10,
+    -49, -10, 77, -30, -5, 20, -94, 109, -70, -10, 32, 20, 14, -84, 50, 38,
+    5, 1, -51, -14, -64, -9, -17, 32, 28, 3, 54, -58, -34, 47, 9, 77,
+    12, 47, -49, 45, 82, -17, 89, -36, 22, -27, -16, -30, 14, -2, -9, 86,
+    5, -24, -65, 18, -15, -27, 4, 36, 24, -15, 24, -5, 19, 48, -56, -36,
+    10, -56, -55, -5, 45, -43, -4, -13, -10, -23, 37, -59, -127, 3, -45, -48,
+    22, -29, 16, 31, -76, -12, 21, -37, -3, -36, 27, -47, -45, -11, 20, 20,
+    49, -83, 28, -25, 73, 36, -53, -16, 13, 3, -14, -70, -51, 25, -19, -30,
+    49, -16, -85, -50, -3, 30, 38, 0, 57, 56, -38, -30, 43, 62, -16, -13,
+    -31, -17, 12, 12, 61, 4, -18, 23, -4, 19, -42, 60, -91, 2, 36, 21,
+    -98, -45, 13, 88, 69, -10, -15, 20, 41, 43, 36, -38, 2, -6, 5, -21,
+    -78, -51, 48, 63, -43, 52, 0, -12, -6, 25, -5, -26, -8, -30, -80, 20,
+    -22, 41, -11, -45, -1, -47, 30, -29, 4, 53, -28, -1, 85, 3, 9, -22,
+    -11, -14, -84, -5, 3, -70, -12, -12, -23, 60, -7, 28, 11, -30, 88, 20,
+    30, 63, 48, 65, -49, -15, 30, -13, 19, -33, -40, -70, 2, 96, -49, -52,
+    45, -54, 23, -22, -58, -35, -18, 49, 84, 51, 13, -49, -22, 33, 12, -52,
+    -82, -4, 2, 23, 6, -56, 82, -15, 1, -6, 43, -26, -68, 38, -15, -33,
+    20, 1, -11, 21, -20, 0, 2, -15, -49, -47, -1, -23, -47, 7, -38, 91,
+    -5, -10, 67, -48, -45, -13, 38, -26, -27, -66, -21, -13, -8, 30, -2, -10,
+    9, 30, -2, 32, 43, 63, 50, 46, 36, -37, 21, -54, -51, -85, -44, 31,
+    -14, -3, 39, 30, 34, -16, 22, -13, 24, 23, -24, 23, -17, 70, 6, -76,
+    101, 21, 35, -2, -11, -50, -18, -26, -37, -29, -32, 10, 23, -6, -57, 10,
+    58, -63, 10, -65, 4, 52, -2, 106, -26, -4, -55, -33, 12, 2, 4, -21,
+    5, -25, 31, -101, 16, -9, -24, -63, -10, 31, 7, -35, -23, 23, 79, -29,
+    13, 10, -41, 46, 73, -47, -41, 23, 61, 34, -32, -27, -51, 43, -38, 48,
+    23, -17, -96, 29, 31, 8, 64, 60, 5, 42, 10, -11, -68, 8, -7, -49,
+    -9, 19, 30, -12, 23, -31, -19, -91, -5, -11, 11, 1, -34, -24, -57, 27,
+    17, -58, -66, 4, 62, 18, 26, -62, 32, 96, 3, -28, -26, 4, -38, -30,
+    12, 63, -15, -15, -43, -51, 0, -53, -10, 5, -49, -3, -97, 64, 17, 9,
+    -2, 1, -5, -66, -53, -65, 111, -26, 4, 46, 43, -10, 13, 13, 67, -16,
+    52, 5, -33, 31, -19, -10, 65, -41, -33, 38, -1, 25, -6, -19, 24, 9,
+    15, -4, -19, 28, 11, 39, -26, 6, 21, 14, 31, -8, -79, 23, 17, 22,
+    -31, -8, -15, -72, -22, 11, -44, -41, 19, -52, 82, -4, -20, 19, -47, -8,
+    82, 49, -37, -4, 73, -34, -10, -60, -53, 0, 35, 31, 0, -45, 9, -27,
+    -1, -29, -22, 9, -3, 0, 19, 33, -28, 15, 46, -80, 27, 46, -66, -71,
+    -26, -21, 38, -18, 18, 4, 65, -95, 64, -33, -22, 16, -21, 44, 7, 43,
+    -16, 35, -20, 27, 29, -24, -54, -64, -30, 17, -64, -53, 46, -95, 23, -41,
+    30, 37, 9, -49, 36, 22, -7, 20, 10, -44, -14, 41, 31, -17, 21, 10,
+    8, 78, 51, 74, 0, -13, -42, 51, 8, 20, 89, -22, 6, -16, 91, -22,
+    -79, 81, -26, 72, 21, -32, -41, 68, 4, 54, 5, -5, -9, 40, 42, 26,
+    3, 7, 46, -29, 11, -30, 20, 30, 24, -1, -7, -20, -5, 60, -34, 55,
+    3, 3, 46, 42, 21, -39, -59, 21, -44, -53, -36, 25, -20, -94, -86, 33,
+    -50, 56, 32, -18, -8, 16, -16, -11, 47, 25, 39, -50, 56, 61, -5, -30,
+    26, 61, 4, 49, 33, 67, -25, -21, -43, -67, -63, 40, -27, -6, 28, 48,
+    -50, 7, 15, 8, -35, 26, -65, 15, 39, 62, 31, 44, -29, 42, 2, 35,
+    -27, 13, -34, 44, -77, -24, -26, 67, 8, 44, 21, 3, 10, 29, 30, -10,
+    5, 1, -14, -30, 32, 106, -7, -22, 13, 50, -10, -2, -5, 5, -54, -29,
+    -12, 12, 39, -49, -19, 19, 64, -94, 27, 40, 60, 9, -33, -11, -33, 28,
+    19, 23, 19, -33, 96, 52, -44, 108, 7, 0, 28, 11, 8, -41, 25, 0,
+    -30, 35, 19, -65, -80, -57, 45, 43, -9, -36, 28, 8, 39, 50, 26, 24,
+    -93, 6, -46, 60, 5, 1, 45, -5, -54, 20, -18, 36, -30, -20, 38, -24,
+    -8, -11, -4, 15, 8, 27, -14, -51, 34, -31, 87, 8, 38, -15, -1, -4,
+    -62, -30, 28, 21, 12, 73, -22, -7, -4, -7, 14, 24, -55, 51, 73, -36,
+    24, -68, -18, -25, -44, -13, -13, -5, 27, 3, -46, 55, -2, -22, -51, -39,
+    -38, 20, -40, 10, 43, 1, 70, 70, -48, 127, -3, -32, -14, 13, 48, 16,
+    -57, -7, 22, 18, -59, 38, 29, -30, -12, -84, -56, 16, -57, 39, -34, 15,
+    -2, 3, 28, -28, -30, -68, 117, -61, 9, -20, 74, -94, 48, 3, 13, 2,
+    -14, 64, -22, -33, 24, 53, -3, 54, -1, 2, -27, -13, -106, -23, 54, -13,
+    -4, 28, 112, 1, -47, -4, 25, 72, 7, -52, 12, 23, -78, 21, -30, -42,
+    6, 33, 52, 19, 70, -1, 127, -42, -35, -8, 25, 24, 42, 40, -2, 62,
+    -17, 116, 30, 19, -7, 27, 48, -18, -66, -32, -33, -9, -12, -13, 32, -34,
+    72, -58, 9, -14, -53, -26, 81, -34, -38, 51, 26, 28, -2, 8, -32, -78,
+    73, -39, 10, -90, 30, -19, 50, -21, -46, -42, 33, -24, 65, -51, -14, -103,
+    14, -28, -49, 30, -39, 23, -12, -92, 64, -3, 25, 23, 45, 13, -84, 37,
+    41, -114, -28, 24, 30, -17, -42, -53, -56, -65, -26, -68, 7, -83, -46, 33,
+    -27, -31, -53, 14, 11, 41, -32, -52, -30, 14, -4, -33, -38, -68, -3, 46,
+    -29, -17, -29, -43, -10, 11, 58, -16, -91, 44, 21, 97, -74, -115, -6, 4,
+    29, 76, -8, 0, -9, -17, -55, 34, 29, -12, 5, -2, 5, -42, 2, 16,
+    10, -82, -20, -30, -58, 60, -30, 10, -46, 49, 26, -30, -25, 52, -4, -115,
+    23, 66, -47, 11, 8, 56, 59, 33, -3, -21, 27, 19, -36, 39, -1, 14,
+    39, 107, 33, 10, -59, 18, -47, 53, 72, 23, 35, -104, 3, 1, -89, -67,
+    -81, -42, -49, 26, 53, -49, 21, -20, 34, 24, 6, 8, 54, 1, 49, -5,
+    -79, -22, 8, 89, 1, 63, -15, 0, 17, 44, 30, -32, 23, -2, 113, -44,
+    -52, 5, -60, 11, -48, -7, -12, -57, -50, 19, -5, -44, 33, -3, 52, -14,
+    31, 93, 56, 66, -69, -62, -29, 12, 7, -33, -33, 42, -96, -30, 60, 37,
+    -52, -28, 33, 20, 27, -14, 34, -1, -22, -55, 62, -1, -9, -41, -27, 21,
+    12, -72, 35, -39, -21, 9, 120, -20, 1, -57, 19, -18, 75, -35, 9, -37,
+    -7, -32, 17, -32, 31, 32, -56, 51, 20, -29, -61, 27, 68, -70, 18, 11,
+    -40, -77, 6, -5, -4, -47, 30, 27, -57, 27, -61, -46, 17, -24, 32, -26,
+    -42, 6, 71, -3, -11, 31, -5, -22, 41, -2, 43, 42, 90, -58, -20, 9,
+    -8, 46, -14, 7, -14, 2, 33, -50, 23, 38, 1, -12, -81, 104, 25, 28,
+    -60, -56, 95, 42, -18, 10, 1, 9, 79, 70, -10, 19, -24, -8, -23, -3,
+    3, -58, -56, -11, 57, -21, -4, -16, -41, 19, -36, 48, 20, 15, -35, -39,
+    2, -58, 2, -9, 88, 62, 82, 7, 1, -51, -12, 13, -23, 34, 7, -99,
+    26, -52, -86, -41, -13, 28, -36, -45, -42, 44, -31, 54, -34, 52, 8, 8,
+    -35, 61, 18, 12, 28, 47, -14, 39, 14, -37, 25, 44, 31, -43, -12, 60,
+    -22, 1, 41, 20, 44, -42, 4, -10, -10, -35, 10, 9, -17, -23, -4, 79,
+    -31, -29, 121, 12, -4, 17, 28, 4, -23, 69, 12, -40, 37, 71, 26, -24,
+    11, 33, -32, 41, 8, -12, 11, 17, -53, 9, 54, -20, 43, 39, -44, -33,
+    28, 32, 23, 36, -61, -47, 82, -32, -26, -90, -84, 3, -40, 16, 12, 33,
+    63, 39, -42, -44, 54, 49, 10, 14, 17, 26, -83, 44, -21, 41, -32, 24,
+    -16, 30, -27, -17, 65, -22, 6, 31, 17, 40, -19, 28, -3, 16, -3, -3,
+    -59, -50, 20, 59, -26, 15, -11, -19, -66, -39, -46, -19, -30, 43, -29, 22,
+    25, -52, 16, 20, 40, 50, -27, -53, 5, 8, -52, 66, -115, -15, -5, 33,
+    3, -9, 13, -6, 26, 81, 56, 57, -20, -6, -11, -26, -60, -11, 56, 76,
+    -12, 46, -34, -33, 7, 76, 67, -30, -4, -69, -21, -40, 21, -36, 10, 79,
+    18, -59, -19, 17, 71, -16, 38, -19, -46, 127, 22, 19, 9, -107, -44, -51,
+    52, 10, 70, -52, -20, -13, 77, 4, 49, -18, -13, 56, -3, -55, 53, 30,
+    -3, 15, -18, 54, -17, -19, 6, -72, 55, 28, 93, -25, -31, -40, 18, -3,
+    41, 43, 37, 28, -17, -20, 66, 17, -32, -31, 46, 32, -5, 36, -32, 19,
+    -16, 13, 5, -26, 20, -25, 55, -69, 5, -61, -54, -29, 4, -60, 38, -14,
+    -23, -12, 32, 8, 57, 3, 10, -7, 51, -31, -15, -4, 32, 62, 13, -54,
+    63, -44, 11, -20, 20, -26, 1, 16, 1, -38, -24, -27, -62, 41, -36, 30,
+    -2, 38, -26, 42, -27, 104, -17, -68, 52, -26, 73, 32, -6, 4, 20, -71,
+    -53, -13, 48, -1, -30, -66, -19, 37, 12, -42, 1, -35, 24, -5, 44, -24,
+    5, -12, 32, 34, 85, -14, 15, 3, 20, -6, 47, -19, 18, -38, -42, -33,
+    40, -3, 35, -8, -5, -76, -86, 13, -62, -33, -3, -76, -12, 4, 26, -2,
+    2, -11, 25, -25, -106, -33, -5, -45, -60, 68, -43, 39, -65, 18, 44, -43,
+    -6, -10, 42, 22, 21, 47, -68, 2, -3, -38, 10, -28, 3, -39, 5, -34,
+    13, 79, 26, -21, 8, -10, -27, -7, 18, 33, 48, 10, 19, 34, 57, 55,
+    -13, -7, -64, -42, -6, -29, -66, -25, 53, 33, -24, 52, -15, 13, 8, -24,
+    -12, -25, -15, -45, 45, -2, 78, 77, -38, -66, 27, -1, 26, 60, -54, 5,
+    -19, -1, 1, 42, 36, -40, 60, 27, -10, 3, 69, 3, 55, -67, 29, -35,
+    22, -56, 28, 26, -39, -22, 34, -20, -30, -23, 96, 5, 41, 57, 56, 71,
+    -1, 52, -37, -43, -89, 59, -49, 55, -30, -2, 1, 73, -8, 24, -19, -10,
+    45, 48, 31, -4, -49, 43, -75, -18, 77, 25, -56, 2, -30, 23, -17, -13,
+    -41, 72, 37, -38, -26, -43, 55, -1, 8, 16, -39, 5, 43, 31, -8, 35,
+    -8, -43, 60, 87, -72, -46, -42, 23, -20, 5, -45, -78, -37, 13, 13, -8,
+    -50, 21, 72, -14, 70, -45, -19, -74, 16, 31, -71, 11, -30, 102, 9, -31,
+    -91, -75, -74, -10, 6, -26, 5, 71, -27, -3, 57, 38, -8, 26, 41, -19,
+    -49, 100, -19, 4, 35, 8, -78, 43, -22, -45, 58, -34, 52, 11, -63, -30,
+    20, -22, 19, 24, 91, 59, 2, 53, -15, 7, 13, -57, 25, 23, -4, 106,
+    -74, 18, -45, 31, -51, -12, 90, 36, -42, 25, -2, 18, 29, 4, -48, -37,
+    24, -15, 109, -8, -31, -28, -24, 50, 12, 15, 25, -58, 9, 27, -74, 54,
+    53, -28, -38, -2, -67, 24, 22, -50, -10, -18, 35, 43, 84, 19, -29, -23,
+    43, -25, -49, 31, 24, -11, 42, -10, -17, 7, 79, 43, 42, -24, -34, 56,
+    11, 22, 65, 35, -32, 51, -42, -27, 2, -19, 28, 16, 59, -28, 71, 1,
+    18, -11, -1, 25, -17, 3, -46, 65, -33, 13, 5, 56, -33, -16, 53, -41,
+    76, 0, 65, 20, -58, 16, 22, 10, 34, 59, -3, 4, -97, -13, -20, -7,
+    8, -54, -38, 7, -7, -43, 38, -15, 3, 20, -23, -27, -5, -32, -54, -14,
+    5, 78, -48, -1, 23, -31, 54, 26, -9, 1, 90, 3, -7, -1, 71, -8,
+    18, -28, 28, 14, -24, 25, -12, -32, -35, -1, 2, 18, 24, 36, 5, 32,
+    33, -3, -1, 53, -40, 16, 21, 22, -16, -83, -65, -40, -34, -12, -48, 53,
+    58, 26, 38, 20, 34, -35, 70, -9, 4, -36, -2, -39, -16, -23, 9, -70,
+    23, -110, -20, -23, -77, 67, -9, 22, 27, -31, -1, -4, -9, -56, -29, -28,
+    -8, -23, 19, -13, 11, -7, 7, -25, -27, 7, 27, 2, 26, -53, 23, -26,
+    -50, -6, -67, 68, -68, 19, -8, -23, 2, 13, -35, 10, 40, 25, -3, -3,
+    -50, 46, 6, 41, 38, -42, 53, -14, 65, -28, 10, 30, 72, 6, -6, -37,
+    -44, 28, 25, -35, 23, 31, -55, 39, 92, -82, -62, 19, 33, -46, -11, 74,
+    17, 18, 23, 15, -10, -3, -58, -28, -9, 32, -5, -42, -11, 51, 1, 23,
+    -25, -28, -76, -7, 11, -13, 55, -44, 2, 53, -114, 50, 4, 46, -13, -103,
+    4, 43, 20, -47, 38, 17, 82, -36, 1, 66, 31, 10, 11, -17, -33, -20,
+    72, 61, -41, 24, -17, -29, -71, 41, -15, 58, -2, 4, 70, 7, 58, 78,
+    -14, 61, 59, 19, 8, -34, -14, 23, 60, 83, 19, 37, 28, 17, -18, -56,
+    -3, 56, 83, 42, 7, 12, -16, -49, 14, 12, 28, 5, -52, 46, 80, -118,
+    -24, 32, -3, 62, -12, -2, 1, 70, -22, 93, 58, 50, -63, -92, -19, 9,
+    -7, 37, 11, -1, 11, 14, 88, -75, -48, -11, -11, 81, 45, -9, -3, 53,
+    -50, -18, 5, 18, 18, 45, -48, 45, 30, 65, -35, 64, -59, -39, -20, 72,
+    28, 2, -20, -16, -50, -34, -15, 13, -19, -9, 47, 0, -28, 23, 41, 39,
+    9, 15, 41, 41, -63, -39, -32, -37, 41, 24, 22, -2, -49, -18, -51, -43,
+    18, -48, 7, -25, 6, 6, 9, -58, -20, -51, -10, -49, 27, 5, 22, -5,
+    -54, 6, -18, -49, 13, -13, 76, 23, -58, -26, 47, -24, 32, -9, -19, 5,
+    -45, 59, -25, -14, -29, -41, -49, 2, 19, -12, -30, -68, -70, 45, 19, -28,
+    8, -2, 71, -38, -25, -10, -29, -87, -25, -49, 50, -101, 27, -18, 44, -12,
+    -24, 38, -46, -27, 73, -56, 7, 18, -42, 27, 16, 23, 22, -34, -59, -15,
+    2, 22, 53, -76, -4, 86, 13, -24, 15, 18, 20, -40, 0, 3, -46, -9,
+    11, -11, 23, -31, 23, -16, 5, 55, -12, 16, -4, -53, 13, -3, -40, -31,
+    -21, 16, -24, 1, -29, 42, -78, -23, -45, -47, -41, -50, -57, 97, 36, 59,
+    3, 10, 23, 4, -22, 1, -20, -59, 10, 5, -14, -39, 1, 24, 40, 20,
+    13, 42, 37, -34, -33, -12, -21, 32, 50, -6, 52, 3, 43, -8, -11, 4,
+    -15, 4, -40, -57, -41, -41, 1, -7, 3, -7, -23, -60, 28, -54, -21, 8,
+    40, 57, -27, 70, -8, 32, -29, -19, -26, -47, 73, 25, 13, -23, -49, -41,
+    -28, 71, -41, -25, -71, -8, -23, -2, -44, 34, 6, -22, -44, -27, 38, -64,
+    10, 4, 68, 31, -5, 62, -12, -2, 15, 38, 5, -42, -34, -34, -98, 39,
+    37, 12, -43, 41, -49, 13, 30, -29, -11, 25, -10, 11, -33, -43, 40, 21,
+    -30, 45, -35, 8, 35, -123, 36, -35, -19, -35, 89, 54, -16, -8, -48, -36,
+    37, 28, -2, 27, -16, 1, -20, 16, -13, -9, -6, -23, 33, 17, 1, -9,
+    17, -12, 20, 6, -65, -13, -51, -4, 38, 34, 28, 47, -61, -29, 20, 4,
+    22, 31, 29, -48, -2, -53, -2, -51, -15, -66, -4, -6, -15, 30, 12, -7,
+    -58, -19, 0, -42, 7, 42, 5, -12, 6, -2, 3, 41, -77, 82, -66, 5,
+    -19, 4, 25, -36, -9, -69, 21, 29, -61, 63, 48, -83, -73, -59, -27, 39,
+    -11, 47, -12, -11, 6, 11, -45, -11, 46, -20, 49, 32, 22, -14, 21, -80,
+    -27, 42, -9, -55, -38, -16, -34, -3, -44, 60, -72, -11, 7, -46, -51, 12,
+    28, -37, 18, -60, 33, -5, -14, -14, 31, 3, 61, 1, 120, -61, -24, 47,
+    -24, -46, 34, 6, -60, -69, 40, 20, -71, -11, -63, -43, -34, 68, -9, 7,
+    5, 22, -13, -3, -28, 3, 37, 39, 83, -20, -12, -16, 56, -38, 39, 13,
+    7, 41, -38, -93, -46, 47, 12, 35, 68, 84, -67, -53, -4, 27, 20, 79,
+    -34, 34, 50, -2, 18, 18, 1, -53, 10, -23, 20, -51, -102, -38, 10, 47,
+    -30, -92, 6, -21, 1, -30, -28, -9, 113, -28, -61, 32, 3, -23, 29, 44,
+    -98, 14, -40, -8, -32, 22, -6, 2, -63, -35, 3, -15, 51, -16, 6, -31,
+    23, -8, 61, -10, -56, 24, -9, -39, -27, -49, -61, 15, 18, -51, -95, -21,
+    64, 34, -10, 17, 68, -10, 8, -4, -46, -51, -48, 4, 18, 0, -41, 8,
+    60, 3, -43, 46, 7, -55, -34, 6, 20, -5, -52, 0, -52, -55, 58, 32,
+    44, -17, 10, -2, 0, -19, -40, 23, 50, -30, -31, -74, 40, -14, -8, -64,
+    16, -74, 45, 73, 13, 16, -18, -9, -39, 28, 2, 1, 77, -49, -55, 55,
+    -6, 63, 24, 33, -50, 66, 30, 5, 8, -10, 18, 53, -48, -12, 81, -9,
+    -42, -70, -25, -90, -37, 14, -51, 26, -39, 37, -30, -29, -21, -60, 14, 51,
+    88, 11, -43, -21, 112, -33, 1, -39, 21, 18, -11, -47, -44, -41, -9, -37,
+    -8, 19, -6, -42, 6, 29, -67, 65, -13, -3, 41, -43, 10, -14, -24, 10,
+    -34, -6, -27, 0, 56, 18, 12, 40, 21, 28, -33, 6, 25, -16, 12, -2,
+    -67, 1, 25, -31, 39, 18, 35, -94, 37, -35, 6, -6, -15, -6, -32, 60,
+    31, 37, -11, -14, -42, -48, -17, -21, 15, -34, -7, 1, 29, 6, 20, 2,
+    31, 17, -57, 23, -17, 10, 84, 11, 62, -31, 27, -32, -68, -3, -30, -41,
+    -106, 67, -41, 0, -21, -55, 84, 1, 18, 11, -28, 1, 60, 69, -65, 9,
+    -56, 1, -33, 28, -31, 5, 13, 3, 17, -63, 14, -16, 21, 14, 14, 33,
+    -15, -8, 35, -8, -26, 61, 61, 9, -53, 47, 72, 63, -23, 14, 44, 20,
+    5, 11, 53, -4, 46, -33, 44, -38, -3, 4, 2, -27, 54, 71, 9, -22,
+    -36, 17, -1, -26, -14, -34, 36, -19, 2, 20, -90, -54, -35, 30, -39, -87,
+    46, 52, 47, -15, -13, 33, -64, 28, 20, -72, -21, 38, -26, 13, -35, -17,
+    -58, 75, -3, -37, -12, 30, -52, -7, -66, 7, 5, 5, -53, 64, 26, 58,
+    -48, -1, -17, 30, -2, -11, -45, 9, -51, -15, 24, -68, -8, 49, 14, -24,
+    -42, -8, 3, -33, -15, 50, 41, 8, -66, 66, 10, 10, 42, 32, 58, -36,
+    32, -16, -27, -10, -84, 35, -31, 34, -65, 36, 40, -6, -96, 67, 6, 12,
+    32, -50, -31, 54, 18, -15, -36, -88, -40, 9, 21, 10, -8, -26, -8, 1,
+    75, -8, 21, 25, -68, 5, -2, 36, 41, -86, 9, 5, -42, 5, -9, -43,
+    33, -49, 1, -15, 127, 3, 28, -45, 21, 8, 87, -29, -7, 7, -7, 35,
+    56, 14, 2, 6, -7, 18, -37, 9, -77, -2, -1, 118, 75, 64, -41, 18,
+    -6, -31, 23, 119, 32, -30, -53, 11, 16, 25, -83, 9, -80, 21, 8, -24,
+    37, -47, -12, -4, 0, 55, 13, 10, 74, -27, 13, 38, -3, -46, -40, -57,
+    -36, -3, 14, -22, -94, 4, 7, -10, -19, -50, -12, -72, 41, -67, -127, 67,
+    -15, -4, -24, -25, 92, -61, -33, -73, 55, -108, -58, -24, 31, -55, -50, 52,
+    93, -41, -35, -6, -62, 14, 48, 38, 16, -6, 5, -35, 10, 59, 0, 31,
+    41, -60, -73, -14, -3, 42, 31, 88, -42, -29, 3, -22, -95, -46, -65, 56,
+    -106, 16, -52, 7, 44, -9, -16, 0, 40, -16, 13, 39, 5, 51, 47, 4,
+    -63, -27, 12, 34, 13, 125, -4, -55, 38, 26, -38, 27, -4, -47, -24, 14,
+    -12, 28, 86, -24, -19, -10, 27, -24, 45, -32, -28, -65, 47, -78, -44, 0,
+    -85, -32, -25, 56, 54, -40, 29, 58, 19, 39, -47, -35, 17, 51, 12, 37,
+    -23, -32, -93, 61, -14, -61, -51, -3, 23, -58, 8, 8, 5, 45, -13, -7,
+    -6, -13, -8, -28, 27, 112, 65, 12, 22, 16, -53, -9, -45, -3, 18, 66,
+    -47, 17, -6, -16, 16, -27, 2, 5, 14, -5, -46, -29, -63, 45, -62, -44,
+    3, -26, -13, -3, -18, 30, -24, -43, 18, -11, 37, 71, -39, 25, 97, -7,
+    34, 48, -12, 7, 41, -49, -14, 27, 6, 20, -12, 12, -43, -16, -14, 19,
+    -37, 74, -9, -1, -30, -46, -29, 82, -59, -62, -4, 10, -1, 20, 23, -63,
+    14, 19, -43, -31, -23, 6, -47, 0, 6, -8, -65, 6, 14, 56, 46, -44,
+    9, 5, -43, 66, 22, -40, -36, 25, -14, 66, 20, 47, -32, 15, 12, 23,
+    16, -10, 41, 32, -17, -3, 46, 3, 7, 20, -5, 29, -58, 9, 19, -38,
+    35, -25, 30, -30, 28, -12, -4, 38, -32, 51, -11, -37, -26, 36, 51, 21,
+    -11, 59, -41, 33, 38, -12, -1, 21, -8, -32, -19, -83, -8, -44, -5, 68,
+    -18, -8, -29, 0, 10, 4, -15, 18, -17, 5, 5, 35, 20, 5, -34, -12,
+    -18, -8, -31, 17, -9, -34, 2, 32, 21, -15, -12, -52, 56, -64, -25, 8,
+    -43, -25, 26, 31, 25, -48, 49, 1, 70, 38, -6, -55, 35, -127, 28, 33,
+    -11, -33, 27, -15, -13, -9, -23, 20, -29, -3, -56, -9, 1, -43, 73, -10,
+    1, 9, 11, -39, 29, 27, -55, 50, -41, 28, -67, 26, -22, 29, -86, -21,
+    -77, -26, 53, -14, -48, 49, -12, -66, 62, 7, 19, 28, -1, -31, 10, -62,
+    9, -9, -5, -1, 23, 20, -27, -36, -12, -26, 35, 10, 11, -63, 34, 48,
+    -14, 65, -43, 18, -75, 27, -17, 34, -65, -35, 3, 30, 37, -6, 49, -22,
+    13, 80, 18, 2, 17, -17, 18, 80, -12, 70, -41, -40, -20, 58, 16, -18,
+    -16, 36, -17, -33, 31, 3, -30, -23, 10, 27, 109, -16, -68, 11, -52, -1,
+    20, -13, 18, 49, 8, 10, -35, -38, 14, -25, 21, -6, 15, -12, 60, 3,
+    20, -40, -65, 64, -86, 31, 19, 35, -35, 37, 21, 38, 34, -11, -34, 33,
+    52, -44, -7, 36, 17, -28, 12, -5, 34, -19, -106, 30, 60, 30, -80, -3,
+    36, 42, -30, 21, 12, -19, -6, -24, 18, -28, -75, 16, 24, -73, -14, 7,
+    -23, 31, -59, 2, -32, 61, -16, 74, 8, -4, 9, -21, 5, 1, -21, 39,
+    -29, 5, 25, -11, -17, 64, 43, 13, 24, -22, 9, -18, -2, 76, 47, -33,
+    26, 41, 19, -15, -52, 25, 3, 41, -32, -10, 14, -67, 39, 48, -12, 15,
+    23, -22, -5, -13, 21, -47, 11, 4, 8, 52, -67, -112, 44, -60, 7, 19,
+    79, 19, 5, 40, 4, -29, 14, -12, -80, -7, -60, 27, 22, 77, 18, 34,
+};
+
+static const int32_t nnb_pw3_bias[64] = {
+    -19645, -123, -3634, 14932, 4954, -651, 10814, -3341, 14041, 9450, 6237, -13209, -5139, -6888, -6729, -10234,
+    1218, -9190, 20347, -5178, -2119, -1424, -14215, -1802, -11044, 7140, -16966, -11805, 3404, 7929, -13594, 16595,
+    -9685, -14227, 4664, 3408, -5327, -6996, -19193, -88, 7158, 5793, 11075, -2200, 12414, 2177, -9574, 14818,
+    10066, 8416, 5987, -11453, 7886, -9924, 18987, -2440, 14276, 1227, -2655, 5187, 18625, -5851, -3873, -11463,
+};
+
+static const int32_t nnb_pw3_mult[64] = {
+    1552105629, 1643783183, 1403773057, 1672792994, 1493827862, 1657343223, 1553261745, 1522447560, 1587596533, 1121139427, 1840382834, 1812798331, 1518243065, 1805545622, 1939422710, 1909657989,
+    1275939224, 1495601215, 1190978800, 1194578344, 2066398070, 2072346374, 1651730021, 1435870917, 1119313298, 2070927007, 2072239854, 1647904175, 1497230491, 1486264735, 1477838209, 1375827900,
+    1291774673, 1393326103, 1912859478, 1278718166, 1742139304, 1753556212, 1528604927, 2025900822, 1828972282, 1745155822, 1200101995, 1980842462, 1242922258, 1537348473, 1803176776, 1306651531,
+    1775957814, 1918990243, 1787136933, 1841896306, 2118371091, 1396092426, 1383951381, 1379657317, 1732903674, 1417128853, 1993510451, 1554859217, 1317296698, 1818850443, 1836916847, 1828419288,
+};
+
+static const int32_t nnb_pw3_shift[64] = {
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+};
+
+static const int8_t nnb_dw4_weights[576] = {
+    -44, 82, 6, 10, -6, 10, -2, 6, 5, -23, 23, 41, 96, -23, 14, 56,
+    35, -21, 32, 63, -12, -20, 13, -47, -38, -21, 2, 33, 12, -13, 9, -51,
+    -88, -22, -52, 33, -32, -20, 24, 88, 31, 64, -2, -46, -39, -1, -64, -30,
+    3, -12, -48, -68, 5, -25, -61, 12, 41, 7, -76, -43, 44, 41, 1, 31,
+    20, 7, 35, 11, 13, 43, -61, -12, -35, 21, -17, 32, -38, -19, -75, 73,
+    -73, 8, 93, 35, 58, -28, 3, 44, 17, 14, -16, -53, 0, 11, 27, 20,
+    12, 43, 42, 27, 19, -127, 14, -27, -32, -30, 10, 42, 7, 61, -111, 68,
+    -26, 48, -37, -37, -55, 2, -59, 64, 14, 11, 29, -28, -17, 33, -15, -20,
+    -108, -14, -55, -51, -23, -11, -34, 10, -80, -21, -3, 15, -25, -37, -25, 8,
+    -24, 23, -4, -13, 20, 32, -13, 20, 33, 19, -54, -52, -10, -27, 27, 25,
+    -53, 4, 62, 37, 6, -12, 22, -18, -54, -57, -65, -32, 52, -53, 4, 33,
+    33, 30, -25, -9, 23, -14, -10, 33, 30, -20, 12, 25, -10, 91, -14, -68,
+    -50, -67, 58, 36, -28, -11, -51, -124, -7, 0, -18, -73, -13, 9, -28, 14,
+    -76, 42, 25, -13, -22, 57, 7, -44, 68, 74, 33, -10, -3, -58, 18, 2,
+    43, 51, 20, -15, 45, -34, 34, -58, -48, -52, 28, -42, 9, 68, 9, -8,
+    3, -8, -4, -4, 40, 92, 28, -16, -59, -23, 26, 13, 35, -85, 14, 39,
+    -31, -19, -35, 33, 59, -37, 42, -35, -22, 4, 96, -45, -14, 62, 1, 31,
+    -55, -2, 45, -4, -6, -20, 19, 43, 3, -49, -7, -20, 24, -2, 42, 16,
+    36, -10, -22, -24, 39, -7, -35, -4, 15, 30, -47, 13, 18, -4, -71, -78,
+    43, -35, 52, 55, 51, 21, -55, -3, -2, -25, -21, -78, -8, -39, 19, 15,
+    3, -11, 22, -19, 40, -19, 39, -29, 52, -38, -9, 72, 35, -22, 20, 23,
+    -10, -10, 82, -20, 55, -8, 22, -3, -23, 37, 104, 33, 11, -57, -47, -6,
+    42, -14, 45, -24, 21, -11, 8, -68, 19, 13, 16, -21, -1, 37, 56, -5,
+    3, 23, -57, 46, -52, 80, 0, -13, -14, -28, -64, -17, 28, 6, -49, 57,
+    12, 21, 90, -47, 8, 51, 39, 38, -20, 24, 59, -14, -75, 43, -14, -45,
+    -45, -27, -39, 64, 4, -27, 26, -33, 3, 31, 67, -37, 15, -2, -70, -24,
+    25, 100, 67, 24, 29, 17, -26, 9, 32, -34, 30, 0, -35, -56, -27, 59,
+    -77, 37, 25, 13, -72, -63, 47, -18, -37, 20, 32, -4, 47, -77, 73, 83,
+    65, -23, 1, 33, -18, -22, -16, 42, 24, -20, 23, -4, 0, 68, -29, 11,
+    30, 64, 41, 12, 37, 54, 52, 18, -6, 21, 5, 25, 16, 12, -3, 72,
+    29, -59, 43, 12, 5, -64, 58, -35, -14, 56, -34, 38, 47, 17, -31, 12,
+    -4, -25, 77, 26, 48, 65, -36, -4, 3, -3, -16, 42, -19, -4, -41, -11,
+    -21, 6, -5, -31, 81, -39, -11, 65, 13, -23, 6, 49, -58, 23, -29, 53,
+    -8, 18, -13, -15, -32, 46, 64, -20, 21, 12, -23, -71, -73, -47, -1, 58,
+    -8, -24, -12, 17, -4, -75, 58, -86, 25, -11, 8, -25, 9, -25, -9, -2,
+    71, -16, 0, -38, 21, -14, 87, 3, 38, -27, 1, -42, 61, -30, -26, -14,
+};
+
+static const int32_t nnb_dw4_bias[64] = {
+    1946, 134, -1918, -1933, -3105, -1029, 3087, 1578, 526, 2444, -2971, -2428, 5793, -1015, 2110, -3355,
+    8228, -664, -3890, 150, -4154, -2462, -2082, 236, -1948, -6834, 1036, 1870, -687, 6144, 628, -6619,
+    73, -1731, -10897, -69, -1939, 6327, -3489, 5816, 1803, 4, 1491, 1660, -565, 610, 2660, -1173,
+    -3254, -947, -3288, 2172, -3043, -8314, 182, -154, -673, 1062, 3325, 1851, -5261, -5374, 2070, -1648,
+};
+
+static const int32_t nnb_dw4_mult[64] = {
+    1149854341, 1668500704, 1198674718, 1338612084, 1365328717, 1813287542, 1309736194, 1420424191, 1248567938, 1149329853, 1336482044, 1477982685, 1484877953, 1499606694, 1502886315, 1761216785,
+    1818850443, 2014428365, 1085537796, 1798083359, 1319452337, 1923813054, 1289076132, 1315663117, 1636355112, 1807758565, 1531973946, 2081691550, 1461833773, 1465802296, 1358824814, 1749396538,
+    1233440881, 2142158680, 1696967660, 1267674399, 1562613424, 1269377404, 1270550877, 1546548502, 1511979686, 1806030926, 1214417614, 1697539286, 1536098850, 1737334507, 1314005031, 1732754714,
+    1340332894, 1669053310, 1933531766, 2132489581, 1617793995, 1541188122, 1382369577, 1236265016, 1999640881, 1467224853, 1664642687, 1275266544, 1275804631, 1664688511, 1795734040, 1239915106,
+};
+
+static const int32_t nnb_dw4_shift[64] = {
+    -5, -5, -6, -5, -6, -6, -5, -6, -6, -5, -6, -6, -6, -6, -6, -5,
+    -6, -6, -5, -5, -5, -6, -5, -6, -5, -6, -6, -6, -5, -6, -5, -6,
+    -5, -7, -6, -4, -5, -6, -5, -6, -5, -6, -5, -5, -5, -5, -6, -5,
+    -6, -5, -6, -6, -6, -6, -6, -5, -6, -4, -6, -5, -5, -7, -6, -5,
+};
+
+static const int8_t nnb_pw4_weights[4096] = {
+    -18, -55, -24, 35, 13, 71, 10, -27, -72, -16, 20, -64, -41, -45, -98, 54,
+    7, -10, -56, 53, -24, -36, -33, 34, -1, -8, 20, 8, -11, 53, 6, -11,
+    98, -16, 31, -9, 23, 6, -4, 38, 7, 26, -10, -13, 27, -15, 40, -35,
+    -43, 37, -16, -17, -22, -52, -45, -78, 36, -12, 92, 5, -13, 59, -15, 16,
+    32, 8, -13, -57, 38, -12, 55, -6, 46, 30, -10, -19, 39, -27, -62, -51,
+    28, 80, 70, 109, -2, -16, -99, 12, 77, 6, 10, 17, -16, 28, -37, 88,
+    4, 1, -64, 15, -32, 9, -56, 59, 77, -26, -30, -21, -29, -36, 92, -38,
+    -10, -20, 27, -2, 40, 58, -21, 34, -11, -5, 36, -3, -6, -24, 108, 3,
+    -9, -31, -9, -22, 10, 20, 6, 60, 36, 1, 47, -34, -7, -52, 47, -26,
+    34, 3, 43, -63, 23, -9, 37, -85, -80, 26, 31, 29, -11, 12, 8, 6,
+    -2, 47, -71, -60, -51, 4, 35, 10, 6, -5, 43, -19, 98, 24, -17, 34,
+    54, 68, -2, 51, -99, 32, 20, -13, 5, 16, -38, 21, -41, -19, 6, 30,
+    48, -13, 9, 8, -22, -45, -44, -27, -26, 20, -9, -75, 47, 3, -80, -19,
+    72, 18, -10, -35, 23, -19, -10, -20, -11, -69, 7, -34, -25, 37, -16, -43,
+    81, 48, 2, 12, -42, -47, 2, -2, 28, -27, -8, -40, -43, 23, 48, -34,
+    59, 2, -67, -83, 0, 65, 73, -24, 89, 33, -77, 43, 41, 21, 64, -38,
+    31, 28, 3, 26, 20, 59, -18, -17, 42, 59, 16, 33, -33, 7, 16, -74,
+    -86, 8, -45, 88, 46, -54, 0, -36, -23, -15, -13, -15, 74, 19, 0, -71,
+    3, 22, 83, -12, -31, -22, -48, -78, 41, 22, -8, 34, 39, 17, -14, 60,
+    -9, -5, -9, -28, -18, -28, 26, -59, 9, 63, -48, 22, -28, -18, 30, -41,
+    45, -15, 16, -71, -71, 17, 14, 14, 11, -44, 83, -19, 6, 67, -66, 22,
+    39, 21, 16, 43, -16, -17, -90, 21, -31, -6, 23, 1, -58, -71, -29, -39,
+    41, -2, -62, 25, 2, -6, 20, -21, -41, -38, 56, -53, 53, 22, -82, 6,
+    -3, 8, 40, -19, 29, 56, 32, -48, 31, 5, -4, 58, 5, 65, 11, 5,
+    -111, -24, -50, -4, -31, -44, -16, -31, -1, -107, 5, -24, -7, -35, -15, 12,
+    15, 64, 32, -1, 26, -5, 13, 14, -94, -2, -20, -51, 18, -34, -11, -29,
+    -25, 20, -58, -37, -105, 13, -21, 11, -63, 17, -4, 29, 13, -51, -103, -16,
+    16, -4, -9, -10, -11, 26, 34, 26, 13, 1, -5, 7, -55, 16, -6, 30,
+    -10, 75, -13, -4, 21, 26, 58, 30, -4, 2, 5, 18, -50, 19, -39, 72,
+    -48, 30, -52, 34, -9, -12, -98, 42, 49, -46, 36, -4, -47, 90, -30, -39,
+    -37, 4, -43, -29, -4, -13, -7, 3, -44, -40, -13, -1, -21, -90, 1, 32,
+    82, -11, -15, -26, 85, -1, -19, 7, 36, 84, 19, -8, 20, 70, -86, 7,
+    60, -21, -4, -15, -21, 55, 9, -5, 14, -13, 9, 70, 6, -22, -33, 46,
+    -67, -27, 35, -39, -34, 16, -24, 7, 31, 44, -9, -47, 55, -19, 13, 51,
+    -45, -18, -44, -47, 46, -6, 1, 35, -1, 47, 63, -93, -18, 5, -24, -24,
+    -7, -23, -55, 0, 56, -36, -5, -62, -54, 72, 34, -64, -10, -50, -20, 37,
+    27, 28, 12, 22, -18, 42, -12, 38, 2, 75, 15, 5, 30, -26, -26, 57,
+    2, 22, -1, -25, 49, -45, 6, -16, 4, 6, 41, 32, 29, 61, -46, -43,
+    -57, 36, -22, 9, 56, 31, 53, -53, 30, 48, 3, 43, -31, -25, 74, -27,
+    -40, 12, -49, -15, -60, -78, -45, -7, -18, -11, -14, 0, -33, 33, -3, 41,
+    55, -35, 23, -15, 31, -43, 13, 0, 28, 1, -7, -11, 42, 54, -39, -14,
+    2, 21, 11, -12, 25, -13, 25, -23, -56, -14, 75, -84, -21, 55, 8, 22,
+    -43, 45, 1, 9, 4, -12, -16, -9, 15, 12, -38, 51, -37, -37, -68, 39,
+    28, 31, -25, -28, -60, -30, -32, -98, 32, -8, 11, -14, 37, 18, 24, -17,
+    25, -20, 4, -7, -36, 37, 1, 0, 17, -5, 9, 13, -46, -19, 21, 43,
+    9, -8, -16, 40, 22, 40, 4, 7, 84, -4, 12, -53, 59, 36, -17, 5,
+    -23, 16, -11, -27, -23, 30, -15, -63, 41, -31, 13, 41, -20, 30, -103, -18,
+    -44, -78, -37, -59, 11, 3, -14, 4, 56, -11, 51, -5, -25, -19, -21, -10,
+    19, -51, -103, 82, -56, 31, -38, -12, 54, 82, 50, 35, 56, -16, 30, 12,
+    0, 42, 19, 56, -9, -3, -16, -40, -4, -3, 56, 28, -104, -4, 41, 19,
+    57, 112, 30, 32, -9, -40, 45, -20, 7, -1, 17, 47, -68, 39, 6, 32,
+    -13, 7, -26, 14, -24, -31, -32, 60, -45, 72, 38, -21, 23, -63, 12, -26,
+    69, -18, -56, -6, -21, 65, -15, -29, -9, 5, -22, -23, -71, -31, 41, 37,
+    -25, 5, 40, -12, 69, -45, -31, -47, 4, 76, -55, -9, -44, -15, 42, -73,
+    20, 87, -5, -12, -28, 27, 38, 27, 58, 15, -23, 15, 10, 22, 31, 44,
+    -34, 58, 7, 10, -24, 60, -45, -35, -8, 28, -67, -25, 33, 7, -9, 16,
+    50, 0, 30, 64, 27, 75, -69, 8, 33, -75, 6, 19, -88, -23, -35, -2,
+    -37, 29, 25, -41, -22, -1, 98, 60, -6, -14, 16, -64, 3, -42, 35, 10,
+    -27, -74, 55, 32, -7, 6, 12, -24, -3, -41, 9, -25, -38, -58, 47, -48,
+    19, -19, 108, -6, -23, 100, -85, 31, -27, -8, -19, 32, -50, 10, -28, 5,
+    -10, 4, -14, -31, -19, -31, -14, 9, -36, -5, -1, -10, -16, 36, 51, -50,
+    -18, -4, -22, 13, -17, 56, -33, 11, -43, -18, 7, 26, 10, -47, 8, 37,
+    127, 36, -17, 10, -39, 54, 64, 27, 2, 8, -20, -3, -19, 21, 64, -4,
+    33, -50, -81, 7, -45, 17, 26, 71, -72, -34, -45, -51, 20, 61, -83, 23,
+    -53, 43, 24, 18, -73, -84, 10, 32, -16, -5, -1, -11, 7, -21, -93, 1,
+    -18, -19, -3, -11, -9, -30, -70, 33, 27, -38, 6, -2, -32, -4, 43, -12,
+    81, -18, 28, 29, -29, -36, 5, -30, 18, -47, 58, 15, -6, -67, -28, -3,
+    36, -9, -3, -27, -27, -27, 13, 15, 38, 82, -37, -41, -29, 55, -31, -48,
+    16, 38, 24, -52, 28, -35, 86, -19, -20, 111, 20, 10, 45, 19, -45, -63,
+    26, -32, 2, 43, -90, -3, 28, 6, 53, 33, -35, 16, 50, -9, 25, 8,
+    32, 14, 21, -17, -35, -27, -10, -60, 4, 0, 3, 72, 7, 18, 18, 19,
+    -13, -50, -31, 33, -43, -12, 20, -8, -16, 20, 73, -9, 17, 45, -5, -62,
+    -12, -11, 0, -4, 62, 38, -5, -24, 7, 20, 15, 15, 23, -50, -35, 64,
+    8, 67, -71, -36, 0, 44, 4, -10, 60, -41, 7, 55, -25, 80, 35, 28,
+    -66, -23, -15, 21, -31, -47, 75, -6, 7, 45, 0, 37, 68, -2, -23, 62,
+    -1, 0, 3, 25, 28, 37, -73, 88, 25, -79, 64, -37, 46, -5, -28, 32,
+    -32, 27, -5, 30, -60, -44, -30, -8, 57, -37, 60, -55, -87, -24, -1, 49,
+    -12, 40, 82, -19, -11, 5, 52, -13, -36, 51, 80, -16, 5, -118, 55, -22,
+    -20, 27, 23, 4, 30, 21, 50, -16, 17, 27, -26, -19, 16, 80, -4, 44,
+    9, 0, 4, 24, -61, -17, 14, -19, 94, -58, -3, 50, 27, -21, -9, 0,
+    -32, -51, -95, -56, 29, -10, 30, -23, -2, 27, -50, 72, -26, 6, 72, 12,
+    -7, -64, -37, -25, -54, 3, -79, -4, 93, 38, -12, 12, -16, 16, -45, -24,
+    17, 15, 31, -2, -46, 9, 35, -47, 1, 37, -56, 29, -1, 10, 38, 42,
+    -31, -25, 32, -22, 27, 47, 17, 40, -20, -31, -32, -17, -45, -23, 79, 22,
+    -33, 8, 73, 69, 46, -26, 26, 34, -50, 17, 13, -32, -16, -14, 35, 92,
+    -30, -11, 29, 16, 20, -29, -29, -69, -35, 3, 55, -52, 6, 49, 20, 62,
+    25, 15, -44, 86, 6, -73, 0, -46, -35, 17, 40, 80, -16, -33, 45, 49,
+    19, -94, 68, -20, -51, -34, -73, -9, 72, -22, 22, -11, -25, 112, 10, -28,
+    -13, 29, 3, -65, -8, -44, -28, 9, -28, 36, -9, -16, -10, 2, -57, 34,
+    18, -42, 50, -17, 90, -45, -16, -103, -28, 42, 72, 36, -79, 21, 47, -38,
+    27, -2, 22, 58, 3, 10, -47, -7, 45, -43, -34, -20, 42, 29, 48, -24,
+    -8, 48, 60, 40, 10, 11, 15, 60, -33, 15, 41, 22, 6, 87, -55, -42,
+    78, -30, -79, -2, -81, 27, 22, 32, 40, -30, -25, -14, 52, -13, 74, -127,
+    27, -8, 18, 58, -84, -12, -15, 28, -34, 4, 64, 11, -38, -52, 62, -23,
+    44, -31, 16, 39, 21, -27, 81, -34, -8, -72, 51, -67, 37, 34, 41, -7,
+    3, 18, 15, 4, 2, -59, -3, 60, 31, 28, 110, 88, -57, -15, 14, 0,
+    15, -15, 50, -30, -15, -15, 1, 6, 35, -24, 18, 29, 40, -20, 42, 35,
+    -6, -20, 36, 111, 60, -30, -9, 2, -17, -3, -16, -31, -18, 7, 6, 37,
+    32, 40, -6, 71, -24, -51, 33, -20, -10, -27, 51, 20, -17, -26, -20, -66,
+    28, -13, 14, -28, -40, 28, 18, 41, -59, -11, -44, -8, 46, 59, -19, 10,
+    37, 50, 12, -47, -82, 80, 54, -48, 46, 47, 53, 41, 14, -45, 44, -15,
+    7, 17, -2, -61, -42, 27, 12, 26, 62, -22, 45, -96, 59, 36, 20, 23,
+    -7, -17, -12, 33, -60, 60, -18, -51, 103, 0, 33, -26, -29, -31, 35, -19,
+    65, 29, 16, -71, -5, -54, 37, 18, -60, -15, -2, 9, -69, -32, -6, -37,
+    -60, -91, 37, -28, 21, -95, 19, 4, 22, -30, 38, 3, -15, -32, -9, -32,
+    -22, 46, 24, -25, 11, -16, 43, -44, 57, 5, 24, -42, -11, -1, -27, -11,
+    22, 14, -8, -3, -47, -67, -15, 7, -5, -7, -45, 64, -14, 8, -34, -7,
+    42, -1, -17, 21, -45, -39, 49, -31, -45, 17, 41, 26, -106, 42, 14, -1,
+    -82, 34, -8, 1, 36, -62, 2, -23, -20, -50, -37, -13, 68, 8, -50, 51,
+    -47, 37, -18, 57, -38, 4, -22, 10, -98, -8, -64, -19, 13, -26, 20, -11,
+    32, 42, -36, -8, -12, 14, 14, -25, -20, -15, 9, 49, 16, -24, -4, 6,
+    -37, -6, 51, 9, -43, 13, -88, -1, 10, 52, -26, -63, 24, -20, -54, 39,
+    -7, -36, 93, 60, 46, -45, 57, -57, 28, 11, 9, -40, -27, 37, -25, 10,
+    38, 31, 28, 9, 56, -51, 29, -15, 21, 31, 23, 9, 35, -49, -42, 35,
+    -34, -16, -13, 26, 32, 20, -6, 111, 6, -83, 9, 1, 75, 41, 11, -9,
+    -63, -5, 50, 1, 75, -59, 60, -30, -37, -49, -93, -30, 5, -1, -24, 36,
+    -35, 15, 74, 4, -13, 8, 1, 39, 13, -18, 18, 40, -8, -76, 6, 29,
+    -49, 37, -39, -60, 38, -25, 13, 50, -1, 86, 41, 40, -9, -44, -53, 10,
+    51, 34, 17, 23, -21, 30, -17, 66, -59, -13, 5, 33, 8, 20, -33, -11,
+    -21, -24, -26, -25, 44, -36, 8, 113, 44, -73, 17, -12, 22, -28, 33, -26,
+    24, 9, -82, 28, -30, -25, 3, 45, -36, 32, -6, 29, -7, -29, 7, 14,
+    14, -11, -41, -3, 4, 3, 80, 21, 4, -26, 88, 13, -40, -53, -54, -2,
+    -40, 19, -9, 25, -1, 38, 12, -38, -33, -57, 39, -19, -5, 21, -7, -9,
+    59, 12, 29, 3, 6, 14, 5, 7, -64, -28, 57, 47, 23, 33, -15, 4,
+    7, 12, -38, 26, 23, -21, 50, -40, 14, -28, -48, -85, 46, 24, -5, -23,
+    44, -32, -67, 56, -22, -12, 21, 30, 73, -7, -63, 50, -90, 37, -5, 6,
+    -25, -37, -15, -16, 11, 54, -17, -16, -77, 28, 14, -14, -10, 65, -20, -45,
+    29, -24, -1, -72, 14, 43, -38, 9, -44, 74, -44, 22, -14, 82, -18, 40,
+    -52, -88, -94, -3, -52, -72, 25, -13, 74, 36, 1, 41, 22, -33, 25, 8,
+    15, 35, -7, 14, 51, -8, 12, -5, -50, -4, -23, -11, -25, 50, -33, -66,
+    49, 20, -80, 17, 3, -57, 4, -54, 48, 12, -31, 16, 46, -15, 9, -13,
+    27, -22, -73, -49, 37, -1, 56, -27, 48, 38, -7, 25, 21, -4, 9, -37,
+    -1, -3, -25, -51, -6, -19, 28, 18, 4, 0, 4, 23, 11, -23, -49, 22,
+    -35, -13, -28, -6, -31, 19, -21, -23, 37, -55, -24, -32, 41, -27, 2, -25,
+    -36, 52, 42, 20, -18, 16, -3, -4, -17, -23, -115, 12, -6, 43, 12, 1,
+    -45, -11, 66, 62, -55, -19, 5, -47, -32, -16, -85, -37, 3, -52, 19, -42,
+    3, -22, 20, 4, 15, 35, 37, -26, 16, 8, 58, 40, -53, 70, 4, -20,
+    -5, 36, -46, -15, 0, 58, -59, 67, -16, -75, -127, -56, -11, -57, 0, 46,
+    19, 6, -18, 2, 21, -86, -36, 11, 89, 6, -37, -29, 23, -36, -35, 13,
+    45, 13, 50, -15, -19, 13, 16, 25, 25, 60, 37, -7, -67, -33, -39, 20,
+    18, -2, 16, 2, -18, 41, -40, 8, -18, -40, -5, 48, 50, 24, 81, -19,
+    5, -23, 30, 42, 38, -43, -61, 5, 40, 4, 6, -23, -23, 15, 53, -11,
+    15, 4, -11, -51, -20, 67, 0, 51, 13, -8, -14, -42, 5, -30, -9, -45,
+    -127, 31, 29, 5, 5, -79, 15, -14, 27, 3, 5, -25, -3, -30, 78, 39,
+    -71, 22, -8, -22, -78, -39, 26, 6, -75, -4, 58, 14, 25, -85, -69, -40,
+    -36, -39, 38, 30, 82, 26, -18, 27, 84, -26, -23, 32, 36, 3, -41, 10,
+    -1, 18, -34, 41, 12, 23, 11, -7, 16, -34, -14, 25, -36, 24, -122, 54,
+    -36, 21, 71, -8, 22, -70, -7, -19, 5, -15, -31, -22, 11, -52, 23, 64,
+    -31, -15, 0, 25, 26, -20, 20, -1, -18, -26, 55, -19, -10, 14, 36, 40,
+    83, 17, 64, 23, -12, -47, 17, -37, -40, -31, -19, 86, 55, -34, 60, -72,
+    -16, -68, -36, 21, 20, 16, 27, 11, -24, 23, -84, 22, 31, 37, 44, 109,
+    14, -57, 9, -9, 74, 7, 3, 40, -105, 34, 6, -56, -2, -41, 28, 59,
+    75, -25, -87, 54, -45, -7, 36, -27, -26, 63, 30, 19, 12, -29, 3, 53,
+    -67, 86, -32, -54, -2, 56, 51, -7, -121, -72, 42, 61, 9, 73, -12, -30,
+    -31, 34, 36, -38, 48, 12, 9, -13, -14, -54, 20, 37, -25, -47, -28, 3,
+    30, -26, 9, -45, 15, 23, 41, 22, 0, -99, 19, 62, 105, 43, -50, -42,
+    -47, 25, -46, 23, -10, -81, -1, -63, 0, -4, 79, 51, -32, 80, -29, -15,
+    40, -1, -74, 15, 45, -9, 48, -38, 16, 27, -57, -53, 79, -53, 36, -4,
+    -26, 33, 43, 14, -26, 22, -19, -18, -37, 48, -29, 20, -36, 86, 30, -29,
+    66, -63, -49, 6, 19, -15, -14, -23, 24, 43, 49, -98, -19, -31, 29, 13,
+    31, 47, 20, 44, 48, 38, 24, 27, 10, -4, 7, -14, -30, 42, 69, -5,
+    7, -22, -32, -20, 53, -22, -36, -71, -7, 72, 77, -20, 51, 38, -30, -52,
+    -9, -33, 22, -20, -62, 6, -3, 20, -9, -62, 11, 17, -4, 9, 3, -31,
+    -67, 21, 16, -63, -36, -43, 2, -21, -17, -20, 7, 1, -13, 10, 12, -86,
+    -37, -57, -26, -39, -4, 30, 6, 24, 28, 34, -24, -74, 29, -33, -8, 3,
+    -52, -41, 2, -15, -76, -60, -31, -7, -31, -50, 34, 19, -16, 27, -36, 17,
+    -4, 21, -31, 10, -45, 55, 17, 18, 23, 16, -6, 75, -46, 30, 10, 70,
+    7, -6, -6, -49, -10, -42, -58, -40, 4, 60, -32, 37, -27, 80, -4, 72,
+    -74, 67, -51, 8, 26, 19, 57, 42, -33, -96, -19, 49, -35, -18, -39, -5,
+    -38, 65, -2, 47, -6, -47, 30, -61, 100, 25, -54, 49, -54, -62, -32, -2,
+    -21, 36, -82, 89, 8, -54, -51, -46, 25, 10, -32, -6, 18, -56, 37, 1,
+    10, -46, 2, -10, -17, 8, -27, -42, 3, 62, 27, 5, -93, -42, 45, 52,
+    -27, -19, 3, -13, 25, -21, -25, 43, -6, 22, -4, -77, -69, -20, -37, 17,
+    -64, 35, 0, -8, 80, 6, -7, 48, 39, -2, -26, 38, 37, 21, -25, 34,
+    3, -9, -58, 12, -65, 32, 49, -2, 17, 104, -15, -16, 19, 48, -36, 17,
+    18, -12, 49, 44, 43, -28, -51, -55, -52, -43, -8, -31, -1, 52, -14, -30,
+    38, -40, 29, 33, 36, 27, -52, 38, 66, 20, 6, -37, 35, 30, 71, 6,
+    -57, 56, -47, 5, -15, -90, -43, -17, 39, 27, 60, 19, 85, 39, -25, -71,
+    10, 21, 27, 11, 55, 36, -6, 78, -30, 4, 58, -4, -2, 34, -8, -42,
+    -36, -11, 11, -66, -13, 5, 20, 65, -53, 5, 34, -5, -39, 105, -32, 31,
+    79, -8, -12, -19, 66, 37, 1, 7, 53, 2, -57, 14, -36, 54, 61, 14,
+    19, -25, 23, -33, -21, -30, -24, -42, 17, 23, -10, 38, -25, 30, 0, 19,
+    16, 41, 4, 14, -1, -38, -36, 38, 14, -46, 20, -21, -51, -50, 33, -15,
+    -41, -5, -48, -84, 49, 10, -7, -15, -24, -47, 61, -1, 27, 48, 42, -55,
+    69, -39, 45, 7, -3, 55, 8, -59, 32, 7, 13, -20, 21, -38, 21, 42,
+    12, -18, -34, -30, -40, -38, -36, 1, 17, -2, -17, 74, 47, -59, -3, 44,
+    22, -12, -49, -93, -21, 20, -74, 50, 17, 24, 2, 20, -22, -63, 53, -42,
+    43, 53, -64, 15, 31, 110, 51, -53, 45, -32, 12, -61, -18, 103, 74, -92,
+    38, -85, -53, 4, 36, -19, 6, -2, 10, -18, -29, 52, 8, -71, -55, 26,
+    79, 42, 18, 29, 21, -25, -34, -100, -26, -27, -59, 25, -26, -78, -62, -4,
+    -98, 12, -58, 1, -41, -1, 48, -7, 44, 48, -47, 37, 73, -63, 9, 68,
+    -14, 74, 38, -32, 7, 5, -17, 14, -61, 16, 41, -64, 33, 95, 1, 30,
+    11, 16, 29, 6, 41, 2, -23, 18, -10, 96, 69, -59, 80, 33, -48, -73,
+    -32, 34, -1, -3, -24, 2, -37, -44, 16, 5, 28, -94, -35, 75, -16, -15,
+    12, -29, -9, 7, -95, 8, -78, 7, 47, 79, 33, 55, 13, 43, -26, 65,
+    46, -32, -18, -35, -44, -13, -13, 8, 12, -52, -51, 50, -72, -40, -45, -6,
+    53, -33, 31, -14, -13, 41, 2, -47, 3, 21, 7, 63, 42, -32, -33, 12,
+    0, 9, -52, -127, -49, -21, -88, -1, 31, -22, 7, -26, 6, -43, 5, 24,
+    -4, 39, 41, -13, 32, -25, -9, 13, -31, -25, 5, 15, -14, 51, -27, 62,
+    -41, 0, -23, -47, 30, -16, 4, 61, -35, 83, 34, 53, -2, -43, 71, -85,
+    -12, -28, 68, -5, -19, -61, 66, -47, 20, 82, 6, 22, 7, 30, -90, 31,
+    -34, -29, 25, 41, -13, 55, 64, -44, 127, -31, -41, -66, 36, -34, 87, -6,
+    -32, -23, 43, -5, -44, 1, -13, -44, -47, 84, 7, 38, -43, -19, 12, -31,
+    -61, -36, 38, -40, 69, 92, 27, 17, -2, -45, 72, -5, 40, 14, 16, 38,
+    19, -21, -22, 31, 24, -11, -13, 42, 21, 65, 37, 18, -25, 35, -37, -8,
+    42, 18, 25, -21, -9, -63, 17, -50, -100, 28, 8, 28, 19, -93, 64, -6,
+    46, 83, -4, 20, -24, 73, -43, -23, -9, -45, -38, 32, 32, 61, -25, 47,
+    -50, -23, 56, 1, -30, 21, -24, -42, 59, -26, 23, -17, -6, 11, -34, 29,
+    28, -7, 59, -24, -26, -14, 30, 64, 23, 28, -39, 27, 15, -62, -14, 28,
+    -10, 41, 2, -29, 33, 10, -47, 73, 6, -33, 32, -5, -25, 25, 41, -5,
+    14, -62, 41, -24, -52, 31, -34, 10, -16, -21, 12, -57, 9, 36, -28, -29,
+    -9, -6, 24, 0, 20, 9, 7, 15, -60, -101, 36, -37, -93, -20, 31, 11,
+    -1, 89, 31, 6, -12, 24, 24, 30, -23, -57, -19, -24, 41, -17, 13, -37,
+    -5, 29, -33, 2, -20, 27, 30, -31, 81, -65, 34, -29, -42, -29, -64, 65,
+    53, -14, 8, -2, -48, 60, 6, 38, 73, -28, -2, 42, -29, 28, 13, 3,
+    110, 2, 38, -6, -68, -2, -57, 20, 19, -14, -23, -23, 19, -21, -7, 0,
+    61, 48, -30, -13, -48, 23, 7, 10, -13, 26, -36, -63, -60, 9, -6, 5,
+    -46, 57, 7, -27, -35, -22, -2, 0, -36, -6, 26, 47, -11, -16, 8, -5,
+    21, 41, -11, 57, 46, 67, -72, 16, 10, 68, 0, -58, 2, 4, -86, -61,
+    -33, 10, -48, 33, 0, -8, -38, 56, -8, -8, 35, 38, 30, -76, 22, 69,
+    -12, -44, -31, 7, -21, -38, 5, 30, -17, -48, 93, 36, 7, 40, 20, 3,
+    -17, 6, 27, -61, -26, 7, -24, -21, 7, 37, -38, -54, -46, -29, -16, -1,
+    39, 2, -32, 30, -109, 12, 3, -6, -41, 12, -17, 15, -25, 34, 2, -21,
+    -4, 22, 23, 14, -41, 90, -24, -13, -14, -12, 42, 42, -44, -47, -35, -85,
+    -13, -32, 71, 1, -43, -5, 5, 82, -37, 33, -44, 67, 7, 19, 36, -60,
+    1, -16, -35, 27, 32, 83, 1, 18, 26, 17, -52, -4, 39, -31, 56, 0,
+    -73, 42, 25, 26, 32, -6, 57, 30, 3, 35, 21, 51, 35, 12, -25, 33,
+    41, -32, -3, -28, 9, 16, -4, -85, -50, 92, 11, 51, -12, -36, 41, 19,
+    -16, -27, -14, -10, 37, -10, 23, 21, -10, 16, -22, 31, -43, 4, -14, -38,
+    -22, -35, -24, 5, 7, -15, -6, -18, 10, -45, -63, -19, 35, 62, 33, -9,
+    -9, -28, 24, -32, -4, -83, -61, 7, -21, -2, 24, -49, 17, 103, 44, -49,
+    -9, 63, 8, 14, 21, 30, -34, 10, -1, -55, -83, -37, -22, 13, 40, -47,
+    -55, 26, -8, 71, 24, 39, -8, -34, 91, 74, 23, 57, 37, 19, 48, -4,
+    6, -36, -40, -24, -79, 6, 7, 17, -4, -42, 38, 71, 25, -20, 31, -2,
+    37, 47, 4, 8, 94, -46, -75, 21, -7, -22, 2, 34, -10, -14, 6, 18,
+    -6, -14, 21, 51, 11, 16, 15, -24, 11, -43, -63, 81, -48, 91, 61, -36,
+    0, 21, -21, 44, -6, -19, -22, -12, 70, 5, -28, -15, -4, -12, 1, -48,
+    29, -21, -17, 16, 32, 45, 53, 22, 6, 12, 17, -46, -10, 6, -7, 8,
+    83, -10, 16, 10, -19, 13, 24, 24, -10, -25, -15, -28, -15, -7, 52, 4,
+    -32, 38, -31, -6, -61, 51, 94, -38, 38, -18, -32, -13, -26, 19, 27, 15,
+    -64, -44, 50, -59, 5, 37, 17, 28, 36, 4, 31, 4, 16, -19, -8, 9,
+    9, -10, -57, -31, 9, 58, -39, -25, -32, 60, 22, -2, 20, 21, -22, -10,
+    10, 18, 3, 23, -30, -15, 19, 2, -19, -25, -32, 2, 10, -43, 21, 67,
+    -6, 1, 32, -87, -59, 15, -17, -69, 18, -31, 1, 7, 18, 19, 40, -89,
+    -14, 4, 35, -76, 2, -18, 6, 39, -47, 48, -45, 10, -49, 22, 26, 10,
+    12, 41, -66, 21, -13, 60, -29, 2, 5, 8, 32, -22, 37, 9, -13, 38,
+    55, -20, -22, 54, -2, 13, 52, 24, 67, 19, 15, -33, 16, -18, 6, -51,
+    -26, 26, 16, 21, -36, -58, 51, 10, 26, 11, 53, 38, 29, -42, -13, 18,
+    9, -51, -4, -15, 43, 5, 24, -4, 33, 3, 24, 43, -9, -23, -24, 14,
+    -67, -68, -5, -6, 20, -34, 35, 32, 6, 44, -26, 35, 57, -8, 49, -13,
+    -44, 24, -28, 40, 11, -11, 33, -5, -24, -20, 26, -22, 0, -7, -25, 5,
+    40, -20, 101, 75, 35, 50, -20, 28, -5, -2, -14, -3, 8, -23, 19, 45,
+    0, 70, -61, -44, -53, -15, 2, -1, -10, -34, -20, -30, 9, 50, -60, -11,
+    -42, -27, 38, 7, -6, -18, -1, -51, 31, 120, -5, -27, -4, -20, 77, -13,
+    -47, 33, 15, 8, 94, -30, -87, 75, 91, 18, -10, 12, -41, 55, 33, 4,
+    37, 39, 14, -8, 7, 4, -13, 6, -44, 26, 75, 10, -18, -29, -23, -7,
+};
+
+static const int32_t nnb_pw4_bias[64] = {
+    523, -25297, -9437, 3989, -775, 1447, 20512, 4131, 4347, -3087, -419, 2106, -16299, -5193, 11655, -7196,
+    9279, -16239, -13573, -18617, 13072, -6255, -14977, -6076, -12486, 6637, 6210, 10178, -7158, -6753, 4049, 17538,
+    4976, 11783, -9131, 1761, 2815, -11427, 4356, -5598, -2037, 6733, 13536, 2948, -4126, 10014, 4757, 3631,
+    -4742, 12339, -8562, -7886, -1166, -5810, 1592, -884, -10768, 10695, -5673, -7190, 15581, -12982, -8622, -6556,
+};
+
+static const int32_t nnb_pw4_mult[64] = {
+    1153275222, 1445066420, 1472978676, 1830079274, 1196492809, 1844818167, 1681771498, 1543351441, 1311867139, 1536411065, 1131184802, 1640616916, 1589766806, 1820547898, 1747829114, 1627021619,
+    1940978930, 1883839741, 1274164883, 1438500905, 1635072043, 1489743048, 1452633666, 1118919800, 1927922324, 1357635084, 2114149753, 1756459366, 1696824813, 1228679335, 1683878805, 1639371599,
+    2144589670, 2015233922, 1445170021, 1653220141, 1654305554, 1142943480, 1528875449, 1402893786, 1408087632, 1870438264, 1737284597, 1535747760, 1549719121, 1148129702, 1477513243, 1640750455,
+    1563825692, 1534306072, 1213978792, 2018193149, 1485425058, 1793124967, 1523713453, 1979578033, 1727014494, 1530655551, 1578191438, 2098231828, 1680789892, 1970579364, 1779302072, 1667304646,
+};
+
+static const int32_t nnb_pw4_shift[64] = {
+    -6, -7, -7, -7, -7, -7, -7, -7, -7, -7, -6, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7, -7,
+    -7, -7, -7, -7, -7, -7, -7, -8, -7, -7, -7, -7, -7, -7, -7, -7,
+};
+
+static const int8_t nnb_fc_weights[768] = {
+    -23, 27, 36, 28, -17, 24, -30, 63, 26, 10, 42, -28, -28, 0, -39, 61,
+    29, -14, -33, 48, -68, 1, -66, 8, -41, 53, -40, 38, 4, -19, 16, 44,
+    51, 16, -94, -5, 0, 19, 49, -23, -39, 20, -16, 59, -21, 23, -18, -50,
+    21, -50, 4, 57, -21, -25, -16, 54, -72, -36, 2, -8, 57, 22, -49, -21,
+    -5, 39, -28, -1, 35, -39, -16, 3, 60, -6, 26, 22, 14, 4, 37, 18,
+    -35, 46, 9, 8, -56, -3, -27, -20, -4, -26, -38, 7, 11, 20, -39, 6,
+    -15, 8, -25, -18, 25, 27, -30, -49, -16, 8, -78, 10, -46, -62, 10, 1,
+    10, 4, -21, -50, -40, 27, 24, -40, -42, 17, -22, 34, -54, -66, 19, -58,
+    19, 41, -47, -31, 15, 8, -59, 17, -7, -15, 25, 32, 28, 50, -30, -17,
+    -15, -15, 21, -18, 31, -65, 69, 53, 46, -42, -20, 65, -22, 2, 43, 21,
+    24, 14, 68, 52, -28, 18, -9, -3, 1, 29, -32, 1, 10, 57, -9, 20,
+    67, 54, 78, 63, 45, 2, -19, 95, 28, -8, 29, -11, 15, -16, -36, -26,
+    -20, -17, -33, -37, -23, 6, -78, -40, 30, -44, 62, 3, 11, -45, -53, -73,
+    -1, 20, 13, 12, -6, -14, -127, 4, 1, 54, -9, 32, -48, -2, 66, -31,
+    -11, 25, -15, 44, -33, 64, -2, -22, -70, 89, 56, 24, -8, -11, -8, -33,
+    -38, -10, 35, 13, -10, 23, 9, 8, 28, -7, 45, 53, 70, -75, -22, -10,
+    15, -3, -18, -46, -56, -37, 10, -31, 17, -6, 30, -60, 5, 62, -3, 40,
+    -49, -33, 69, 35, -55, 2, 36, -59, -83, -4, 11, 47, 16, 17, 30, -51,
+    39, 81, -31, -15, 5, 11, -41, -5, -5, -4, -23, 38, 42, 39, -44, 30,
+    31, 6, -28, 32, -4, 8, 5, 8, -26, 23, 38, 5, 4, -38, 28, 34,
+    -1, 79, 62, -95, 2, -9, 0, -27, -51, -24, -51, 17, -28, 30, -21, -10,
+    -41, -16, 19, 10, -127, -23, 64, 50, 38, -11, 14, -67, 80, 35, 58, -74,
+    -42, 45, 37, -33, -53, 1, -82, 37, 127, -50, 7, -28, 22, -6, -18, -24,
+    -56, 77, -48, 11, 94, -21, 62, 40, 12, -51, 53, -41, 6, -1, 37, 58,
+    45, -42, -32, 10, -95, -14, -10, -26, 19, -21, -37, -8, -18, 12, 48, -58,
+    -3, 48, 12, -45, -12, -23, -23, -46, 25, -1, 37, 12, 10, -43, 46, 0,
+    -51, -11, -18, -55, 5, 18, 7, -99, -14, 66, -6, -5, 90, 70, 52, -1,
+    -45, -81, 24, -27, -6, 56, -66, -31, 25, -27, 15, -5, -44, 25, -40, 18,
+    7, -47, -14, -87, -19, -17, -21, -8, 46, 45, 37, -24, -28, 28, -1, -33,
+    -25, -66, -54, 3, 3, -11, 29, 5, 52, 13, 0, 11, 0, 20, -55, -31,
+    24, -7, -29, 91, -9, 2, 21, -2, 40, 46, 39, 47, 4, 12, 2, -3,
+    33, -31, 88, 22, 25, -23, 30, 43, 78, -24, 25, -28, 22, -13, 9, 21,
+    -18, 24, -38, -29, -12, 12, 15, 33, -23, -79, -19, -13, 4, -5, 56, 10,
+    51, 66, -45, 3, -51, -54, 3, -7, -20, -33, -98, 17, -57, -25, 20, -23,
+    1, 28, -56, -21, -55, -22, -24, -33, -4, 28, -34, 19, 1, 5, -18, -8,
+    32, 5, 26, 9, -25, -61, -50, 7, 85, -60, -40, 41, 2, -9, 70, -1,
+    42, 29, 27, -27, -75, 37, -18, 47, -38, -61, 48, -73, -87, -48, 24, 15,
+    -20, -29, -64, -70, 8, 24, 59, 21, 12, 47, 66, 45, -46, 3, 24, -44,
+    33, 32, 62, -30, 90, 53, 70, 54, 18, -65, 83, -29, -29, 121, 6, 10,
+    -15, 36, -61, 30, -14, 23, -82, 38, 52, 31, 55, 54, -63, 52, -44, 10,
+    -33, -22, 8, -36, -8, -1, -70, 1, -13, 57, -30, 34, -27, 22, 10, 0,
+    -41, -69, 24, 15, -8, -22, -59, -36, 24, -16, 20, -30, -88, 28, -65, -1,
+    20, -4, -8, 46, 21, 9, -44, 35, -5, 36, -32, -15, -14, -44, -25, 24,
+    -16, 84, 20, -47, 22, -16, -16, -65, -77, 7, 61, -7, -20, 5, 1, -4,
+    -7, -55, 5, -65, -31, -79, -15, -52, -38, -31, 64, -15, 36, -112, -14, 17,
+    -39, -65, 17, -33, 3, 31, 42, 44, -21, 31, -6, -91, -12, -6, -94, -10,
+    -7, -5, 17, -2, 24, 84, -7, 45, -12, 16, -35, -14, 1, 7, -11, -14,
+    -105, 10, 32, 87, -16, -24, -40, -33, 47, 36, -7, 2, -9, -6, -14, -39,
+};
+
+static const int32_t nnb_fc_bias[12] = {
+    -269, 1427, 2103, 754, -639, -661, -1438, -1548, -1283, -2295, -1672, -3376,
+};
+
+static const int32_t nnb_fc_mult[1] = {
+    1321083803,
+};
+
+static const int32_t nnb_fc_shift[1] = {
+    -7,
+};
+
+static const nnb_layer_t nnb_layers[] = {
+    {"conv1", NNB_CONV, {1, 49, 10, 1}, {64, 10, 4, 1}, {1, 25, 5, 64}, {2, 2}, {1, 4}, 0, -128, {-128, 127}, (const int8_t *)nnb_conv1_weights, (const int32_t *)nnb_conv1_bias, (int32_t *)nnb_conv1_mult, (int32_t *)nnb_conv1_shift, 0x012b912cU, NNB_INPUT_OFFSET, NNB_CONV1_OFFSET, NNB_CONV1_SCRATCH_OFFSET, NNB_CONV1_SCRATCH_SIZE},
+    {"dw1", NNB_DW_CONV, {1, 25, 5, 64}, {64, 3, 3, 64}, {1, 25, 5, 64}, {1, 1}, {1, 1}, 128, -128, {-128, 127}, (const int8_t *)nnb_dw1_weights, (const int32_t *)nnb_dw1_bias, (int32_t *)nnb_dw1_mult, (int32_t *)nnb_dw1_shift, 0xd9c091ceU, NNB_CONV1_OFFSET, NNB_DW1_OFFSET, NNB_DW1_SCRATCH_OFFSET, NNB_DW1_SCRATCH_SIZE},
+    {"pw1", NNB_PW_CONV, {1, 25, 5, 64}, {64, 1, 1, 64}, {1, 25, 5, 64}, {1, 1}, {0, 0}, 128, -128, {-128, 127}, (const int8_t *)nnb_pw1_weights, (const int32_t *)nnb_pw1_bias, (int32_t *)nnb_pw1_mult, (int32_t *)nnb_pw1_shift, 0x9f9cab98U, NNB_DW1_OFFSET, NNB_PW1_OFFSET, NNB_PW1_SCRATCH_OFFSET, NNB_PW1_SCRATCH_SIZE},
+    {"dw2", NNB_DW_CONV, {1, 25, 5, 64}, {64, 3, 3, 64}, {1, 25, 5, 64}, {1, 1}, {1, 1}, 128, -128, {-128, 127}, (const int8_t *)nnb_dw2_weights, (const int32_t *)nnb_dw2_bias, (int32_t *)nnb_dw2_mult, (int32_t *)nnb_dw2_shift, 0x745e4b8aU, NNB_PW1_OFFSET, NNB_DW2_OFFSET, NNB_DW2_SCRATCH_OFFSET, NNB_DW2_SCRATCH_SIZE},
+    {"pw2", NNB_PW_CONV, {1, 25, 5, 64}, {64, 1, 1, 64}, {1, 25, 5, 64}, {1, 1}, {0, 0}, 128, -128, {-128, 127}, (const int8_t *)nnb_pw2_weights, (const int32_t *)nnb_pw2_bias, (int32_t *)nnb_pw2_mult, (int32_t *)nnb_pw2_shift, 0x53e54e47U, NNB_DW2_OFFSET, NNB_PW2_OFFSET, NNB_PW2_SCRATCH_OFFSET, NNB_PW2_SCRATCH_SIZE},
+    {"dw3", NNB_DW_CONV, {1, 25, 5, 64}, {64, 3, 3, 64}, {1, 25, 5, 64}, {1, 1}, {1, 1}, 128, -128, {-128, 127}, (const int8_t *)nnb_dw3_weights, (const int32_t *)nnb_dw3_bias, (int32_t *)nnb_dw3_mult, (int32_t *)nnb_dw3_shift, 0x9c763c6bU, NNB_PW2_OFFSET, NNB_DW3_OFFSET, NNB_DW3_SCRATCH_OFFSET, NNB_DW3_SCRATCH_SIZE},
+    {"pw3", NNB_PW_CONV, {1, 25, 5, 64}, {64, 1, 1, 64}, {1, 25, 5, 64}, {1, 1}, {0, 0}, 128, -128, {-128, 127}, (const int8_t *)nnb_pw3_weights, (const int32_t *)nnb_pw3_bias, (int32_t *)nnb_pw3_mult, (int32_t *)nnb_pw3_shift, 0xf3484281U, NNB_DW3_OFFSET, NNB_PW3_OFFSET, NNB_PW3_SCRATCH_OFFSET, NNB_PW3_SCRATCH_SIZE},
+    {"dw4", NNB_DW_CONV, {1, 25, 5, 64}, {64, 3, 3, 64}, {1, 25, 5, 64}, {1, 1}, {1, 1}, 128, -128, {-128, 127}, (const int8_t *)nnb_dw4_weights, (const int32_t *)nnb_dw4_bias, (int32_t *)nnb_dw4_mult, (int32_t *)nnb_dw4_shift, 0x2e1ccc9eU, NNB_PW3_OFFSET, NNB_DW4_OFFSET, NNB_DW4_SCRATCH_OFFSET, NNB_DW4_SCRATCH_SIZE},
+    {"pw4", NNB_PW_CONV, {1, 25, 5, 64}, {64, 1, 1, 64}, {1, 25, 5, 64}, {1, 1}, {0, 0}, 128, -128, {-128, 127}, (const int8_t *)nnb_pw4_weights, (const int32_t *)nnb_pw4_bias, (int32_t *)nnb_pw4_mult, (int32_t *)nnb_pw4_shift, 0x2ad11595U, NNB_DW4_OFFSET, NNB_PW4_OFFSET, NNB_PW4_SCRATCH_OFFSET, NNB_PW4_SCRATCH_SIZE},
+    {"avgpool", NNB_AVGPOOL, {1, 25, 5, 64}, {64, 25, 5, 64}, {1, 1, 1, 64}, {1, 1}, {0, 0}, 0, 0, {-128, 127}, NULL, NULL, NULL, NULL, 0x126755b7U, NNB_PW4_OFFSET, NNB_AVGPOOL_OFFSET, NNB_AVGPOOL_SCRATCH_OFFSET, NNB_AVGPOOL_SCRATCH_SIZE},
+    {"fc", NNB_FC, {1, 1, 1, 64}, {64, 1, 1, 12}, {1, 1, 1, 12}, {1, 1}, {0, 0}, 128, 0, {-128, 127}, (const int8_t *)nnb_fc_weights, (const int32_t *)nnb_fc_bias, (int32_t *)nnb_fc_mult, (int32_t *)nnb_fc_shift, 0x1d84ebf3U, NNB_AVGPOOL_OFFSET, NNB_FC_OFFSET, NNB_FC_SCRATCH_OFFSET, NNB_FC_SCRATCH_SIZE},
+    {"softmax", NNB_SOFTMAX, {1, 1, 1, 12}, {12, 1, 1, 12}, {1, 1, 1, 12}, {1, 1}, {0, 0}, 0, 0, {-128, 127}, NULL, NULL, NULL, NULL, 0x00000000U, NNB_FC_OFFSET, NNB_SOFTMAX_OFFSET, NNB_SOFTMAX_SCRATCH_OFFSET, NNB_SOFTMAX_SCRATCH_SIZE},
+};
+
+#endif /* __NNBENCH_MODEL_H__ */
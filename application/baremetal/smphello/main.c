@@ -57,7 +57,7 @@ void smp_main(void)
 void main(void)
 {
     unsigned long hartid = __RV_CSR_READ(CSR_MHARTID);
-    if (hartid == 0) { // boot hart
+    if (hartid == BOOT_HARTID) { // boot hart
         spinlock_init(&lock);
         lock_ready = 1;
         finished = 0;
@@ -0,0 +1,142 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "nuclei_sdk_soc.h"
+
+/*
+ * Measure cycles per byte of memcpy, memset, memcmp and strlen, the vector
+ * versions in demosoc_string.c are used when V extension is enabled and
+ * STR_USE_VECTOR is defined, otherwise the C library ones.
+ */
+#ifndef STRBENCH_MAX_SIZE
+#define STRBENCH_MAX_SIZE       4096
+#endif
+#define STRBENCH_REPEAT         3
+/* Unaligned offset used by the .u cases */
+#define STRBENCH_UNALIGN        3
+
+static unsigned char strbench_src[STRBENCH_MAX_SIZE + 8];
+static unsigned char strbench_dst[STRBENCH_MAX_SIZE + 8];
+static volatile unsigned long strbench_sink;
+
+static const unsigned short strbench_sizes[] = {16, 64, 256, 1024, STRBENCH_MAX_SIZE};
+
+#define STRBENCH_SIZES          (sizeof(strbench_sizes) / sizeof(strbench_sizes[0]))
+
+typedef unsigned long (*strbench_func_t)(unsigned int offset, unsigned long size);
+
+/*
+ * Called through function pointers, so compiler can't expand the
+ * routines inline with known size
+ */
+static unsigned long strbench_memcpy(unsigned int offset, unsigned long size)
+{
+    return (unsigned long)memcpy(strbench_dst + offset, strbench_src, size);
+}
+
+static unsigned long strbench_memset(unsigned int offset, unsigned long size)
+{
+    return (unsigned long)memset(strbench_dst + offset, 0x5A, size);
+}
+
+static unsigned long strbench_memcmp(unsigned int offset, unsigned long size)
+{
+    return (unsigned long)memcmp(strbench_dst + offset, strbench_src + offset, size);
+}
+
+static unsigned long strbench_strlen(unsigned int offset, unsigned long size)
+{
+    return (unsigned long)strlen((const char *)(strbench_src + offset));
+}
+
+typedef struct {
+    const char *name;
+    strbench_func_t func;
+} strbench_item_t;
+
+static const strbench_item_t strbench_items[] = {
+    { "memcpy", strbench_memcpy },
+    { "memset", strbench_memset },
+    { "memcmp", strbench_memcmp },
+    { "strlen", strbench_strlen },
+};
+
+#define STRBENCH_ITEMS          (sizeof(strbench_items) / sizeof(strbench_items[0]))
+
+/* Prepare buffers, strlen sees size bytes, memcmp compares equal buffers */
+static void strbench_prepare(unsigned int offset, unsigned long size)
+{
+    unsigned long i;
+
+    for (i = 0; i < sizeof(strbench_src); i ++) {
+        strbench_src[i] = (unsigned char)(i % 251 + 1);
+    }
+    strbench_src[offset + size] = '\0';
+    memcpy(strbench_dst, strbench_src, sizeof(strbench_dst));
+}
+
+/* Return the minimal cycles of several runs, first run is used to warm up cache */
+static unsigned long strbench_measure(strbench_func_t func, unsigned int offset, unsigned long size)
+{
+    unsigned long cycle, best = (unsigned long)(-1);
+    uint64_t start;
+    int i;
+
+    strbench_sink ^= func(offset, size);
+    for (i = 0; i < STRBENCH_REPEAT; i ++) {
+        start = __get_rv_cycle();
+        strbench_sink ^= func(offset, size);
+        cycle = (unsigned long)(__get_rv_cycle() - start);
+        if (cycle < best) {
+            best = cycle;
+        }
+    }
+    return best;
+}
+
+/* Print cycles per byte in x.xx format, no float printf in newlib_small */
+static void strbench_report(const char *name, const char *type, unsigned long size, unsigned long cycle)
+{
+    unsigned long percent = cycle * 100 / size;
+
+    printf("CSV, %s.%lu%s, %lu.%02lu\n", name, size, type, percent / 100, percent % 100);
+}
+
+int main(void)
+{
+    unsigned int i, j;
+    unsigned long size, errs = 0;
+
+#if defined(__riscv_vector) && defined(STR_USE_VECTOR)
+    printf("Benchmark vector string routines, cycles per byte\n");
+#else
+    printf("Benchmark C library string routines, cycles per byte\n");
+#endif
+    for (i = 0; i < STRBENCH_ITEMS; i ++) {
+        for (j = 0; j < STRBENCH_SIZES; j ++) {
+            size = strbench_sizes[j];
+            strbench_prepare(0, size);
+            strbench_report(strbench_items[i].name, "", size, strbench_measure(strbench_items[i].func, 0, size));
+            strbench_prepare(STRBENCH_UNALIGN, size);
+            strbench_report(strbench_items[i].name, ".u", size, \
+                            strbench_measure(strbench_items[i].func, STRBENCH_UNALIGN, size));
+        }
+    }
+    /* Quick sanity check of results, full check is done in test/core/test_string.c */
+    strbench_prepare(STRBENCH_UNALIGN, STRBENCH_MAX_SIZE);
+    if (strlen((const char *)(strbench_src + STRBENCH_UNALIGN)) != STRBENCH_MAX_SIZE) {
+        errs ++;
+    }
+    memset(strbench_dst + STRBENCH_UNALIGN, 0, STRBENCH_MAX_SIZE);
+    memcpy(strbench_dst + STRBENCH_UNALIGN, strbench_src + STRBENCH_UNALIGN, STRBENCH_MAX_SIZE);
+    if (memcmp(strbench_dst, strbench_src, sizeof(strbench_dst)) != 0) {
+        errs ++;
+    }
+    if (errs) {
+        printf("String benchmark failed\n");
+        return 1;
+    }
+    printf("String benchmark finished\n");
+    return 0;
+}
@@ -0,0 +1,107 @@
+#include <stdint.h>
+#include <stdio.h>
+
+#include "nuclei_sdk_soc.h"
+#include "nuclei_trace.h"
+
+/*
+ * The system timer interrupt is a non-vector interrupt, it is recorded by
+ * irq_entry, and it triggers the software interrupt, which is a vector
+ * interrupt, so its handler records itself with NTRACE_VectorIrqEnter and
+ * NTRACE_VectorIrqExit. The main loop records a span for each tick, then the
+ * trace buffer is checked and dumped for trace2chrome.py.
+ */
+/* Define the interrupt handler name same as vector table in case download mode is flashxip. */
+#define mtimer_irq_handler      eclic_mtip_handler
+#define mtimer_sw_irq_handler   eclic_msip_handler
+
+#define TRACE_DEMO_TICKS        10
+#define TRACE_DEMO_TICK_HZ      100
+#define TRACE_DEMO_SPAN_ID      1
+#define TRACE_DEMO_MARK_ID      2
+
+static uint64_t trace_demo_period;
+static volatile uint32_t trace_demo_ticks;
+static volatile uint32_t trace_demo_swirqs;
+
+void mtimer_irq_handler(void)
+{
+    uint32_t tick = trace_demo_ticks + 1;
+
+    NTRACE_Mark(TRACE_DEMO_MARK_ID, tick);
+    SysTimer_SetSWIRQ();
+    trace_demo_ticks = tick;
+    if (tick < TRACE_DEMO_TICKS) {
+        SysTimer_SetCompareValue(SysTimer_GetCompareValue() + trace_demo_period);
+    } else {
+        ECLIC_DisableIRQ(SysTimer_IRQn);
+    }
+}
+
+__INTERRUPT void mtimer_sw_irq_handler(void)
+{
+    SAVE_IRQ_CSR_CONTEXT();
+    NTRACE_VectorIrqEnter();
+
+    SysTimer_ClearSWIRQ();
+    trace_demo_swirqs ++;
+
+    NTRACE_VectorIrqExit();
+    RESTORE_IRQ_CSR_CONTEXT();
+}
+
+/* Count recorded events with type and argument, the ring buffer must not be wrapped */
+static uint32_t trace_demo_count(uint8_t type, uint16_t arg)
+{
+    uint32_t i, cnt = 0;
+
+    for (i = 0; i < NTRACE_Data.index; i ++) {
+        if ((NTRACE_Data.events[i].type == type) && (NTRACE_Data.events[i].arg == arg)) {
+            cnt ++;
+        }
+    }
+    return cnt;
+}
+
+int main(void)
+{
+    uint32_t tick = 0;
+    uint32_t timer_irqs, sw_irqs, spans;
+
+    printf("Trace %d system timer and software interrupts\n", TRACE_DEMO_TICKS);
+    NTRACE_Init();
+    trace_demo_period = SOC_TIMER_FREQ / TRACE_DEMO_TICK_HZ;
+    ECLIC_Register_IRQ(SysTimerSW_IRQn, ECLIC_VECTOR_INTERRUPT, ECLIC_LEVEL_TRIGGER, 2, 0, \
+                       mtimer_sw_irq_handler);
+    ECLIC_Register_IRQ(SysTimer_IRQn, ECLIC_NON_VECTOR_INTERRUPT, ECLIC_LEVEL_TRIGGER, 1, 0, \
+                       mtimer_irq_handler);
+    NTRACE_Start();
+    SysTimer_SetCompareValue(SysTimer_GetLoadValue() + trace_demo_period);
+    __enable_irq();
+
+    /* Record a span between two ticks */
+    while (tick < TRACE_DEMO_TICKS) {
+        NTRACE_Begin(TRACE_DEMO_SPAN_ID);
+        while (trace_demo_ticks == tick);
+        tick = trace_demo_ticks;
+        NTRACE_End(TRACE_DEMO_SPAN_ID);
+    }
+    while (trace_demo_swirqs < TRACE_DEMO_TICKS);
+    NTRACE_Stop();
+
+    timer_irqs = trace_demo_count(NTRACE_EVT_IRQ_ENTER, SysTimer_IRQn);
+    sw_irqs = trace_demo_count(NTRACE_EVT_IRQ_EXIT, SysTimerSW_IRQn);
+    spans = trace_demo_count(NTRACE_EVT_SPAN_END, TRACE_DEMO_SPAN_ID);
+    printf("Recorded %lu events, timer irq %lu, software irq %lu, span %lu\n", \
+           (unsigned long)NTRACE_Data.index, (unsigned long)timer_irqs, \
+           (unsigned long)sw_irqs, (unsigned long)spans);
+    NTRACE_Dump();
+
+    if ((timer_irqs != TRACE_DEMO_TICKS) || (sw_irqs != TRACE_DEMO_TICKS) \
+        || (spans != TRACE_DEMO_TICKS) || (NTRACE_Data.index > NTRACE_BUF_SIZE)) {
+        printf("Trace demo failed\n");
+        return 1;
+    }
+    printf("Trace demo finished\n");
+    return 0;
+}
@@ -0,0 +1,155 @@
+/* FreeRTOS software timer benchmark
+ *
+ * Creates a large number of auto-reload timers and measures the cost of
+ * restarting all of them in one burst, the way a protocol stack refreshing
+ * its timeouts after a received frame would do. The burst is issued with
+ * the scheduler suspended so every command is queued before the timer
+ * daemon gets to run.
+ *
+ * Build with APP_COMMON_FLAGS=-DconfigUSE_TIMER_WHEEL=0 and/or
+ * -DconfigUSE_TIMER_COMMAND_BATCH=0 to compare against the original
+ * sorted-list implementation.
+ */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "timers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nuclei_sdk_soc.h"
+
+#ifndef BENCH_TIMER_NUM
+#if __riscv_xlen == 64
+/* Timers and stacks take nearly twice the memory on RV64, fewer fit in 64K data memory */
+#define BENCH_TIMER_NUM         250
+#else
+#define BENCH_TIMER_NUM         500
+#endif
+#endif
+#define BENCH_TIMER_PERIOD_MIN  20
+#define BENCH_BURST_ROUNDS      8
+#define BENCH_RUN_TICKS         200
+
+static TimerHandle_t xBenchTimers[BENCH_TIMER_NUM];
+static volatile uint32_t ulTimerFired[BENCH_TIMER_NUM];
+static TaskHandle_t xBenchTaskHandle;
+static char cRunTimeStats[512];
+
+static void vBenchTimerCallback(TimerHandle_t xTimer)
+{
+    uint32_t idx = (uint32_t)(uintptr_t)pvTimerGetTimerID(xTimer);
+
+    ulTimerFired[idx] ++;
+}
+
+static uint32_t prvBurstReset(uint64_t* pullCycles)
+{
+    uint32_t i, fails = 0;
+    uint64_t start;
+
+    start = __get_rv_cycle();
+    vTaskSuspendAll();
+    for (i = 0; i < BENCH_TIMER_NUM; i ++) {
+        if (xTimerReset(xBenchTimers[i], 0) != pdPASS) {
+            fails ++;
+        }
+    }
+    /* Resuming lets the higher priority timer daemon drain the commands */
+    xTaskResumeAll();
+    *pullCycles = __get_rv_cycle() - start;
+    return fails;
+}
+
+static void vBenchTask(void* pvParameters)
+{
+    uint32_t i, round, fails;
+    uint64_t cycles, total = 0, worst = 0;
+    uint32_t fired = 0, expected = 0;
+    TickType_t period;
+
+    for (i = 0; i < BENCH_TIMER_NUM; i ++) {
+        period = BENCH_TIMER_PERIOD_MIN + i;
+        xBenchTimers[i] = xTimerCreate("bench", period, pdTRUE, \
+                                       (void*)(uintptr_t)i, vBenchTimerCallback);
+        if (xBenchTimers[i] == NULL) {
+            printf("Unable to create timer %u\r\n", (unsigned int)i);
+            while (1);
+        }
+    }
+
+    printf("Timer wheel %d, command batch %d, %d timers\r\n", \
+           configUSE_TIMER_WHEEL, configUSE_TIMER_COMMAND_BATCH, BENCH_TIMER_NUM);
+
+    for (round = 0; round < BENCH_BURST_ROUNDS; round ++) {
+        fails = prvBurstReset(&cycles);
+        total += cycles;
+        if (cycles > worst) {
+            worst = cycles;
+        }
+        printf("Burst %u: %u cycles, %u commands dropped\r\n", (unsigned int)round, \
+               (unsigned int)cycles, (unsigned int)fails);
+        vTaskDelay(1);
+    }
+
+    /* Let all timers run freely, then check each one fired as expected */
+    for (i = 0; i < BENCH_TIMER_NUM; i ++) {
+        ulTimerFired[i] = 0;
+    }
+    prvBurstReset(&cycles);
+    vTaskDelay(BENCH_RUN_TICKS);
+    for (i = 0; i < BENCH_TIMER_NUM; i ++) {
+        xTimerStop(xBenchTimers[i], portMAX_DELAY);
+        fired += ulTimerFired[i];
+        expected += BENCH_RUN_TICKS / (BENCH_TIMER_PERIOD_MIN + i);
+    }
+
+    printf("Timer callbacks %u, expected at least %u\r\n", \
+           (unsigned int)fired, (unsigned int)expected);
+    printf("CSV, TimerBurstReset, %u, %u\r\n", \
+           (unsigned int)(total / BENCH_BURST_ROUNDS), (unsigned int)worst);
+
+    /* Cycles spent by each task, sampled from mcycle at every task switch */
+    vTaskGetRunTimeStats(cRunTimeStats);
+    printf("Task\t\tCycles\t\tUsage\r\n%s", cRunTimeStats);
+    if (fired >= expected) {
+        printf("Timer benchmark finished\r\n");
+    } else {
+        printf("Timer benchmark failed\r\n");
+    }
+    while (1) {
+        vTaskDelay(1000);
+    }
+}
+
+int main(void)
+{
+    /* Benchmark task runs below the timer daemon priority */
+    xTaskCreate((TaskFunction_t)vBenchTask, (const char*)"bench",
+                (uint16_t)512, (void*)NULL, (UBaseType_t)2,
+                (TaskHandle_t*)&xBenchTaskHandle);
+
+    vTaskStartScheduler();
+
+    printf("OS should never run to here\r\n");
+
+    while (1);
+}
+
+void vApplicationMallocFailedHook(void)
+{
+    printf("malloc failed\n");
+    while (1);
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char* pcTaskName)
+{
+    printf("Stack Overflow\n");
+    while (1);
+}
+/*-----------------------------------------------------------*/
+
+void vApplicationIdleHook(void)
+{
+}
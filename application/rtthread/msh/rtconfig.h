@@ -30,6 +30,10 @@
 // <o>the max length of object name<2-16>
 //  <i>Default: 8
 #define RT_NAME_MAX    8
+// <c1>Using CPU architecture optimized __rt_ffs
+//  <i>Using ctz instruction or constant-time code to find highest ready priority
+//#define RT_USING_CPU_FFS
+// </c>
 // <c1>Using RT-Thread components initialization
 //  <i>Using RT-Thread components initialization
 #define RT_USING_COMPONENTS_INIT
@@ -74,6 +78,11 @@
 // </c>
 // </h>
 
+// <c1>using cpu usage
+//  <i>Count cpu cycles of each thread, shown by msh top command
+#define RT_USING_CPU_USAGE
+// </c>
+
 // <e>Software timers Configuration
 // <i> Enables user timers
 #define RT_USING_TIMER_SOFT         0
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ctest.h"
+#include "nuclei_sdk_soc.h"
+
+/*
+ * Known answer tests of bitmanip wrapper functions, they are run on the
+ * instructions when B extension is enabled, otherwise on the C code
+ */
+#define XLEN_ONES       (~0UL)
+#define XLEN_MSB        (1UL << (__RISCV_XLEN - 1))
+
+CTEST(bitmanip, count)
+{
+    ASSERT_EQUAL(__RV_CPOP(0), 0);
+    ASSERT_EQUAL(__RV_CPOP(0x80000001UL), 2);
+    ASSERT_EQUAL(__RV_CPOP(XLEN_ONES), __RISCV_XLEN);
+    ASSERT_EQUAL(__RV_CLZ(0), __RISCV_XLEN);
+    ASSERT_EQUAL(__RV_CLZ(1), __RISCV_XLEN - 1);
+    ASSERT_EQUAL(__RV_CLZ(XLEN_MSB), 0);
+    ASSERT_EQUAL(__RV_CLZ(0x00010000UL), __RISCV_XLEN - 17);
+    ASSERT_EQUAL(__RV_CTZ(0), __RISCV_XLEN);
+    ASSERT_EQUAL(__RV_CTZ(XLEN_MSB), __RISCV_XLEN - 1);
+    ASSERT_EQUAL(__RV_CTZ(0x00010000UL), 16);
+    ASSERT_EQUAL(__CLZ(0), 32);
+    ASSERT_EQUAL(__CLZ(0x00008000), 16);
+}
+
+CTEST(bitmanip, bytes)
+{
+#if __RISCV_XLEN == 32
+    ASSERT_EQUAL(__RV_REV8(0x12345678UL), 0x78563412UL);
+    ASSERT_EQUAL(__RV_ORCB(0x00120080UL), 0x00FF00FFUL);
+#else
+    ASSERT_EQUAL(__RV_REV8(0x0123456789ABCDEFUL), 0xEFCDAB8967452301UL);
+    ASSERT_EQUAL(__RV_ORCB(0x0100002000800000UL), 0xFF0000FF00FF0000UL);
+#endif
+    ASSERT_EQUAL(__RV_ORCB(0), 0);
+    ASSERT_EQUAL(__REV(0x12345678), 0x78563412);
+    ASSERT_EQUAL(__REV16(0x12345678), 0x34127856);
+}
+
+CTEST(bitmanip, logic_shift)
+{
+    ASSERT_EQUAL(__RV_ANDN(0xFF, 0x0F), 0xF0);
+    ASSERT_EQUAL(__RV_ORN(0, XLEN_ONES - 1), 1);
+    ASSERT_EQUAL(__RV_XNOR(0x5, XLEN_ONES), 0x5);
+    ASSERT_EQUAL(__RV_ROL(XLEN_MSB | 1, 1), 3);
+    ASSERT_EQUAL(__RV_ROR(3, 1), XLEN_MSB | 1);
+    ASSERT_EQUAL(__RV_ROL(5, __RISCV_XLEN), 5);
+    ASSERT_EQUAL(__RV_SH1ADD(3, 1), 7);
+    ASSERT_EQUAL(__RV_SH2ADD(3, 1), 13);
+    ASSERT_EQUAL(__RV_SH3ADD(3, 1), 25);
+}
+
+CTEST(bitmanip, single_bit)
+{
+    ASSERT_EQUAL(__RV_BSET(0, 5), 0x20);
+    ASSERT_EQUAL(__RV_BSET(0, __RISCV_XLEN + 1), 0x2);
+    ASSERT_EQUAL(__RV_BCLR(0xFF, 0), 0xFE);
+    ASSERT_EQUAL(__RV_BINV(0x10, 4), 0);
+    ASSERT_EQUAL(__RV_BEXT(0x10, 4), 1);
+    ASSERT_EQUAL(__RV_BEXT(0x10, 3), 0);
+}
+
+CTEST(bitmanip, string)
+{
+    char buf[40];
+    int i, j;
+
+    /* every alignment and length, with word scanning strlen and memchr */
+    for (i = 0; i < 8; i ++) {
+        for (j = 0; j < 24; j ++) {
+            memset(buf, 'a', sizeof(buf));
+            buf[i + j] = '\0';
+            if (j > 0) {
+                buf[i + j / 2] = 'x';
+            }
+            ASSERT_EQUAL(strlen(buf + i), j);
+            ASSERT_TRUE(memchr(buf + i, 'x', j + 1) == (j > 0 ? (void *)(buf + i + j / 2) : NULL));
+            ASSERT_TRUE(memchr(buf + i, 'y', j + 1) == NULL);
+            ASSERT_TRUE(memchr(buf + i, 'a' + 256, j + 1) == (j > 1 ? (void *)(buf + i) : NULL));
+        }
+    }
+}
@@ -0,0 +1,263 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "ctest.h"
+#include "nuclei_sdk_soc.h"
+
+#if defined(__DSP_PRESENT) && (__DSP_PRESENT == 1)
+
+/*
+ * Known answer tests, they are run on both the DSP instructions and the
+ * C emulation(core_feature_dsp_emu.h) when compiled without P extension,
+ * only the lower 32 bits are checked, so they are the same for RV32 and RV64
+ */
+#define LOW32(x)        ((uint32_t)(x))
+
+CTEST(dsp, simd_add_sub)
+{
+    ASSERT_EQUAL(LOW32(__RV_ADD8(0x01FF7F80, 0x01010101)), 0x02008081);
+    ASSERT_EQUAL(LOW32(__RV_SUB16(0x00010000, 0x00020001)), 0xFFFFFFFF);
+    ASSERT_EQUAL(LOW32(__RV_RADD8(0x7F7F8080, 0x7F018081)), 0x7F408080);
+    ASSERT_EQUAL(LOW32(__RV_URSUB16(0x00010004, 0x00030002)), 0xFFFF0001);
+    ASSERT_EQUAL(LOW32(__RV_CRAS16(0x00050003, 0x00020001)), 0x00060001);
+    ASSERT_EQUAL(LOW32(__RV_SMAX8(0x80017F00, 0x7F0280FF)), 0x7F027F00);
+    ASSERT_EQUAL(LOW32(__RV_UCMPLT8(0x80017F00, 0x7F0280FF)), 0x00FFFFFF);
+    ASSERT_EQUAL(__RV_AVE(3, 4), 4);
+    ASSERT_EQUAL(__RV_AVE(-3, -4), -3);
+}
+
+CTEST(dsp, saturation_ov)
+{
+    __RV_CLROV();
+    ASSERT_EQUAL(LOW32(__RV_KADD8(0x01010101, 0x01010101)), 0x02020202);
+    ASSERT_EQUAL(__RV_RDOV(), 0);
+    ASSERT_EQUAL(LOW32(__RV_KADD8(0x7F80, 0x01FF)), 0x7F80);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(__RV_RDOV(), 0);
+    ASSERT_EQUAL(LOW32(__RV_UKSUB16(0x00010005, 0x00020003)), 0x00000002);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(LOW32(__RV_KHM16(0x80004000, 0x80004000)), 0x7FFF2000);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(LOW32(__RV_KMDA(0x80008000, 0x80008000)), 0x7FFFFFFF);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(__RV_KADD64(0x7FFFFFFFFFFFFFFFLL, 1), 0x7FFFFFFFFFFFFFFFLL);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(__RV_UKSUB64(1, 2), 0);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(LOW32(__RV_SCLIP8(0x00007F80, 3)), 0x000007F8);
+    ASSERT_EQUAL(LOW32(__RV_UCLIP16(0xFFFF0123, 8)), 0x000000FF);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+}
+
+CTEST(dsp, shift_round)
+{
+    ASSERT_EQUAL(LOW32(__RV_SRA8(0x87, 2)), 0xE1);
+    ASSERT_EQUAL(LOW32(__RV_SRA8_U(0x87, 2)), 0xE2);
+    ASSERT_EQUAL(LOW32(__RV_SRAI8_U(0x87, 2)), 0xE2);
+    ASSERT_EQUAL(LOW32(__RV_SRL16_U(0x00030003, 1)), 0x00020002);
+    ASSERT_EQUAL(LOW32(__RV_KSLRA16(0x0000FFF0, -4)), 0x0000FFFF);
+    __RV_CLROV();
+    ASSERT_EQUAL(LOW32(__RV_KSLRA16(0x00004000, 1)), 0x00007FFF);
+    ASSERT_EQUAL(__RV_RDOV(), 1);
+    __RV_CLROV();
+    ASSERT_EQUAL(__RV_SRA_U(-5, 1), -2);
+}
+
+CTEST(dsp, multiply)
+{
+    ASSERT_EQUAL(__RV_SMMUL(0x00010000, 0x00008000), 0);
+    ASSERT_EQUAL(__RV_SMMUL_U(0x00010000, 0x00008000), 1);
+    ASSERT_EQUAL(__RV_KWMMUL(0x40000000, 0x40000000), 0x20000000);
+    ASSERT_EQUAL(__RV_SMAQA(10, 0x01020304, 0x01FF0102), 20);
+    ASSERT_EQUAL(__RV_SMAL(10, 0x0002FFFD), 4);
+    ASSERT_EQUAL(LOW32(__RV_SMBT16(0x0000FFFE, 0x00030000)), 0xFFFFFFFA);
+    ASSERT_EQUAL(__RV_MULSR64(-2, 3), -6);
+    ASSERT_EQUAL(__RV_MULR64(0xFFFFFFFF, 2), 0x1FFFFFFFEULL);
+    ASSERT_EQUAL(__RV_SMUL16(0xFFFF0002, 0x00030004), 0xFFFFFFFD00000008ULL);
+}
+
+CTEST(dsp, misc)
+{
+    ASSERT_EQUAL(LOW32(__RV_CLRS8(0x00FF0010)), 0x07070702);
+    ASSERT_EQUAL(LOW32(__RV_CLZ16(0x00010000)), 0x000F0010);
+    ASSERT_EQUAL(__RV_BITREV(0x1, 7), 0x80);
+    ASSERT_EQUAL(LOW32(__RV_INSB(0x11223344, 0xAB, 2)), 0x11AB3344);
+    ASSERT_EQUAL(LOW32(__RV_PKBT16(0x11112222, 0x33334444)), 0x22223333);
+    ASSERT_EQUAL(LOW32(__RV_SUNPKD810(0x0000807F)), 0xFF80007F);
+    ASSERT_EQUAL(LOW32(__RV_SWAP8(0x11223344)), 0x22114433);
+    ASSERT_EQUAL(__RV_WEXT(0x123456789ABCDEF0LL, 8), 0x789ABCDE);
+}
+
+#if defined(__riscv_dsp) && defined(DSP_EMU_DIFF_TEST)
+/*
+ * Differential test of DSP instructions against C emulation, both are called
+ * with the same edge values and pseudo random values, results and OV flag
+ * must be the same. Large code is generated for this test, so it is enabled
+ * by make DSP_EMU_DIFF=1, and DOWNLOAD=ddr is needed when it can't fit into ILM.
+ */
+#include "core_feature_dsp_emu.h"
+
+#define DSP_DIFF_LOOPS          400
+
+#define DSP_UNARY_FUNCS(X)                                                                      \
+    X(CLRS8) X(CLRS16) X(CLRS32) X(CLO8) X(CLO16) X(CLO32) X(CLZ8) X(CLZ16) X(CLZ32) X(KABS8)  \
+    X(KABS16) X(KABSW) X(SUNPKD810) X(SUNPKD820) X(SUNPKD830) X(SUNPKD831) X(SUNPKD832) X(SWAP8) \
+    X(SWAP16) X(ZUNPKD810) X(ZUNPKD820) X(ZUNPKD830) X(ZUNPKD831) X(ZUNPKD832)
+
+#define DSP_BINARY_FUNCS(X)                                                                     \
+    X(ADD8) X(ADD16) X(ADD64) X(AVE) X(BITREV) X(CMPEQ8) X(CMPEQ16) X(CRAS16) X(CRSA16) X(KADD8) \
+    X(KADD16) X(KADD64) X(KADDH) X(KADDW) X(KCRAS16) X(KCRSA16) X(KDMBB) X(KDMBT) X(KDMTT)      \
+    X(KHM8) X(KHMX8) X(KHM16) X(KHMX16) X(KHMBB) X(KHMBT) X(KHMTT) X(KMDA) X(KMXDA) X(KMMWB2)    \
+    X(KMMWB2_U) X(KMMWT2) X(KMMWT2_U) X(KSLLW) X(KSLL8) X(KSLL16) X(KSLRA8) X(KSLRA8_U)          \
+    X(KSLRA16) X(KSLRA16_U) X(KSLRAW) X(KSLRAW_U) X(KSTAS16) X(KSTSA16) X(KSUB8) X(KSUB16)      \
+    X(KSUB64) X(KSUBH) X(KSUBW) X(KWMMUL) X(KWMMUL_U) X(MAXW) X(MINW) X(MULR64) X(MULSR64)      \
+    X(PBSAD) X(PKBB16) X(PKBT16) X(PKTT16) X(PKTB16) X(RADD8) X(RADD16) X(RADD64) X(RADDW)      \
+    X(RCRAS16) X(RCRSA16) X(RSTAS16) X(RSTSA16) X(RSUB8) X(RSUB16) X(RSUB64) X(RSUBW) X(SCMPLE8) \
+    X(SCMPLE16) X(SCMPLT8) X(SCMPLT16) X(SLL8) X(SLL16) X(SMAL) X(SMAX8) X(SMAX16) X(SMBB16)    \
+    X(SMBT16) X(SMTT16) X(SMDS) X(SMDRS) X(SMXDS) X(SMIN8) X(SMIN16) X(SMMUL) X(SMMUL_U)        \
+    X(SMMWB) X(SMMWB_U) X(SMMWT) X(SMMWT_U) X(SMUL8) X(SMULX8) X(SMUL16) X(SMULX16) X(SRA_U)    \
+    X(SRA8) X(SRA8_U) X(SRA16) X(SRA16_U) X(SRL8) X(SRL8_U) X(SRL16) X(SRL16_U) X(STAS16)       \
+    X(STSA16) X(SUB8) X(SUB16) X(SUB64) X(UCMPLE8) X(UCMPLE16) X(UCMPLT8) X(UCMPLT16) X(UKADD8) \
+    X(UKADD16) X(UKADD64) X(UKADDH) X(UKADDW) X(UKCRAS16) X(UKCRSA16) X(UKSTAS16) X(UKSTSA16)   \
+    X(UKSUB8) X(UKSUB16) X(UKSUB64) X(UKSUBH) X(UKSUBW) X(UMAX8) X(UMAX16) X(UMIN8) X(UMIN16)   \
+    X(UMUL8) X(UMULX8) X(UMUL16) X(UMULX16) X(URADD8) X(URADD16) X(URADD64) X(URADDW)           \
+    X(URCRAS16) X(URCRSA16) X(URSTAS16) X(URSTSA16) X(URSUB8) X(URSUB16) X(URSUB64) X(URSUBW)   \
+    X(WEXT)
+
+#define DSP_TERNARY_FUNCS(X)                                                                    \
+    X(BPICK) X(KDMABB) X(KDMABT) X(KDMATT) X(KMABB) X(KMABT) X(KMATT) X(KMADA) X(KMAXDA)        \
+    X(KMADS) X(KMADRS) X(KMAXDS) X(KMAR64) X(KMMAC) X(KMMAC_U) X(KMMAWB) X(KMMAWB_U) X(KMMAWB2) \
+    X(KMMAWB2_U) X(KMMAWT) X(KMMAWT_U) X(KMMAWT2) X(KMMAWT2_U) X(KMMSB) X(KMMSB_U) X(KMSDA)     \
+    X(KMSXDA) X(KMSR64) X(MADDR32) X(MSUBR32) X(PBSADA) X(SMALBB) X(SMALBT) X(SMALTT) X(SMALDA) \
+    X(SMALXDA) X(SMALDS) X(SMALDRS) X(SMALXDS) X(SMAR64) X(SMAQA) X(SMAQA_SU) X(SMSLDA)         \
+    X(SMSLXDA) X(SMSR64) X(UKMAR64) X(UKMSR64) X(UMAR64) X(UMAQA) X(UMSR64)
+
+/* Instructions with immediate operand, checked with a fixed immediate */
+#define DSP_IMM_FUNCS(X)                                                                        \
+    X(BITREVI, 7) X(KSLLIW, 5) X(KSLLI8, 3) X(KSLLI16, 9) X(SCLIP8, 3) X(SCLIP16, 11)           \
+    X(SCLIP32, 17) X(SLLI8, 5) X(SLLI16, 12) X(SRAI_U, 5) X(SRAI8, 3) X(SRAI8_U, 3) X(SRAI16, 7) \
+    X(SRAI16_U, 7) X(SRLI8, 2) X(SRLI8_U, 2) X(SRLI16, 9) X(SRLI16_U, 9) X(UCLIP8, 5)           \
+    X(UCLIP16, 10) X(UCLIP32, 20) X(WEXTI, 9)
+
+#if __RISCV_XLEN == 64
+#define DSP_XLEN_UNARY_FUNCS(X)     X(KABS32)
+#define DSP_XLEN_BINARY_FUNCS(X)                                                                \
+    X(ADD32) X(CRAS32) X(CRSA32) X(KADD32) X(KCRAS32) X(KCRSA32) X(KDMBB16) X(KDMBT16)          \
+    X(KDMTT16) X(KHMBB16) X(KHMBT16) X(KHMTT16) X(KMDA32) X(KMXDA32) X(KSLL32) X(KSLRA32)       \
+    X(KSLRA32_U) X(KSTAS32) X(KSTSA32) X(KSUB32) X(PKBB32) X(PKBT32) X(PKTT32) X(PKTB32)        \
+    X(RADD32) X(RCRAS32) X(RCRSA32) X(RSTAS32) X(RSTSA32) X(RSUB32) X(SLL32) X(SMAX32) X(SMBB32) \
+    X(SMBT32) X(SMTT32) X(SMDS32) X(SMDRS32) X(SMXDS32) X(SMIN32) X(SRA32) X(SRA32_U) X(SRL32)  \
+    X(SRL32_U) X(STAS32) X(STSA32) X(SUB32) X(UKADD32) X(UKCRAS32) X(UKCRSA32) X(UKSTAS32)      \
+    X(UKSTSA32) X(UKSUB32) X(UMAX32) X(UMIN32) X(URADD32) X(URCRAS32) X(URCRSA32) X(URSTAS32)   \
+    X(URSTSA32) X(URSUB32)
+#define DSP_XLEN_TERNARY_FUNCS(X)                                                               \
+    X(KDMABB16) X(KDMABT16) X(KDMATT16) X(KMABB32) X(KMABT32) X(KMATT32) X(KMADA32) X(KMAXDA32) \
+    X(KMADS32) X(KMADRS32) X(KMAXDS32) X(KMSDA32) X(KMSXDA32)
+#else
+#define DSP_XLEN_UNARY_FUNCS(X)     X(DKABS8) X(DKABS16) X(EXPD80) X(EXPD81) X(EXPD82) X(EXPD83)
+#define DSP_XLEN_BINARY_FUNCS(X)                                                                \
+    X(DKHM8) X(DKHM16) X(DKSLRA8) X(DKSLRA16) X(DKADD8) X(DKADD16) X(DKSUB8) X(DKSUB16)
+#define DSP_XLEN_TERNARY_FUNCS(X)
+#endif
+
+static const unsigned long long dsp_edges[] = {
+    0, 1, 0xFFFFFFFFFFFFFFFFULL, 0x7F7F7F7F7F7F7F7FULL, 0x8080808080808080ULL,
+    0x7FFF7FFF7FFF7FFFULL, 0x8000800080008000ULL, 0x7FFFFFFF7FFFFFFFULL,
+    0x8000000080000000ULL, 0x7FFFFFFFFFFFFFFFULL, 0x8000000000000000ULL, 0x00FF00FF00FF00FFULL
+};
+#define DSP_EDGE_CNT            (sizeof(dsp_edges) / sizeof(dsp_edges[0]))
+
+/* No initialized data here, it would break the test discovery of ctest */
+static unsigned long long dsp_seed;
+
+/*
+ * Return k-th operand of i-th loop, all combinations of edge values are used
+ * first, then the same pseudo random sequence is used for each function
+ */
+static unsigned long long dsp_input(unsigned int i, unsigned int k)
+{
+    if (i < DSP_EDGE_CNT * DSP_EDGE_CNT) {
+        dsp_seed = 0x2545F4914F6CDD1DULL;
+        if (k == 0) {
+            return dsp_edges[i % DSP_EDGE_CNT];
+        } else if (k == 1) {
+            return dsp_edges[i / DSP_EDGE_CNT];
+        }
+        return dsp_edges[(i * 7) % DSP_EDGE_CNT];
+    }
+    dsp_seed ^= dsp_seed << 13;
+    dsp_seed ^= dsp_seed >> 7;
+    dsp_seed ^= dsp_seed << 17;
+    return dsp_seed;
+}
+
+#define DSP_DIFF(name, call)                                                                    \
+    for (i = 0; i < DSP_DIFF_LOOPS; i++) {                                                      \
+        unsigned long long a = dsp_input(i, 0), b = dsp_input(i, 1), c = dsp_input(i, 2);      \
+        unsigned long long res, emu_res;                                                        \
+        unsigned long ov, emu_ov;                                                               \
+        (void)a; (void)b; (void)c;                                                              \
+        __RV_CLROV();                                                                           \
+        res = (unsigned long long)__RV_##call;                                                  \
+        ov = __RV_RDOV();                                                                       \
+        __RV_EMU_CLROV();                                                                       \
+        emu_res = (unsigned long long)__RV_EMU_##call;                                          \
+        emu_ov = __RV_EMU_RDOV();                                                               \
+        if ((res != emu_res) || (ov != emu_ov)) {                                               \
+            CTEST_LOG("%s a=0x%lx b=0x%lx c=0x%lx: 0x%lx ov %lu, emulated 0x%lx ov %lu", #name, \
+                      (unsigned long)a, (unsigned long)b, (unsigned long)c, (unsigned long)res, ov, \
+                      (unsigned long)emu_res, emu_ov);                                          \
+            errs++;                                                                             \
+            break;                                                                              \
+        }                                                                                       \
+    }
+
+#define DSP_DIFF_UNARY(name)        DSP_DIFF(name, name(a))
+#define DSP_DIFF_BINARY(name)       DSP_DIFF(name, name(a, b))
+#define DSP_DIFF_TERNARY(name)      DSP_DIFF(name, name(a, b, c))
+#define DSP_DIFF_IMM(name, imm)     DSP_DIFF(name, name(a, imm))
+
+CTEST(dsp_emu, unary)
+{
+    unsigned int i, errs = 0;
+
+    DSP_UNARY_FUNCS(DSP_DIFF_UNARY)
+    DSP_XLEN_UNARY_FUNCS(DSP_DIFF_UNARY)
+    ASSERT_EQUAL(errs, 0);
+}
+
+CTEST(dsp_emu, binary)
+{
+    unsigned int i, errs = 0;
+
+    DSP_BINARY_FUNCS(DSP_DIFF_BINARY)
+    DSP_XLEN_BINARY_FUNCS(DSP_DIFF_BINARY)
+    ASSERT_EQUAL(errs, 0);
+}
+
+CTEST(dsp_emu, ternary)
+{
+    unsigned int i, errs = 0;
+
+    DSP_TERNARY_FUNCS(DSP_DIFF_TERNARY)
+    DSP_XLEN_TERNARY_FUNCS(DSP_DIFF_TERNARY)
+    DSP_DIFF(INSB, INSB(a, b, 1))
+    ASSERT_EQUAL(errs, 0);
+}
+
+CTEST(dsp_emu, immediate)
+{
+    unsigned int i, errs = 0;
+
+    DSP_IMM_FUNCS(DSP_DIFF_IMM)
+    ASSERT_EQUAL(errs, 0);
+}
+#endif /* __riscv_dsp && DSP_EMU_DIFF_TEST */
+
+#endif /* __DSP_PRESENT */
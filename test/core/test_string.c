@@ -0,0 +1,152 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "ctest.h"
+#include "nuclei_sdk_soc.h"
+
+/*
+ * Fuzz tests of memcpy, memset, memcmp and strlen, they are run on the
+ * vector version in demosoc_string.c when V extension is enabled and
+ * VECTOR_STRING=1 is passed to make, otherwise on the C library ones. Each case checks the result with
+ * byte compare, and the guard bytes around the buffer must be unchanged.
+ */
+#define STR_BUF_SIZE        600
+#define STR_GUARD           16
+#define STR_MAX_ALIGN       8
+#define STR_GUARD_BYTE      0xA5
+
+static unsigned char str_src[STR_BUF_SIZE];
+static unsigned char str_dst[STR_BUF_SIZE];
+
+/* Lengths around small size threshold and several vector lengths */
+static const unsigned short str_lens[] = {
+    0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 32, 33, 63, 64, 65, 127, 128, 129,
+    255, 256, 257, 511, 512, 513, STR_BUF_SIZE - 2 * STR_GUARD - STR_MAX_ALIGN
+};
+
+#define STR_LENS            (sizeof(str_lens) / sizeof(str_lens[0]))
+
+static unsigned long str_rand(unsigned long *seed)
+{
+    *seed = *seed * 1103515245UL + 12345UL;
+    return (*seed >> 16) & 0x7FFF;
+}
+
+static void str_fill(unsigned char *buf, unsigned long seed)
+{
+    unsigned int i;
+
+    for (i = 0; i < STR_BUF_SIZE; i ++) {
+        /* no zero byte, so strlen only stops at the terminator */
+        buf[i] = (unsigned char)(str_rand(&seed) % 255 + 1);
+    }
+}
+
+static int str_guard_ok(const unsigned char *buf, unsigned int start, unsigned int len)
+{
+    unsigned int i;
+
+    for (i = 0; i < start; i ++) {
+        if (buf[i] != STR_GUARD_BYTE) {
+            return 0;
+        }
+    }
+    for (i = start + len; i < STR_BUF_SIZE; i ++) {
+        if (buf[i] != STR_GUARD_BYTE) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void str_guard_fill(unsigned char *buf)
+{
+    unsigned int i;
+
+    for (i = 0; i < STR_BUF_SIZE; i ++) {
+        buf[i] = STR_GUARD_BYTE;
+    }
+}
+
+CTEST(string, memcpy)
+{
+    unsigned int i, j, k, doff, soff, len;
+
+    str_fill(str_src, 1);
+    for (i = 0; i < STR_LENS; i ++) {
+        len = str_lens[i];
+        for (j = 0; j < STR_MAX_ALIGN; j ++) {
+            for (k = 0; k < STR_MAX_ALIGN; k ++) {
+                doff = STR_GUARD + j;
+                soff = STR_GUARD + k;
+                str_guard_fill(str_dst);
+                ASSERT_TRUE(memcpy(str_dst + doff, str_src + soff, len) == str_dst + doff);
+                ASSERT_TRUE(str_guard_ok(str_dst, doff, len));
+                ASSERT_EQUAL(memcmp(str_dst + doff, str_src + soff, len), 0);
+            }
+        }
+    }
+}
+
+CTEST(string, memset)
+{
+    unsigned int i, j, k, off, len;
+    int c;
+
+    for (i = 0; i < STR_LENS; i ++) {
+        len = str_lens[i];
+        for (j = 0; j < STR_MAX_ALIGN; j ++) {
+            off = STR_GUARD + j;
+            c = 0x100 + i + j;
+            str_guard_fill(str_dst);
+            ASSERT_TRUE(memset(str_dst + off, c, len) == str_dst + off);
+            ASSERT_TRUE(str_guard_ok(str_dst, off, len));
+            for (k = 0; k < len; k ++) {
+                ASSERT_EQUAL(str_dst[off + k], (unsigned char)c);
+            }
+        }
+    }
+}
+
+CTEST(string, memcmp)
+{
+    unsigned int i, j, pos, len;
+    unsigned long seed = 7;
+    int ret;
+
+    str_fill(str_src, 2);
+    for (i = 0; i < STR_LENS; i ++) {
+        len = str_lens[i];
+        for (j = 0; j < STR_MAX_ALIGN; j ++) {
+            memcpy(str_dst + STR_GUARD + j, str_src + STR_GUARD, len);
+            ASSERT_EQUAL(memcmp(str_dst + STR_GUARD + j, str_src + STR_GUARD, len), 0);
+            if (len == 0) {
+                continue;
+            }
+            /* make one byte different, sign of result follows the unsigned byte compare */
+            pos = str_rand(&seed) % len;
+            str_dst[STR_GUARD + j + pos] = (unsigned char)(str_src[STR_GUARD + pos] ^ 0x80);
+            ret = memcmp(str_dst + STR_GUARD + j, str_src + STR_GUARD, len);
+            if (str_dst[STR_GUARD + j + pos] > str_src[STR_GUARD + pos]) {
+                ASSERT_TRUE(ret > 0);
+            } else {
+                ASSERT_TRUE(ret < 0);
+            }
+            ASSERT_EQUAL(memcmp(str_dst + STR_GUARD + j, str_src + STR_GUARD, pos), 0);
+        }
+    }
+}
+
+CTEST(string, strlen)
+{
+    unsigned int i, j, len;
+
+    for (i = 0; i < STR_LENS; i ++) {
+        len = str_lens[i];
+        for (j = 0; j < STR_MAX_ALIGN; j ++) {
+            str_fill(str_src, i + j);
+            str_src[STR_GUARD + j + len] = '\0';
+            ASSERT_EQUAL(strlen((const char *)(str_src + STR_GUARD + j)), len);
+        }
+    }
+}
@@ -0,0 +1,213 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import struct
+import argparse
+
+from prof2flame import ElfSymbols, generate_flamegraph
+
+# Must match Components/funcprof/include/nuclei_funcprof.h
+NFPROF_MAGIC = 0x434E464E
+NFPROF_HEADER_FMT = "<IHHIIIIII"
+NFPROF_RECORD_FMT = "<II"
+NFPROF_EXIT = 0x1
+
+# name of call graph root, calls of it are not profiled
+ROOT_NAME = "<root>"
+
+def load_funcprof_data(proffile):
+    """ Load raw function profiler buffer from gdb binary dump or from serial log dumped by NFPROF_Dump """
+    with open(proffile, "rb") as pf:
+        data = pf.read()
+    if len(data) >= 4 and struct.unpack_from("<I", data)[0] == NFPROF_MAGIC:
+        return data
+    # Parse serial log, only the last complete dump is used
+    hexdata = None
+    dumpdata = None
+    for line in data.decode("utf-8", errors="ignore").splitlines():
+        pos = line.find("NFPROF:")
+        if pos < 0:
+            continue
+        content = line[pos + len("NFPROF:"):].strip()
+        if content.startswith("BEGIN"):
+            hexdata = []
+        elif content.startswith("END"):
+            if hexdata is not None:
+                dumpdata = bytes.fromhex("".join(hexdata))
+            hexdata = None
+        elif hexdata is not None:
+            hexdata.append(content)
+    return dumpdata
+
+def parse_funcprof_data(data):
+    """ Parse function profiler buffer into header and records in time order, each record is (func, time) """
+    hdrsize = struct.calcsize(NFPROF_HEADER_FMT)
+    if data is None or len(data) < hdrsize:
+        return None, None
+    magic, version, record_size, buf_size, freq, hart, _, index, _ = \
+        struct.unpack_from(NFPROF_HEADER_FMT, data)
+    if magic != NFPROF_MAGIC or record_size != struct.calcsize(NFPROF_RECORD_FMT) or buf_size == 0:
+        return None, None
+    header = {"version": version, "buf_size": buf_size, "freq": freq, "hart": hart, \
+        "index": index, "dropped": max(index - buf_size, 0)}
+    count = min(index, buf_size, (len(data) - hdrsize) // record_size)
+    # oldest record is at index when the ring buffer is full
+    start = index % buf_size if index > buf_size else 0
+    records = []
+    for i in range(count):
+        offset = hdrsize + ((start + i) % buf_size) * record_size
+        records.append(struct.unpack_from(NFPROF_RECORD_FMT, data, offset))
+    return header, records
+
+class FuncStat(object):
+    def __init__(self):
+        self.calls = 0
+        self.self_cycles = 0
+        self.total_cycles = 0
+
+def analyze_records(records, symbols):
+    """
+    Return (stats, edges, folded, total) computed from records
+    stats: {function: FuncStat}, edges: {(caller, callee): [calls, cycles]},
+    folded: {"main;foo;bar": self cycles}, total: cycles of all profiled calls
+    """
+    stats = dict()
+    edges = dict()
+    folded = dict()
+    # each context has its own call stack and clock, clock only counts cycles of this context
+    stacks = dict()
+    clocks = dict()
+    context = None
+    last_time = None
+    total = 0
+
+    def funcname(addr):
+        name = symbols.lookup(addr)
+        return name if name else "0x%x" % (addr)
+
+    def close_frame(stack, clock):
+        name, start, child = stack.pop()
+        cycles = clock - start
+        stat = stats.setdefault(name, FuncStat())
+        stat.self_cycles += cycles - child
+        # recursive calls are only counted once in total
+        if name not in [frame[0] for frame in stack]:
+            stat.total_cycles += cycles
+        caller = stack[-1][0] if stack else ROOT_NAME
+        edges.setdefault((caller, name), [0, 0])[1] += cycles
+        path = ";".join([frame[0] for frame in stack] + [name])
+        folded[path] = folded.get(path, 0) + cycles - child
+        if stack:
+            stack[-1][2] += cycles
+
+    for func, time in records:
+        if func == 0:
+            # time between records of different contexts is not counted,
+            # since the time of switch is unknown
+            context = time
+            last_time = None
+            continue
+        stack = stacks.setdefault(context, [])
+        if last_time is not None:
+            delta = (time - last_time) & 0xFFFFFFFF
+            clocks[context] = clocks.get(context, 0) + delta
+            total += delta
+        last_time = time
+        clock = clocks.get(context, 0)
+        name = funcname(func & ~NFPROF_EXIT)
+        if (func & NFPROF_EXIT) == 0:
+            caller = stack[-1][0] if stack else ROOT_NAME
+            stats.setdefault(name, FuncStat()).calls += 1
+            edges.setdefault((caller, name), [0, 0])[0] += 1
+            stack.append([name, clock, 0])
+            continue
+        names = [frame[0] for frame in stack]
+        if name not in names:
+            # entered before the oldest record in ring buffer
+            continue
+        # functions without exit record, such as left by longjmp, are closed too
+        while stack[-1][0] != name:
+            close_frame(stack, clock)
+        close_frame(stack, clock)
+    # functions still running when dumped, such as main
+    for context, stack in stacks.items():
+        while stack:
+            close_frame(stack, clocks.get(context, 0))
+    return stats, edges, folded, total
+
+def generate_dot(edges, stats, total):
+    """ Return call graph in graphviz dot format """
+    lines = ["digraph funcprof {", "    node [shape=box];"]
+    for name in sorted(stats):
+        stat = stats[name]
+        lines.append('    "%s" [label="%s\\ntotal %.2f%%\\nself %.2f%%"];' % (name, name, \
+            stat.total_cycles * 100.0 / max(total, 1), stat.self_cycles * 100.0 / max(total, 1)))
+    for (caller, callee), (calls, cycles) in sorted(edges.items()):
+        if caller == ROOT_NAME:
+            continue
+        lines.append('    "%s" -> "%s" [label="%d calls\\n%d cycles"];' % (caller, callee, calls, cycles))
+    lines.append("}")
+    return "\n".join(lines) + "\n"
+
+def funcprof_report(elffile, proffile, svgfile=None, foldedfile=None, dotfile=None, top=20):
+    data = load_funcprof_data(proffile)
+    header, records = parse_funcprof_data(data)
+    if header is None:
+        print("No valid function profiler data found in %s" % (proffile))
+        return False
+    symbols = ElfSymbols(elffile)
+    stats, edges, folded, total = analyze_records(records, symbols)
+    freq = "%d Hz" % (header["freq"]) if header["freq"] else "unknown"
+    print("Function profiler records: %d, dropped: %d, hart: %d, cycle frequency: %s, profiled cycles: %d" \
+        % (len(records), header["dropped"], header["hart"], freq, total))
+    if header["dropped"] > 0:
+        print("Oldest records are overwritten, increase NFPROF_BUF_SIZE to keep all calls")
+    print("Flat profile:")
+    print("%8s %12s %8s %12s %8s %12s %12s  %s" % ("Calls", "Self", "Self(%)", "Total", "Total(%)", \
+        "Self/Call", "Total/Call", "Function"))
+    flat = sorted(stats.items(), key=lambda item: (-item[1].self_cycles, -item[1].total_cycles, item[0]))
+    for name, stat in flat[:top]:
+        calls = max(stat.calls, 1)
+        print("%8d %12d %8.2f %12d %8.2f %12d %12d  %s" % (stat.calls, stat.self_cycles, \
+            stat.self_cycles * 100.0 / max(total, 1), stat.total_cycles, stat.total_cycles * 100.0 / max(total, 1), \
+            stat.self_cycles // calls, stat.total_cycles // calls, name))
+    print("Call graph:")
+    print("%8s %12s  %s" % ("Calls", "Total", "Caller -> Callee"))
+    graph = sorted(edges.items(), key=lambda item: (-item[1][1], item[0]))
+    for (caller, callee), (calls, cycles) in graph[:top]:
+        print("%8d %12d  %s -> %s" % (calls, cycles, caller, callee))
+    if foldedfile:
+        with open(foldedfile, "w") as ff:
+            for stack in sorted(folded):
+                ff.write("%s %d\n" % (stack, folded[stack]))
+        print("Folded stacks are saved to %s" % (foldedfile))
+    if dotfile:
+        with open(dotfile, "w") as df:
+            df.write(generate_dot(edges, stats, total))
+        print("Call graph is saved to %s" % (dotfile))
+    if svgfile:
+        with open(svgfile, "w") as sf:
+            sf.write(generate_flamegraph(folded, "%s, %d cycles" % (os.path.basename(elffile), total)))
+        print("Flame graph is saved to %s" % (svgfile))
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Compute cycles of each function and call graph from Nuclei function profiler records")
+    parser.add_argument('elf', help="ELF file of the profiled application")
+    parser.add_argument('prof', help="serial log containing NFPROF_Dump output, or binary file dumped by gdb from NFPROF_Data")
+    parser.add_argument('-o', '--output', help="output flame graph svg file weighted by cycles")
+    parser.add_argument('-f', '--folded', help="output folded stacks file weighted by cycles")
+    parser.add_argument('-d', '--dot', help="output call graph file in graphviz dot format")
+    parser.add_argument('--top', type=int, default=20, help="number of functions and calls shown in flat profile and call graph")
+
+    args = parser.parse_args()
+
+    for fl in (args.elf, args.prof):
+        if os.path.isfile(fl) == False:
+            print("The file %s doesn't exist, please check!" % (fl))
+            sys.exit(1)
+
+    if funcprof_report(args.elf, args.prof, args.output, args.folded, args.dot, args.top) == False:
+        sys.exit(1)
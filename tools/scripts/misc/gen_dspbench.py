@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+
+import os
+import re
+import sys
+import argparse
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+SDK_ROOT = os.path.realpath(os.path.join(SCRIPT_DIR, "..", "..", ".."))
+DEFAULT_HEADER = os.path.join(SDK_ROOT, "NMSIS", "Core", "Include", "core_feature_dsp.h")
+DEFAULT_OUTPUT = os.path.join(SDK_ROOT, "application", "baremetal", "dspbench", "dspbench_list.h")
+
+FUNC_RE = re.compile(r"^__STATIC_FORCEINLINE\s+(.+?)\s*\b__RV_(\w+)\s*\((.*)\)")
+MACRO_RE = re.compile(r"^#define\s+__RV_(\w+)\((.*)\)")
+ASM_RE = re.compile(r"__ASM\s+volatile\(\"([a-z0-9.]+)")
+# immediate shift instructions, which need a constant, not a register
+IMM_INSN_RE = re.compile(r"^(k?slli|srai|srli)(8|16|32|w)?(\.u)?$")
+
+# These are not computation instructions, ov flag is checked by application directly
+EXCLUDES = ["CLROV", "RDOV"]
+
+# Immediate used to benchmark intrinsic macros, it must be in the range of the instruction
+IMMEDIATES = {
+    "BITREVI": 7, "INSB": 1, "KSLLIW": 5, "KSLLI8": 3, "KSLLI16": 9,
+    "SCLIP8": 3, "SCLIP16": 11, "SCLIP32": 17, "SLLI8": 5, "SLLI16": 12,
+    "SRAI_U": 5, "SRAI8": 3, "SRAI8_U": 3, "SRAI16": 7, "SRAI16_U": 7,
+    "SRLI8": 2, "SRLI8_U": 2, "SRLI16": 9, "SRLI16_U": 9,
+    "UCLIP8": 5, "UCLIP16": 10, "UCLIP32": 20, "WEXTI": 9,
+}
+
+LISTS = ["UNARY", "BINARY", "TERNARY", "IMM", "TERNARY_IMM"]
+
+def param_type(param):
+    """ Get C type of a parameter declaration such as unsigned long a """
+    return " ".join(param.split()[:-1])
+
+def parse_dsp_header(header):
+    """ Collect all __RV_ intrinsics in header, grouped by xlen section and kind """
+    intrinsics = {"all": dict((kind, []) for kind in LISTS),
+                  "64": dict((kind, []) for kind in LISTS),
+                  "32": dict((kind, []) for kind in LISTS)}
+    skipped = []
+    section = "all"
+    with open(header, "r") as hf:
+        lines = hf.readlines()
+    idx = 0
+    while idx < len(lines):
+        line = lines[idx]
+        idx += 1
+        if line.startswith("#if (__RISCV_XLEN == 64)"):
+            section = "64"
+            continue
+        if line.startswith("#if (__RISCV_XLEN == 32)"):
+            section = "32"
+            continue
+        if line.startswith("#endif /* __RISCV_XLEN =="):
+            section = "all"
+            continue
+        match = MACRO_RE.match(line)
+        if match:
+            name, params = match.group(1), [p.strip() for p in match.group(2).split(",")]
+            if name not in IMMEDIATES:
+                skipped.append(name)
+                continue
+            kind = "IMM" if len(params) == 2 else "TERNARY_IMM"
+            intrinsics[section][kind].append((name, IMMEDIATES[name]))
+            continue
+        match = FUNC_RE.match(line)
+        if match is None:
+            continue
+        rettype, name, params = match.group(1), match.group(2), match.group(3).strip()
+        # find the instruction used in function body
+        insn = ""
+        for body in lines[idx:idx + 8]:
+            asmmatch = ASM_RE.search(body)
+            if asmmatch:
+                insn = asmmatch.group(1)
+                break
+        if name in EXCLUDES or params in ("", "void") or IMM_INSN_RE.match(insn):
+            skipped.append(name)
+            continue
+        types = [param_type(p) for p in params.split(",")]
+        if len(types) > 3:
+            skipped.append(name)
+            continue
+        kind = LISTS[len(types) - 1]
+        intrinsics[section][kind].append(tuple([name, rettype] + types))
+    return intrinsics, skipped
+
+def format_list(macro, entries, indent=""):
+    if len(entries) == 0:
+        return "%s#define %s(X)\n" % (indent, macro)
+    items = ["X(%s)" % (", ".join([str(field) for field in entry])) for entry in entries]
+    return "%s#define %s(X) \\\n%s\n" % (indent, macro, " \\\n".join(["    " + item for item in items]))
+
+def gen_dspbench_list(header, output):
+    intrinsics, skipped = parse_dsp_header(header)
+    content = []
+    content.append("/* This file is generated by tools/scripts/misc/gen_dspbench.py, don't edit it */")
+    content.append("#ifndef __DSPBENCH_LIST_H__")
+    content.append("#define __DSPBENCH_LIST_H__")
+    content.append("")
+    content.append("/*")
+    content.append(" * X(name, rettype, type of a...) lists of __RV_ intrinsics in core_feature_dsp.h")
+    content.append(" * X(name, imm) lists of intrinsic macros which need an immediate")
+    content.append(" * Skipped: %s" % (" ".join(skipped)))
+    content.append(" */")
+    for kind in LISTS:
+        content.append(format_list("DSPBENCH_%s_FUNCS" % (kind), intrinsics["all"][kind]))
+    content.append("#if __RISCV_XLEN == 64")
+    for kind in LISTS:
+        content.append(format_list("DSPBENCH_XLEN_%s_FUNCS" % (kind), intrinsics["64"][kind]))
+    content.append("#else")
+    for kind in LISTS:
+        content.append(format_list("DSPBENCH_XLEN_%s_FUNCS" % (kind), intrinsics["32"][kind]))
+    content.append("#endif")
+    content.append("")
+    content.append("#endif /* __DSPBENCH_LIST_H__ */")
+    with open(output, "w") as of:
+        of.write("\n".join(content) + "\n")
+    total = sum([len(intrinsics[sec][kind]) for sec in intrinsics for kind in LISTS])
+    print("Generate %s with %d intrinsics, %d skipped" % (output, total, len(skipped)))
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Generate intrinsic lists of dspbench application from core_feature_dsp.h")
+    parser.add_argument('--header', default=DEFAULT_HEADER, help="path of core_feature_dsp.h")
+    parser.add_argument('-o', '--output', default=DEFAULT_OUTPUT, help="output list header file")
+
+    args = parser.parse_args()
+
+    if os.path.isfile(args.header) == False:
+        print("The file %s doesn't exist, please check!" % (args.header))
+        sys.exit(1)
+
+    if gen_dspbench_list(args.header, args.output) == False:
+        sys.exit(1)
@@ -0,0 +1,372 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import math
+import random
+import argparse
+
+import nn_arena_planner
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+SDK_ROOT = os.path.realpath(os.path.join(SCRIPT_DIR, "..", "..", ".."))
+DEFAULT_OUTPUT = os.path.join(SDK_ROOT, "application", "baremetal", "nnbench", "nnbench_model.h")
+DEFAULT_ARENA = os.path.join(SDK_ROOT, "application", "baremetal", "nnbench", "nnbench_arena.h")
+
+# DS-CNN keyword spotting model, input is 49 frames x 10 MFCC features
+INPUT_SHAPE = (49, 10, 1)
+NUM_CLASSES = 12
+# real value of one logit step, used by softmax
+LOGIT_SCALE = 1.0 / 16
+# activations after relu use zero point -128, and are mapped to [-128, ACT_TARGET - 128]
+ACT_TARGET = 220
+LOGIT_TARGET = 100
+SOFTMAX_INT_BITS = 5
+
+def quantize_multiplier(real):
+    """ Convert real multiplier to Q31 multiplier and shift as tflite QuantizeMultiplier """
+    if real == 0:
+        return 0, 0
+    mant, shift = math.frexp(real)
+    mult = int(round(mant * (1 << 31)))
+    if mult == (1 << 31):
+        mult //= 2
+        shift += 1
+    if shift < -31:
+        return 0, 0
+    return mult, shift
+
+def rounding_div_pow2(val, exp):
+    """ riscv_nn_divide_by_power_of_two, mid point rounded away from zero """
+    if exp == 0:
+        return val
+    mask = (1 << exp) - 1
+    rem = val & mask
+    res = val >> exp
+    threshold = (mask >> 1) + (1 if res < 0 else 0)
+    if rem > threshold:
+        res += 1
+    return res
+
+def to_int32(val):
+    val &= 0xFFFFFFFF
+    return val - (1 << 32) if val & 0x80000000 else val
+
+def requantize(val, mult, shift):
+    """ riscv_nn_requantize: doubling high multiply without saturation then rounding shift """
+    left = shift if shift > 0 else 0
+    right = 0 if shift > 0 else -shift
+    prod = to_int32(val * (1 << left)) * mult + (1 << 30)
+    return rounding_div_pow2(to_int32(prod >> 31), right)
+
+def checksum(data):
+    """ Order sensitive checksum of int8 tensor, same as nnb_checksum in main.c """
+    cs = 0
+    for val in data:
+        cs = (cs * 31 + (val & 0xFF)) & 0xFFFFFFFF
+    return cs
+
+def rand_weights(rng, count):
+    return [max(-127, min(127, int(round(rng.gauss(0, 40))))) for _ in range(count)]
+
+def conv_acc(inp, ishape, weights, wshape, oshape, stride, pad, in_offset, depthwise):
+    """ Accumulators of conv in NHWC, weights are [C_OUT, KH, KW, C_IN] or [1, KH, KW, C] for depthwise """
+    ih, iw, ic = ishape
+    kh, kw = wshape
+    oh, ow, oc = oshape
+    accs = [0] * (oh * ow * oc)
+    for oy in range(oh):
+        for ox in range(ow):
+            base = (oy * ow + ox) * oc
+            for ky in range(kh):
+                iy = oy * stride[0] - pad[0] + ky
+                if iy < 0 or iy >= ih:
+                    continue
+                for kx in range(kw):
+                    ix = ox * stride[1] - pad[1] + kx
+                    if ix < 0 or ix >= iw:
+                        continue
+                    src = (iy * iw + ix) * ic
+                    pix = [v + in_offset for v in inp[src:src + ic]]
+                    if depthwise:
+                        widx = (ky * kw + kx) * oc
+                        for c in range(oc):
+                            accs[base + c] += pix[c] * weights[widx + c]
+                    else:
+                        for c in range(oc):
+                            widx = ((c * kh + ky) * kw + kx) * ic
+                            accs[base + c] += sum(p * w for p, w in zip(pix, weights[widx:widx + ic]))
+    return accs
+
+def mean_std(vals):
+    mean = sum(vals) / len(vals)
+    return mean, math.sqrt(sum((v - mean) ** 2 for v in vals) / len(vals)) or 1.0
+
+def calibrate(rng, accs, channels, target, per_channel=True):
+    """ Add bias and choose multiplier so that max output of each channel is about target """
+    bias = []
+    if per_channel:
+        for c in range(channels):
+            # remove most of the mean, so relu keeps about half of the values
+            mean, std = mean_std(accs[c::channels])
+            bias.append(int(round(-mean + rng.gauss(0, 0.3) * std)))
+    else:
+        # one value per channel, such as logits
+        mean, std = mean_std(accs)
+        bias = [int(round(rng.gauss(0, 0.3) * std)) for _ in range(channels)]
+    if per_channel:
+        reals = []
+        for c in range(channels):
+            peak = max(abs(v + bias[c]) for v in accs[c::channels]) or 1
+            reals.append(float(target) / peak)
+    else:
+        peak = max(abs(v + bias[i % channels]) for i, v in enumerate(accs)) or 1
+        reals = [float(target) / peak] * channels
+    quants = [quantize_multiplier(real) for real in reals]
+    return bias, [q[0] for q in quants], [q[1] for q in quants]
+
+def output(accs, channels, bias, mult, shift, out_offset, act_min, act_max):
+    outs = []
+    for i, acc in enumerate(accs):
+        c = i % channels
+        val = requantize(acc + bias[c], mult[c], shift[c]) + out_offset
+        outs.append(max(act_min, min(act_max, val)))
+    return outs
+
+class Model(object):
+    def __init__(self, seed, channels):
+        self.rng = random.Random(seed)
+        self.channels = channels
+        self.layers = []
+        self.arrays = []
+        # name of tensor used as input of next layer
+        self.last = "input"
+
+    def add_array(self, ctype, name, values):
+        self.arrays.append((ctype, name, values))
+        return name
+
+    def add_layer(self, layer, out):
+        layer["checksum"] = checksum(out)
+        layer["input"] = self.last
+        layer["output_size"] = len(out)
+        self.layers.append(layer)
+        self.last = layer["name"]
+        return out
+
+    def conv(self, name, kind, inp, ishape, kernel, stride, oshape, pad, in_offset):
+        depthwise = (kind == "NNB_DW_CONV")
+        ic = ishape[2]
+        oc = oshape[2]
+        wcount = kernel[0] * kernel[1] * (oc if depthwise else oc * ic)
+        weights = rand_weights(self.rng, wcount)
+        accs = conv_acc(inp, ishape, weights, kernel, oshape, stride, pad, in_offset, depthwise)
+        bias, mult, shift = calibrate(self.rng, accs, oc, ACT_TARGET)
+        out = output(accs, oc, bias, mult, shift, -128, -128, 127)
+        layer = dict(name=name, type=kind, ishape=ishape, kernel=kernel, oshape=oshape,
+                     stride=stride, pad=pad, in_offset=in_offset, out_offset=-128,
+                     act_min=-128, act_max=127)
+        layer["weights"] = self.add_array("int8_t", "nnb_%s_weights" % name, weights)
+        layer["bias"] = self.add_array("int32_t", "nnb_%s_bias" % name, bias)
+        layer["mult"] = self.add_array("int32_t", "nnb_%s_mult" % name, mult)
+        layer["shift"] = self.add_array("int32_t", "nnb_%s_shift" % name, shift)
+        return self.add_layer(layer, out)
+
+    def avgpool(self, name, inp, ishape):
+        ih, iw, ic = ishape
+        count = ih * iw
+        out = []
+        for c in range(ic):
+            total = sum(inp[c::ic])
+            # same as c division in library, truncated toward zero
+            total = total + count // 2 if total > 0 else total - count // 2
+            out.append(max(-128, min(127, int(total / count))))
+        layer = dict(name=name, type="NNB_AVGPOOL", ishape=ishape, kernel=(ih, iw),
+                     oshape=(1, 1, ic), stride=(1, 1), pad=(0, 0), in_offset=0,
+                     out_offset=0, act_min=-128, act_max=127)
+        return self.add_layer(layer, out)
+
+    def fc(self, name, inp, in_offset, classes):
+        depth = len(inp)
+        weights = rand_weights(self.rng, depth * classes)
+        accs = [sum((inp[k] + in_offset) * weights[c * depth + k] for k in range(depth))
+                for c in range(classes)]
+        bias, mult, shift = calibrate(self.rng, accs, classes, LOGIT_TARGET, False)
+        out = output(accs, classes, bias, mult, shift, 0, -128, 127)
+        layer = dict(name=name, type="NNB_FC", ishape=(1, 1, depth), kernel=(1, 1),
+                     oshape=(1, 1, classes), stride=(1, 1), pad=(0, 0), in_offset=in_offset,
+                     out_offset=0, act_min=-128, act_max=127)
+        layer["weights"] = self.add_array("int8_t", "nnb_%s_weights" % name, weights)
+        layer["bias"] = self.add_array("int32_t", "nnb_%s_bias" % name, bias)
+        layer["mult"] = self.add_array("int32_t", "nnb_%s_mult" % name, mult[:1])
+        layer["shift"] = self.add_array("int32_t", "nnb_%s_shift" % name, shift[:1])
+        return self.add_layer(layer, out)
+
+    def softmax(self, name, inp):
+        peak = max(inp)
+        exps = [math.exp((v - peak) * LOGIT_SCALE) for v in inp]
+        total = sum(exps)
+        out = [max(-128, min(127, int(round(e / total * 256)) - 128)) for e in exps]
+        layer = dict(name=name, type="NNB_SOFTMAX", ishape=(1, 1, len(inp)), kernel=(1, 1),
+                     oshape=(1, 1, len(inp)), stride=(1, 1), pad=(0, 0), in_offset=0,
+                     out_offset=0, act_min=-128, act_max=127)
+        self.add_layer(layer, out)
+        # float softmax is not bit exact, output is checked with nnb_expected_probs instead
+        layer["checksum"] = 0
+        return out
+
+def gen_input(rng):
+    frames, feats, _ = INPUT_SHAPE
+    data = []
+    for t in range(frames):
+        for f in range(feats):
+            val = 50 * math.sin(0.3 * t + 0.7 * f) + 30 * math.cos(0.011 * t * f * f) + rng.gauss(0, 8)
+            data.append(max(-128, min(127, int(round(val)))))
+    return data
+
+def same_padding(in_size, kernel, stride):
+    out = (in_size + stride - 1) // stride
+    total = max((out - 1) * stride + kernel - in_size, 0)
+    return out, total // 2
+
+def build_model(seed, channels, blocks):
+    model = Model(seed, channels)
+    model.input = gen_input(model.rng)
+    ih, iw, ic = INPUT_SHAPE
+    oh, pad_h = same_padding(ih, 10, 2)
+    ow, pad_w = same_padding(iw, 4, 2)
+    shape = (oh, ow, channels)
+    act = model.conv("conv1", "NNB_CONV", model.input, INPUT_SHAPE, (10, 4), (2, 2), shape, (pad_h, pad_w), 0)
+    for i in range(blocks):
+        act = model.conv("dw%d" % (i + 1), "NNB_DW_CONV", act, shape, (3, 3), (1, 1), shape, (1, 1), 128)
+        act = model.conv("pw%d" % (i + 1), "NNB_PW_CONV", act, shape, (1, 1), (1, 1), shape, (0, 0), 128)
+    act = model.avgpool("avgpool", act, shape)
+    logits = model.fc("fc", act, 128, NUM_CLASSES)
+    model.logits = logits
+    model.probs = model.softmax("softmax", logits)
+    return model
+
+def scratch_bound(layer):
+    """ Upper bound of *_get_buffer_size of the kernel used by layer, checked in main.c """
+    ih, iw, ic = layer["ishape"]
+    kh, kw = layer["kernel"]
+    if layer["type"] == "NNB_CONV":
+        return 2 * ic * kh * kw * 2
+    if layer["type"] == "NNB_DW_CONV":
+        return ic * kh * kw * 2
+    if layer["type"] == "NNB_AVGPOOL":
+        return ic * 4
+    if layer["type"] == "NNB_FC":
+        return ic * 2
+    return 0
+
+def build_graph(model):
+    """ Layer graph used by nn_arena_planner.py """
+    tensors = {"input": len(model.input)}
+    layers = []
+    for layer in model.layers:
+        tensors[layer["name"]] = layer["output_size"]
+        layers.append(dict(name=layer["name"], inputs=[layer["input"]], outputs=[layer["name"]],
+                           scratch=scratch_bound(layer)))
+    return dict(align=8, tensors=tensors, inputs=["input"], outputs=[model.last], layers=layers)
+
+def softmax_params():
+    """ Same as tflite PreprocessSoftmaxScaling and CalculateInputRadius with beta 1.0 """
+    real = min(LOGIT_SCALE * (1 << (31 - SOFTMAX_INT_BITS)), (1 << 31) - 1.0)
+    mult, shift = quantize_multiplier(real)
+    radius = ((1 << SOFTMAX_INT_BITS) - 1) * (1 << (31 - SOFTMAX_INT_BITS)) / float(1 << shift)
+    return mult, shift, -int(math.floor(radius))
+
+def format_array(ctype, name, values, perline=16):
+    lines = ["static const %s %s[%d] = {" % (ctype, name, len(values))]
+    for idx in range(0, len(values), perline):
+        lines.append("    " + ", ".join(str(v) for v in values[idx:idx + perline]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+def format_layer(layer):
+    def ptr(key, cast):
+        return "(%s)%s" % (cast, layer[key]) if key in layer else "NULL"
+    if layer["type"] == "NNB_FC":
+        # filter of fully connected layer is [accumulation depth, output depth]
+        fdims = (layer["ishape"][2], 1, 1, layer["oshape"][2])
+    else:
+        fdims = (layer["oshape"][2], ) + tuple(layer["kernel"]) + (layer["ishape"][2], )
+    fields = [
+        "\"%s\"" % layer["name"], layer["type"],
+        "{1, %d, %d, %d}" % layer["ishape"],
+        "{%d, %d, %d, %d}" % fdims,
+        "{1, %d, %d, %d}" % layer["oshape"],
+        "{%d, %d}" % (layer["stride"][1], layer["stride"][0]),
+        "{%d, %d}" % (layer["pad"][1], layer["pad"][0]),
+        str(layer["in_offset"]), str(layer["out_offset"]),
+        "{%d, %d}" % (layer["act_min"], layer["act_max"]),
+        ptr("weights", "const int8_t *"), ptr("bias", "const int32_t *"),
+        ptr("mult", "int32_t *"), ptr("shift", "int32_t *"),
+        "0x%08xU" % layer["checksum"],
+        "NNB_%s_OFFSET" % layer["input"].upper(),
+        "NNB_%s_OFFSET" % layer["name"].upper(),
+        "NNB_%s_SCRATCH_OFFSET" % layer["name"].upper(),
+        "NNB_%s_SCRATCH_SIZE" % layer["name"].upper(),
+    ]
+    return "    {" + ", ".join(fields) + "},"
+
+def gen_header(model, output, seed, blocks):
+    mult, shift, diff_min = softmax_params()
+    weights = sum(len(v) * (1 if t == "int8_t" else 4) for t, _, v in model.arrays)
+    out = []
+    out.append("/* This file is generated by tools/scripts/misc/gen_nnmodel.py, don't edit it */")
+    out.append("#ifndef __NNBENCH_MODEL_H__")
+    out.append("#define __NNBENCH_MODEL_H__")
+    out.append("")
+    out.append("#include \"nnbench.h\"")
+    out.append("#include \"nnbench_arena.h\"")
+    out.append("")
+    out.append("/*")
+    out.append(" * DS-CNN keyword spotting model, %d channels, %d depthwise separable blocks," % (model.channels, blocks))
+    out.append(" * int8 weights are random with seed %d, quantization is calibrated on nnb_input." % seed)
+    out.append(" * Checksum of each layer output is calculated by the python reference.")
+    out.append(" */")
+    out.append("#define NNB_NUM_CLASSES         %d" % NUM_CLASSES)
+    out.append("#define NNB_WEIGHT_BYTES        %d" % weights)
+    out.append("#define NNB_SOFTMAX_MULT        %d" % mult)
+    out.append("#define NNB_SOFTMAX_SHIFT       %d" % shift)
+    out.append("#define NNB_SOFTMAX_DIFF_MIN    (%d)" % diff_min)
+    out.append("#define NNB_EXPECTED_CLASS      %d" % model.probs.index(max(model.probs)))
+    out.append("")
+    out.append(format_array("int8_t", "nnb_input", model.input))
+    out.append("")
+    out.append(format_array("int8_t", "nnb_expected_probs", model.probs))
+    out.append("")
+    for ctype, name, values in model.arrays:
+        out.append(format_array(ctype, name, values))
+        out.append("")
+    out.append("static const nnb_layer_t nnb_layers[] = {")
+    for layer in model.layers:
+        out.append(format_layer(layer))
+    out.append("};")
+    out.append("")
+    out.append("#endif /* __NNBENCH_MODEL_H__ */")
+    with open(output, "w") as of:
+        of.write("\n".join(out) + "\n")
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Generate int8 DS-CNN model header for nnbench application")
+    parser.add_argument('--output', default=DEFAULT_OUTPUT, help="Generated model header file")
+    parser.add_argument('--arena', default=DEFAULT_ARENA, help="Generated arena header file")
+    parser.add_argument('--seed', type=int, default=2026, help="Random seed of weights and input")
+    parser.add_argument('--channels', type=int, default=64, help="Channels of each layer, multiple of 4")
+    parser.add_argument('--blocks', type=int, default=4, help="Number of depthwise separable blocks")
+    args = parser.parse_args()
+
+    if args.channels % 4 != 0:
+        print("Channels must be multiple of 4, which is required by riscv_convolve_1x1_s8_fast")
+        sys.exit(1)
+    nnmodel = build_model(args.seed, args.channels, args.blocks)
+    gen_header(nnmodel, args.output, args.seed, args.blocks)
+    nngraph = build_graph(nnmodel)
+    planned, arena_size = nn_arena_planner.plan_arena(nngraph)
+    nn_arena_planner.gen_header(nngraph, planned, arena_size, args.arena, "NNB",
+                                "tools/scripts/misc/gen_nnmodel.py")
+    print("Generated %s with %d layers, expected class %d" % (args.output, len(nnmodel.layers),
+                                                             nnmodel.probs.index(max(nnmodel.probs))))
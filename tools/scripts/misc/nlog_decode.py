@@ -0,0 +1,157 @@
+#!/usr/bin/env python3
+
+import os
+import re
+import sys
+import struct
+import argparse
+
+# Must match Components/nlog/source/nuclei_log.c raw output
+NLOG_PREFIX = "NLOG:"
+
+# printf conversion specification
+FMT_SPEC_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|j|z|t|L)?([diouxXcspfFeEgGaA%])")
+
+class ElfImage(object):
+    """ Read memory contents of allocated sections from an ELF file """
+    def __init__(self, elffile):
+        with open(elffile, "rb") as ef:
+            self.data = ef.read()
+        if self.data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % (elffile))
+        self.is64 = self.data[4] == 2
+        self.endian = "<" if self.data[5] == 1 else ">"
+        self.sections = []
+        if self.is64:
+            shoff, = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+            shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data, 0x3A)
+            shfmt = self.endian + "IIQQQQIIQQ"
+        else:
+            shoff, = struct.unpack_from(self.endian + "I", self.data, 0x20)
+            shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data, 0x2E)
+            shfmt = self.endian + "IIIIIIIIII"
+        SHT_PROGBITS = 1
+        SHF_ALLOC = 0x2
+        for i in range(shnum):
+            _, shtype, flags, addr, offset, size, _, _, _, _ = \
+                struct.unpack_from(shfmt, self.data, shoff + i * shentsize)
+            if shtype == SHT_PROGBITS and (flags & SHF_ALLOC) and size > 0:
+                self.sections.append((addr, offset, size))
+
+    def read_string(self, addr):
+        for secaddr, offset, size in self.sections:
+            if secaddr <= addr < secaddr + size:
+                start = offset + addr - secaddr
+                end = self.data.find(b"\0", start, offset + size)
+                if end < 0:
+                    end = offset + size
+                return self.data[start:end].decode("utf-8", errors="replace")
+        return None
+
+def to_signed(value, bits):
+    value &= (1 << bits) - 1
+    if value >= (1 << (bits - 1)):
+        value -= (1 << bits)
+    return value
+
+def format_message(elf, fmt, args, xlen):
+    """ Format C printf style string using raw integer arguments """
+    output = []
+    argidx = 0
+    last = 0
+    for match in FMT_SPEC_RE.finditer(fmt):
+        output.append(fmt[last:match.start()])
+        last = match.end()
+        flags, width, prec, length, conv = match.groups()
+        if conv == "%":
+            output.append("%")
+            continue
+        if width == "*" or prec == "*":
+            # star width or precision consumes arguments too
+            if width == "*":
+                width = str(to_signed(args[argidx], 32)) if argidx < len(args) else ""
+                argidx += 1
+            if prec == "*":
+                prec = str(to_signed(args[argidx], 32)) if argidx < len(args) else ""
+                argidx += 1
+        if argidx >= len(args):
+            output.append(match.group(0))
+            continue
+        value = args[argidx]
+        argidx += 1
+        bits = 32
+        if length in ("l", "z", "t", "j"):
+            bits = xlen
+        elif length == "ll":
+            bits = 64
+        elif length == "h":
+            bits = 16
+        elif length == "hh":
+            bits = 8
+        pyspec = "%" + flags + (width or "") + ("." + prec if prec else "")
+        if conv in "di":
+            output.append((pyspec + "d") % (to_signed(value, bits)))
+        elif conv in "ouxX":
+            output.append((pyspec + conv) % (value & ((1 << bits) - 1)))
+        elif conv == "c":
+            output.append((pyspec + "c") % (chr(value & 0xFF)))
+        elif conv == "p":
+            output.append((pyspec + "s") % ("0x%x" % (value)))
+        elif conv == "s":
+            string = elf.read_string(value)
+            if string is None:
+                string = "<0x%x>" % (value)
+            output.append((pyspec + "s") % (string))
+        else:
+            # floating point arguments are not supported by nlog
+            output.append(match.group(0))
+    output.append(fmt[last:])
+    return "".join(output)
+
+def nlog_decode(elffile, logfile, outfile=None):
+    elf = ElfImage(elffile)
+    xlen = 64 if elf.is64 else 32
+    with open(logfile, "rb") as lf:
+        lines = lf.read().decode("utf-8", errors="ignore").splitlines(True)
+    output = []
+    cnt = 0
+    for line in lines:
+        pos = line.find(NLOG_PREFIX)
+        fields = line[pos + len(NLOG_PREFIX):].split() if pos >= 0 else []
+        try:
+            values = [int(field, 16) for field in fields]
+        except ValueError:
+            values = []
+        if len(values) == 0:
+            output.append(line)
+            continue
+        fmt = elf.read_string(values[0])
+        if fmt is None:
+            output.append(line)
+            continue
+        output.append(line[:pos] + format_message(elf, fmt, values[1:], xlen))
+        cnt += 1
+    if outfile:
+        with open(outfile, "w") as of:
+            of.write("".join(output))
+    else:
+        sys.stdout.write("".join(output))
+    sys.stderr.write("Decode %d nlog messages using %s\n" % (cnt, elffile))
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Decode Nuclei nlog raw messages using format strings in ELF file")
+    parser.add_argument('elf', help="ELF file of the application built with -DNLOG_RAW_OUTPUT")
+    parser.add_argument('log', help="serial log containing NLOG: raw messages")
+    parser.add_argument('-o', '--output', help="output decoded log file, default print to stdout")
+
+    args = parser.parse_args()
+
+    for fl in (args.elf, args.log):
+        if os.path.isfile(fl) == False:
+            print("The file %s doesn't exist, please check!" % (fl))
+            sys.exit(1)
+
+    if nlog_decode(args.elf, args.log, args.output) == False:
+        sys.exit(1)
@@ -0,0 +1,137 @@
+#!/usr/bin/env python3
+
+"""
+Plan activation and scratch buffers of a NMSIS NN model in a single arena.
+
+Graph is a json file like this, sizes are in bytes, scratch is the buffer size
+returned by *_get_buffer_size of the kernel used by the layer:
+
+{
+    "align": 8,
+    "tensors": {"input": 490, "conv1": 8000, "dw1": 8000},
+    "inputs": ["input"],
+    "outputs": ["dw1"],
+    "layers": [
+        {"name": "conv1", "inputs": ["input"], "outputs": ["conv1"], "scratch": 160},
+        {"name": "dw1", "inputs": ["conv1"], "outputs": ["dw1"], "scratch": 1152}
+    ]
+}
+
+A tensor lives from the layer which produces it to the last layer which uses it,
+graph inputs live from the first layer and graph outputs live to the last layer,
+scratch buffer of a layer only lives in that layer. Buffers are placed from the
+biggest one, each at the lowest offset which doesn't overlap with the placed
+buffers whose lifetime overlaps, same as greedy by size planner of tflite micro.
+"""
+
+import os
+import sys
+import json
+import argparse
+
+DEFAULT_ALIGN = 8
+
+def align_up(val, align):
+    return (val + align - 1) // align * align
+
+def collect_buffers(graph):
+    """ Return list of buffers as dict of name, size, first and last layer index """
+    tensors = graph["tensors"]
+    layers = graph["layers"]
+    last = len(layers) - 1
+    lifetime = dict()
+    for name in graph.get("inputs", []):
+        lifetime[name] = [0, 0]
+    for idx, layer in enumerate(layers):
+        for name in layer.get("inputs", []) + layer.get("outputs", []):
+            if name not in tensors:
+                raise ValueError("Layer %s uses unknown tensor %s" % (layer["name"], name))
+            if name in lifetime:
+                lifetime[name][1] = idx
+            else:
+                lifetime[name] = [idx, idx]
+    for name in graph.get("outputs", []):
+        lifetime[name][1] = last
+    buffers = []
+    for name, size in tensors.items():
+        if name not in lifetime:
+            # not used by any layer, no memory required
+            continue
+        buffers.append(dict(name=name, size=size, first=lifetime[name][0], last=lifetime[name][1], scratch=False))
+    for idx, layer in enumerate(layers):
+        size = layer.get("scratch", 0)
+        if size > 0:
+            buffers.append(dict(name=layer["name"] + "_scratch", size=size, first=idx, last=idx, scratch=True))
+    return buffers
+
+def plan_arena(graph):
+    """ Place buffers in arena, return buffers with offset, and arena size """
+    align = graph.get("align", DEFAULT_ALIGN)
+    buffers = collect_buffers(graph)
+    placed = []
+    # biggest first, earlier one first when sizes are same
+    for buf in sorted(buffers, key=lambda b: (-b["size"], b["first"], b["name"])):
+        lives = sorted([p for p in placed if p["first"] <= buf["last"] and buf["first"] <= p["last"]],
+                       key=lambda p: p["offset"])
+        offset = 0
+        for other in lives:
+            if offset + buf["size"] <= other["offset"]:
+                break
+            offset = max(offset, align_up(other["offset"] + other["size"], align))
+        buf["offset"] = offset
+        placed.append(buf)
+    arena = 0
+    for buf in placed:
+        arena = max(arena, align_up(buf["offset"] + buf["size"], align))
+    return sorted(placed, key=lambda b: (b["first"], b["scratch"], b["name"])), arena
+
+def macro_name(prefix, name):
+    return ("%s_%s" % (prefix, name)).upper()
+
+def gen_header(graph, buffers, arena, output, prefix, generator=None):
+    """ Write offset and size of each buffer into a C header """
+    guard = "__%s__" % os.path.basename(output).upper().replace(".", "_")
+    unshared = sum(align_up(buf["size"], graph.get("align", DEFAULT_ALIGN)) for buf in buffers)
+    out = []
+    out.append("/* This file is generated by %s, don't edit it */" % (generator or "tools/scripts/misc/nn_arena_planner.py"))
+    out.append("#ifndef %s" % guard)
+    out.append("#define %s" % guard)
+    out.append("")
+    out.append("/*")
+    out.append(" * Arena layout, lifetime is the first and last layer which use the buffer")
+    out.append(" * %-20s %8s %8s  %s" % ("buffer", "offset", "size", "lifetime"))
+    for buf in buffers:
+        out.append(" * %-20s %8d %8d  %d-%d" % (buf["name"], buf["offset"], buf["size"], buf["first"], buf["last"]))
+    out.append(" * Arena is %d bytes, %d bytes are required without sharing" % (arena, unshared))
+    out.append(" */")
+    out.append("#define %-40s %d" % (macro_name(prefix, "arena_size"), arena))
+    out.append("")
+    for buf in buffers:
+        out.append("#define %-40s %d" % (macro_name(prefix, buf["name"] + "_offset"), buf["offset"]))
+        out.append("#define %-40s %d" % (macro_name(prefix, buf["name"] + "_size"), buf["size"]))
+    # layers without scratch buffer, so all layers have the macros
+    for layer in graph["layers"]:
+        if layer.get("scratch", 0) <= 0:
+            out.append("#define %-40s 0" % macro_name(prefix, layer["name"] + "_scratch_offset"))
+            out.append("#define %-40s 0" % macro_name(prefix, layer["name"] + "_scratch_size"))
+    out.append("")
+    out.append("#endif /* %s */" % guard)
+    with open(output, "w") as of:
+        of.write("\n".join(out) + "\n")
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Plan NMSIS NN activation and scratch buffers in a single arena")
+    parser.add_argument('graph', help="Layer graph json file")
+    parser.add_argument('--output', required=True, help="Generated C header file")
+    parser.add_argument('--prefix', default="NN", help="Prefix of generated macros, default NN")
+    args = parser.parse_args()
+
+    with open(args.graph, "r") as gf:
+        nngraph = json.load(gf)
+    try:
+        planned, arena_size = plan_arena(nngraph)
+    except (KeyError, ValueError) as exc:
+        print("Invalid graph %s: %s" % (args.graph, exc))
+        sys.exit(1)
+    gen_header(nngraph, planned, arena_size, args.output, args.prefix)
+    print("Generated %s, arena is %d bytes" % (args.output, arena_size))
@@ -0,0 +1,263 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import struct
+import bisect
+import argparse
+
+# Must match Components/profiler/include/nuclei_profiler.h
+NPROF_MAGIC = 0x4652504E
+NPROF_HEADER_FMT = "<IIIIIIIIII"
+
+# flame graph layout in svg
+FLAME_WIDTH = 1200
+FLAME_FRAME_HEIGHT = 16
+FLAME_FONT_SIZE = 12
+FLAME_MIN_WIDTH = 0.1
+
+class ElfSymbols(object):
+    """ Look up function symbols of an ELF file by address """
+    def __init__(self, elffile):
+        with open(elffile, "rb") as ef:
+            data = ef.read()
+        if data[:4] != b"\x7fELF":
+            raise ValueError("%s is not an ELF file" % (elffile))
+        is64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is64:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+            shfmt = endian + "IIQQQQIIQQ"
+            symfmt = endian + "IBBHQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+            shfmt = endian + "IIIIIIIIII"
+            symfmt = endian + "IIIBBH"
+        SHT_SYMTAB = 2
+        SHF_EXECINSTR = 0x4
+        STT_NOTYPE = 0
+        STT_FUNC = 2
+        sections = [struct.unpack_from(shfmt, data, shoff + i * shentsize) for i in range(shnum)]
+        functions = dict()
+        labels = dict()
+        for _, shtype, _, _, offset, size, link, _, _, entsize in sections:
+            if shtype != SHT_SYMTAB or entsize == 0:
+                continue
+            stroff = sections[link][4]
+            for i in range(size // entsize):
+                if is64:
+                    name, info, _, shndx, value, symsize = struct.unpack_from(symfmt, data, offset + i * entsize)
+                else:
+                    name, value, symsize, info, _, shndx = struct.unpack_from(symfmt, data, offset + i * entsize)
+                if name == 0 or shndx == 0 or shndx >= len(sections):
+                    continue
+                end = data.find(b"\0", stroff + name)
+                symname = data[stroff + name:end].decode("utf-8", errors="replace")
+                if symname.startswith(".L") or symname.startswith("$"):
+                    continue
+                if (info & 0xF) == STT_FUNC:
+                    # prefer larger function symbol at same address
+                    if value not in functions or functions[value][1] < symsize:
+                        functions[value] = (symname, symsize)
+                elif (info & 0xF) == STT_NOTYPE and (sections[shndx][2] & SHF_EXECINSTR):
+                    # labels of assembly code such as irq_entry
+                    labels.setdefault(value, (symname, 0))
+        funcaddrs = sorted(functions.keys())
+        for value, label in labels.items():
+            idx = bisect.bisect_right(funcaddrs, value) - 1
+            if idx >= 0 and value < funcaddrs[idx] + functions[funcaddrs[idx]][1]:
+                continue
+            functions.setdefault(value, label)
+        self.addrs = sorted(functions.keys())
+        self.symbols = [functions[addr] for addr in self.addrs]
+
+    def lookup(self, addr):
+        idx = bisect.bisect_right(self.addrs, addr) - 1
+        if idx < 0:
+            return None
+        name, size = self.symbols[idx]
+        if size > 0 and addr >= self.addrs[idx] + size:
+            return None
+        return name
+
+def load_prof_data(proffile):
+    """ Load raw profiler buffer from gdb binary dump or from serial log dumped by NPROF_Dump """
+    with open(proffile, "rb") as pf:
+        data = pf.read()
+    if len(data) >= 4 and struct.unpack_from("<I", data)[0] == NPROF_MAGIC:
+        return data
+    # Parse serial log, only the last complete dump is used
+    hexdata = None
+    dumpdata = None
+    for line in data.decode("utf-8", errors="ignore").splitlines():
+        pos = line.find("NPROF:")
+        if pos < 0:
+            continue
+        content = line[pos + len("NPROF:"):].strip()
+        if content.startswith("BEGIN"):
+            hexdata = []
+        elif content.startswith("END"):
+            if hexdata is not None:
+                dumpdata = bytes.fromhex("".join(hexdata))
+            hexdata = None
+        elif hexdata is not None:
+            hexdata.append(content)
+    return dumpdata
+
+def parse_prof_data(data):
+    """ Parse profiler buffer into header and samples, each sample is [pc, return addresses...] """
+    hdrsize = struct.calcsize(NPROF_HEADER_FMT)
+    if data is None or len(data) < hdrsize:
+        return None, None
+    magic, version, word_size, depth, buf_size, rate, _, count, dropped, _ = \
+        struct.unpack_from(NPROF_HEADER_FMT, data)
+    if magic != NPROF_MAGIC or word_size not in (4, 8):
+        return None, None
+    header = {"version": version, "depth": depth, "buf_size": buf_size, "rate": rate, \
+        "count": count, "dropped": dropped}
+    wordfmt = "<%d%s" % (depth + 1, "Q" if word_size == 8 else "I")
+    samplesize = struct.calcsize(wordfmt)
+    samples = []
+    offset = hdrsize
+    for _ in range(min(count, buf_size)):
+        if offset + samplesize > len(data):
+            break
+        samples.append(list(struct.unpack_from(wordfmt, data, offset)))
+        offset += samplesize
+    return header, samples
+
+def fold_samples(samples, symbols):
+    """ Return folded stacks {"main;foo;bar": count}, outermost caller first """
+    folded = dict()
+    for sample in samples:
+        frames = []
+        for i, addr in enumerate(sample):
+            if addr == 0:
+                break
+            # return address points to the instruction after call
+            name = symbols.lookup(addr if i == 0 else addr - 1)
+            frames.append(name if name else "0x%x" % (addr))
+        stack = ";".join(reversed(frames))
+        folded[stack] = folded.get(stack, 0) + 1
+    return folded
+
+def flat_profile(folded):
+    """ Return [(function, self samples, total samples)] sorted by self samples """
+    selfcnt = dict()
+    totalcnt = dict()
+    for stack, count in folded.items():
+        frames = stack.split(";")
+        selfcnt[frames[-1]] = selfcnt.get(frames[-1], 0) + count
+        # recursive functions are only counted once in total
+        for frame in set(frames):
+            totalcnt[frame] = totalcnt.get(frame, 0) + count
+    return sorted([(func, selfcnt.get(func, 0), totalcnt[func]) for func in totalcnt], \
+        key=lambda item: (-item[1], -item[2], item[0]))
+
+def escape_xml(text):
+    return text.replace("&", "&amp;").replace("<", "&lt;").replace(">", "&gt;").replace("\"", "&quot;")
+
+def frame_color(name):
+    # stable warm color for each function name
+    value = 0
+    for ch in name:
+        value = (value * 31 + ord(ch)) & 0xFFFF
+    return "rgb(%d,%d,%d)" % (205 + value % 50, 80 + (value >> 4) % 130, 40 + (value >> 8) % 50)
+
+def generate_flamegraph(folded, title):
+    """ Return svg flame graph of folded stacks, root at bottom """
+    root = {"count": 0, "children": dict()}
+    maxdepth = 0
+    for stack, count in sorted(folded.items()):
+        node = root
+        node["count"] += count
+        frames = stack.split(";")
+        maxdepth = max(maxdepth, len(frames))
+        for frame in frames:
+            node = node["children"].setdefault(frame, {"count": 0, "children": dict()})
+            node["count"] += count
+    total = root["count"]
+    height = (maxdepth + 3) * FLAME_FRAME_HEIGHT
+    lines = ['<?xml version="1.0" standalone="no"?>',
+             '<svg version="1.1" width="%d" height="%d" xmlns="http://www.w3.org/2000/svg">' % (FLAME_WIDTH, height),
+             '<rect x="0" y="0" width="%d" height="%d" fill="rgb(248,248,248)"/>' % (FLAME_WIDTH, height),
+             '<text x="%d" y="%d" font-size="%d" font-family="Verdana" text-anchor="middle">%s</text>' \
+                % (FLAME_WIDTH // 2, FLAME_FRAME_HEIGHT, FLAME_FONT_SIZE + 2, escape_xml(title))]
+    if total == 0:
+        lines.append("</svg>")
+        return "\n".join(lines) + "\n"
+    scale = float(FLAME_WIDTH - 20) / total
+    pending = [("all", root, 10.0, 0)]
+    while pending:
+        name, node, x, depth = pending.pop()
+        width = node["count"] * scale
+        if width < FLAME_MIN_WIDTH:
+            continue
+        y = height - (depth + 1) * FLAME_FRAME_HEIGHT
+        tip = "%s (%d samples, %.2f%%)" % (name, node["count"], node["count"] * 100.0 / total)
+        lines.append('<g><title>%s</title><rect x="%.1f" y="%d" width="%.1f" height="%d" fill="%s" rx="2"/>' \
+            % (escape_xml(tip), x, y, width, FLAME_FRAME_HEIGHT - 1, frame_color(name)))
+        # about 7 pixels for each character
+        maxchars = int(width / 7)
+        if maxchars >= 3:
+            label = name if len(name) <= maxchars else name[:maxchars - 2] + ".."
+            lines.append('<text x="%.1f" y="%d" font-size="%d" font-family="Verdana">%s</text>' \
+                % (x + 3, y + FLAME_FRAME_HEIGHT - 4, FLAME_FONT_SIZE, escape_xml(label)))
+        lines.append('</g>')
+        childx = x
+        for childname in sorted(node["children"]):
+            child = node["children"][childname]
+            pending.append((childname, child, childx, depth + 1))
+            childx += child["count"] * scale
+    lines.append("</svg>")
+    return "\n".join(lines) + "\n"
+
+def prof2flame(elffile, proffile, svgfile=None, foldedfile=None, top=20):
+    data = load_prof_data(proffile)
+    header, samples = parse_prof_data(data)
+    if header is None:
+        print("No valid profiler data found in %s" % (proffile))
+        return False
+    symbols = ElfSymbols(elffile)
+    folded = fold_samples(samples, symbols)
+    total = len(samples)
+    rate = "%d Hz" % (header["rate"]) if header["rate"] else "application defined rate"
+    print("Profiler samples: %d, dropped: %d, backtrace depth: %d, sample rate: %s" \
+        % (total, header["dropped"], header["depth"], rate))
+    if header["dropped"] > 0:
+        print("Buffer is full, increase NPROF_BUF_SIZE or decrease sample rate to keep all samples")
+    print("%8s %8s %8s %8s  %s" % ("Self", "Self(%)", "Total", "Total(%)", "Function"))
+    for func, selfcnt, totalcnt in flat_profile(folded)[:top]:
+        print("%8d %8.2f %8d %8.2f  %s" % (selfcnt, selfcnt * 100.0 / max(total, 1), \
+            totalcnt, totalcnt * 100.0 / max(total, 1), func))
+    if foldedfile:
+        with open(foldedfile, "w") as ff:
+            for stack in sorted(folded):
+                ff.write("%s %d\n" % (stack, folded[stack]))
+        print("Folded stacks are saved to %s" % (foldedfile))
+    if svgfile:
+        with open(svgfile, "w") as sf:
+            sf.write(generate_flamegraph(folded, "%s, %d samples" % (os.path.basename(elffile), total)))
+        print("Flame graph is saved to %s" % (svgfile))
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Symbolize Nuclei profiler samples into folded stacks and flame graph")
+    parser.add_argument('elf', help="ELF file of the profiled application")
+    parser.add_argument('prof', help="serial log containing NPROF_Dump output, or binary file dumped by gdb from NPROF_Data")
+    parser.add_argument('-o', '--output', default="flame.svg", help="output flame graph svg file")
+    parser.add_argument('-f', '--folded', help="output folded stacks file, which can be used by flamegraph.pl or speedscope")
+    parser.add_argument('--top', type=int, default=20, help="number of functions shown in flat profile")
+
+    args = parser.parse_args()
+
+    for fl in (args.elf, args.prof):
+        if os.path.isfile(fl) == False:
+            print("The file %s doesn't exist, please check!" % (fl))
+            sys.exit(1)
+
+    if prof2flame(args.elf, args.prof, args.output, args.folded, args.top) == False:
+        sys.exit(1)
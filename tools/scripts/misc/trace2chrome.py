@@ -0,0 +1,190 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import json
+import struct
+import argparse
+
+# Must match Components/trace/include/nuclei_trace.h
+NTRACE_MAGIC = 0x4352544E
+NTRACE_HEADER_FMT = "<IHHIIIIII"
+NTRACE_NAME_FMT = "<I12s"
+NTRACE_EVENT_FMT = "<IBBHI"
+
+NTRACE_EVT_TASK_SWITCH = 1
+NTRACE_EVT_IRQ_ENTER = 2
+NTRACE_EVT_IRQ_EXIT = 3
+NTRACE_EVT_OBJ_GIVE = 4
+NTRACE_EVT_OBJ_TAKE = 5
+NTRACE_EVT_OBJ_BLOCK = 6
+NTRACE_EVT_MARK = 7
+NTRACE_EVT_SPAN_BEGIN = 8
+NTRACE_EVT_SPAN_END = 9
+
+OBJ_EVENT_NAMES = {
+    NTRACE_EVT_OBJ_GIVE: "give",
+    NTRACE_EVT_OBJ_TAKE: "take",
+    NTRACE_EVT_OBJ_BLOCK: "wait",
+}
+
+# chrome trace thread ids used for each hart
+TID_TASK = 1
+TID_IRQ = 2
+TID_USER = 3
+
+def load_trace_data(tracefile):
+    """ Load raw trace buffer from gdb binary dump or from serial log dumped by NTRACE_Dump """
+    with open(tracefile, "rb") as tf:
+        data = tf.read()
+    if len(data) >= 4 and struct.unpack_from("<I", data)[0] == NTRACE_MAGIC:
+        return data
+    # Parse serial log, only the last complete dump is used
+    hexdata = None
+    dumpdata = None
+    for line in data.decode("utf-8", errors="ignore").splitlines():
+        pos = line.find("NTRACE:")
+        if pos < 0:
+            continue
+        content = line[pos + len("NTRACE:"):].strip()
+        if content.startswith("BEGIN"):
+            hexdata = []
+        elif content.startswith("END"):
+            if hexdata is not None:
+                dumpdata = bytes.fromhex("".join(hexdata))
+            hexdata = None
+        elif hexdata is not None:
+            hexdata.append(content)
+    return dumpdata
+
+def parse_trace_data(data):
+    """ Parse trace buffer into header, name dict and events in recorded order """
+    hdrsize = struct.calcsize(NTRACE_HEADER_FMT)
+    if data is None or len(data) < hdrsize:
+        return None, None, None
+    magic, version, event_size, buf_size, name_max, freq, enable, index, name_cnt = \
+        struct.unpack_from(NTRACE_HEADER_FMT, data)
+    if magic != NTRACE_MAGIC or event_size != struct.calcsize(NTRACE_EVENT_FMT):
+        return None, None, None
+    header = {"version": version, "buf_size": buf_size, "freq": freq, "index": index}
+
+    names = dict()
+    offset = hdrsize
+    namesize = struct.calcsize(NTRACE_NAME_FMT)
+    for i in range(name_max):
+        if i < name_cnt:
+            obj, name = struct.unpack_from(NTRACE_NAME_FMT, data, offset)
+            names[obj] = name.split(b"\0")[0].decode("utf-8", errors="ignore")
+        offset += namesize
+
+    nevents = min(index, buf_size)
+    nevents = min(nevents, (len(data) - offset) // event_size)
+    rawevents = []
+    for i in range(nevents):
+        rawevents.append(struct.unpack_from(NTRACE_EVENT_FMT, data, offset + i * event_size))
+    # ring buffer wrapped, oldest event is at index % buf_size
+    if index > buf_size and nevents == buf_size:
+        start = index % buf_size
+        rawevents = rawevents[start:] + rawevents[:start]
+    return header, names, rawevents
+
+def unwrap_timestamps(rawevents):
+    """ Extend 32-bit mcycle timestamps, events may be slightly out of order between harts """
+    cycles = []
+    last = None
+    total = 0
+    for evt in rawevents:
+        if last is not None:
+            delta = (evt[0] - last) & 0xFFFFFFFF
+            if delta >= 0x80000000:
+                delta -= 0x100000000
+            total += delta
+        last = evt[0]
+        cycles.append(total)
+    return cycles
+
+def obj_name(names, obj):
+    return names.get(obj, "0x%08x" % (obj))
+
+def convert_to_chrome(header, names, rawevents, freq):
+    events = []
+    cycles = unwrap_timestamps(rawevents)
+    to_us = lambda cyc: cyc * 1000000.0 / freq
+    harts = set()
+    running = dict()
+    irqstack = dict()
+
+    for evt, cyc in zip(rawevents, cycles):
+        _, evtype, hart, arg, obj = evt
+        ts = to_us(cyc)
+        harts.add(hart)
+        if evtype == NTRACE_EVT_TASK_SWITCH:
+            if hart in running:
+                task, start = running[hart]
+                events.append({"name": obj_name(names, task), "ph": "X", "pid": hart, "tid": TID_TASK, \
+                    "ts": start, "dur": ts - start})
+            running[hart] = (obj, ts)
+        elif evtype == NTRACE_EVT_IRQ_ENTER:
+            irqstack.setdefault(hart, []).append((arg, ts))
+        elif evtype == NTRACE_EVT_IRQ_EXIT:
+            if irqstack.get(hart):
+                irq, start = irqstack[hart].pop()
+                events.append({"name": "IRQ %d" % (irq), "ph": "X", "pid": hart, "tid": TID_IRQ, \
+                    "ts": start, "dur": ts - start})
+        elif evtype in OBJ_EVENT_NAMES:
+            events.append({"name": "%s %s" % (OBJ_EVENT_NAMES[evtype], obj_name(names, obj)), "ph": "i", "s": "t", \
+                "pid": hart, "tid": TID_TASK, "ts": ts, "args": {"arg": arg}})
+        elif evtype == NTRACE_EVT_MARK:
+            events.append({"name": "mark %d" % (arg), "ph": "i", "s": "t", "pid": hart, "tid": TID_USER, \
+                "ts": ts, "args": {"value": obj}})
+        elif evtype == NTRACE_EVT_SPAN_BEGIN:
+            events.append({"name": "span %d" % (arg), "ph": "B", "pid": hart, "tid": TID_USER, "ts": ts})
+        elif evtype == NTRACE_EVT_SPAN_END:
+            events.append({"name": "span %d" % (arg), "ph": "E", "pid": hart, "tid": TID_USER, "ts": ts})
+
+    # close the slices which are still running at the end of the trace
+    endts = to_us(cycles[-1]) if cycles else 0
+    for hart, (task, start) in running.items():
+        events.append({"name": obj_name(names, task), "ph": "X", "pid": hart, "tid": TID_TASK, \
+            "ts": start, "dur": endts - start})
+
+    for hart in sorted(harts):
+        events.append({"name": "process_name", "ph": "M", "pid": hart, "args": {"name": "Hart %d" % (hart)}})
+        for tid, tname in ((TID_TASK, "Tasks"), (TID_IRQ, "Interrupts"), (TID_USER, "User")):
+            events.append({"name": "thread_name", "ph": "M", "pid": hart, "tid": tid, "args": {"name": tname}})
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+def trace2chrome(tracefile, outfile, freq=None):
+    data = load_trace_data(tracefile)
+    header, names, rawevents = parse_trace_data(data)
+    if header is None:
+        print("No valid trace data found in %s" % (tracefile))
+        return False
+    if freq is None:
+        freq = header["freq"]
+    if not freq:
+        print("Timestamp frequency is unknown, please pass it using --freq")
+        return False
+    chrome = convert_to_chrome(header, names, rawevents, freq)
+    with open(outfile, "w") as of:
+        json.dump(chrome, of)
+    print("Convert %d events recorded at %d Hz to %s" % (len(rawevents), freq, outfile))
+    if header["index"] > header["buf_size"]:
+        print("Trace buffer wrapped, %d oldest events are lost" % (header["index"] - header["buf_size"]))
+    return True
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Convert Nuclei trace buffer to chrome trace json format")
+    parser.add_argument('trace', help="serial log containing NTRACE_Dump output, or binary file dumped by gdb from NTRACE_Data")
+    parser.add_argument('-o', '--output', default="trace.json", help="output chrome trace json file, open it in chrome://tracing or ui.perfetto.dev")
+    parser.add_argument('--freq', type=int, help="timestamp frequency in Hz, default use the one recorded in trace buffer")
+
+    args = parser.parse_args()
+
+    if os.path.isfile(args.trace) == False:
+        print("The trace file %s doesn't exist, please check!" % (args.trace))
+        sys.exit(1)
+
+    if trace2chrome(args.trace, args.output, args.freq) == False:
+        sys.exit(1)
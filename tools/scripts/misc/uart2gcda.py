@@ -0,0 +1,93 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import struct
+import argparse
+
+# Must match Components/gcov/source/nuclei_gcov.c
+NGCOV_PREFIX = "NGCOV:"
+GCOV_DATA_MAGIC = 0x67636461
+
+def load_gcda_dumps(logfile):
+    """
+    Return ([(filename, gcda data)], [filename]) dumped by NGCOV_Dump in serial log,
+    the second list is gcda files written on host directly using semihosting
+    """
+    with open(logfile, "rb") as lf:
+        lines = lf.read().decode("utf-8", errors="ignore").splitlines()
+    dumps = []
+    written = []
+    filename = None
+    hexdata = []
+    for line in lines:
+        pos = line.find(NGCOV_PREFIX)
+        if pos < 0:
+            continue
+        content = line[pos + len(NGCOV_PREFIX):].strip()
+        if content.startswith("WRITE "):
+            written.append(content[len("WRITE "):].strip())
+        elif content.startswith("FILE "):
+            filename = content[len("FILE "):].strip()
+            hexdata = []
+        elif content.startswith("END"):
+            if filename:
+                try:
+                    dumps.append((filename, bytes.fromhex("".join(hexdata))))
+                except ValueError:
+                    print("Drop incomplete gcda data of %s" % (filename))
+            filename = None
+        elif filename:
+            hexdata.append(content)
+    return dumps, written
+
+def get_gcda_path(filename, outdir=None, strip=None):
+    """ Return path to write gcda file, which is same as path used by libgcov by default """
+    if strip and filename.startswith(strip):
+        filename = filename[len(strip):].lstrip("/\\")
+    if outdir:
+        # keep mangled name of -fprofile-generate=dir, or path relative to stripped prefix
+        if os.path.isabs(filename):
+            filename = os.path.basename(filename)
+        filename = os.path.join(outdir, filename)
+    return filename
+
+def uart2gcda(logfile, outdir=None, strip=None):
+    dumps, written = load_gcda_dumps(logfile)
+    for filename in written:
+        print("Already written by semihosting: %s" % (filename))
+    if len(dumps) == 0 and len(written) > 0:
+        return True
+    if len(dumps) == 0:
+        print("No gcda data found in %s, please check whether application is built with PGO=gen" % (logfile))
+        return False
+    ret = True
+    for filename, data in dumps:
+        if len(data) < 4 or struct.unpack_from("<I", data)[0] != GCOV_DATA_MAGIC:
+            print("Invalid gcda data of %s" % (filename))
+            ret = False
+            continue
+        gcdafile = get_gcda_path(filename, outdir, strip)
+        gcdadir = os.path.dirname(gcdafile)
+        if gcdadir and os.path.isdir(gcdadir) == False:
+            os.makedirs(gcdadir)
+        with open(gcdafile, "wb") as gf:
+            gf.write(data)
+        print("Write %d bytes to %s" % (len(data), gcdafile))
+    return ret
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Write gcda files dumped by Nuclei gcov component in serial log")
+    parser.add_argument('log', help="serial log containing NGCOV_Dump output")
+    parser.add_argument('-o', '--outdir', help="write gcda files to this directory instead of the path recorded in application")
+    parser.add_argument('--strip', help="strip this prefix from recorded path, the rest is kept under --outdir")
+
+    args = parser.parse_args()
+
+    if os.path.isfile(args.log) == False:
+        print("The file %s doesn't exist, please check!" % (args.log))
+        sys.exit(1)
+
+    if uart2gcda(args.log, args.outdir, args.strip) == False:
+        sys.exit(1)
@@ -111,7 +111,8 @@ class nsdk_bench(nsdk_runner):
             return False, None
         # Build all the applications
         print("Build %d applications defined by configuration" % (len(apps_config)))
-        cmdsts, build_status = self.build_apps_with_configs(apps_config, show_output, stoponfail)
+        cmdsts, build_status = self.build_apps_with_configs(apps_config, show_output, stoponfail=stoponfail, \
+                                                            jobs=config.get("jobs", 1))
         return cmdsts, build_status
 
     def run_apps(self, config:dict, show_output=True, logdir=None, stoponfail=False):
@@ -219,7 +220,8 @@ class nsdk_bench(nsdk_runner):
             return False, None
         print("Run %d applications defined by configuration" % (len(apps_config)))
         # Run all the applications
-        cmdsts, build_status = self.run_apps_with_configs(apps_config, show_output, stoponfail)
+        cmdsts, build_status = self.run_apps_with_configs(apps_config, show_output, stoponfail, \
+                                                          jobs=config.get("jobs", 1), sim_jobs=config.get("sim_jobs", None))
         return cmdsts, build_status
 
 
@@ -241,6 +243,9 @@ if __name__ == '__main__':
     parser.add_argument('--run_target', help="Run target which program will run, such as hardware, qemu or xlspike")
     parser.add_argument('--parallel', help="parallel value, such as -j4 or -j or -j8, default None")
     parser.add_argument('--run', action='store_true', help="If specified, will do run not build process")
+    parser.add_argument('--jobs', type=int, help="Number of applications and configurations built or run at the same time, default 1")
+    parser.add_argument('--sim_jobs', type=int, help="Max number of qemu, xlspike or ncycm running at the same time when --jobs is used, default same as --jobs")
+    parser.add_argument('--failfast', action='store_true', help="If specified, stop building or running remaining applications when one failed")
     parser.add_argument('--ncycm',  help="If specified, will use cycle model specified here")
     parser.add_argument("--timeout", help="If specified, will use timeout value specified here")
     parser.add_argument('--verbose', action='store_true', help="If specified, will show detailed build/run messsage")
@@ -266,9 +271,9 @@ if __name__ == '__main__':
 
     nsdk_ext = nsdk_bench()
     if args.run:
-        cmdsts, result = nsdk_ext.run_apps(config, args.verbose, args.logdir, False)
+        cmdsts, result = nsdk_ext.run_apps(config, args.verbose, args.logdir, args.failfast)
     else:
-        cmdsts, result = nsdk_ext.build_apps(config, args.verbose, args.logdir, False)
+        cmdsts, result = nsdk_ext.build_apps(config, args.verbose, args.logdir, args.failfast)
 
     runtime = round(time.time() - start_time, 2)
     print("Applications specified in %s build or run status: %s, time cost %s seconds" % (args.appcfg, cmdsts, runtime))
@@ -16,6 +16,9 @@ try:
     import json
     import argparse
     from threading import Thread
+    import threading
+    import contextlib
+    from concurrent.futures import ThreadPoolExecutor
     import subprocess
 except:
     print("Please install requried packages using: pip3 install -r %s" % (requirement_file))
@@ -62,12 +65,16 @@ class nsdk_builder(object):
         pass
 
     @staticmethod
-    def get_objects(appdir, target=None, timestamp=None):
+    def get_objects(appdir, target=None, timestamp=None, outdir=None):
         if nsdk_builder.is_app(appdir) == False:
             return None
+        # Objects are placed in outdir for out-of-tree build, relative outdir is in appdir
+        searchdir = appdir
+        if outdir:
+            searchdir = os.path.join(appdir, outdir)
 
         def find_app_object(pattern):
-            files = find_files(appdir, pattern)
+            files = find_files(searchdir, pattern)
             found_file = ""
             latest_timestamp = 0
             for fl in files:
@@ -222,10 +229,17 @@ class nsdk_builder(object):
         build_status["toolver"] = self.get_build_toolver(appdir, make_options)
         build_status["flags"] = self.get_build_flags(appdir, make_options)
         apptarget = None
+        appoutdir = None
         if build_status["flags"]:
             apptarget = build_status["flags"].get("TARGET", None)
-        build_status["objects"] = nsdk_builder.get_objects(appdir, apptarget)
+            appoutdir = build_status["flags"].get("OUTPUT_DIR", None)
+        build_status["objects"] = nsdk_builder.get_objects(appdir, apptarget, outdir=appoutdir)
         build_status["size"] = get_elfsize(build_status["objects"].get("elf", ""))
+        # memory regions and libraries size parsed from map file, symbols are saved in build_app_with_config
+        mapsize = parse_mapfile(build_status["objects"].get("map", ""))
+        if mapsize:
+            build_status["memsize"] = {"regions": mapsize["regions"], "libraries": mapsize["libraries"]}
+            build_status["mapsize"] = mapsize
         return cmdsts, build_status
 
     def clean_app(self, appdir, make_options="", show_output=True, logfile=None):
@@ -377,6 +391,10 @@ class MonitorThread(Thread):
 class nsdk_runner(nsdk_builder):
     def __init__(self):
         super().__init__()
+        # Slots used by job pool, see run_jobs_in_pool
+        self.build_slot = contextlib.nullcontext()
+        self.sim_slots = contextlib.nullcontext()
+        self.isolate_objects = False
         pass
 
     @staticmethod
@@ -494,9 +512,12 @@ class nsdk_runner(nsdk_builder):
             build_core = build_info["CORE"]
             build_download = build_info["DOWNLOAD"]
             build_smp = build_info.get("SMP", "")
+            build_semihost = build_info.get("SEMIHOST", "")
             build_arch_ext = build_config.get("ARCH_EXT", "")
             if build_smp != "":
                 qemu_extraopt = "%s -smp %s" % (qemu_extraopt, build_smp)
+            if build_semihost == "1":
+                qemu_extraopt = "%s -semihosting-config enable=on,target=native" % (qemu_extraopt)
             if qemu_machine is None:
                 if build_soc == "hbird" or build_soc == "demosoc" or build_soc == "xlspike":
                     machine = "nuclei_n"
@@ -671,6 +692,21 @@ class nsdk_runner(nsdk_builder):
         # copy objects if copy_objects_required
         if copy_objects_required:
             nsdk_builder.copy_objects(appsts, objs_copydir)
+        # save size of each symbol, object and library, and check size budget of memory regions
+        mapsize = appsts.pop("mapsize", None)
+        if mapsize and logfile:
+            sizefile = os.path.join(objs_copydir, "size.json")
+            save_json(sizefile, mapsize)
+            appsts["logs"]["size"] = sizefile
+        if appcmdsts and mapsize:
+            exceeded = check_size_budget(mapsize, get_sdk_size_budget())
+            if len(exceeded) > 0:
+                for item in exceeded:
+                    print("Application %s exceeds size budget of %s, used %d bytes, budget %d bytes" \
+                        % (appdir, item["region"], item["used"], item["budget"]))
+                appsts["size_budget"] = exceeded
+                appsts["status"]["build"] = False
+                appcmdsts = False
         buildtime = appsts["time"]["build"]
         print("Build application %s, time cost %s seconds, passed: %s" %(appdir, buildtime, appcmdsts))
 
@@ -681,7 +717,12 @@ class nsdk_runner(nsdk_builder):
         appconfig["build_target"] = "clean dasm"
         # build application
         build_cktime = time.time()
-        appcmdsts, appsts = self.build_app_with_config(appdir, appconfig, show_output, buildlog)
+        with self.build_slot:
+            appcmdsts, appsts = self.build_app_with_config(appdir, appconfig, show_output, buildlog)
+            # In job pool, objects in application directory may be cleaned by next build
+            # while running, so run the objects copied to log directory
+            if self.isolate_objects and appcmdsts and buildlog:
+                nsdk_builder.copy_objects(appsts, os.path.dirname(buildlog))
         # run application
         if appcmdsts == False:
             print("Failed to build application %s, so we can't run it!" % (appdir))
@@ -692,8 +733,12 @@ class nsdk_runner(nsdk_builder):
         # get run checks
         DEFAULT_CHECKS = { "PASS": [ ], "FAIL": [ "MCAUSE:" ] }
         app_runchecks = appconfig.get("checks", DEFAULT_CHECKS)
+        run_objects = appsts["objects"]
+        if self.isolate_objects:
+            run_objects = copy.deepcopy(appsts["objects"])
+            run_objects.update(appsts.get("saved_objects", dict()))
         misc_config = {"make_options": appsts["app"]["make_options"], "build_config": appconfig["build_config"],\
-            "build_info": appsts["info"], "build_objects": appsts["objects"], "build_time": build_cktime}
+            "build_info": appsts["info"], "build_objects": run_objects, "build_time": build_cktime}
         runcfg = {"run_config": app_runcfg, "checks": app_runchecks, "misc": misc_config}
         print("Run application on %s" % app_runtarget)
         runstarttime = time.time()
@@ -713,7 +758,8 @@ class nsdk_runner(nsdk_builder):
             if uploader:
                 appsts["app"]["uploader"] = uploader
         elif app_runtarget == "qemu":
-            runstatus, runner = self.run_app_onqemu(appdir, runcfg, show_output, runlog)
+            with self.sim_slots:
+                runstatus, runner = self.run_app_onqemu(appdir, runcfg, show_output, runlog)
             # If run successfully, then do log analyze
             if runlog and runstatus:
                 appsts["result"] = self.analyze_runlog(runlog)
@@ -722,7 +768,8 @@ class nsdk_runner(nsdk_builder):
             if runner:
                 appsts["app"]["qemu"] = runner
         elif app_runtarget == "xlspike":
-            runstatus, runner = self.run_app_onxlspike(appdir, runcfg, show_output, runlog)
+            with self.sim_slots:
+                runstatus, runner = self.run_app_onxlspike(appdir, runcfg, show_output, runlog)
             # If run successfully, then do log analyze
             if runlog and runstatus:
                 appsts["result"] = self.analyze_runlog(runlog)
@@ -731,7 +778,8 @@ class nsdk_runner(nsdk_builder):
             if runner:
                 appsts["app"]["xlspike"] = runner
         elif app_runtarget == "ncycm":
-            runstatus, runner = self.run_app_onncycm(appdir, runcfg, show_output, runlog)
+            with self.sim_slots:
+                runstatus, runner = self.run_app_onncycm(appdir, runcfg, show_output, runlog)
             # If run successfully, then do log analyze
             if runlog and runstatus:
                 appsts["result"] = self.analyze_runlog(runlog)
@@ -748,9 +796,106 @@ class nsdk_runner(nsdk_builder):
         appsts["time"]["run"] = runtime
         return runstatus, appsts
 
-    def build_apps_with_config(self, config:dict, show_output=True, logdir=None, stoponfail=False):
+    def run_jobs_in_pool(self, jobs:list, jobfunc, workers:int, sim_workers=None, stoponfail=False, serial_build=True):
+        # Call jobfunc(job) for each job in a pool of worker threads, jobfunc returns (cmdsts, status)
+        # Return a list of (cmdsts, status) in the same order as jobs, None for jobs skipped
+        # after a failure when stoponfail is True.
+        # Objects of SDK sources are built in the source tree and shared by all applications,
+        # so only one build runs at a time unless serial_build is False, which is only safe for
+        # out-of-tree builds, and at most sim_workers qemu/xlspike/ncycm run at a time.
+        results = [None] * len(jobs)
+        failed = threading.Event()
+
+        def pool_worker(index):
+            if stoponfail and failed.is_set():
+                return
+            cmdsts, status = jobfunc(jobs[index])
+            results[index] = (cmdsts, status)
+            if cmdsts == False:
+                failed.set()
+
+        if sim_workers is None or sim_workers <= 0:
+            sim_workers = workers
+        if serial_build:
+            self.build_slot = threading.Lock()
+            self.isolate_objects = True
+        self.sim_slots = threading.BoundedSemaphore(sim_workers)
+        try:
+            with ThreadPoolExecutor(max_workers=workers) as pool:
+                list(pool.map(pool_worker, range(len(jobs))))
+        finally:
+            self.build_slot = contextlib.nullcontext()
+            self.sim_slots = contextlib.nullcontext()
+            self.isolate_objects = False
+        if stoponfail and failed.is_set():
+            print("Stop jobs in pool due to failure, %d of %d jobs are done" \
+                % (len([rst for rst in results if rst is not None]), len(jobs)))
+        return results
+
+    def get_pool_jobs(self, jobs, joblist:list, logkey="build"):
+        # Check whether joblist [(appdir, cfgname, appconfig)] can be done in job pool,
+        # return number of workers, 1 means sequential
+        try:
+            jobs = int(jobs)
+        except (TypeError, ValueError):
+            jobs = 1
+        if jobs <= 1 or len(joblist) <= 1:
+            return 1
+        for _, _, appconfig in joblist:
+            if appconfig.get("logs", dict()).get(logkey, None) is None:
+                print("Log directory is required to run jobs in pool, run them one by one")
+                return 1
+            if logkey == "run" and appconfig.get("run_config", dict()).get("target", "hardware") == "hardware":
+                print("Applications run on hardware can't be run in pool, run them one by one")
+                return 1
+        print("Run %d jobs with %d workers in pool" % (len(joblist), jobs))
+        return jobs
+
+    @staticmethod
+    def is_outtree_build(joblist:list):
+        # Objects of each job are placed in its own directory when BUILD_DIR is passed,
+        # so they can be built at the same time and are not cleaned by other jobs
+        for _, _, appconfig in joblist:
+            build_config = appconfig.get("build_config", None)
+            if not isinstance(build_config, dict) or str(build_config.get("BUILD_DIR", "")).strip() == "":
+                return False
+        return True
+
+    @staticmethod
+    def get_outtree_jobs(joblist:list, logkey="build"):
+        # Objects of SDK sources are shared by in-tree builds, so pass BUILD_DIR
+        # to jobs which don't set it, objects of each job are placed in "build"
+        # next to its log file, then all jobs can be built at the same time
+        outtree_jobs = []
+        for appdir, cfgname, appconfig in joblist:
+            appconfig = copy.deepcopy(appconfig)
+            build_config = appconfig.get("build_config", None)
+            if not isinstance(build_config, dict):
+                build_config = dict()
+            if str(build_config.get("BUILD_DIR", "")).strip() == "":
+                logdir = os.path.dirname(os.path.abspath(appconfig["logs"][logkey]))
+                build_config["BUILD_DIR"] = os.path.join(logdir, "build")
+            appconfig["build_config"] = build_config
+            outtree_jobs.append((appdir, cfgname, appconfig))
+        return outtree_jobs
+
+    def build_apps_in_pool(self, joblist:list, jobs:int, stoponfail=False):
+        def build_job(job):
+            appdir, _, appconfig = job
+            with self.build_slot:
+                return self.build_app_with_config(appdir, appconfig, False, appconfig["logs"]["build"])
+        joblist = self.get_outtree_jobs(joblist, "build")
+        results = self.run_jobs_in_pool(joblist, build_job, jobs, stoponfail=stoponfail, \
+                                        serial_build=not self.is_outtree_build(joblist))
+        return self.merge_pool_results(joblist, results)
+
+    def build_apps_with_config(self, config:dict, show_output=True, logdir=None, stoponfail=False, jobs=1):
         # Build all the applications, each application only has one configuration
         # "app" : { the_only_config }
+        joblist = [(appdir, None, appconfig) for appdir, appconfig in config.items()]
+        jobs = self.get_pool_jobs(jobs, joblist, "build")
+        if jobs > 1:
+            return self.build_apps_in_pool(joblist, jobs, stoponfail)
         cmdsts = True
         build_status = dict()
         apps_config = copy.deepcopy(config)
@@ -767,9 +912,14 @@ class nsdk_runner(nsdk_builder):
                     return cmdsts, build_status
         return cmdsts, build_status
 
-    def build_apps_with_configs(self, config:dict, show_output=True, logdir=None, stoponfail=False):
+    def build_apps_with_configs(self, config:dict, show_output=True, logdir=None, stoponfail=False, jobs=1):
         # Build all the applications, each application has more than one configuration
         # "app" : {"configs": {"case1": case1_config}}
+        joblist = [(appdir, cfgname, appcfg) for appdir in config \
+                    for cfgname, appcfg in config[appdir].get("configs", dict()).items()]
+        jobs = self.get_pool_jobs(jobs, joblist, "build")
+        if jobs > 1:
+            return self.build_apps_in_pool(joblist, jobs, stoponfail)
         cmdsts = True
         build_status = dict()
         apps_config = copy.deepcopy(config)
@@ -792,9 +942,41 @@ class nsdk_runner(nsdk_builder):
                         return cmdsts, build_status
         return cmdsts, build_status
 
-    def run_apps_with_config(self, config:dict, show_output=True, stoponfail=False):
+    def merge_pool_results(self, joblist:list, results:list):
+        # Merge results of run_jobs_in_pool in order of joblist, same format as sequential run
+        cmdsts = True
+        build_status = dict()
+        for (appdir, cfgname, _), result in zip(joblist, results):
+            if result is None:
+                continue
+            if cfgname is None:
+                build_status[appdir] = result[1]
+            else:
+                if appdir not in build_status:
+                    build_status[appdir] = dict()
+                build_status[appdir][cfgname] = result[1]
+            if result[0] == False:
+                cmdsts = False
+        return cmdsts, build_status
+
+    def run_apps_in_pool(self, joblist:list, jobs:int, sim_jobs=None, stoponfail=False):
+        def run_job(job):
+            appdir, _, appconfig = job
+            applogs = appconfig.get("logs", dict())
+            return self.run_app_with_config(appdir, appconfig, False, \
+                                            applogs.get("build", None), applogs.get("run", None))
+        joblist = self.get_outtree_jobs(joblist, "run")
+        results = self.run_jobs_in_pool(joblist, run_job, jobs, sim_jobs, stoponfail, \
+                                        serial_build=not self.is_outtree_build(joblist))
+        return self.merge_pool_results(joblist, results)
+
+    def run_apps_with_config(self, config:dict, show_output=True, stoponfail=False, jobs=1, sim_jobs=None):
         # Run all the applications, each application only has one configuration
         # "app" : { the_only_config }
+        joblist = [(appdir, None, appconfig) for appdir, appconfig in config.items()]
+        jobs = self.get_pool_jobs(jobs, joblist, "run")
+        if jobs > 1:
+            return self.run_apps_in_pool(joblist, jobs, sim_jobs, stoponfail)
         cmdsts = True
         build_status = dict()
         apps_config = copy.deepcopy(config)
@@ -812,9 +994,14 @@ class nsdk_runner(nsdk_builder):
                     return cmdsts, build_status
         return cmdsts, build_status
 
-    def run_apps_with_configs(self, config:dict, show_output=True, stoponfail=False):
+    def run_apps_with_configs(self, config:dict, show_output=True, stoponfail=False, jobs=1, sim_jobs=None):
         # Run all the applications, each application has more than one configuration
         # "app" : {"configs": {"case1": case1_config}}
+        joblist = [(appdir, cfgname, appcfg) for appdir in config \
+                    for cfgname, appcfg in config[appdir].get("configs", dict()).items()]
+        jobs = self.get_pool_jobs(jobs, joblist, "run")
+        if jobs > 1:
+            return self.run_apps_in_pool(joblist, jobs, sim_jobs, stoponfail)
         cmdsts = True
         build_status = dict()
         apps_config = copy.deepcopy(config)
@@ -96,7 +96,8 @@ class nsdk_executor(nsdk_runner):
             return False, None
         # Build all the applications
         print("Build %d applications defined by configuration" % (len(apps_config)))
-        cmdsts, build_status = self.build_apps_with_config(apps_config, show_output, stoponfail)
+        cmdsts, build_status = self.build_apps_with_config(apps_config, show_output, stoponfail=stoponfail, \
+                                                           jobs=config.get("jobs", 1))
         return cmdsts, build_status
 
     def run_apps(self, config:dict, show_output=True, logdir=None, stoponfail=False):
@@ -189,7 +190,8 @@ class nsdk_executor(nsdk_runner):
             return False, None
         print("Run %d applications defined by configuration" % (len(apps_config)))
         # Run all the applications
-        cmdsts, build_status = self.run_apps_with_config(apps_config, show_output, stoponfail)
+        cmdsts, build_status = self.run_apps_with_config(apps_config, show_output, stoponfail, \
+                                                         jobs=config.get("jobs", 1), sim_jobs=config.get("sim_jobs", None))
         return cmdsts, build_status
 
 def merge_config(appcfg, hwcfg):
@@ -251,6 +253,9 @@ if __name__ == '__main__':
     parser.add_argument('--run_target', help="Run target which program will run, such as hardware, qemu or xlspike")
     parser.add_argument('--parallel', help="parallel value, such as -j4 or -j or -j8, default None")
     parser.add_argument('--run', action='store_true', help="If specified, will do run not build process")
+    parser.add_argument('--jobs', type=int, help="Number of applications and configurations built or run at the same time, default 1")
+    parser.add_argument('--sim_jobs', type=int, help="Max number of qemu, xlspike or ncycm running at the same time when --jobs is used, default same as --jobs")
+    parser.add_argument('--failfast', action='store_true', help="If specified, stop building or running remaining applications when one failed")
     parser.add_argument('--verbose', action='store_true', help="If specified, will show detailed build/run messsage")
     args = parser.parse_args()
 
@@ -273,9 +278,9 @@ if __name__ == '__main__':
 
     nsdk_ext = nsdk_executor()
     if args.run:
-        cmdsts, result = nsdk_ext.run_apps(config, args.verbose, args.logdir, False)
+        cmdsts, result = nsdk_ext.run_apps(config, args.verbose, args.logdir, args.failfast)
     else:
-        cmdsts, result = nsdk_ext.build_apps(config, args.verbose, args.logdir, False)
+        cmdsts, result = nsdk_ext.build_apps(config, args.verbose, args.logdir, args.failfast)
     runtime = round(time.time() - start_time, 2)
     print("Applications specified in %s build or run status: %s, time cost %s seconds" % (args.appcfg, cmdsts, runtime))
     expected = config.get("expected", None)
@@ -233,7 +233,37 @@ td:first-child {
         with open(htmlfile, 'w') as htf:
             htf.write(mdhtml)
 
-def generate_report(config, result, rptfile, rpthtml, logdir, runapp=False):
+def generate_regression_md(rf, regression):
+    rf.write("\n# Performance Compared with Baseline\n\n")
+    rf.write("Baseline: %s, noise threshold: %s%%\n\n" % (regression["baseline"], regression["threshold"]))
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Regressed", "Improved", "Unchanged", "Missing", "New"]
+    summary = regression["summary"]
+    x.add_row([summary["regressed"], summary["improved"], summary["unchanged"], summary["missing"], summary["new"]])
+    rf.write(str(x))
+    rf.write("\n")
+    for status, title in (("regressed", "Regressions"), ("improved", "Improvements"), ("missing", "Missing in Current Run")):
+        items = [item for item in regression["items"] if item["status"] == status]
+        if len(items) == 0:
+            continue
+        rf.write("\n## %s\n\n" % (title))
+        x = PrettyTable()
+        x.set_style(MARKDOWN)
+        x.field_names = ["Case Name", "Type", "Subtype", "Key", "Baseline", "Current", "Delta(%)", "Better"]
+        for item in items:
+            delta = "-" if item["delta"] is None else "%+.2f" % (item["delta"])
+            better = "higher" if item["higher_better"] else "lower"
+            if status == "regressed":
+                delta = "**%s**" % (delta)
+            basevalue = "-" if item["baseline"] is None else item["baseline"]
+            curvalue = "-" if item["current"] is None else item["current"]
+            x.add_row([item["case"], item["type"], item["subtype"], item["key"], \
+                basevalue, curvalue, delta, better])
+        rf.write(str(x))
+        rf.write("\n")
+
+def generate_report(config, result, rptfile, rpthtml, logdir, runapp=False, regression=None):
     if not(isinstance(config, dict) and isinstance(result, dict) and isinstance(rptfile, str)):
         return False
     report = analyze_report(config, result, runapp)
@@ -336,6 +366,9 @@ def generate_report(config, result, rptfile, rpthtml, logdir, runapp=False):
             rf.write("\n# Expected Build or Run Failed Cases\n\n")
             rf.write(str(x))
             rf.write("\n")
+        # performance compared with baseline
+        if isinstance(regression, dict):
+            generate_regression_md(rf, regression)
     # generate html from markdown
     md2html(rptfile, rpthtml)
     pass
@@ -485,12 +518,12 @@ def parse_result2dict(result):
             csvdict[cfg][apptype][appsubtype]["size"] = appresult[cfg]["size"]
     return csvdict
 
-def save_report_files(logdir, config, result, run=False):
+def save_report_files(logdir, config, result, run=False, regression=None):
     if os.path.isdir(logdir) == False:
         os.makedirs(logdir)
     rptfile = os.path.join(logdir, "report.md")
     rpthtml = os.path.join(logdir, "report.html")
-    generate_report(config, result, rptfile, rpthtml, logdir, run)
+    generate_report(config, result, rptfile, rpthtml, logdir, run, regression)
     csvfile = os.path.join(logdir, "result.csv")
     save_bench_csv(result, csvfile)
     print("Generate report csv file to %s" % (csvfile))
@@ -590,7 +623,89 @@ def save_runresult(runresult, excelfile):
 
     return True
 
-def generate_report_for_logs(logdir, run=False, split=False):
+# Benchmark values whose key contains these tags are better when higher, others are cycles
+# or cycles per operation, which are better when lower
+HIGHER_BETTER_TAGS = ("/mhz", "mips", "coremark", "dhrystone", "whetstone", "speedup", "snr", "score")
+DEFAULT_NOISE_THRESHOLD = 1.0
+
+def is_higher_better(key):
+    key = key.lower()
+    for tag in HIGHER_BETTER_TAGS:
+        if tag in key:
+            return True
+    return False
+
+def flatten_runresult(runresult):
+    # Get {(case, type, subtype, key): value} of numeric values in runresult generated by parse_result2dict
+    values = dict()
+    if not isinstance(runresult, dict):
+        return values
+    for cfg in runresult:
+        for apptype in runresult[cfg]:
+            for subtype in runresult[cfg][apptype]:
+                rstvalues = runresult[cfg][apptype][subtype].get("value", dict())
+                for key in rstvalues:
+                    try:
+                        value = float(rstvalues[key])
+                    except (TypeError, ValueError):
+                        continue
+                    values[(cfg, apptype, subtype, key)] = value
+    return values
+
+def load_runresult(path, split=False):
+    # Load run result from a runresult.json or baseline json file, or a log directory of nsdk_bench.py
+    if os.path.isfile(path):
+        _, runresult = load_json(path)
+        return runresult
+    if os.path.isdir(path) == False:
+        return None
+    runresult_file = os.path.join(path, "runresult.json")
+    if os.path.isfile(runresult_file):
+        _, runresult = load_json(runresult_file)
+        return runresult
+    if split == False:
+        _, all_result = merge_all_config_and_result(path)
+    else:
+        _, all_result = merge_split_config_and_result(path)
+    return parse_result2dict(all_result)
+
+def compare_runresult(baseline, current, threshold=DEFAULT_NOISE_THRESHOLD):
+    # Compare benchmark values of current run with baseline, delta is in percent of baseline value,
+    # a value is regressed or improved only when delta is beyond threshold percent
+    basevalues = flatten_runresult(baseline)
+    curvalues = flatten_runresult(current)
+    items = []
+    summary = {"regressed": 0, "improved": 0, "unchanged": 0, "missing": 0, "new": 0}
+    for vkey in sorted(set(basevalues.keys()) | set(curvalues.keys())):
+        basevalue = basevalues.get(vkey, None)
+        curvalue = curvalues.get(vkey, None)
+        higher_better = is_higher_better(vkey[3])
+        delta = None
+        if basevalue is None:
+            status = "new"
+        elif curvalue is None:
+            status = "missing"
+        else:
+            if basevalue != 0:
+                delta = (curvalue - basevalue) * 100.0 / abs(basevalue)
+            elif curvalue != 0:
+                delta = float("inf") if curvalue > 0 else float("-inf")
+            else:
+                delta = 0.0
+            if abs(delta) <= threshold:
+                status = "unchanged"
+            elif (delta > 0) == higher_better:
+                status = "improved"
+            else:
+                status = "regressed"
+        summary[status] += 1
+        items.append({"case": vkey[0], "type": vkey[1], "subtype": vkey[2], "key": vkey[3], \
+            "baseline": basevalue, "current": curvalue, "delta": delta, \
+            "higher_better": higher_better, "status": status})
+    return {"threshold": threshold, "summary": summary, "items": items}
+
+def generate_report_for_logs(logdir, run=False, split=False, baseline=None, threshold=DEFAULT_NOISE_THRESHOLD, savebaseline=None):
+    # Return False if any benchmark value is regressed compared with baseline
     if logdir and os.path.isdir(logdir):
         if split == False:
             all_mergedcfg, all_result = merge_all_config_and_result(logdir)
@@ -603,10 +718,27 @@ def generate_report_for_logs(logdir, run=False, split=False):
             print("Save all result file to %s" % (result_file))
             save_json(config_file, all_mergedcfg)
             save_json(result_file, all_result)
-            save_report_files(logdir, all_mergedcfg, all_result, run)
+            regression = None
+            if baseline:
+                baseresult = load_runresult(baseline, split)
+                if baseresult is None:
+                    print("Can't load baseline run result from %s" % (baseline))
+                    return False
+                regression = compare_runresult(baseresult, parse_result2dict(all_result), threshold)
+                regression["baseline"] = baseline
+                regression_file = os.path.join(logdir, "regression.json")
+                save_json(regression_file, regression)
+                print("Compared with baseline %s: %s" % (baseline, regression["summary"]))
+                print("Save comparison result file to %s" % (regression_file))
+            save_report_files(logdir, all_mergedcfg, all_result, run, regression)
+            if savebaseline:
+                save_json(savebaseline, parse_result2dict(all_result))
+                print("Save run result as baseline to %s" % (savebaseline))
+            if regression and regression["summary"]["regressed"] > 0:
+                return False
         else:
             print("Can't find any valid reports in %s generated by nsdk_bench.py" % (logdir))
-    pass
+    return True
 
 
 if __name__ == '__main__':
@@ -614,6 +746,10 @@ if __name__ == '__main__':
     parser.add_argument('--logdir', required=True, help="logs directory where saved the report json files")
     parser.add_argument('--split', action='store_true', help="Split for different configurations")
     parser.add_argument('--run', action='store_true', help="If specified, it means this is a runner report")
+    parser.add_argument('--baseline', help="Baseline log directory or run result json file to compare benchmark values with")
+    parser.add_argument('--threshold', type=float, default=DEFAULT_NOISE_THRESHOLD, \
+                        help="Noise threshold in percent, changes within it are not regressions, default %s" % (DEFAULT_NOISE_THRESHOLD))
+    parser.add_argument('--save_baseline', help="Save run result of this log directory to a json file used as --baseline later")
 
     args = parser.parse_args()
 
@@ -621,4 +757,11 @@ if __name__ == '__main__':
         print("The log directory doesn't exist, please check!")
         sys.exit(1)
 
-    generate_report_for_logs(args.logdir, args.run, args.split)
+    if args.baseline and os.path.exists(args.baseline) == False:
+        print("The baseline %s doesn't exist, please check!" % (args.baseline))
+        sys.exit(1)
+
+    ret = generate_report_for_logs(args.logdir, args.run, args.split, args.baseline, args.threshold, args.save_baseline)
+    # exit with error when benchmark values are regressed, so it can be used to gate changes
+    if ret == False:
+        sys.exit(1)
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+
+import os
+import sys
+import argparse
+
+SCRIPT_DIR = os.path.dirname(os.path.realpath(__file__))
+requirement_file = os.path.abspath(os.path.join(SCRIPT_DIR, "..", "requirements.txt"))
+
+MARKDOWN_PLUGIN=True
+try:
+    import markdown
+    from prettytable import *
+except:
+    MARKDOWN_PLUGIN=False
+    print("Please install requried packages using: pip3 install -r %s" % (requirement_file))
+    sys.exit(1)
+
+from nsdk_utils import *
+
+def load_mapsize(sizefile):
+    # Load size from a map file, or size.json saved by nsdk_bench.py or nsdk_execute.py
+    if sizefile.endswith(".map"):
+        return parse_mapfile(sizefile)
+    _, mapsize = load_json(sizefile)
+    return mapsize
+
+def load_sizes(path):
+    # Return {name: mapsize}, name is relative path of size.json in log directory
+    sizes = dict()
+    if os.path.isdir(path):
+        for sizefile in find_files(path, "**/size.json", True):
+            name = os.path.dirname(os.path.relpath(sizefile, path)).replace("\\", "/")
+            mapsize = load_mapsize(sizefile)
+            if mapsize:
+                sizes[name] = mapsize
+    elif os.path.isfile(path):
+        mapsize = load_mapsize(path)
+        if mapsize:
+            sizes[os.path.basename(path)] = mapsize
+    return sizes
+
+def sum_size(sizes):
+    return sizes.get("text", 0) + sizes.get("data", 0) + sizes.get("bss", 0)
+
+def diff_items(olditems, newitems, getsize):
+    # Return [(name, old, new, delta)] of changed items, sorted by absolute delta
+    diffs = []
+    for name in set(olditems.keys()) | set(newitems.keys()):
+        oldsize = getsize(olditems[name]) if name in olditems else 0
+        newsize = getsize(newitems[name]) if name in newitems else 0
+        if oldsize != newsize:
+            diffs.append((name, oldsize, newsize, newsize - oldsize))
+    diffs.sort(key=lambda item: (-abs(item[3]), item[0]))
+    return diffs
+
+def format_delta(delta):
+    if delta > 0:
+        return "**+%d**" % (delta)
+    return "%d" % (delta)
+
+def generate_size_md(name, mapsize, top, budgets):
+    mdtxt = "\n# %s\n\n" % (name)
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Region", "Origin", "Length", "Used", "Used(%)", "Budget"]
+    exceeded = [item["region"] for item in check_size_budget(mapsize, budgets)]
+    for region, info in mapsize["regions"].items():
+        percent = "%.1f" % (info["used"] * 100.0 / info["length"]) if info["length"] else "-"
+        budget = budgets.get(region, "-")
+        if region in exceeded:
+            budget = "**%s exceeded**" % (budget)
+        x.add_row([region, hex(info["origin"]), info["length"], info["used"], percent, budget])
+    mdtxt += str(x) + "\n"
+    mdtxt += "\n## Libraries\n\n"
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Library", "Text", "Data", "Bss", "Total"]
+    for library, sizes in sorted(mapsize["libraries"].items(), key=lambda item: -sum_size(item[1])):
+        x.add_row([library, sizes["text"], sizes["data"], sizes["bss"], sum_size(sizes)])
+    mdtxt += str(x) + "\n"
+    mdtxt += "\n## Top %d Symbols\n\n" % (top)
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Symbol", "Type", "Size", "Library", "Object"]
+    symbols = sorted(mapsize["symbols"].items(), key=lambda item: -item[1]["size"])
+    for symbol, info in symbols[:top]:
+        x.add_row([symbol, info["type"], info["size"], info["library"], info["object"]])
+    mdtxt += str(x) + "\n"
+    return mdtxt
+
+def generate_sizediff_md(name, oldsize, newsize, top):
+    mdtxt = "\n# %s\n\n" % (name)
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Region", "Old", "New", "Delta"]
+    for region, _, _, delta in sorted(diff_items(oldsize["regions"], newsize["regions"], lambda info: info["used"])):
+        x.add_row([region, oldsize["regions"].get(region, {}).get("used", 0), \
+            newsize["regions"].get(region, {}).get("used", 0), format_delta(delta)])
+    mdtxt += str(x) + "\n"
+    for title, column, key, getsize in (("Libraries", "Library", "libraries", sum_size), \
+                                        ("Objects", "Object", "objects", sum_size), \
+                                        ("Symbols", "Symbol", "symbols", lambda info: info["size"])):
+        diffs = diff_items(oldsize[key], newsize[key], getsize)
+        if len(diffs) == 0:
+            continue
+        mdtxt += "\n## %s, %d changed\n\n" % (title, len(diffs))
+        x = PrettyTable()
+        x.set_style(MARKDOWN)
+        x.field_names = [column, "Old", "New", "Delta"]
+        for item, old, new, delta in diffs[:top]:
+            x.add_row([item, old, new, format_delta(delta)])
+        mdtxt += str(x) + "\n"
+    return mdtxt
+
+def save_size_report(mdtxt, report):
+    with open(report, "w") as rf:
+        rf.write(mdtxt)
+    print("Generate size report markdown file to %s" % (report))
+    htmlfile = os.path.splitext(report)[0] + ".html"
+    with open(htmlfile, "w") as hf:
+        hf.write(markdown.markdown(mdtxt, extensions=["extra"]))
+    print("Generate size report html file to %s" % (htmlfile))
+
+def show_sizes(path, top, report=None):
+    # Show size of each map file or build in log directory, return False if size budget is exceeded
+    sizes = load_sizes(path)
+    if len(sizes) == 0:
+        print("No map file or size.json found in %s" % (path))
+        return False
+    budgets = get_sdk_size_budget()
+    mdtxt = ""
+    ret = True
+    for name in sorted(sizes):
+        mdtxt += generate_size_md(name, sizes[name], top, budgets)
+        if len(check_size_budget(sizes[name], budgets)) > 0:
+            ret = False
+    print(mdtxt)
+    if report:
+        save_size_report(mdtxt, report)
+    return ret
+
+def diff_sizes(oldpath, newpath, top, report=None):
+    # Diff size between two map files, size.json files or log directories of two builds,
+    # builds in log directories are matched by relative path of size.json
+    oldsizes = load_sizes(oldpath)
+    newsizes = load_sizes(newpath)
+    if os.path.isfile(oldpath) and os.path.isfile(newpath) and len(oldsizes) == 1 and len(newsizes) == 1:
+        pairs = [("%s -> %s" % (oldpath, newpath), list(oldsizes.values())[0], list(newsizes.values())[0])]
+    else:
+        pairs = [(name, oldsizes[name], newsizes[name]) for name in sorted(oldsizes) if name in newsizes]
+    if len(pairs) == 0:
+        print("No builds can be compared between %s and %s" % (oldpath, newpath))
+        return False
+    mdtxt = ""
+    x = PrettyTable()
+    x.set_style(MARKDOWN)
+    x.field_names = ["Build", "Region", "Old", "New", "Delta"]
+    for name, oldsize, newsize in pairs:
+        for region, old, new, delta in sorted(diff_items(oldsize["regions"], newsize["regions"], lambda info: info["used"])):
+            x.add_row([name, region, old, new, format_delta(delta)])
+    mdtxt += "\n# Summary\n\n" + str(x) + "\n"
+    for name, oldsize, newsize in pairs:
+        mdtxt += generate_sizediff_md(name, oldsize, newsize, top)
+    print(mdtxt)
+    if report:
+        save_size_report(mdtxt, report)
+    return True
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description="Nuclei SDK Symbol Size Report Tools")
+    parser.add_argument('--show', help="Map file, size.json or log directory of nsdk_bench.py to show size")
+    parser.add_argument('--old', help="Map file, size.json or log directory of old build to diff")
+    parser.add_argument('--new', help="Map file, size.json or log directory of new build to diff")
+    parser.add_argument('--top', type=int, default=20, help="Number of symbols or changes shown in each table, default 20")
+    parser.add_argument('--report', help="Save report to this markdown file, and a html file with same name")
+
+    args = parser.parse_args()
+
+    if args.show:
+        ret = show_sizes(args.show, args.top, args.report)
+    elif args.old and args.new:
+        ret = diff_sizes(args.old, args.new, args.top, args.report)
+    else:
+        print("Please pass --show or both --old and --new")
+        ret = False
+    if ret == False:
+        sys.exit(1)
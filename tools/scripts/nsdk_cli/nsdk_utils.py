@@ -7,6 +7,7 @@ requirement_file = os.path.abspath(os.path.join(SCRIPT_DIR, "..", "requirements.
 
 try:
     import time
+    import gc
     import shutil
     import signal
     import psutil
@@ -30,7 +31,8 @@ SDK_GLOBAL_VARIABLES = {
     "sdk_checktag": "Nuclei SDK Build Time:",
     "sdk_check": True,
     "sdk_banner_tmout": 15,
-    "sdk_copy_objects": "elf,map,dasm,verilog"
+    "sdk_copy_objects": "elf,map,dasm,verilog",
+    "sdk_size_budget": ""
     }
 
 class NThread(Thread):
@@ -380,7 +382,14 @@ async def run_cmd_and_check_async(command, timeout:int, checks:dict, checktime=t
     return check_status, cmd_elapsed_ticks
 
 def run_cmd_and_check(command, timeout:int, checks:dict, checktime=time.time(), sdk_check=False, logfile=None, show_output=False, banner_timeout=30):
-    loop = asyncio.get_event_loop()
+    own_loop = False
+    try:
+        loop = asyncio.get_event_loop()
+    except RuntimeError:
+        # No event loop in worker threads of job pool, use a new one for this command
+        loop = asyncio.new_event_loop()
+        asyncio.set_event_loop(loop)
+        own_loop = True
     try:
         ret, cmd_elapsed_ticks = loop.run_until_complete( \
             run_cmd_and_check_async(command, timeout, checks, checktime, sdk_check, logfile, show_output, banner_timeout))
@@ -390,6 +399,12 @@ def run_cmd_and_check(command, timeout:int, checks:dict, checktime=time.time(),
     finally:
         if sys.platform != "win32":
             os.system("stty echo 2> /dev/null")
+        if own_loop:
+            # let subprocess transports be closed before closing the loop
+            gc.collect()
+            loop.run_until_complete(asyncio.sleep(0))
+            loop.close()
+            asyncio.set_event_loop(None)
 
     return ret, cmd_elapsed_ticks
 
@@ -451,6 +466,205 @@ def get_elfsize(elf):
     os.remove(sizelog)
     return sizeinfo
 
+def parse_size_value(value):
+    # Parse size value such as 4096, "0x1000", "4K" or "1M" in bytes
+    if isinstance(value, int):
+        return value
+    try:
+        value = str(value).strip().upper()
+        scale = 1
+        if value.endswith("K"):
+            scale = 1024
+            value = value[:-1]
+        elif value.endswith("M"):
+            scale = 1024 * 1024
+            value = value[:-1]
+        return int(value, 0) * scale
+    except (TypeError, ValueError):
+        return None
+
+# Libraries which objects in map file belong to, checked in order
+SIZE_LIBRARIES = [
+    ("libnmsis_dsp", "NMSIS DSP"),
+    ("libnmsis_nn", "NMSIS NN"),
+    ("/OS/", "RTOS"),
+    ("/Components/", "Components"),
+    ("/SoC/", "SoC"),
+    ("libncrt", "libncrt"),
+    ("libc_nano.a", "newlib"),
+    ("libc.a", "newlib"),
+    ("libg_nano.a", "newlib"),
+    ("libg.a", "newlib"),
+    ("libm.a", "newlib"),
+    ("libm_nano.a", "newlib"),
+    ("libnosys.a", "newlib"),
+    ("libgcc.a", "libgcc"),
+    ("libstdc++", "libstdc++"),
+    ("libsupc++", "libstdc++"),
+]
+
+def get_size_library(objfile):
+    objpath = "/" + objfile.replace("\\", "/")
+    for tag, library in SIZE_LIBRARIES:
+        if tag in objpath:
+            return library
+    if objfile == "":
+        return "Linker"
+    return "Application"
+
+def normalize_objpath(objfile):
+    # Make object path same for in-tree, out-of-tree and cached builds, and builds in different folders
+    objpath = objfile.replace("\\", "/")
+    archive = re.match(r"(.*)\((.*)\)$", objpath)
+    if archive:
+        return "%s(%s)" % (os.path.basename(archive.group(1)), archive.group(2))
+    objpath = "/" + objpath
+    for tag in ("/SoC/", "/NMSIS/", "/OS/", "/Components/"):
+        index = objpath.find(tag)
+        if index >= 0:
+            return objpath[index + 1:]
+    # Objects in BUILD_DIR are placed in a folder named by hash of configuration
+    found = re.search(r"/[0-9a-f]{8,}/(.*)$", objpath)
+    if found:
+        objpath = "/" + found.group(1)
+    objpath = objpath.replace("/__/", "/../").lstrip("/")
+    if objpath.startswith("./"):
+        objpath = objpath[2:]
+    return objpath
+
+def get_section_type(secname):
+    if "bss" in secname or secname.startswith("COMMON") or secname in (".heap", ".stack"):
+        return "bss"
+    if secname.startswith(".data") or secname.startswith(".sdata") or secname.startswith(".tdata"):
+        return "data"
+    return "text"
+
+def parse_mapfile(mapfile):
+    # Parse gnu ld map file, return memory regions with used size, size of output sections,
+    # and text/data/bss size of each object, library and symbol, symbol is the first symbol
+    # of an input section, which is a function or variable when -ffunction-sections and
+    # -fdata-sections are used.
+    if isinstance(mapfile, str) == False or os.path.isfile(mapfile) == False:
+        return None
+    regions = dict()
+    sections = dict()
+    inputs = []
+    with open(mapfile, "r", errors="ignore") as mf:
+        lines = mf.readlines()
+    NUM = r"(0x[0-9a-fA-F]+)"
+    state = ""
+    outsec = None
+    pending = None
+    curinput = None
+    for line in lines:
+        line = line.rstrip("\n")
+        if line.startswith("Memory Configuration"):
+            state = "memory"
+            continue
+        if line.startswith("Linker script and memory map"):
+            state = "map"
+            continue
+        if state == "memory":
+            parts = line.split()
+            if len(parts) >= 3 and parts[1].startswith("0x") and parts[0] != "*default*":
+                regions[parts[0]] = {"origin": int(parts[1], 16), "length": int(parts[2], 16), "used": 0}
+            continue
+        if state != "map" or line.strip() == "":
+            continue
+        # Name of input or output section is too long, address and size are in next line
+        if pending is not None:
+            matched = re.match(r"^\s+" + NUM + r"\s+" + NUM + r"(.*)$", line)
+            if matched:
+                line = pending + " " + line.strip()
+            pending = None
+        matched = re.match(r"^(\S+)\s+" + NUM + r"\s+" + NUM + r"(?:\s+load address\s+" + NUM + ")?", line)
+        if matched:
+            # output section
+            outsec = {"name": matched.group(1), "addr": int(matched.group(2), 16), \
+                      "size": int(matched.group(3), 16), "load": matched.group(4)}
+            if outsec["size"] > 0:
+                sections[outsec["name"]] = outsec
+            curinput = None
+            continue
+        if re.match(r"^\S+$", line):
+            pending = line.strip()
+            continue
+        matched = re.match(r"^ (\S+)\s+" + NUM + r"\s+" + NUM + r"\s*(.*)$", line)
+        if matched and matched.group(1).startswith("*(") == False:
+            size = int(matched.group(3), 16)
+            curinput = {"section": matched.group(1), "addr": int(matched.group(2), 16), \
+                        "size": size, "object": matched.group(4).strip(), "symbol": None}
+            if size > 0 and outsec is not None:
+                curinput["outsec"] = outsec["name"]
+                inputs.append(curinput)
+            continue
+        if re.match(r"^ (\S+)$", line) and line.strip().startswith("*") == False:
+            pending = line
+            continue
+        matched = re.match(r"^\s+" + NUM + r"\s+([A-Za-z_.$][\w.$]*)\s*$", line)
+        if matched and curinput is not None and curinput["symbol"] is None:
+            curinput["symbol"] = matched.group(2)
+
+    def find_region(addr):
+        for name in regions:
+            region = regions[name]
+            if region["origin"] <= addr < region["origin"] + region["length"]:
+                return name
+        return None
+
+    # Only sections placed in memory regions are counted, debug sections are not
+    allocsecs = dict()
+    for name in sections:
+        region = find_region(sections[name]["addr"])
+        if region is None:
+            continue
+        allocsecs[name] = sections[name]["size"]
+        regions[region]["used"] += sections[name]["size"]
+        load = sections[name]["load"]
+        if load:
+            loadregion = find_region(int(load, 16))
+            if loadregion and loadregion != region and get_section_type(name) != "bss":
+                regions[loadregion]["used"] += sections[name]["size"]
+    objects = dict()
+    libraries = dict()
+    symbols = dict()
+    for item in inputs:
+        if item["outsec"] not in allocsecs:
+            continue
+        sectype = get_section_type(item["outsec"])
+        objpath = normalize_objpath(item["object"])
+        library = get_size_library(item["object"])
+        for dct, key in ((objects, objpath), (libraries, library)):
+            if key not in dct:
+                dct[key] = {"text": 0, "data": 0, "bss": 0}
+            dct[key][sectype] += item["size"]
+        symbol = item["symbol"]
+        if symbol is None:
+            # name of input section without symbol, such as .text.func, .data(file.c.o) or *fill*
+            symbol = "%s(%s)" % (item["section"], os.path.basename(objpath)) if objpath else item["section"]
+            for prefix in (".text.", ".rodata.", ".srodata.", ".data.", ".sdata.", ".bss.", ".sbss."):
+                if item["section"].startswith(prefix) and len(item["section"]) > len(prefix):
+                    symbol = item["section"][len(prefix):]
+                    break
+        if symbol in symbols and symbols[symbol]["object"] != objpath:
+            symbol = "%s(%s)" % (symbol, os.path.basename(objpath))
+        if symbol not in symbols:
+            symbols[symbol] = {"size": 0, "type": sectype, "object": objpath, "library": library}
+        symbols[symbol]["size"] += item["size"]
+    return {"regions": regions, "sections": allocsecs, "libraries": libraries, \
+            "objects": objects, "symbols": symbols}
+
+def check_size_budget(mapsize, budgets):
+    # Return list of memory regions whose used size exceeds budget
+    exceeded = []
+    if not isinstance(mapsize, dict) or not isinstance(budgets, dict):
+        return exceeded
+    regions = mapsize.get("regions", dict())
+    for region in budgets:
+        if region in regions and regions[region]["used"] > budgets[region]:
+            exceeded.append({"region": region, "used": regions[region]["used"], "budget": budgets[region]})
+    return exceeded
+
 def merge_config_with_makeopts(config, make_options):
     opt_splits=make_options.strip().split()
     passed_buildcfg = dict()
@@ -483,6 +697,8 @@ def merge_config_with_args(config, args_dict):
     run_target = args_dict.get("run_target", None)
     timeout = args_dict.get("timeout", None)
     ncycm = args_dict.get("ncycm", None)
+    jobs = args_dict.get("jobs", None)
+    sim_jobs = args_dict.get("sim_jobs", None)
     if isinstance(config, dict) == False:
         return None
     new_config = copy.deepcopy(config)
@@ -516,6 +732,10 @@ def merge_config_with_args(config, args_dict):
         new_config["build_target"] = build_target
     if parallel is not None:
         new_config["parallel"] = parallel
+    if jobs is not None:
+        new_config["jobs"] = int(jobs)
+    if sim_jobs is not None:
+        new_config["sim_jobs"] = int(sim_jobs)
     if make_options:
         new_config = merge_config_with_makeopts(new_config, make_options)
     return new_config
@@ -613,6 +833,27 @@ def get_sdk_check():
         check = SDK_GLOBAL_VARIABLES.get("sdk_check")
     return check
 
+def get_sdk_size_budget():
+    # Size budget of memory regions in linker script, such as "ilm=60K,ram=32K",
+    # or a dict such as {"ilm": "60K", "ram": 32768} in global_variables of config
+    budget = os.environ.get("SDK_SIZE_BUDGET")
+    if budget is None:
+        budget = SDK_GLOBAL_VARIABLES.get("sdk_size_budget")
+    budgets = dict()
+    if isinstance(budget, str):
+        for item in budget.split(","):
+            if "=" in item:
+                region, value = item.split("=", 1)
+                budgets[region.strip()] = value
+    elif isinstance(budget, dict):
+        budgets = budget
+    sizebudgets = dict()
+    for region in budgets:
+        value = parse_size_value(budgets[region])
+        if value is not None:
+            sizebudgets[region] = value
+    return sizebudgets
+
 def get_sdk_banner_tmout():
     tmout = os.environ.get("SDK_BANNER_TMOUT")
     if tmout is not None:
@@ -767,6 +1008,24 @@ def parse_benchmark_runlog(lines, lgf=""):
         elif "baremetal/demo_dsp" in lgf:
             program_type, result = parse_benchmark_baremetal_csv(lines)
             program_type = "demo_dsp"
+        elif "baremetal/dspbench" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "dspbench"
+        elif "baremetal/stringbench" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "stringbench"
+        elif "baremetal/dspsmall" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "dspsmall"
+        elif "baremetal/dsplibbench" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "dsplibbench"
+        elif "baremetal/nnbench" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "nnbench"
+        elif "baremetal/dsppipe" in lgf:
+            program_type, result = parse_benchmark_baremetal_csv(lines)
+            program_type = "dsppipe"
         elif "DSP/Examples/RISCV" in lgf:
             program_type, result = parse_benchmark_baremetal_csv(lines)
             program_type = "nmsis_dsp_example"